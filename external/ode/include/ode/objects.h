@@ -153,6 +153,36 @@ ODE_API void dWorldSetStepIslandsProcessingMaxThreadCount(dWorldID w, unsigned c
  */
 ODE_API unsigned dWorldGetStepIslandsProcessingMaxThreadCount(dWorldID w);
 
+/**
+ * @brief Callback notified when stepping of an island starts and finishes.
+ *
+ * Islands are numbered in the order they are found in the world, starting from zero.
+ * The callback is invoked from whichever thread processes the island, so it must be
+ * thread safe. Each island is started and finished exactly once per step.
+ *
+ * @param data The user data pointer passed to @c dWorldSetIslandStepCallback
+ * @param island_index Index of the island within this step
+ * @param body_count Number of bodies in the island
+ * @param joint_count Number of joints in the island
+ * @param finished Zero when the island is about to be stepped, non-zero when it is done
+ * @ingroup world
+ */
+typedef void dWorldIslandStepCallback(void *data, unsigned island_index, unsigned body_count, unsigned joint_count, int finished);
+
+/**
+ * @brief Set a callback to be notified as each island is stepped.
+ *
+ * Stepping also seeds the random number generator per island from a value drawn 
+ * on the calling thread, so constraint reordering in @c dWorldQuickStep gives 
+ * the same result regardless of how many threads step the islands.
+ *
+ * @param w The world affected
+ * @param callback The callback, or NULL to disable
+ * @param data User data passed to the callback
+ * @ingroup world
+ */
+ODE_API void dWorldSetIslandStepCallback(dWorldID w, dWorldIslandStepCallback *callback, void *data);
+
 /**
  * @brief Set the world to use shared working memory along with another world.
  *
@@ -978,6 +1008,33 @@ ODE_API void dBodySetLinearVel  (dBodyID, dReal x, dReal y, dReal z);
  */
 ODE_API void dBodySetAngularVel (dBodyID, dReal x, dReal y, dReal z);
 
+/**
+ * @brief Set the position, orientation and velocities of a body in one call.
+ * @ingroup bodies
+ * @remarks
+ * Unlike dBodySetQuaternion the quaternion is stored exactly as given and
+ * is not renormalized, so state read back with dBodyGetPosition,
+ * dBodyGetQuaternion, dBodyGetLinearVel and dBodyGetAngularVel restores
+ * the body bit for bit. The rotation matrix is rebuilt from the quaternion
+ * and attached geoms are notified once.
+ */
+ODE_API void dBodySetState (dBodyID, const dVector3 pos, const dQuaternion q, const dVector3 lvel, const dVector3 avel);
+
+/**
+ * @brief Copy the position, orientation and velocities of many bodies.
+ * @ingroup bodies
+ * @param bodies the bodies to copy, NULL entries are skipped.
+ * @param count number of entries in bodies.
+ * @param state receives 13 values per body: position (3), quaternion (4),
+ * linear velocity (3) and angular velocity (3).
+ * @param stride distance in dReals from one body's values to the next, at least 13.
+ * @remarks
+ * A straight copy of what dBodyGetPosition, dBodyGetQuaternion,
+ * dBodyGetLinearVel and dBodyGetAngularVel point to, so the values can
+ * be given back to dBodySetState to restore each body bit for bit.
+ */
+ODE_API void dBodyGetStates (const dBodyID *bodies, int count, dReal *state, int stride);
+
 /**
  * @brief Get the position of a body.
  * @ingroup bodies
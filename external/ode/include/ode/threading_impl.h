@@ -63,6 +63,26 @@ typedef struct dxThreadingThreadPool *dThreadingThreadPoolID;
  */
 ODE_API dThreadingImplementationID dThreadingAllocateMultiThreadedImplementation();
 
+/**
+ * @brief Allocates built-in self-threaded threading implementation object.
+ *
+ * A self-threaded implementation is a type of implementation that performs 
+ * processing of posted calls by means of caller thread itself. This type of 
+ * implementation does not need thread pool to serve it.
+ *
+ * The default implementation shared by all worlds is self-threaded and is not
+ * safe to use from several threads at once. Worlds that are stepped concurrently
+ * from different threads should each be assigned their own implementation
+ * with @c dWorldSetStepThreadingImplementation.
+ *
+ * @returns ID of object allocated or NULL on failure
+ * 
+ * @ingroup threading
+ * @see dThreadingAllocateMultiThreadedImplementation
+ * @see dThreadingFreeImplementation
+ */
+ODE_API dThreadingImplementationID dThreadingAllocateSelfThreadedImplementation();
+
 /**
  * @brief Retrieves the functions record of a built-in threading implementation.
  *
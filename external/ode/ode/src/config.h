@@ -5,6 +5,11 @@
 #ifndef ODE_CONFIG_H
 #define ODE_CONFIG_H
 
+/* Windows doesn't run configure, see config-windows.h */
+#if defined(_MSC_VER)
+#include "config-windows.h"
+#else
+
 
 /* Define if building universal (internal helper macro) */
 /* #undef AC_APPLE_UNIVERSAL_BUILD */
@@ -255,7 +260,7 @@
 #define dATOMICS_ENABLED 1
 
 /* Built-in multithreaded threading implementation included */
-/* #undef dBUILTIN_THREADING_IMPL_ENABLED */
+#define dBUILTIN_THREADING_IMPL_ENABLED 1
 
 /* Generic OU features are enabled */
 #define dOU_ENABLED 1
@@ -320,6 +325,7 @@ typedef uintptr_t intP;
 
 #include "typedefs.h"
 
+#endif /* #if defined(_MSC_VER) */
 
 #endif /* #define ODE_CONFIG_H */
 
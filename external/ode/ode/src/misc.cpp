@@ -30,22 +30,19 @@
 //****************************************************************************
 // random numbers
 
-static volatile duint32 seed = 0;
+// the seed is thread local so that independent worlds stepped on different
+// threads each get their own deterministic random sequence (see dRandSetSeed)
 
-unsigned long dRand()
-{
-    duint32 origSeed, newSeed;
-#if !dTHREADING_INTF_DISABLED
-    do {
-#endif
-        origSeed = seed;
-        newSeed = ((duint32)1664525 * origSeed + (duint32)1013904223) & (duint32)0xffffffff;
-#if dTHREADING_INTF_DISABLED
-        seed = newSeed;
+#if defined(_MSC_VER)
+static __declspec(thread) duint32 seed = 0;
 #else
-    } while (!AtomicCompareExchange((volatile atomicord32 *)&seed, origSeed, newSeed));
+static __thread duint32 seed = 0;
 #endif
-    return newSeed;
+
+unsigned long dRand()
+{
+    seed = ((duint32)1664525 * seed + (duint32)1013904223) & (duint32)0xffffffff;
+    return seed;
 }
 
 
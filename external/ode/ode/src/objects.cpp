@@ -94,6 +94,8 @@ dxWorld::dxWorld():
     adis(NULL),
     body_flags(0),
     islands_max_threads(dWORLDSTEP_THREADCOUNT_UNLIMITED),
+    island_step_callback(NULL),
+    island_step_callback_data(NULL),
     wmem(NULL),
     qs(NULL),
     contactp(NULL),
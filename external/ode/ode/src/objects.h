@@ -28,6 +28,7 @@
 
 #include <ode/common.h>
 #include <ode/memory.h>
+#include <ode/objects.h>
 #include <ode/mass.h>
 #include "error.h"
 #include "array.h"
@@ -168,6 +169,8 @@ struct dxWorld : public dBase, public dxThreadingBase, private dxIThreadingDefau
     dxAutoDisable adis;		// auto-disable parameters
     int body_flags;               // flags for new bodies
     unsigned islands_max_threads; // maximum threads to allocate for island processing
+    dWorldIslandStepCallback *island_step_callback; // optional per island stepping notification
+    void *island_step_callback_data;
     dxStepWorkingMemory *wmem; // Working memory object for dWorldStep/dWorldQuickStep
 
     dxQuickStepParameters qs;
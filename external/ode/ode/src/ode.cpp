@@ -404,6 +404,53 @@ void dBodySetAngularVel (dBodyID b, dReal x, dReal y, dReal z)
 }
 
 
+void dBodySetState (dBodyID b, const dVector3 pos, const dQuaternion q, const dVector3 lvel, const dVector3 avel)
+{
+    dAASSERT (b && pos && q && lvel && avel);
+    b->posr.pos[0] = pos[0];
+    b->posr.pos[1] = pos[1];
+    b->posr.pos[2] = pos[2];
+    b->q[0] = q[0];
+    b->q[1] = q[1];
+    b->q[2] = q[2];
+    b->q[3] = q[3];
+    dQtoR (b->q,b->posr.R);
+    b->lvel[0] = lvel[0];
+    b->lvel[1] = lvel[1];
+    b->lvel[2] = lvel[2];
+    b->avel[0] = avel[0];
+    b->avel[1] = avel[1];
+    b->avel[2] = avel[2];
+
+    // notify all attached geoms that this body has moved
+    for (dxGeom *geom = b->geom; geom; geom = dGeomGetBodyNext (geom))
+        dGeomMoved (geom);
+}
+
+
+void dBodyGetStates (const dBodyID *bodies, int count, dReal *state, int stride)
+{
+    dAASSERT (bodies && state && count >= 0 && stride >= 13);
+    for (int i = 0; i < count; ++i, state += stride) {
+        const dxBody *b = bodies[i];
+        if (!b) continue;
+        state[0] = b->posr.pos[0];
+        state[1] = b->posr.pos[1];
+        state[2] = b->posr.pos[2];
+        state[3] = b->q[0];
+        state[4] = b->q[1];
+        state[5] = b->q[2];
+        state[6] = b->q[3];
+        state[7] = b->lvel[0];
+        state[8] = b->lvel[1];
+        state[9] = b->lvel[2];
+        state[10] = b->avel[0];
+        state[11] = b->avel[1];
+        state[12] = b->avel[2];
+    }
+}
+
+
 const dReal * dBodyGetPosition (dBodyID b)
 {
     dAASSERT (b);
@@ -1670,6 +1717,13 @@ unsigned dWorldGetStepIslandsProcessingMaxThreadCount(dWorldID w)
     return w->islands_max_threads;
 }
 
+void dWorldSetIslandStepCallback(dWorldID w, dWorldIslandStepCallback *callback, void *data)
+{
+    dAASSERT (w);
+    w->island_step_callback = callback;
+    w->island_step_callback_data = data;
+}
+
 int dWorldUseSharedWorkingMemory(dWorldID w, dWorldID from_world)
 {
     dUASSERT (w,"bad world argument");
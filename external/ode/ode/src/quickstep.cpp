@@ -1423,7 +1423,17 @@ void dxQuickStepIsland_Stage3(dxQuickStepperStage3CallContext *stage3CallContext
         BEGIN_STATE_SAVE(memarena, lcpstate) {
             IFTIMING (dTimerNow ("solving LCP problem"));
             // solve the LCP problem and get lambda and invM*constraint_force
-            SOR_LCP (memarena,m,nb,J,jb,body,invI,lambda,cforce,rhs,lo,hi,cfm,findex,&world->qs);
+            // when islands are stepped in parallel the seed is per island so constraint reordering doesn't depend
+            // on which thread runs this, and the thread's own seed is restored so the next step draws the same island seeds
+            if (callContext->m_useIslandRandomSeed) {
+                unsigned long threadSeed = dRandGetSeed ();
+                dRandSetSeed (callContext->m_islandRandomSeed);
+                SOR_LCP (memarena,m,nb,J,jb,body,invI,lambda,cforce,rhs,lo,hi,cfm,findex,&world->qs);
+                dRandSetSeed (threadSeed);
+            }
+            else {
+                SOR_LCP (memarena,m,nb,J,jb,body,invI,lambda,cforce,rhs,lo,hi,cfm,findex,&world->qs);
+            }
 
         } END_STATE_SAVE(memarena, lcpstate);
 
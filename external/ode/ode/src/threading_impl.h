@@ -36,9 +36,9 @@
 #include <ode/threading.h>
 
 
-// This function has been removed from public headers as there is no need for it
-// to be accessible to outer code at this time. In future it is possible 
-// it could be published back again.
+// This function has been published back in <ode/threading_impl.h> so that worlds
+// stepped concurrently on different threads can each have their own self-threaded
+// implementation instead of sharing the global default one.
 /**
  * @brief Allocates built-in self-threaded threading implementation object.
  *
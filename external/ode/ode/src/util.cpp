@@ -345,12 +345,14 @@ struct dxIslandsProcessingCallContext
 {
     dxIslandsProcessingCallContext(dxWorld *world, const dxWorldProcessIslandsInfo &islandsInfo, dReal stepSize, dstepper_fn_t stepper):
         m_world(world), m_islandsInfo(islandsInfo), m_stepSize(stepSize), m_stepper(stepper),
-        m_groupReleasee(NULL), m_islandToProcessStorage(0), m_stepperAllowedThreads(0)
+        m_groupReleasee(NULL), m_islandToProcessStorage(0), m_stepperAllowedThreads(0), m_islandRandomSeeds(false), m_randomSeedBase(0)
     {
     }
 
     void AssignGroupReleasee(dCallReleaseeID groupReleasee) { m_groupReleasee = groupReleasee; }
     void SetStepperAllowedThreads(unsigned allowedThreadsLimit) { m_stepperAllowedThreads = allowedThreadsLimit; }
+    // only draws from the thread's random sequence when islands may be stepped out of order, so single threaded worlds step exactly as before
+    void AssignIslandRandomSeeds() { m_islandRandomSeeds = true; m_randomSeedBase = dRand(); }
 
     static int ThreadedProcessGroup_Callback(void *callContext, dcallindex_t callInstanceIndex, dCallReleaseeID callThisReleasee);
     bool ThreadedProcessGroup();
@@ -364,6 +366,8 @@ struct dxIslandsProcessingCallContext
     static int ThreadedProcessIslandStepper_Callback(void *callContext, dcallindex_t callInstanceIndex, dCallReleaseeID callThisReleasee);
     void ThreadedProcessIslandStepper(dxSingleIslandCallContext *stepperCallContext);
 
+    void NotifyIslandStepped(dxSingleIslandCallContext *stepperCallContext, bool finished);
+
     size_t ObtainNextIslandToBeProcessed(size_t islandsCount);
 
     dxWorld                         *const m_world;
@@ -373,6 +377,8 @@ struct dxIslandsProcessingCallContext
     dCallReleaseeID                 m_groupReleasee;
     size_t                          volatile m_islandToProcessStorage;
     unsigned                        m_stepperAllowedThreads;
+    bool                            m_islandRandomSeeds;
+    unsigned long                   m_randomSeedBase;
 };
 
 
@@ -381,7 +387,7 @@ struct dxSingleIslandCallContext
     dxSingleIslandCallContext(dxIslandsProcessingCallContext *islandsProcessingContext, 
         dxWorldProcessMemArena *stepperArena, void *arenaInitialState, 
         dxBody *const *islandBodiesStart, dxJoint *const *islandJointsStart):
-        m_islandsProcessingContext(islandsProcessingContext), m_islandIndex(0), 
+        m_islandsProcessingContext(islandsProcessingContext), m_islandIndex(0), m_steppedIsland(0), 
         m_stepperArena(stepperArena), m_arenaInitialState(arenaInitialState), 
         m_stepperCallContext(islandsProcessingContext->m_world, islandsProcessingContext->m_stepSize, islandsProcessingContext->m_stepperAllowedThreads, stepperArena, islandBodiesStart, islandJointsStart)
     {
@@ -413,6 +419,7 @@ struct dxSingleIslandCallContext
 
     dxIslandsProcessingCallContext  *m_islandsProcessingContext;
     size_t                          m_islandIndex;
+    size_t                          m_steppedIsland; // index + 1 of the island stepped before this search, zero if none
     dxWorldProcessMemArena          *m_stepperArena;
     void                            *m_arenaInitialState;
     dxStepperProcessingCallContext  m_stepperCallContext;
@@ -902,7 +909,13 @@ bool dxProcessIslands (dxWorld *world, const dxWorldProcessIslandsInfo &islandsI
         dIASSERT(islandsAllowedThreadCount != 0);
         dIASSERT(activeThreadCount >= islandsAllowedThreadCount);
 
-        unsigned stepperAllowedThreadCount = islandsAllowedThreadCount; // For now, set stepper allowed threads equal to island stepping threads
+        if (islandsAllowedThreadCount > 1 || world->island_step_callback != NULL) {
+            callContext.AssignIslandRandomSeeds();
+        }
+
+        // each island is stepped on a single thread. islands share nothing so they scale across threads cleanly,
+        // while splitting a single island's stages across threads reads stale island selections under load
+        unsigned stepperAllowedThreadCount = 1;
 
         unsigned simultaneousCallsCount = EstimateIslandProcessingSimultaneousCallsMaximumCount(activeThreadCount, islandsAllowedThreadCount, stepperAllowedThreadCount, maxCallCountEstimator);
         if (!world->PreallocateResourcesForThreadedCalls(simultaneousCallsCount)) {
@@ -985,6 +998,9 @@ void dxIslandsProcessingCallContext::ThreadedProcessIslandSearch(dxSingleIslandC
 {
     bool finalizeJob = false;
 
+    // searches are posted to run after the previous island stepper has released, so that island is finished now
+    NotifyIslandStepped(stepperCallContext, true);
+
     const dxWorldProcessIslandsInfo &islandsInfo = m_islandsInfo;
     unsigned int const *islandSizes = islandsInfo.GetIslandSizes();
 
@@ -1004,6 +1020,10 @@ void dxIslandsProcessingCallContext::ThreadedProcessIslandSearch(dxSingleIslandC
             if (islandIndex == islandToProcess) {
                 // Store selected island details
                 stepperCallContext->AssignIslandSelection(islandBodiesStart, islandJointsStart, bcount, jcount);
+                if (m_islandRandomSeeds) {
+                    stepperCallContext->m_stepperCallContext.AssignIslandRandomSeed(m_randomSeedBase + islandIndex);
+                }
+                stepperCallContext->m_steppedIsland = islandIndex + 1;
 
                 // Store next island index to continue search from
                 ++islandIndex;
@@ -1052,9 +1072,27 @@ int dxIslandsProcessingCallContext::ThreadedProcessIslandStepper_Callback(void *
 
 void dxIslandsProcessingCallContext::ThreadedProcessIslandStepper(dxSingleIslandCallContext *stepperCallContext)
 {
+    NotifyIslandStepped(stepperCallContext, false);
     m_stepper(&stepperCallContext->m_stepperCallContext);
 }
 
+void dxIslandsProcessingCallContext::NotifyIslandStepped(dxSingleIslandCallContext *stepperCallContext, bool finished)
+{
+    if (stepperCallContext->m_steppedIsland == 0) {
+        return;
+    }
+
+    if (m_world->island_step_callback != NULL) {
+        const dxStepperProcessingCallContext &islandContext = stepperCallContext->m_stepperCallContext;
+        m_world->island_step_callback(m_world->island_step_callback_data, (unsigned)(stepperCallContext->m_steppedIsland - 1), 
+            islandContext.m_islandBodiesCount, islandContext.m_islandJointsCount, finished ? 1 : 0);
+    }
+
+    if (finished) {
+        stepperCallContext->m_steppedIsland = 0;
+    }
+}
+
 size_t dxIslandsProcessingCallContext::ObtainNextIslandToBeProcessed(size_t islandsCount)
 {
     return ThrsafeIncrementSizeUpToLimit(&m_islandToProcessStorage, islandsCount);
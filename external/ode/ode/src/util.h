@@ -297,10 +297,16 @@ struct dxStepperProcessingCallContext
         dxWorldProcessMemArena *stepperArena, dxBody *const *islandBodiesStart, dxJoint *const *islandJointsStart): 
         m_world(world), m_stepSize(stepSize), m_stepperArena(stepperArena), m_finalReleasee(NULL), 
         m_islandBodiesStart(islandBodiesStart), m_islandJointsStart(islandJointsStart), m_islandBodiesCount(0), m_islandJointsCount(0),
-        m_stepperAllowedThreads(stepperAllowedThreads)
+        m_stepperAllowedThreads(stepperAllowedThreads), m_useIslandRandomSeed(false), m_islandRandomSeed(0)
     {
     }
 
+    void AssignIslandRandomSeed(unsigned long islandRandomSeed)
+    {
+        m_useIslandRandomSeed = true;
+        m_islandRandomSeed = islandRandomSeed;
+    }
+
     void AssignIslandSelection(dxBody *const *islandBodiesStart, dxJoint *const *islandJointsStart, 
         unsigned islandBodiesCount, unsigned islandJointsCount)
     {
@@ -327,6 +333,8 @@ struct dxStepperProcessingCallContext
     unsigned                m_islandBodiesCount;
     unsigned                m_islandJointsCount;
     unsigned                m_stepperAllowedThreads;
+    bool                    m_useIslandRandomSeed;
+    unsigned long           m_islandRandomSeed; // islands may be stepped on any thread, so each gets its own seed
 };
 
 #define BEGIN_STATE_SAVE(memarena, state) void *state = memarena->SaveState();
@@ -63,11 +63,54 @@ project "tinycthread"
     files { "external/tinycthread/*.h", "external/tinycthread/*.c" }
     targetdir "lib"
 
+-- ODE is built with configure in external/ode and installed, except on windows, where it is
+-- built from source here with the options of external/ode/ode/src/config-windows.h
+
+if os.is "windows" then
+
+project "ode"
+    language "C++"
+    kind "StaticLib"
+    files { "external/ode/ode/src/*.cpp", "external/ode/ode/src/*.c", "external/ode/ode/src/joints/*.cpp", "external/ode/ou/src/ou/*.cpp" }
+    -- no trimesh or libccd, as in the configure build
+    excludes {
+        "external/ode/ode/src/collision_trimesh_box.cpp",
+        "external/ode/ode/src/collision_trimesh_ccylinder.cpp",
+        "external/ode/ode/src/collision_trimesh_distance.cpp",
+        "external/ode/ode/src/collision_trimesh_gimpact.cpp",
+        "external/ode/ode/src/collision_trimesh_opcode.cpp",
+        "external/ode/ode/src/collision_trimesh_plane.cpp",
+        "external/ode/ode/src/collision_trimesh_ray.cpp",
+        "external/ode/ode/src/collision_trimesh_sphere.cpp",
+        "external/ode/ode/src/collision_trimesh_trimesh.cpp",
+        "external/ode/ode/src/collision_trimesh_trimesh_new.cpp",
+        "external/ode/ode/src/collision_cylinder_trimesh.cpp",
+        "external/ode/ode/src/collision_libccd.cpp"
+    }
+    removeincludedirs { "." }
+    includedirs { "external/ode/include", "external/ode/ode/src", "external/ode/ode/src/joints", "external/ode/ou/include" }
+    defines { "ODE_LIB", "_OU_NAMESPACE=odeou", "_CRT_SECURE_NO_DEPRECATE", "_USE_MATH_DEFINES" }
+    links { "user32" }
+    targetdir "lib"
+
+end
+
+function link_ode()
+    if os.is "windows" then
+        links { "ode" }
+    else
+        configuration "Debug"
+            links { "ode-debug" }
+        configuration "Release"
+            links { "ode" }
+    end
+end
+
 project "TestCore"
     language "C++"
     kind "ConsoleApp"
     files { "tests/Core/*.cpp" }
-    links { "Core" }
+    links { "Core", "tinycthread" }
     targetdir "bin"
 
 project "TestNetwork"
@@ -94,12 +137,9 @@ project "TestClientServer"
 project "TestCubes"
     language "C++"
     kind "ConsoleApp"
-    files { "tests/Cubes/*.cpp" }
-    links { "Core", "Cubes", "ode" }
-	configuration "Debug"
-		links { "ode-debug" }
-	configuration "Release"
-		links { "ode" }
+    files { "tests/Cubes/Test*.cpp" }
+    links { "Core", "Cubes", "tinycthread", "ode" }
+    link_ode()
     targetdir "bin"
 
 project "TestVirtualGo"
@@ -107,10 +147,15 @@ project "TestVirtualGo"
     kind "ConsoleApp"
     files { "tests/VirtualGo/*.cpp" }
     links { "Core", "VirtualGo" }
-	configuration "Debug"
-		links { "ode-debug" }
-	configuration "Release"
-		links { "ode" }
+    link_ode()
+    targetdir "bin"
+
+project "TestGame"
+    language "C++"
+    kind "ConsoleApp"
+    files { "tests/Game/Test*.cpp" }
+    links { "Core", "Cubes", "tinycthread" }
+    link_ode()
     targetdir "bin"
 
 project "SoakProtocol"
@@ -141,6 +186,22 @@ project "ProfileClientServer"
     links { "Core", "Network", "Protocol", "ClientServer" }
     targetdir "bin"
 
+project "ProfileSnapshot"
+    language "C++"
+    kind "ConsoleApp"
+    files { "tests/Game/ProfileSnapshot.cpp" }
+    links { "Core", "Cubes", "tinycthread" }
+    link_ode()
+    targetdir "bin"
+
+project "ProfileCubes"
+    language "C++"
+    kind "ConsoleApp"
+    files { "tests/Cubes/ProfileCubes.cpp" }
+    links { "Core", "Cubes", "tinycthread" }
+    link_ode()
+    targetdir "bin"
+
 --[[project "FontTool"
     language "C++"
     kind "ConsoleApp"
@@ -149,6 +210,20 @@ project "ProfileClientServer"
     targetdir "bin"
 --]]
 
+project "EntropyTool"
+    language "C++"
+    kind "ConsoleApp"
+    files { "tools/Entropy/*.cpp" }
+    links { "Core", "Protocol" }
+    targetdir "bin"
+
+project "PacketDictionaryTool"
+    language "C++"
+    kind "ConsoleApp"
+    files { "tools/PacketDictionary/*.cpp" }
+    links { "Core", "Network" }
+    targetdir "bin"
+
 --[[
 project "StoneTool"
     language "C++"
@@ -172,11 +247,8 @@ project "Server"
     language "C++"
     kind "ConsoleApp"
     files { "src/game/*.cpp" }
-    links { "Core", "Network", "Protocol", "ClientServer", "Cubes" }
-	configuration "Debug"
-		links { "ode-debug" }
-	configuration "Release"
-		links { "ode" }
+    links { "Core", "Network", "Protocol", "ClientServer", "Cubes", "tinycthread" }
+    link_ode()
     targetdir "bin"
 
 if _ACTION == "clean" then
@@ -315,8 +387,8 @@ if not os.is "windows" then
         valid_tools = premake.action.get("gmake").valid_tools,
      
         execute = function ()
-            if os.execute "make -j4 TestCore; make -j4 TestNetwork; make -j4 TestProtocol; make -j4 TestClientServer; make -j4 TestCubes; make -j4 TestVirtualGo" == 0 then
-                os.execute "./bin/TestCore; ./bin/TestNetwork; ./bin/TestProtocol; ./bin/TestClientServer; ./bin/TestCubes; ./bin/TestVirtualGo"
+            if os.execute "make -j4 TestCore; make -j4 TestNetwork; make -j4 TestProtocol; make -j4 TestClientServer; make -j4 TestCubes; make -j4 TestVirtualGo; make -j4 TestGame" == 0 then
+                os.execute "./bin/TestCore; ./bin/TestNetwork; ./bin/TestProtocol; ./bin/TestClientServer; ./bin/TestCubes; ./bin/TestVirtualGo; ./bin/TestGame"
             end
         end
     }
@@ -702,4 +774,19 @@ if not os.is "windows" then
         end
     }
 
+    newaction
+    {
+        trigger     = "profile_cubes",
+        description = "Build and run cubes rooms per core profile",
+        valid_kinds = premake.action.get("gmake").valid_kinds,
+        valid_languages = premake.action.get("gmake").valid_languages,
+        valid_tools = premake.action.get("gmake").valid_tools,
+     
+        execute = function ()
+            if os.execute "make -j4 ProfileCubes" == 0 then
+                os.execute "bin/ProfileCubes"
+            end
+        end
+    }
+
 end
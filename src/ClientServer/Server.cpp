@@ -41,6 +41,8 @@ namespace clientServer
 
 //            printf( "creating server with %d client slots\n", m_config.maxClients );
 
+        m_random.Seed( m_config.seed ? m_config.seed : core::nanoseconds() );
+
         m_packetFactory = &m_config.networkInterface->GetPacketFactory();
 
         m_numClients = m_config.maxClients;
@@ -466,7 +468,7 @@ namespace clientServer
 
         client.address = address;
         client.clientId = packet->clientId;
-        client.serverId = core::generate_id();
+        client.serverId = m_random.GenerateId();
         client.lastPacketTime = m_timeBase.time;
 
         SetClientState( clientIndex, SERVER_CLIENT_STATE_SENDING_CHALLENGE );
@@ -25,6 +25,7 @@
 #ifndef CLIENT_SERVER_SERVER_H
 #define CLIENT_SERVER_SERVER_H
 
+#include "core/Random.h"
 #include "protocol/Connection.h"
 #include "ClientServerContext.h"
 #include "ClientServerDataBlock.h"
@@ -63,6 +64,8 @@ namespace clientServer
         int fragmentsPerSecond = 60;                            // number of fragment packets to send per-second. set pretty high because we want the data to get across quickly.
 
         network::Simulator * networkSimulator = nullptr;        // optional network simulator.
+
+        uint64_t seed = 0;                                      // random seed used to generate server ids. if zero then seed from the clock.
     };
 
     class Server
@@ -111,6 +114,8 @@ namespace clientServer
 
         core::TimeBase m_timeBase;
 
+        core::RandomGenerator m_random;
+
         bool m_open = true;
 
         int m_numClients = 0;
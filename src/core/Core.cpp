@@ -23,6 +23,7 @@
 */
 
 #include "core/Core.h"
+#include "core/Random.h"
 #include <time.h>
 #include <stdio.h>
 
@@ -83,15 +84,28 @@ namespace core
         #endif
     }
 
+    RandomGenerator & default_random_generator()
+    {
+        // IMPORTANT: One generator per-thread so the global random functions never race.
+        // Seeded from the clock and the address of the generator so threads get different sequences.
+        static thread_local RandomGenerator generator( nanoseconds(), uint64_t( uintptr_t( &generator ) ) );
+        return generator;
+    }
+
+    void random_seed( uint64_t seed )
+    {
+        default_random_generator().Seed( seed );
+    }
+
     uint16_t generate_id()
     {
-        return ( rand() % 65535 ) + 1;
+        return default_random_generator().GenerateId();
     }
 
     int random_int( int min, int max )
     {
         CORE_ASSERT( max > min );
-        int result = min + rand() % ( max - min + 1 );
+        int result = default_random_generator().GetInt( min, max );
         CORE_ASSERT( result >= min );
         CORE_ASSERT( result <= max );
         return result;
@@ -99,9 +113,7 @@ namespace core
 
     float random_float( float min, float max )
     {
-        const int res = 10000000;
-        double scale = ( rand() % res ) / double( res - 1 );
-        return (float) ( min + (double) ( max - min ) * scale );
+        return default_random_generator().GetFloat( min, max );
     }
 
     uint32_t hash_data( const uint8_t * data, uint32_t length, uint32_t hash )
@@ -202,7 +214,7 @@ namespace core
             now /= info.denom;
             return now;
 
-        #elif CORE_PLATFORM == CORE_PLATFORM_LINUX
+        #elif CORE_PLATFORM == CORE_PLATFORM_UNIX
 
             #ifdef CLOCK_MONOTONIC
             #define CLOCKID CLOCK_MONOTONIC
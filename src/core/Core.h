@@ -241,6 +241,8 @@ namespace core
         return s1 - s2;
     }
 
+    // these use the calling thread's default random generator. see core/Random.h
+
     uint16_t generate_id();
 
     int random_int( int min, int max );
@@ -0,0 +1,218 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "core/JobSystem.h"
+#include "tinycthread/tinycthread.h"
+
+#if CORE_PLATFORM == CORE_PLATFORM_MAC || CORE_PLATFORM == CORE_PLATFORM_UNIX
+#include <unistd.h>
+#elif CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+namespace core
+{
+    const int MaxJobThreads = 64;
+
+    struct JobSystemImpl
+    {
+        JobSystemConfig config;
+
+        mtx_t mutex;
+        cnd_t work_available;
+        cnd_t work_done;
+
+        JobFunction function = nullptr;
+        void * data = nullptr;
+        int count = 0;
+        int next = 0;
+        int completed = 0;
+        bool quit = false;
+
+        int num_threads = 0;
+        thrd_t threads[MaxJobThreads];
+    };
+
+    JobSystem::JobSystem( const JobSystemConfig & config )
+    {
+        impl = new JobSystemImpl();
+
+        impl->config = config;
+
+        mtx_init( &impl->mutex, mtx_plain );
+        cnd_init( &impl->work_available );
+        cnd_init( &impl->work_done );
+
+        int num_threads = config.num_threads;
+        if ( num_threads < 0 )
+            num_threads = get_num_cores() - 1;
+        if ( num_threads > MaxJobThreads )
+            num_threads = MaxJobThreads;
+
+        for ( int i = 0; i < num_threads; ++i )
+        {
+            if ( thrd_create( &impl->threads[impl->num_threads], WorkerThread, this ) != thrd_success )
+                break;
+            impl->num_threads++;
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        mtx_lock( &impl->mutex );
+        impl->quit = true;
+        cnd_broadcast( &impl->work_available );
+        mtx_unlock( &impl->mutex );
+
+        for ( int i = 0; i < impl->num_threads; ++i )
+            thrd_join( impl->threads[i], nullptr );
+
+        cnd_destroy( &impl->work_done );
+        cnd_destroy( &impl->work_available );
+        mtx_destroy( &impl->mutex );
+
+        delete impl;
+        impl = nullptr;
+    }
+
+    void JobSystem::Run( JobFunction function, void * data, int count )
+    {
+        CORE_ASSERT( function );
+        CORE_ASSERT( count >= 0 );
+
+        if ( count == 0 )
+            return;
+
+        // no workers, or only one job: don't bother waking anybody up
+
+        if ( impl->num_threads == 0 || count == 1 )
+        {
+            for ( int i = 0; i < count; ++i )
+                function( data, i );
+            return;
+        }
+
+        mtx_lock( &impl->mutex );
+        CORE_ASSERT( impl->next >= impl->count );
+        impl->function = function;
+        impl->data = data;
+        impl->count = count;
+        impl->next = 0;
+        impl->completed = 0;
+        cnd_broadcast( &impl->work_available );
+        mtx_unlock( &impl->mutex );
+
+        // the calling thread takes jobs too, then waits for any still running on workers
+
+        while ( RunNextJob() ) {}
+
+        mtx_lock( &impl->mutex );
+        while ( impl->completed < impl->count )
+            cnd_wait( &impl->work_done, &impl->mutex );
+        impl->function = nullptr;
+        impl->data = nullptr;
+        mtx_unlock( &impl->mutex );
+    }
+
+    int JobSystem::GetNumThreads() const
+    {
+        return impl->num_threads + 1;
+    }
+
+    bool JobSystem::RunNextJob()
+    {
+        mtx_lock( &impl->mutex );
+
+        if ( impl->next >= impl->count )
+        {
+            mtx_unlock( &impl->mutex );
+            return false;
+        }
+
+        const int index = impl->next++;
+        JobFunction function = impl->function;
+        void * data = impl->data;
+
+        mtx_unlock( &impl->mutex );
+
+        function( data, index );
+
+        mtx_lock( &impl->mutex );
+        if ( ++impl->completed == impl->count )
+            cnd_signal( &impl->work_done );
+        mtx_unlock( &impl->mutex );
+
+        return true;
+    }
+
+    int JobSystem::WorkerThread( void * arg )
+    {
+        JobSystem * job_system = (JobSystem*) arg;
+
+        JobSystemImpl * impl = job_system->impl;
+
+        if ( impl->config.thread_start )
+            impl->config.thread_start( impl->config.context );
+
+        mtx_lock( &impl->mutex );
+
+        while ( true )
+        {
+            while ( !impl->quit && impl->next >= impl->count )
+                cnd_wait( &impl->work_available, &impl->mutex );
+
+            if ( impl->quit )
+                break;
+
+            mtx_unlock( &impl->mutex );
+
+            while ( job_system->RunNextJob() ) {}
+
+            mtx_lock( &impl->mutex );
+        }
+
+        mtx_unlock( &impl->mutex );
+
+        if ( impl->config.thread_stop )
+            impl->config.thread_stop( impl->config.context );
+
+        return 0;
+    }
+
+    int get_num_cores()
+    {
+        #if CORE_PLATFORM == CORE_PLATFORM_MAC || CORE_PLATFORM == CORE_PLATFORM_UNIX
+            const long cores = sysconf( _SC_NPROCESSORS_ONLN );
+            return cores > 0 ? (int) cores : 1;
+        #elif CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+            SYSTEM_INFO info;
+            GetSystemInfo( &info );
+            return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+        #else
+            return 1;
+        #endif
+    }
+}
@@ -0,0 +1,76 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef CORE_JOB_SYSTEM_H
+#define CORE_JOB_SYSTEM_H
+
+#include "core/Core.h"
+
+namespace core
+{
+    // job system for running independent pieces of work (eg. one game instance per job) across worker threads
+
+    typedef void (*JobFunction)( void * data, int index );
+
+    typedef void (*JobThreadFunction)( void * context );
+
+    struct JobSystemConfig
+    {
+        int num_threads = -1;                           // number of worker threads. -1 means one per core, minus the calling thread.
+        JobThreadFunction thread_start = nullptr;       // called on each worker thread before it runs any jobs, eg. to allocate per-thread library data
+        JobThreadFunction thread_stop = nullptr;        // called on each worker thread as it exits
+        void * context = nullptr;
+    };
+
+    class JobSystem
+    {
+    public:
+
+        JobSystem( const JobSystemConfig & config = JobSystemConfig() );
+
+        ~JobSystem();
+
+        // calls function( data, i ) for i in [0,count) across the workers and the calling thread. returns when all jobs are done.
+
+        void Run( JobFunction function, void * data, int count );
+
+        int GetNumThreads() const;
+
+    private:
+
+        static int WorkerThread( void * arg );
+
+        bool RunNextJob();
+
+        JobSystem( const JobSystem & other );
+        JobSystem & operator = ( const JobSystem & other );
+
+        struct JobSystemImpl * impl;
+    };
+
+    int get_num_cores();
+}
+
+#endif
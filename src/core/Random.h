@@ -0,0 +1,142 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CORE_RANDOM_H
+#define CORE_RANDOM_H
+
+#include "core/Core.h"
+
+namespace core
+{
+    /*
+        Small, fast PCG32 random number generator (http://www.pcg-random.org).
+
+        Unlike rand() each instance owns its own state, so it is thread-safe as long 
+        as instances are not shared between threads, and a given seed always reproduces 
+        the same sequence regardless of what else in the process is consuming random numbers.
+    */
+
+    class RandomGenerator
+    {
+    public:
+
+        static const uint64_t DefaultSeed = 0x853c49e6748fea9bULL;
+        static const uint64_t DefaultSequence = 0xda3e39cb94b95bdbULL;
+
+        RandomGenerator( uint64_t seed = DefaultSeed, uint64_t sequence = DefaultSequence )
+        {
+            Seed( seed, sequence );
+        }
+
+        void Seed( uint64_t seed, uint64_t sequence = DefaultSequence )
+        {
+            m_state = 0;
+            m_increment = ( sequence << 1 ) | 1;
+            GetUint32();
+            m_state += seed;
+            GetUint32();
+        }
+
+        uint32_t GetUint32()
+        {
+            const uint64_t oldState = m_state;
+            m_state = oldState * 6364136223846793005ULL + m_increment;
+            const uint32_t xorShifted = uint32_t( ( ( oldState >> 18 ) ^ oldState ) >> 27 );
+            const uint32_t rotate = uint32_t( oldState >> 59 );
+            return ( xorShifted >> rotate ) | ( xorShifted << ( ( 32 - rotate ) & 31 ) );
+        }
+
+        uint32_t GetUint32( uint32_t bound )
+        {
+            // IMPORTANT: Returns [0,bound-1] without modulo bias (Lemire's multiply and reject).
+
+            CORE_ASSERT( bound > 0 );
+            uint64_t product = uint64_t( GetUint32() ) * bound;
+            uint32_t low = uint32_t( product );
+            if ( low < bound )
+            {
+                const uint32_t threshold = ( 0 - bound ) % bound;
+                while ( low < threshold )
+                {
+                    product = uint64_t( GetUint32() ) * bound;
+                    low = uint32_t( product );
+                }
+            }
+            return uint32_t( product >> 32 );
+        }
+
+        int GetInt( int min, int max )
+        {
+            CORE_ASSERT( max >= min );
+            const uint32_t range = uint32_t( int64_t( max ) - int64_t( min ) + 1 );
+            if ( range == 0 )
+                return int( GetUint32() );
+            return int( int64_t( min ) + GetUint32( range ) );
+        }
+
+        float GetFloat()
+        {
+            // [0,1) with 24 bits of precision so every value is exactly representable.
+            return ( GetUint32() >> 8 ) * ( 1.0f / 16777216.0f );
+        }
+
+        float GetFloat( float min, float max )
+        {
+            return min + ( max - min ) * GetFloat();
+        }
+
+        uint16_t GenerateId()
+        {
+            return uint16_t( GetUint32( 65535 ) + 1 );
+        }
+
+        void GetUint32s( uint32_t * values, int count )
+        {
+            CORE_ASSERT( values );
+            CORE_ASSERT( count >= 0 );
+            for ( int i = 0; i < count; ++i )
+                values[i] = GetUint32();
+        }
+
+        void GetFloats( float * values, int count, float min = 0.0f, float max = 1.0f )
+        {
+            CORE_ASSERT( values );
+            CORE_ASSERT( count >= 0 );
+            const float scale = ( max - min ) * ( 1.0f / 16777216.0f );
+            for ( int i = 0; i < count; ++i )
+                values[i] = min + ( GetUint32() >> 8 ) * scale;
+        }
+
+    private:
+
+        uint64_t m_state;
+        uint64_t m_increment;
+    };
+
+    RandomGenerator & default_random_generator();
+
+    void random_seed( uint64_t seed );
+}
+
+#endif
@@ -23,44 +23,62 @@
 */
 
 #include "Activation.h"
+#include "vectorial/simd4f.h"
 
 namespace activation
 {
-	void CellObjectSet::DeleteObject( ActiveObject * activeObjects, ObjectId id )
+	// distance test four consecutive cell objects against a circle, one bit per object inside.
+	// a cell object is four 32 bit words (flags, active index, x, y), so on sse four of them
+	// load as a 4x4 block and transpose into x and y lanes
+
+	static inline uint32_t CellObjectsInsideCircle( const CellObject * objects, float x, float y, float radiusSquared )
 	{
-		assert( count >= 1 );
-		for ( int i = 0; i < count; ++i )
-		{
-			if ( ids[i] == id )
+		#if defined( VECTORIAL_SSE ) && !defined( VALIDATION )
+
+			assert( sizeof( CellObject ) == 4 * sizeof( float ) );
+			simd4f o0 = _mm_loadu_ps( (const float*) &objects[0] ), o1 = _mm_loadu_ps( (const float*) &objects[1] ), o2 = _mm_loadu_ps( (const float*) &objects[2] ), o3 = _mm_loadu_ps( (const float*) &objects[3] );
+			_MM_TRANSPOSE4_PS( o0, o1, o2, o3 );
+			const simd4f dx = simd4f_sub( o2, simd4f_splat( x ) );
+			const simd4f dy = simd4f_sub( o3, simd4f_splat( y ) );
+			const simd4f distanceSquared = simd4f_add( simd4f_mul( dx, dx ), simd4f_mul( dy, dy ) );
+			return (uint32_t) _mm_movemask_ps( _mm_cmplt_ps( distanceSquared, simd4f_splat( radiusSquared ) ) );
+
+		#else // #if defined( VECTORIAL_SSE ) && !defined( VALIDATION )
+
+			uint32_t inside = 0;
+			for ( int i = 0; i < 4; ++i )
 			{
-				DeleteObject( activeObjects, objects[i] );
-				return;
+				const float dx = objects[i].x - x;
+				const float dy = objects[i].y - y;
+				if ( dx*dx + dy*dy < radiusSquared )
+					inside |= 1U << i;
 			}
-		}
-		assert( false );
+			return inside;
+
+		#endif // #if defined( VECTORIAL_SSE ) && !defined( VALIDATION )
+	}
+
+	void CellObjectSet::DeleteObject( ActiveObject * activeObjects, ObjectId id )
+	{
+		assert( count >= 1 );
+		const int i = FindIndex( id );
+		assert( i >= 0 );
+		DeleteObject( activeObjects, objects[i] );
 	}
 
 	void CellObjectSet::DeleteObject( ActiveObject * activeObjects, CellObject & cellObject )
 	{			
 		assert( count >= 1 );
-		CellObject * cellObjects = &objects[0];
-		int i = (int) ( &cellObject - cellObjects );
+		int i = (int) ( &cellObject - &objects[0] );
 		assert( i >= 0 );
 		assert( i < count );
-		int last = count - 1;
-		if ( i != last )
+		Set<CellObject>::DeleteObject( i );
+		if ( i < count && objects[i].active )
 		{
-			ids[i] = ids[last];
-			cellObjects[i] = cellObjects[last];
-			if ( cellObjects[i].active )
-			{
-				const int activeObjectIndex = cellObjects[i].activeObjectIndex;
-				activeObjects[activeObjectIndex].cellObjectIndex = (int) ( &cellObjects[i] - cellObjects );
-			}					
+			// the last object was moved into the deleted slot
+			const int activeObjectIndex = objects[i].activeObjectIndex;
+			activeObjects[activeObjectIndex].cellObjectIndex = i;
 		}
-		count--;
-		if ( count < size/3 )
-			Shrink();
 	}
 
 #ifdef VALIDATION
@@ -117,39 +135,27 @@ namespace activation
 	void ActiveObjectSet::DeleteObject( Cell * cells, ObjectId id )
 	{
 		assert( count >= 1 );
-		for ( int i = 0; i < count; ++i )
-		{
-			if ( ids[i] == id )
-			{
-				DeleteObject( cells, objects[i] );
-				return;
-			}
-		}
-		assert( false );
+		const int i = FindIndex( id );
+		assert( i >= 0 );
+		DeleteObject( cells, objects[i] );
 	}
 
 	void ActiveObjectSet::DeleteObject( Cell * cells, ActiveObject & activeObject )
 	{
 		assert( count >= 1 );
-		ActiveObject * activeObjects = &objects[0];
-		int i = (int) ( &activeObject - activeObjects );
+		int i = (int) ( &activeObject - &objects[0] );
 		assert( i >= 0 );
 		assert( i < count );
-		int last = count - 1;
-		if ( i != last )
+		Set<ActiveObject>::DeleteObject( i );
+		if ( i < count )
 		{
-			ids[i] = ids[last];
-			activeObjects[i] = activeObjects[last];
 			// IMPORTANT: we must patch up the cell object active id to match new index
-			Cell & cell = cells[activeObjects[i].cellIndex];
-			CellObject & cellObject = cell.GetObject( activeObjects[i].cellObjectIndex );
-			assert( cellObject.id == activeObjects[i].id );
-			assert( cellObject.activeObjectIndex == uint32_t( last ) );
+			Cell & cell = cells[objects[i].cellIndex];
+			CellObject & cellObject = cell.GetObject( objects[i].cellObjectIndex );
+			assert( cellObject.id == objects[i].id );
+			assert( cellObject.activeObjectIndex == uint32_t( count ) );
 			cellObject.activeObjectIndex = i;
 		}
-		count--;
-		if ( count < size/3 )
-			Shrink();
 	}
 
 	ActivationSystem::ActivationSystem( int maxObjects, float radius, int width, int height, float size, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime )
@@ -162,12 +168,41 @@ namespace activation
 		*/
 		
 		assert( maxObjects > 0 );
+		this->maxObjects = maxObjects;
+		this->world = NULL;
+		Initialize( radius, width, height, size, initialObjectsPerCell, initialActiveObjects, deactivationTime );
+		const int numCells = width * height;
+		for ( int i = 0; i < numCells; ++i )
+		{
+			cells[i].resident = true;
+			cells[i].Initialize( initialObjectsPerCell );
+		}
+		idToCellIndex = new int[maxObjects]; 
+		#ifdef DEBUG
+		for ( int i = 0; i < maxObjects; ++i )
+			idToCellIndex[i] = -1;
+		#endif
+	}
+
+	ActivationSystem::ActivationSystem( WorldFile & world, float radius, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime )
+	{
+		assert( world.IsOpen() );
+		this->maxObjects = world.GetObjectCount() + 1;
+		this->world = &world;
+		Initialize( radius, world.GetWidth(), world.GetHeight(), world.GetCellSize(), initialObjectsPerCell, initialActiveObjects, deactivationTime );
+		idToCellIndex = NULL;
+	}
+
+	void ActivationSystem::Initialize( float radius, int width, int height, float size, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime )
+	{
 		assert( width > 0 );
 		assert( height >  0 );
 		assert( size > 0.0f );
-		this->maxObjects = maxObjects;
-		this->activation_x = 0.0f;
-		this->activation_y = 0.0f;
+		this->incremental = true;
+		this->activation_points = 1;
+		this->activation_point_end = 1;
+		this->activation_x[0] = 0.0f;
+		this->activation_y[0] = 0.0f;
 		this->activation_radius = radius;
 		this->activation_radius_squared = radius * radius;
 		this->width = width;
@@ -196,17 +231,13 @@ namespace activation
 				cell.y1 = fy;
 				cell.x2 = fx + size;
 				cell.y2 = fy + size;
-				cell.Initialize( initialObjectsPerCell );
+				cell.resident = false;
+				cell.visitors = 0;
 				fx += size;
 				++index;
 			}
 			fy += size;
 		}
-		idToCellIndex = new int[maxObjects]; 
-		#ifdef DEBUG
-		for ( int i = 0; i < maxObjects; ++i )
-			idToCellIndex[i] = -1;
-		#endif
 		enabled = true;
 		enabled_last_frame = false;
 		active_objects.Allocate( initialActiveObjects );
@@ -251,69 +282,234 @@ namespace activation
 			else
 				++i;
 		}
+		if ( world )
+			EvictCells();
 	}
 
 	void ActivationSystem::ActivateObjectsInsideCircle()
 	{
-		// determine grid cells to inspect...
-		int ix1 = (int) math::floor( ( activation_x - activation_radius + bound_x ) * inverse_size ) - 1;
-		int ix2 = (int) math::floor( ( activation_x + activation_radius + bound_x ) * inverse_size ) + 1;
-		int iy1 = (int) math::floor( ( activation_y - activation_radius + bound_y ) * inverse_size ) - 1;
-		int iy2 = (int) math::floor( ( activation_y + activation_radius + bound_y ) * inverse_size ) + 1;
+		for ( int i = 0; i < activation_point_end; ++i )
+		{
+			if ( HasActivationPoint( i ) )
+				ActivateObjectsInsideCircle( i );
+		}
+		Validate();
+	}
+
+	void ActivationSystem::ActivateObjectsInsideCircle( int index )
+	{
+		const float x = activation_x[index];
+		const float y = activation_y[index];
+		int ix1, iy1, ix2, iy2;
+		GetCellBounds( x, y, ix1, iy1, ix2, iy2 );
+		for ( int iy = iy1; iy <= iy2; ++iy )
+		{
+			if ( incremental )
+			{
+				RowCoverage row;
+				GetRowCoverage( iy, x, y, row );
+				ix1 = row.touch_x1;
+				ix2 = row.touch_x2;
+			}
+			for ( int ix = ix1; ix <= ix2; ++ix )
+				UpdateCell( cells[iy*width+ix], index );
+		}
+	}
+
+	void ActivationSystem::ReleaseObjectsInsideCircle( int index, float x, float y )
+	{
+		int ix1, iy1, ix2, iy2;
+		GetCellBounds( x, y, ix1, iy1, ix2, iy2 );
+		for ( int iy = iy1; iy <= iy2; ++iy )
+		{
+			if ( incremental )
+			{
+				RowCoverage row;
+				GetRowCoverage( iy, x, y, row );
+				ix1 = row.touch_x1;
+				ix2 = row.touch_x2;
+			}
+			for ( int ix = ix1; ix <= ix2; ++ix )
+				ReleaseCell( cells[iy*width+ix], index );
+		}
+	}
+
+	void ActivationSystem::DeactivateAllObjects()
+	{
+		for ( int i = 0; i < active_objects.GetCount(); ++i )
+		{
+			ActiveObject & activeObject = active_objects.GetObject( i );
+			activeObject.activationMask = 0;
+			if ( !activeObject.pendingDeactivation )
+				QueueObjectForDeactivation( activeObject );
+		}
+	}
+
+	void ActivationSystem::GetCellBounds( float x, float y, int & ix1, int & iy1, int & ix2, int & iy2 ) const
+	{
+		// one cell of slack each side so objects in cells outside the bounds are always outside the circle
+		ix1 = (int) math::floor( ( x - activation_radius + bound_x ) * inverse_size ) - 1;
+		ix2 = (int) math::floor( ( x + activation_radius + bound_x ) * inverse_size ) + 1;
+		iy1 = (int) math::floor( ( y - activation_radius + bound_y ) * inverse_size ) - 1;
+		iy2 = (int) math::floor( ( y + activation_radius + bound_y ) * inverse_size ) + 1;
 		ix1 = math::clamp( ix1, 0, width - 1 );
 		ix2 = math::clamp( ix2, 0, width - 1 );
 		iy1 = math::clamp( iy1, 0, height - 1 );
 		iy2 = math::clamp( iy2, 0, height - 1 );
-		// iterate over grid cells and activate objects inside activation circle
-		int index = iy1 * width + ix1;
-		int stride = width - ( ix2 - ix1 + 1 );
-		for ( int iy = iy1; iy <= iy2; ++iy )
+	}
+
+	void ActivationSystem::GetRowCoverage( int iy, float x, float y, RowCoverage & row ) const
+	{
+		row.touch_x1 = width;
+		row.touch_x2 = -1;
+		row.inside_x1 = width;
+		row.inside_x2 = -1;
+
+		// objects sit in the cell containing them give or take float error, so pad cells a little.
+		// touching cells get an extra column each side, inside cells lose one, so both stay conservative
+		const float epsilon = size * 0.01f;
+		const Cell & cell = cells[iy*width];
+		const float y1 = cell.y1 - epsilon - y;
+		const float y2 = cell.y2 + epsilon - y;
+		const float nearest_y = y1 > 0.0f ? y1 : ( y2 < 0.0f ? -y2 : 0.0f );
+		if ( nearest_y * nearest_y >= activation_radius_squared )
+			return;
+		const float touch = math::sqrt( activation_radius_squared - nearest_y * nearest_y );
+		row.touch_x1 = math::clamp( (int) math::floor( ( x - touch + bound_x ) * inverse_size ) - 1, 0, width - 1 );
+		row.touch_x2 = math::clamp( (int) math::floor( ( x + touch + bound_x ) * inverse_size ) + 1, 0, width - 1 );
+
+		const float farthest_y = math::maximum( -y1, y2 );
+		if ( farthest_y * farthest_y >= activation_radius_squared )
+			return;
+		const float inside = math::sqrt( activation_radius_squared - farthest_y * farthest_y );
+		row.inside_x1 = (int) math::floor( ( x - inside + epsilon + bound_x ) * inverse_size ) + 1;
+		row.inside_x2 = (int) math::floor( ( x + inside - epsilon + bound_x ) * inverse_size ) - 1;
+	}
+
+	void ActivationSystem::UpdateCell( Cell & cell, int index )
+	{
+		const float x = activation_x[index];
+		const float y = activation_y[index];
+		if ( !cell.resident )
+			LoadCell( cell );
+		const uint32_t mask = 1U << index;
+		const CellObject * objects = cell.objects.GetObjectArray();
+		const int count = cell.objects.GetCount();
+		uint32_t inside = 0;
+		for ( int i = 0; i < count; ++i )
 		{
-			assert( iy >= 0 );
-			assert( iy < height );
-			for ( int ix = ix1; ix <= ix2; ++ix )
+			// distance test the next four objects together, but handle them one at a time so events stay in cell order
+			if ( ( i & 3 ) == 0 )
 			{
-				assert( ix >= 0 );
-				assert( ix < width );
-				assert( index == iy * width + ix );
-				Cell & cell = cells[index++];
-				for ( int i = 0; i < cell.objects.GetCount(); ++i )
+				if ( i + 4 <= count )
+					inside = CellObjectsInsideCircle( objects + i, x, y, activation_radius_squared );
+				else
 				{
-					CellObject & cellObject = cell.objects.GetObject( i );
-					const float dx = cellObject.x - activation_x;
-					const float dy = cellObject.y - activation_y;
-					const float distanceSquared = dx*dx + dy*dy;
-					if ( distanceSquared < activation_radius_squared && !cellObject.disabled )
+					inside = 0;
+					for ( int j = i; j < count; ++j )
 					{
-						if ( !cellObject.active )
-						{
-							ActivateObject( cellObject, cell );
-						}
-						else
-						{
-							ActiveObject & activeObject = active_objects.GetObject( cellObject.activeObjectIndex );
-							activeObject.pendingDeactivation = false;
-						}
+						const float dx = objects[j].x - x;
+						const float dy = objects[j].y - y;
+						if ( dx*dx + dy*dy < activation_radius_squared )
+							inside |= 1U << ( j - i );
 					}
 				}
 			}
-			index += stride;
+			CellObject & cellObject = cell.objects.GetObject( i );
+			if ( ( inside & ( 1U << ( i & 3 ) ) ) && !cellObject.disabled )
+			{
+				if ( !cellObject.active )
+				{
+					ActivateObject( cellObject, cell );
+				}
+				else
+				{
+					ActiveObject & activeObject = active_objects.GetObject( cellObject.activeObjectIndex );
+					activeObject.activationMask |= mask;
+					activeObject.pendingDeactivation = false;
+				}
+			}
+			else if ( cellObject.active )
+			{
+				ReleaseObject( active_objects.GetObject( cellObject.activeObjectIndex ), mask );
+			}
 		}
-		Validate();
 	}
 
-	void ActivationSystem::DeactivateAllObjects()
+	void ActivationSystem::ReleaseCell( Cell & cell, int index )
 	{
-		for ( int i = 0; i < active_objects.GetCount(); ++i )
+		// cells that aren't loaded have no active objects
+		if ( !cell.resident )
+			return;
+		const uint32_t mask = 1U << index;
+		for ( int i = 0; i < cell.objects.GetCount(); ++i )
 		{
-			ActiveObject & activeObject = active_objects.GetObject( i );
-			if ( !activeObject.pendingDeactivation )
-				QueueObjectForDeactivation( activeObject );
+			CellObject & cellObject = cell.objects.GetObject( i );
+			if ( cellObject.active )
+				ReleaseObject( active_objects.GetObject( cellObject.activeObjectIndex ), mask );
+		}
+	}
+
+	uint32_t ActivationSystem::GetActivationMask( float x, float y ) const
+	{
+		uint32_t mask = 0;
+		for ( int i = 0; i < activation_point_end; ++i )
+		{
+			if ( !HasActivationPoint( i ) )
+				continue;
+			const float dx = x - activation_x[i];
+			const float dy = y - activation_y[i];
+			const float distanceSquared = dx*dx + dy*dy;
+			if ( distanceSquared < activation_radius_squared )
+				mask |= 1U << i;
 		}
+		return mask;
 	}
 
-	void ActivationSystem::MoveActivationPoint( float new_x, float new_y )
+	void ActivationSystem::ReleaseObject( ActiveObject & activeObject, uint32_t mask )
 	{
+		if ( ( activeObject.activationMask & mask ) == 0 )
+			return;
+		activeObject.activationMask &= ~mask;
+		if ( activeObject.activationMask == 0 && !activeObject.pendingDeactivation )
+			QueueObjectForDeactivation( activeObject );
+	}
+
+	void ActivationSystem::AddActivationPoint( int index, float x, float y )
+	{
+		assert( index >= 0 );
+		assert( index < MaxActivationPoints );
+		assert( !HasActivationPoint( index ) );
+
+		activation_points |= 1U << index;
+		activation_point_end = core::max( activation_point_end, index + 1 );
+		activation_x[index] = math::clamp( x, -bound_x, +bound_x );
+		activation_y[index] = math::clamp( y, -bound_y, +bound_y );
+
+		if ( enabled )
+			ActivateObjectsInsideCircle( index );
+
+		Validate();
+	}
+
+	void ActivationSystem::RemoveActivationPoint( int index )
+	{
+		assert( HasActivationPoint( index ) );
+
+		if ( enabled )
+			ReleaseObjectsInsideCircle( index, activation_x[index], activation_y[index] );
+
+		activation_points &= ~( 1U << index );
+		while ( activation_point_end > 0 && !HasActivationPoint( activation_point_end - 1 ) )
+			activation_point_end--;
+
+		Validate();
+	}
+
+	void ActivationSystem::MoveActivationPoint( int index, float new_x, float new_y )
+	{
+		assert( HasActivationPoint( index ) );
+
 		Validate();
 		
 		// clamp in bounds
@@ -324,54 +520,75 @@ namespace activation
 		if ( !enabled )
 			return;
 			
-		const float old_x = activation_x;
-		const float old_y = activation_y;
+		const float old_x = activation_x[index];
+		const float old_y = activation_y[index];
+
+		// objects only change activation as they move, so a point standing still costs nothing
+		if ( new_x == old_x && new_y == old_y )
+			return;
 
-		// if there is no overlap between new and old,
-		// then we can take a shortcut and just deactivate old circle
-		// and activate the new circle...
-		if ( math::abs( new_x - old_x ) > activation_radius || math::abs( new_y - old_y ) > activation_radius )
+		int old_ix1, old_iy1, old_ix2, old_iy2;
+		int new_ix1, new_iy1, new_ix2, new_iy2;
+		GetCellBounds( old_x, old_y, old_ix1, old_iy1, old_ix2, old_iy2 );
+		GetCellBounds( new_x, new_y, new_ix1, new_iy1, new_ix2, new_iy2 );
+
+		// IMPORTANT: update the position first, objects activated below test against every point
+		activation_x[index] = new_x;
+		activation_y[index] = new_y;
+
+		// if there is no overlap between new and old bounds,
+		// then we can take a shortcut: release everything in the old
+		// circle and activate the new circle...
+		if ( new_ix1 > old_ix2 || old_ix1 > new_ix2 || new_iy1 > old_iy2 || old_iy1 > new_iy2 )
 		{
-			DeactivateAllObjects();
-			activation_x = new_x;
-			activation_y = new_y;
-			ActivateObjectsInsideCircle();
+			ReleaseObjectsInsideCircle( index, old_x, old_y );
+			ActivateObjectsInsideCircle( index );
 			Validate();
 			return;
 		}
 		
-		// new and old activation regions overlap
-		// first, we determine which grid cells to inspect...
-		int ix1,ix2;
-		if ( new_x > old_x )
-		{
-			ix1 = (int) math::floor( ( old_x - activation_radius + bound_x ) * inverse_size ) - 1;
-			ix2 = (int) math::floor( ( new_x + activation_radius + bound_x ) * inverse_size ) + 1;
-		}
-		else
-		{
-			ix1 = (int) math::floor( ( new_x - activation_radius + bound_x ) * inverse_size ) - 1;
-			ix2 = (int) math::floor( ( old_x + activation_radius + bound_x ) * inverse_size ) + 1;
-		}
-		int iy1,iy2;
-		if ( new_y > old_y )
-		{
-			iy1 = (int) math::floor( ( old_y - activation_radius + bound_y ) * inverse_size ) - 1;
-			iy2 = (int) math::floor( ( new_y + activation_radius + bound_y ) * inverse_size ) + 1;
-		}
-		else
+		// new and old bounds overlap. cells leaving the bounds release this point's
+		// references without a distance test, cells entering or staying are tested
+		const int ix1 = core::min( old_ix1, new_ix1 );
+		const int ix2 = core::max( old_ix2, new_ix2 );
+		const int iy1 = core::min( old_iy1, new_iy1 );
+		const int iy2 = core::max( old_iy2, new_iy2 );
+
+		// in incremental mode, only the ring of cells whose coverage changed is visited, row by row:
+		// cells entirely inside both circles or touching neither can't change. this relies on objects
+		// inside the old circle already being active, so it waits until the system has updated once.
+		// cells are visited in the same order either way, so events come out in the same order
+		if ( incremental && enabled_last_frame )
 		{
-			iy1 = (int) math::floor( ( new_y - activation_radius + bound_y ) * inverse_size ) - 1;
-			iy2 = (int) math::floor( ( old_y + activation_radius + bound_y ) * inverse_size ) + 1;
+			for ( int iy = iy1; iy <= iy2; ++iy )
+			{
+				RowCoverage new_row, old_row;
+				GetRowCoverage( iy, new_x, new_y, new_row );
+				GetRowCoverage( iy, old_x, old_y, old_row );
+				const int skip_x1 = core::max( new_row.inside_x1, old_row.inside_x1 );
+				const int skip_x2 = core::min( new_row.inside_x2, old_row.inside_x2 );
+				const int row_x1 = core::min( new_row.touch_x1, old_row.touch_x1 );
+				const int row_x2 = core::max( new_row.touch_x2, old_row.touch_x2 );
+				for ( int ix = row_x1; ix <= row_x2; ++ix )
+				{
+					if ( ix >= skip_x1 && ix <= skip_x2 )
+					{
+						ix = skip_x2;
+						continue;
+					}
+					Cell & cell = cells[iy*width+ix];
+					if ( ix >= new_row.touch_x1 && ix <= new_row.touch_x2 )
+						UpdateCell( cell, index );
+					else if ( ix >= old_row.touch_x1 && ix <= old_row.touch_x2 )
+						ReleaseCell( cell, index );
+				}
+			}
+			Validate();
+			return;
 		}
-		ix1 = math::clamp( ix1, 0, width - 1 );
-		ix2 = math::clamp( ix2, 0, width - 1 );
-		iy1 = math::clamp( iy1, 0, height - 1 );
-		iy2 = math::clamp( iy2, 0, height - 1 );
-		
-		// iterate over grid cells and activate/deactivate objects
-		int index = iy1 * width + ix1;
-		int stride = width - ( ix2 - ix1 + 1 );
+
+		int cellIndex = iy1 * width + ix1;
+		const int stride = width - ( ix2 - ix1 + 1 );
 		for ( int iy = iy1; iy <= iy2; ++iy )
 		{
 			assert( iy >= 0 );
@@ -380,41 +597,16 @@ namespace activation
 			{
 				assert( ix >= 0 );
 				assert( ix < width );
-				assert( index == iy * width + ix );
-				Cell & cell = cells[index++];
-				for ( int i = 0; i < cell.objects.GetCount(); ++i )
-				{
-					CellObject & cellObject = cell.objects.GetObject( i );
-					const float dx = cellObject.x - new_x;
-					const float dy = cellObject.y - new_y;
-					const float distanceSquared = dx*dx + dy*dy;
-					if ( distanceSquared < activation_radius_squared && !cellObject.disabled )
-					{
-						if ( !cellObject.active )
-						{
-							ActivateObject( cellObject, cell );
-						}
-						else
-						{
-							ActiveObject & activeObject = active_objects.GetObject( cellObject.activeObjectIndex );
-							activeObject.pendingDeactivation = false;						
-						}
-					}
-					else if ( cellObject.active )
-					{
-						ActiveObject & activeObject = active_objects.GetObject( cellObject.activeObjectIndex );
-						if ( !activeObject.pendingDeactivation )
-							QueueObjectForDeactivation( activeObject );
-					}
-				}
+				assert( cellIndex == iy * width + ix );
+				Cell & cell = cells[cellIndex++];
+				if ( ix >= new_ix1 && ix <= new_ix2 && iy >= new_iy1 && iy <= new_iy2 )
+					UpdateCell( cell, index );
+				else if ( ix >= old_ix1 && ix <= old_ix2 && iy >= old_iy1 && iy <= old_iy2 )
+					ReleaseCell( cell, index );
 			}
-			index += stride;
+			cellIndex += stride;
 		}
 		
-		// update position
-		activation_x = new_x;
-		activation_y = new_y;
-		
 		Validate();
 	}
 	
@@ -424,13 +616,18 @@ namespace activation
 		assert( x <= + bound_x );
 		assert( y >= - bound_y );
 		assert( y <= + bound_y );
+		// objects in a world file are already there
+		assert( !world );
 		Cell * cell = CellAtPosition( x, y );
 		assert( cell );
-		cell->InsertObject( cells, active_objects.GetObjectArray(), id, x, y );
 		#ifdef DEBUG
 		assert( idToCellIndex[id] == -1 );
 		#endif
-		idToCellIndex[id] = (int) ( cell - &cells[0] );
+		CellObject & cellObject = InsertCellObject( *cell, id, x, y );
+
+		// once running, activation points don't rescan cells they already cover
+		if ( enabled && enabled_last_frame && GetActivationMask( x, y ) )
+			ActivateObject( cellObject, *cell );
 	}
 	
 	void ActivationSystem::MoveObject( ObjectId id, float x, float y )
@@ -458,6 +655,7 @@ namespace activation
 		ActiveObject * activeObject = &active_objects.GetObject( activeIndex );
 		ObjectId id = activeObject->id;
 		Cell * currentCell = &cells[activeObject->cellIndex];
+		assert( currentCell->resident );
 		CellObject * cellObject = currentCell->FindObject( id );
 		assert( cellObject );
 
@@ -477,13 +675,16 @@ namespace activation
 		}
 		else
 		{
+			// load the new cell before the object leaves, so loading doesn't find it there too
+			if ( !newCell->resident )
+				LoadCell( *newCell );
+
 			// remove from current cell
-			currentCell->DeleteObject( active_objects.GetObjectArray(), *cellObject );
+			DeleteCellObject( *currentCell, *cellObject );
 
 			// add to new cell
 			currentCell = newCell;
-			cellObject = &currentCell->InsertObject( cells, active_objects.GetObjectArray(), id, new_x, new_y );
-			idToCellIndex[id] = (int) ( currentCell - cells );
+			cellObject = &InsertCellObject( *currentCell, id, new_x, new_y );
 
 			// update active object
 			cellObject->active = 1;
@@ -498,10 +699,8 @@ namespace activation
 		#endif
 
 		// see if the object needs to be deactivated
-		const float dx = new_x - activation_x;
-		const float dy = new_y - activation_y;
-		const float distanceSquared = dx*dx + dy*dy;
-		if ( distanceSquared > activation_radius_squared )
+		activeObject->activationMask = cellObject->disabled ? 0 : GetActivationMask( new_x, new_y );
+		if ( activeObject->activationMask == 0 )
 		{
 			if ( !activeObject->pendingDeactivation )
 				QueueObjectForDeactivation( *activeObject );
@@ -521,7 +720,7 @@ namespace activation
 		CellObject * cellObject = NULL;
 
 		// inactive object
-		currentCell = &cells[idToCellIndex[id]];
+		currentCell = &GetObjectCell( id );
 		cellObject = currentCell->FindObject( id );
 		assert( cellObject );
 		#ifdef VALIDATION
@@ -539,18 +738,25 @@ namespace activation
 		}
 		else
 		{
+			// load the new cell before the object leaves, so loading doesn't find it there too
+			if ( !newCell->resident )
+				LoadCell( *newCell );
+
 			// remove from current cell
-			currentCell->DeleteObject( active_objects.GetObjectArray(), *cellObject );
+			DeleteCellObject( *currentCell, *cellObject );
 
 			// add to new cell
 			currentCell = newCell;
-			cellObject = &currentCell->InsertObject( cells, active_objects.GetObjectArray(), id, new_x, new_y );
-			idToCellIndex[id] = (int) ( currentCell - cells );
+			cellObject = &InsertCellObject( *currentCell, id, new_x, new_y );
 		}
 		
 		#ifdef VALIDATION
 		Cell::ValidateCellObject( cells, active_objects.GetObjectArray(), *cellObject );
 		#endif
+
+		// activate if it moved into an activation circle
+		if ( enabled && enabled_last_frame && !cellObject->disabled && GetActivationMask( new_x, new_y ) )
+			ActivateObject( *cellObject, *currentCell );
 	}
 	
 	ActiveObject & ActivationSystem::ActivateObject( CellObject & cellObject, Cell & cell )
@@ -565,12 +771,16 @@ namespace activation
 		activeObject.cellIndex = (int) ( &cell - cells );
 		activeObject.cellObjectIndex = cell.GetCellObjectIndex( cellObject );
 		activeObject.pendingDeactivation = false;
+		activeObject.activationMask = GetActivationMask( cellObject.x, cellObject.y );
 		cellObject.active = 1;
 		cellObject.activeObjectIndex = active_objects.GetActiveObjectIndex( activeObject );
 		#ifdef VALIDATION
 		Cell::ValidateActiveObject( cells, active_objects.GetObjectArray(), activeObject );
 		#endif
 		QueueActivationEvent( cellObject.id );
+		// enabled objects activate even outside every circle, but only until the deactivation time runs out
+		if ( activeObject.activationMask == 0 )
+			QueueObjectForDeactivation( activeObject );
 		return activeObject;
 	}
 
@@ -592,8 +802,7 @@ namespace activation
 
 	void ActivationSystem::EnableObject( ObjectId objectId )
 	{
-		const int cellIndex = idToCellIndex[objectId];
- 		Cell & cell = cells[cellIndex];
+		Cell & cell = GetObjectCell( objectId );
 		CellObject * cellObject = cell.FindObject( objectId );
 		assert( cellObject );
 		cellObject->disabled = 0;
@@ -602,12 +811,19 @@ namespace activation
 			// activate object
 			ActivateObject( *cellObject, cell );			
 		}
+		else
+		{
+			// cancel the pending deactivation from being disabled if the object is still inside a circle
+			ActiveObject & activeObject = active_objects.GetObject( cellObject->activeObjectIndex );
+			activeObject.activationMask = GetActivationMask( cellObject->x, cellObject->y );
+			if ( activeObject.activationMask )
+				activeObject.pendingDeactivation = false;
+		}
 	}
 	
 	void ActivationSystem::DisableObject( ObjectId objectId )
 	{
-		const int cellIndex = idToCellIndex[objectId];
- 		Cell & cell = cells[cellIndex];
+		Cell & cell = GetObjectCell( objectId );
 		CellObject * cellObject = cell.FindObject( objectId );
 		assert( cellObject );
 		cellObject->disabled = 1;
@@ -616,11 +832,153 @@ namespace activation
 			// deactivate object
 			ActiveObject * activeObject = active_objects.FindObject( objectId );
 			assert( activeObject );
+			activeObject->activationMask = 0;
 			if ( !activeObject->pendingDeactivation )
 				QueueObjectForDeactivation( *activeObject );
 		}
 	}
 
+	CellObject & ActivationSystem::InsertCellObject( Cell & cell, ObjectId id, float x, float y )
+	{
+		assert( cell.resident );
+		const int cellIndex = (int) ( &cell - cells );
+		if ( world )
+		{
+			const WorldObject & object = world->GetObject( id );
+			if ( object.homeCellIndex != uint32_t( cellIndex ) )
+				cell.visitors++;
+			if ( object.cellIndex != uint32_t( cellIndex ) )
+				world->ModifyObject( id ).cellIndex = cellIndex;
+		}
+		else
+			idToCellIndex[id] = cellIndex;
+		return cell.InsertObject( cells, active_objects.GetObjectArray(), id, x, y );
+	}
+
+	void ActivationSystem::DeleteCellObject( Cell & cell, CellObject & cellObject )
+	{
+		if ( world && world->GetObject( cellObject.id ).homeCellIndex != uint32_t( &cell - cells ) )
+		{
+			assert( cell.visitors > 0 );
+			cell.visitors--;
+		}
+		cell.DeleteObject( active_objects.GetObjectArray(), cellObject );
+	}
+
+	void ActivationSystem::LoadCell( Cell & cell )
+	{
+		assert( world );
+		assert( !cell.resident );
+
+		// objects that started here and haven't moved to another cell. objects that moved
+		// here from other cells pin this cell, so it was never evicted while they are in it
+
+		const int cellIndex = (int) ( &cell - cells );
+		ObjectId first;
+		int count;
+		world->GetCellObjects( cellIndex, first, count );
+		cell.Initialize( core::max( initial_objects_per_cell, count ) );
+		cell.resident = true;
+		for ( ObjectId id = first + 1; id <= first + count; ++id )
+		{
+			const WorldObject & object = world->GetObject( id );
+			if ( object.cellIndex != uint32_t( cellIndex ) )
+				continue;
+			CellObject & cellObject = cell.InsertObject( cells, active_objects.GetObjectArray(), id, object.x, object.y );
+			cellObject.disabled = object.disabled;
+		}
+
+		resident_cells.push_back( cellIndex );
+		stream_stats.cellsLoaded++;
+		stream_stats.objectsLoaded += cell.GetObjectCount();
+		stream_stats.residentCells++;
+		stream_stats.residentObjects += cell.GetObjectCount();
+		stream_stats.peakResidentCells = core::max( stream_stats.peakResidentCells, stream_stats.residentCells );
+		stream_stats.peakResidentObjects = core::max( stream_stats.peakResidentObjects, stream_stats.residentObjects );
+	}
+
+	void ActivationSystem::EvictCells()
+	{
+		assert( world );
+
+		int ix1[MaxActivationPoints], iy1[MaxActivationPoints], ix2[MaxActivationPoints], iy2[MaxActivationPoints];
+		int numPoints = 0;
+		if ( enabled )
+		{
+			for ( int i = 0; i < activation_point_end; ++i )
+			{
+				if ( !HasActivationPoint( i ) )
+					continue;
+				GetCellBounds( activation_x[i], activation_y[i], ix1[numPoints], iy1[numPoints], ix2[numPoints], iy2[numPoints] );
+				ix1[numPoints] -= StreamMargin;
+				iy1[numPoints] -= StreamMargin;
+				ix2[numPoints] += StreamMargin;
+				iy2[numPoints] += StreamMargin;
+				numPoints++;
+			}
+		}
+
+		stream_stats.pinnedCells = 0;
+
+		int numResident = 0;
+		for ( int i = 0; i < (int) resident_cells.size(); ++i )
+		{
+			const int cellIndex = resident_cells[i];
+			Cell & cell = cells[cellIndex];
+
+			bool keep = false;
+			if ( cell.visitors > 0 )
+			{
+				stream_stats.pinnedCells++;
+				keep = true;
+			}
+			for ( int j = 0; j < numPoints && !keep; ++j )
+			{
+				if ( cell.ix >= ix1[j] && cell.ix <= ix2[j] && cell.iy >= iy1[j] && cell.iy <= iy2[j] )
+					keep = true;
+			}
+			for ( int j = 0; j < cell.GetObjectCount() && !keep; ++j )
+			{
+				if ( cell.GetObject( j ).active )
+					keep = true;
+			}
+
+			if ( keep )
+			{
+				resident_cells[numResident++] = cellIndex;
+				continue;
+			}
+
+			// every object left in the cell started here, so the file entries are all that's needed to load it again.
+			// only objects that changed are written, and those back the way the file has them leave the overlay
+
+			const int count = cell.GetObjectCount();
+			for ( int j = 0; j < count; ++j )
+			{
+				const CellObject & cellObject = cell.GetObject( j );
+				const WorldObject & object = world->GetObject( cellObject.id );
+				assert( object.cellIndex == uint32_t( cellIndex ) );
+				assert( object.homeCellIndex == uint32_t( cellIndex ) );
+				if ( object.x != cellObject.x || object.y != cellObject.y || object.disabled != cellObject.disabled )
+				{
+					WorldObject & changed = world->ModifyObject( cellObject.id );
+					changed.x = cellObject.x;
+					changed.y = cellObject.y;
+					changed.disabled = cellObject.disabled;
+				}
+				world->Revert( cellObject.id );
+			}
+			cell.objects.Free();
+			cell.resident = false;
+
+			stream_stats.cellsEvicted++;
+			stream_stats.objectsEvicted += count;
+			stream_stats.residentCells--;
+			stream_stats.residentObjects -= count;
+		}
+		resident_cells.resize( numResident );
+	}
+
 	void ActivationSystem::QueueObjectForDeactivation( ActiveObject & activeObject, bool immediate )
 	{
 		assert( !activeObject.pendingDeactivation );
@@ -628,6 +986,57 @@ namespace activation
 		activeObject.pendingDeactivationTime = immediate ? deactivationTime : 0.0f;
 	}
 	
+	void ActivationSystem::SaveState( State & state ) const
+	{
+		state.enabled = enabled;
+		state.enabledLastFrame = enabled_last_frame;
+		state.activationPoints = activation_points;
+		state.activationPointEnd = activation_point_end;
+		memcpy( state.x, activation_x, sizeof( activation_x ) );
+		memcpy( state.y, activation_y, sizeof( activation_y ) );
+		state.activeObjects.assign( active_objects.GetObjectArray(), active_objects.GetObjectArray() + active_objects.GetCount() );
+		state.events = activation_events;
+	}
+
+	void ActivationSystem::RestoreState( const State & state )
+	{
+		enabled = state.enabled;
+		enabled_last_frame = state.enabledLastFrame;
+		activation_points = state.activationPoints;
+		activation_point_end = state.activationPointEnd;
+		memcpy( activation_x, state.x, sizeof( activation_x ) );
+		memcpy( activation_y, state.y, sizeof( activation_y ) );
+
+		for ( int i = 0; i < active_objects.GetCount(); ++i )
+		{
+			const ActiveObject & activeObject = active_objects.GetObject( i );
+			CellObject & cellObject = cells[activeObject.cellIndex].GetObject( activeObject.cellObjectIndex );
+			cellObject.active = 0;
+			cellObject.activeObjectIndex = 0;
+		}
+
+		active_objects.Clear();
+
+		// objects come back in the cells they are in now. disabling isn't rolled back, so an
+		// object may come back disabled: it is pending deactivation again once it moves
+
+		for ( int i = 0; i < (int) state.activeObjects.size(); ++i )
+		{
+			const ActiveObject & saved = state.activeObjects[i];
+			Cell & cell = GetObjectCell( saved.id );
+			CellObject * cellObject = cell.FindObject( saved.id );
+			assert( cellObject );
+			ActiveObject & activeObject = active_objects.InsertObject( saved.id );
+			activeObject = saved;
+			activeObject.cellIndex = (int) ( &cell - cells );
+			activeObject.cellObjectIndex = cell.GetCellObjectIndex( *cellObject );
+			cellObject->active = 1;
+			cellObject->activeObjectIndex = i;
+		}
+
+		activation_events = state.events;
+	}
+
 	int ActivationSystem::GetEventCount()
 	{
 		return (int) activation_events.size();
@@ -652,6 +1061,8 @@ namespace activation
 		for ( int i = 0; i < size; ++i )
 		{
 			Cell & cell = cells[i];
+			if ( !cell.resident )
+				continue;
 			for ( int j = 0; j < cell.GetObjectCount(); ++j )
 			{
 				CellObject & cellObject = cell.GetObject(j);
@@ -664,12 +1075,104 @@ namespace activation
 			Cell::ValidateActiveObject( cells, active_objects.GetObjectArray(), activeObject );
 			Cell & cell = cells[activeObject.cellIndex];
 			CellObject & cellObject = cell.GetObject( activeObject.cellObjectIndex );
-			const float dx = cellObject.x - activation_x;
-			const float dy = cellObject.y - activation_y;
-			const float distanceSquared = dx*dx + dy*dy;
-			assert( !activeObject.pendingDeactivation && distanceSquared <= activation_radius_squared + 0.001f ||
-			         activeObject.pendingDeactivation && distanceSquared >= activation_radius_squared - 0.001f );
+			if ( enabled && enabled_last_frame )
+				assert( activeObject.activationMask == ( cellObject.disabled ? 0 : GetActivationMask( cellObject.x, cellObject.y ) ) );
+			assert( activeObject.activationMask != 0 || activeObject.pendingDeactivation );
 		}
 		#endif
 	}
+
+	ProximityGrid::ProximityGrid( float cellSize )
+	{
+		assert( cellSize > 0.0f );
+		this->cellSize = cellSize;
+		inverseCellSize = 1.0f / cellSize;
+		bucketMask = 0;
+	}
+
+	void ProximityGrid::Begin( int count )
+	{
+		assert( count >= 0 );
+
+		int numBuckets = 64;
+		while ( numBuckets < count * 2 )
+			numBuckets *= 2;
+
+		bucketMask = numBuckets - 1;
+		objectBucket.resize( count );
+		bucketStart.assign( numBuckets + 1, 0 );
+		entries.resize( count );
+	}
+
+	void ProximityGrid::Insert( int index, float x, float y )
+	{
+		assert( index >= 0 );
+		assert( index < (int) objectBucket.size() );
+		const int ix = (int) floorf( x * inverseCellSize );
+		const int iy = (int) floorf( y * inverseCellSize );
+		const int bucket = GetBucket( ix, iy );
+		objectBucket[index] = bucket;
+		bucketStart[bucket+1]++;
+	}
+
+	void ProximityGrid::End()
+	{
+		// counting sort object indices by bucket. indices stay in increasing order within each bucket
+
+		const int numBuckets = bucketMask + 1;
+		for ( int i = 0; i < numBuckets; ++i )
+			bucketStart[i+1] += bucketStart[i];
+
+		bucketOffset.assign( bucketStart.begin(), bucketStart.end() - 1 );
+		for ( int i = 0; i < (int) objectBucket.size(); ++i )
+			entries[bucketOffset[objectBucket[i]]++] = i;
+	}
+
+	void ProximityGrid::Query( float x, float y, float radius, std::vector<int> & indices ) const
+	{
+		indices.clear();
+
+		if ( objectBucket.empty() )
+			return;
+
+		// pad the query square so objects right on a cell boundary are never missed due to rounding
+
+		const float r = radius + cellSize * 0.01f;
+		const int ix0 = (int) floorf( ( x - r ) * inverseCellSize );
+		const int iy0 = (int) floorf( ( y - r ) * inverseCellSize );
+		const int ix1 = (int) floorf( ( x + r ) * inverseCellSize );
+		const int iy1 = (int) floorf( ( y + r ) * inverseCellSize );
+
+		assert( ( ix1 - ix0 + 1 ) * ( iy1 - iy0 + 1 ) <= MaxQueryCells );
+
+		// different cells can hash to the same bucket. visit each bucket once so no object is returned twice
+
+		int visited[MaxQueryCells];
+		int numVisited = 0;
+
+		for ( int iy = iy0; iy <= iy1; ++iy )
+		{
+			for ( int ix = ix0; ix <= ix1; ++ix )
+			{
+				const int bucket = GetBucket( ix, iy );
+
+				bool seen = false;
+				for ( int i = 0; i < numVisited; ++i )
+				{
+					if ( visited[i] == bucket )
+					{
+						seen = true;
+						break;
+					}
+				}
+				if ( seen )
+					continue;
+
+				visited[numVisited++] = bucket;
+
+				for ( int i = bucketStart[bucket]; i < bucketStart[bucket+1]; ++i )
+					indices.push_back( entries[i] );
+			}
+		}
+	}
 }
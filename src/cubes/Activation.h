@@ -27,11 +27,12 @@
 
 #include "Config.h"
 #include "Mathematics.h"
+#include "WorldFile.h"
+#include "core/Core.h"
 #include <vector>
 
 namespace activation
 {
-	typedef uint32_t ObjectId;
 	typedef uint32_t ActiveId;
 
 	/*
@@ -41,10 +42,10 @@ namespace activation
 	
 	struct CellObject
 	{
-		uint32_t id : 20;
+		uint32_t id : 30;
 		uint32_t active : 1;
 		uint32_t disabled : 1;
-		uint32_t activeObjectIndex : 10;
+		uint32_t activeObjectIndex;						// not packed: with one activation circle per player there can be many thousands of active objects
 		float x,y;
 		#ifdef VALIDATION
  		int cellIndex;
@@ -62,16 +63,20 @@ namespace activation
 	};
 
 	/*
-		Objects inside the player activation circle are activated.
+		Objects inside a player activation circle are activated.
 		This is the activation system data per active object.
+		The activation mask has one bit set for each activation circle
+		containing the object, so it acts as a reference count: the object
+		is queued for deactivation when the last circle lets go of it.
 	*/
 	
 	struct ActiveObject
 	{
- 		uint32_t id : 20;
+ 		uint32_t id : 31;
+		uint32_t pendingDeactivation : 1;
 		uint32_t cellIndex : 20;
  		uint32_t cellObjectIndex : 12;
-		uint32_t pendingDeactivation : 1;
+		uint32_t activationMask;
 		float pendingDeactivationTime;					// TODO - convert to n bits frame counter
 
 		#ifdef VALIDATION
@@ -79,6 +84,7 @@ namespace activation
 		{
 			id = 0;
 			pendingDeactivation = 0;
+			activationMask = 0;
 			pendingDeactivationTime = 0;
 			cellIndex = 0;
 			cellObjectIndex = 0;
@@ -100,6 +106,7 @@ namespace activation
 		{
 			count = 0;
 			size = 0;
+			minimumSize = 0;
 			ids = NULL;
 			objects = NULL;
 		}
@@ -116,7 +123,9 @@ namespace activation
 			ids = new uint32_t[initialSize];
 			objects = new T[initialSize];
 			size = initialSize;
+			minimumSize = initialSize;
 			count = 0;
+			idIndex.Rebuild( ids, count, size );
 		}
 		
 		void Free()
@@ -124,6 +133,8 @@ namespace activation
 			delete [] objects;
 			delete [] ids;
 			objects = NULL;
+			ids = NULL;
+			idIndex.Free();
 			count = 0;
 			size = 0;
 		}
@@ -131,6 +142,7 @@ namespace activation
 		void Clear()
 		{
 			count = 0;
+			idIndex.Clear();
 		}
 
  		T & InsertObject( ObjectId id )
@@ -138,21 +150,16 @@ namespace activation
 			if ( count >= size )
 				Grow();
 			ids[count] = id;
+			idIndex.Insert( id, count );
 			return objects[count++];
 		}
 
 		void DeleteObject( ObjectId id )
 		{
 			assert( count >= 1 );
-			for ( int i = 0; i < count; ++i )
-			{
-				if ( objects[i].id == id )
-				{
-					DeleteObject( i );
-					return;
-				}
-			}
-			assert( false );
+			const int index = FindIndex( id );
+			assert( index >= 0 );
+			DeleteObject( index );
 		}
 		
 		void DeleteObject( T * object )
@@ -169,13 +176,16 @@ namespace activation
 			assert( index >= 0 );
 			assert( index < count );
 			int last = count - 1;
+			idIndex.Delete( ids, index, last );
 			if ( index != last )
 			{
 				ids[index] = ids[last];
 				objects[index] = objects[last];
 			}
 			count--;
-			if ( count < size/3 )
+
+			// shrink at a quarter full, so it takes doubling the count again to grow back
+			if ( count < size/4 && size/2 >= minimumSize )
 				Shrink();
 		}
 
@@ -190,20 +200,28 @@ namespace activation
 			return objects[index];
 		}
 
+		ObjectId GetId( int index ) const
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			return ids[index];
+		}
+
+		int FindIndex( ObjectId id ) const
+		{
+			return idIndex.Find( ids, count, id );
+		}
+
  		T * FindObject( ObjectId id )
 		{
-			for ( int i = 0; i < count; ++i )
-				if ( ids[i] == id )
-					return &objects[i];
-			return NULL;
+			const int index = FindIndex( id );
+			return index >= 0 ? &objects[index] : NULL;
 		}
 
 	 	const T * FindObject( ObjectId id ) const
 		{
-			for ( int i = 0; i < count; ++i )
-				if ( ids[i] == id )
-					return &objects[i];
-			return NULL;
+			const int index = FindIndex( id );
+			return index >= 0 ? &objects[index] : NULL;
 		}
 
 		int GetCount() const
@@ -218,7 +236,7 @@ namespace activation
 		
 		int GetBytes() const
 		{
-			return sizeof(T) * size;
+			return ( sizeof(T) + sizeof(uint32_t) ) * size + idIndex.GetBytes();
 		}
 		
 	protected:
@@ -235,6 +253,7 @@ namespace activation
 			memcpy( &objects[0], &oldObjects[0], sizeof(T)*count );
 			delete[] oldIds;
 			delete[] oldObjects;
+			idIndex.Rebuild( ids, count, size );
 		}
 
 		void Shrink()
@@ -251,12 +270,15 @@ namespace activation
 			memcpy( &objects[0], &oldObjects[0], sizeof(T)*count );
 			delete[] oldIds;
 			delete[] oldObjects;
+			idIndex.Rebuild( ids, count, size );
 		}
 
 		int count;
 		int size;
+		int minimumSize;
 		uint32_t * ids;
 		T * objects;
+		IdIndex idIndex;
 	};
 
 	/*
@@ -299,6 +321,8 @@ namespace activation
 		#endif
 		int ix,iy;
 		float x1,y1,x2,y2;
+		bool resident;						// objects are loaded. always true unless streaming from a world file
+		int visitors;						// objects in this cell that started in another cell
 		CellObjectSet objects;
 
 	#ifdef DEBUG
@@ -374,6 +398,11 @@ namespace activation
 		{
 			return &objects[0];
 		}
+
+		const ActiveObject * GetObjectArray() const
+		{
+			return &objects[0];
+		}
 		
 		int GetActiveObjectIndex( ActiveObject & activeObject )
 		{
@@ -402,25 +431,112 @@ namespace activation
 		uint32_t id : 31;
 	};
 
+	/*
+		Uniform grid over active object positions, rebuilt each frame.
+		Radius queries only visit the cells overlapping the query square.
+		Cells hash into a power of two bucket table, so results may include
+		objects outside the radius: callers must do their own distance test.
+		Each object index is returned at most once per query.
+		Query radius must span no more than MaxQueryCells cells.
+	*/
+
+	class ProximityGrid
+	{
+	public:
+
+		enum { MaxQueryCells = 64 };
+
+		ProximityGrid( float cellSize = 2.0f );
+
+		void Begin( int count );
+
+		void Insert( int index, float x, float y );
+
+		void End();
+
+		void Query( float x, float y, float radius, std::vector<int> & indices ) const;
+
+	private:
+
+		int GetBucket( int ix, int iy ) const
+		{
+			const uint32_t hash = ( uint32_t( ix ) * 73856093U ) ^ ( uint32_t( iy ) * 19349663U );
+			return int( hash & bucketMask );
+		}
+
+		float cellSize;
+		float inverseCellSize;
+		uint32_t bucketMask;
+		std::vector<int> objectBucket;
+		std::vector<int> bucketStart;
+		std::vector<int> bucketOffset;
+		std::vector<int> entries;
+	};
+
+	/*
+		Counters for cells streamed in from a world file.
+		A cell is pinned while it holds objects that started in
+		another cell, since the file can't tell us they are there.
+	*/
+
+	struct StreamStats
+	{
+		uint64_t cellsLoaded;
+		uint64_t cellsEvicted;
+		uint64_t objectsLoaded;
+		uint64_t objectsEvicted;
+		int residentCells;
+		int residentObjects;
+		int peakResidentCells;
+		int peakResidentObjects;
+		int pinnedCells;
+
+		StreamStats()
+		{
+			memset( this, 0, sizeof( StreamStats ) );
+		}
+	};
+
 	/*
 		The activation system tracks which objects are in each grid cell,
-		and maintains the set of active objects for the local player.
+		and maintains the set of active objects for up to MaxActivationPoints
+		activation points, eg. one per player. The active set is the union
+		of all activation circles. Activation point zero exists from the start.
+		When an activation point moves, cells that leave its bounding box only
+		release references and need no distance test.
+
+		Constructed from a world file, the grid starts empty. Cells load their
+		objects the first time an activation point reaches them, and are evicted
+		again once every point has moved away and none of their objects are active.
 	*/
 	
 	class ActivationSystem
 	{
 	public:
 
+		enum { MaxActivationPoints = 32 };
+
 		typedef std::vector<Event> Events;
 
+		// cells beyond the bounds of every activation point by more than this many cells are evicted
+		enum { StreamMargin = 1 };
+
 		ActivationSystem( int maxObjects, float radius, int width, int height, float size, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime = 0.0f );
+		ActivationSystem( WorldFile & world, float radius, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime = 0.0f );
 		~ActivationSystem();
 
 		void SetEnabled( bool enabled );
 		
 		void Update( float deltaTime );
 
-		void MoveActivationPoint( float new_x, float new_y );
+		void MoveActivationPoint( float new_x, float new_y )
+		{
+			MoveActivationPoint( 0, new_x, new_y );
+		}
+
+		void AddActivationPoint( int index, float x, float y );
+		void RemoveActivationPoint( int index );
+		void MoveActivationPoint( int index, float new_x, float new_y );
 		
 		void InsertObject( ObjectId id, float x, float y );
 
@@ -440,6 +556,31 @@ namespace activation
 
 		void QueueObjectForDeactivation( ActiveObject & activeObject, bool immediate = false );
 
+		/*
+			Active set for rollback: the activation points, each active object
+			with its activation mask and pending deactivation timer, in order,
+			and the events not yet handled. Restoring rebuilds the active set as
+			it was without raising events, so active indices match the saved
+			ones and whoever follows the events must restore its own copy.
+			Cell positions are not part of it, move active objects afterwards.
+		*/
+
+		struct State
+		{
+			bool enabled;
+			bool enabledLastFrame;
+			uint32_t activationPoints;
+			int activationPointEnd;
+			float x[MaxActivationPoints];
+			float y[MaxActivationPoints];
+			std::vector<ActiveObject> activeObjects;
+			Events events;
+		};
+
+		void SaveState( State & state ) const;
+
+		void RestoreState( const State & state );
+
 		int GetEventCount();
 
 		const Event & GetEvent( int index );
@@ -466,14 +607,23 @@ namespace activation
 			position.y = math::clamp( position.y, -bound_y, +bound_y );
 		}
 		
-		float GetX() const
+		bool HasActivationPoint( int index ) const
+		{
+			assert( index >= 0 );
+			assert( index < MaxActivationPoints );
+			return ( activation_points & ( 1U << index ) ) != 0;
+		}
+
+		float GetX( int index = 0 ) const
 		{
-			return activation_x;
+			assert( HasActivationPoint( index ) );
+			return activation_x[index];
 		}
 
-		float GetY() const
+		float GetY( int index = 0 ) const
 		{
-			return activation_y;
+			assert( HasActivationPoint( index ) );
+			return activation_y[index];
 		}
 
 		int GetActiveCount() const
@@ -485,6 +635,12 @@ namespace activation
 		{
 			return active_objects.FindObject( id ) != NULL;
 		}
+
+		int GetReferenceCount( ObjectId id ) const
+		{
+			const ActiveObject * activeObject = active_objects.FindObject( id );
+			return activeObject ? (int) core::popcount( activeObject->activationMask ) : 0;
+		}
 		
 		bool IsPendingDeactivation( int activeIndex )
 		{
@@ -502,6 +658,15 @@ namespace activation
 			return &cells[index];
 		}
 
+		const Cell * GetCellAtIndex( int ix, int iy ) const
+		{
+			assert( ix >= 0 );
+			assert( iy >= 0 );
+			assert( ix < width );
+			assert( iy < height );
+			return &cells[ix + iy * width];
+		}
+
 		int GetWidth() const
 		{
 			return width;
@@ -521,9 +686,38 @@ namespace activation
 		{
 			return enabled;
 		}
+
+		// incremental updates only visit cells whose coverage changes as an activation point moves.
+		// turning it off visits every cell in the bounding boxes, with identical results
+		void SetIncremental( bool _incremental )
+		{
+			incremental = _incremental;
+		}
+
+		bool IsIncremental() const
+		{
+			return incremental;
+		}
+
+		bool IsStreaming() const
+		{
+			return world != NULL;
+		}
+
+		const StreamStats & GetStreamStats() const
+		{
+			return stream_stats;
+		}
 		
 		int GetBytes() const
 		{
+			if ( world )
+			{
+				int bytes = sizeof( ActivationSystem ) + width * height * sizeof( Cell ) + (int) resident_cells.size() * sizeof( int );
+				for ( int i = 0; i < (int) resident_cells.size(); ++i )
+					bytes += cells[resident_cells[i]].objects.GetBytes();
+				return bytes;
+			}
 			return sizeof( ActivationSystem ) + width * height * ( sizeof( Cell ) + sizeof( CellObject ) * initial_objects_per_cell ) + maxObjects * sizeof( int );
 		}
 
@@ -542,10 +736,56 @@ namespace activation
 
 	protected:
 
+		void Initialize( float radius, int width, int height, float size, int initialObjectsPerCell, int initialActiveObjects, float deactivationTime );
+
 		void ActivateObjectsInsideCircle();
 
+		void ActivateObjectsInsideCircle( int index );
+
+		void ReleaseObjectsInsideCircle( int index, float x, float y );
+
 		void DeactivateAllObjects();
 
+		void GetCellBounds( float x, float y, int & ix1, int & iy1, int & ix2, int & iy2 ) const;
+
+		struct RowCoverage
+		{
+			int touch_x1, touch_x2;				// cells in the row that may hold objects inside the circle
+			int inside_x1, inside_x2;			// cells in the row entirely inside the circle
+		};
+
+		void GetRowCoverage( int iy, float x, float y, RowCoverage & row ) const;
+
+		void UpdateCell( Cell & cell, int index );
+
+		void ReleaseCell( Cell & cell, int index );
+
+		uint32_t GetActivationMask( float x, float y ) const;
+
+		void ReleaseObject( ActiveObject & activeObject, uint32_t mask );
+
+		CellObject & InsertCellObject( Cell & cell, ObjectId id, float x, float y );
+
+		void DeleteCellObject( Cell & cell, CellObject & cellObject );
+
+		void LoadCell( Cell & cell );
+
+		void EvictCells();
+
+		int GetObjectCellIndex( ObjectId id ) const
+		{
+			return world ? (int) world->GetObject( id ).cellIndex : idToCellIndex[id];
+		}
+
+		// the cell an object is in, loading it if necessary
+		Cell & GetObjectCell( ObjectId id )
+		{
+			Cell & cell = cells[GetObjectCellIndex( id )];
+			if ( !cell.resident )
+				LoadCell( cell );
+			return cell;
+		}
+
 		Cell * CellAtPosition( float x, float y )
 		{
 			assert( x >= -bound_x );
@@ -574,14 +814,17 @@ namespace activation
 		}
 
 		bool active;
+		bool incremental;
 		bool enabled;
 		bool enabled_last_frame;
 		int width;
 		int height;
 		int maxObjects;
 		int initial_objects_per_cell;
-		float activation_x;
-		float activation_y;
+		uint32_t activation_points;
+		int activation_point_end;
+		float activation_x[MaxActivationPoints];
+		float activation_y[MaxActivationPoints];
 		float activation_radius;
 		float activation_radius_squared;
 		float size;
@@ -591,6 +834,9 @@ namespace activation
 		float bound_y;
 		Cell * cells;
  		int * idToCellIndex;
+		WorldFile * world;
+		std::vector<int> resident_cells;
+		StreamStats stream_stats;
 		Events activation_events;
 		ActiveObjectSet active_objects;
 	};
@@ -0,0 +1,982 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+    The box-box narrowphase below (BoxBoxContacts, IntersectRectQuad and CullPoints) is derived from dBoxBox,
+    intersectRectQuad and cullPoints in ODE's box.cpp. ODE is dual licensed under the GNU Lesser General Public 
+    License v2.1 or later (external/ode/LICENSE.TXT) or a BSD-style license. This code uses it under the BSD-style 
+    license, which follows:
+
+    Open Dynamics Engine, Copyright (C) 2001-2003 Russell L. Smith.
+    All rights reserved.  Email: russ@q12.org   Web: www.q12.org
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+        in the documentation and/or other materials provided with the distribution.
+
+        Neither the names of ODE's copyright owner nor the names of its contributors may be used to endorse or promote products derived 
+        from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "Collision.h"
+#include "vectorial/simd4f.h"
+#include <math.h>
+#include <string.h>
+#include <assert.h>
+
+namespace cubes
+{
+	// lane helpers missing from vectorial. masks are all bits set per true lane on sse, 1.0f elsewhere
+
+	#if defined( VECTORIAL_SSE )
+
+		static inline simd4f lanes_abs( simd4f a ) { return _mm_andnot_ps( _mm_set1_ps( -0.0f ), a ); }
+		static inline simd4f lanes_negate( simd4f a ) { return _mm_xor_ps( _mm_set1_ps( -0.0f ), a ); }
+		static inline simd4f lanes_greater( simd4f a, simd4f b ) { return _mm_cmpgt_ps( a, b ); }
+		static inline simd4f lanes_and( simd4f a, simd4f b ) { return _mm_and_ps( a, b ); }
+		static inline simd4f lanes_or( simd4f a, simd4f b ) { return _mm_or_ps( a, b ); }
+		static inline simd4f lanes_select( simd4f mask, simd4f a, simd4f b ) { return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) ); }
+		static inline bool lanes_all( simd4f mask ) { return _mm_movemask_ps( mask ) == 0xF; }
+		static inline bool lanes_test( const float * mask, int lane ) { int bits; memcpy( &bits, mask + lane, sizeof( int ) ); return bits != 0; }
+
+	#else // #if defined( VECTORIAL_SSE )
+
+		struct lanes_values
+		{
+			float v[4];
+
+			lanes_values( simd4f a ) { simd4f_ustore4( a, v ); }
+
+			operator simd4f() const { return simd4f_uload4( v ); }
+		};
+
+		static inline simd4f lanes_abs( simd4f a ) { lanes_values x( a ); for ( int i = 0; i < 4; ++i ) x.v[i] = fabsf( x.v[i] ); return x; }
+		static inline simd4f lanes_negate( simd4f a ) { lanes_values x( a ); for ( int i = 0; i < 4; ++i ) x.v[i] = -x.v[i]; return x; }
+		static inline simd4f lanes_greater( simd4f a, simd4f b ) { lanes_values x( a ), y( b ); for ( int i = 0; i < 4; ++i ) x.v[i] = x.v[i] > y.v[i] ? 1.0f : 0.0f; return x; }
+		static inline simd4f lanes_and( simd4f a, simd4f b ) { lanes_values x( a ), y( b ); for ( int i = 0; i < 4; ++i ) x.v[i] = ( x.v[i] != 0.0f && y.v[i] != 0.0f ) ? 1.0f : 0.0f; return x; }
+		static inline simd4f lanes_or( simd4f a, simd4f b ) { lanes_values x( a ), y( b ); for ( int i = 0; i < 4; ++i ) x.v[i] = ( x.v[i] != 0.0f || y.v[i] != 0.0f ) ? 1.0f : 0.0f; return x; }
+		static inline simd4f lanes_select( simd4f mask, simd4f a, simd4f b ) { lanes_values m( mask ), x( a ), y( b ); for ( int i = 0; i < 4; ++i ) x.v[i] = m.v[i] != 0.0f ? x.v[i] : y.v[i]; return x; }
+		static inline bool lanes_all( simd4f mask ) { lanes_values x( mask ); return x.v[0] != 0.0f && x.v[1] != 0.0f && x.v[2] != 0.0f && x.v[3] != 0.0f; }
+		static inline bool lanes_test( const float * mask, int lane ) { return mask[lane] != 0.0f; }
+
+	#endif // #if defined( VECTORIAL_SSE )
+
+	// transpose four boxes into lanes: one register per component of position, side and rotation
+
+	static inline void GatherBoxes( const CollisionBox * boxes[4], simd4f position[3], simd4f side[3], simd4f rotation[3][3] )
+	{
+		#if defined( VECTORIAL_SSE )
+
+			simd4f p0 = _mm_loadu_ps( boxes[0]->position ), p1 = _mm_loadu_ps( boxes[1]->position ), p2 = _mm_loadu_ps( boxes[2]->position ), p3 = _mm_loadu_ps( boxes[3]->position );
+			_MM_TRANSPOSE4_PS( p0, p1, p2, p3 );
+			position[0] = p0; position[1] = p1; position[2] = p2;
+
+			simd4f s0 = _mm_loadu_ps( boxes[0]->side ), s1 = _mm_loadu_ps( boxes[1]->side ), s2 = _mm_loadu_ps( boxes[2]->side ), s3 = _mm_loadu_ps( boxes[3]->side );
+			_MM_TRANSPOSE4_PS( s0, s1, s2, s3 );
+			side[0] = s0; side[1] = s1; side[2] = s2;
+
+			for ( int i = 0; i < 3; ++i )
+			{
+				simd4f r0 = _mm_loadu_ps( boxes[0]->rotation + i*4 ), r1 = _mm_loadu_ps( boxes[1]->rotation + i*4 ), r2 = _mm_loadu_ps( boxes[2]->rotation + i*4 ), r3 = _mm_loadu_ps( boxes[3]->rotation + i*4 );
+				_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+				rotation[i][0] = r0; rotation[i][1] = r1; rotation[i][2] = r2;
+			}
+
+		#else // #if defined( VECTORIAL_SSE )
+
+			float values[4];
+			for ( int i = 0; i < 3; ++i )
+			{
+				for ( int lane = 0; lane < 4; ++lane )
+					values[lane] = boxes[lane]->position[i];
+				position[i] = simd4f_uload4( values );
+
+				for ( int lane = 0; lane < 4; ++lane )
+					values[lane] = boxes[lane]->side[i];
+				side[i] = simd4f_uload4( values );
+
+				for ( int j = 0; j < 3; ++j )
+				{
+					for ( int lane = 0; lane < 4; ++lane )
+						values[lane] = boxes[lane]->rotation[i*4+j];
+					rotation[i][j] = simd4f_uload4( values );
+				}
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+	}
+
+	// ---------------------------------------------------------------
+
+	// separating axis test for four box pairs at once. this is the 15 axis test from ode's dBoxBox with the
+	// early outs replaced by masks: every axis is tested in every lane, and a lane is separated if any axis
+	// separates it. the arithmetic is done in the same order as ode's so results match it exactly.
+
+	struct SeparatingAxisLanes
+	{
+		simd4f s;								// penetration along the best axis so far (negative)
+		simd4f code;							// best axis: 1..3 face of a, 4..6 face of b, 7..15 edge pairs
+		simd4f invert;							// best axis points from b to a
+		simd4f normal[3];						// best edge axis relative to a, not yet divided by its length
+		simd4f length;
+		simd4f separated;
+	};
+
+	static inline void TestFaceAxis( SeparatingAxisLanes & sat, simd4f expr1, simd4f expr2, float code )
+	{
+		const simd4f zero = simd4f_zero();
+		const simd4f s2 = simd4f_sub( lanes_abs( expr1 ), expr2 );
+		sat.separated = lanes_or( sat.separated, lanes_greater( s2, zero ) );
+		const simd4f better = lanes_greater( s2, sat.s );
+		sat.s = lanes_select( better, s2, sat.s );
+		sat.code = lanes_select( better, simd4f_splat( code ), sat.code );
+		sat.invert = lanes_select( better, lanes_greater( zero, expr1 ), sat.invert );
+	}
+
+	static inline void TestEdgeAxis( SeparatingAxisLanes & sat, simd4f expr1, simd4f expr2, simd4f n1, simd4f n2, simd4f n3, float code )
+	{
+		// edge axes are not unit length so the penetration is scaled by the axis length. degenerate axes
+		// from parallel edges are skipped, and face axes are preferred unless an edge axis is 5% better
+
+		const simd4f zero = simd4f_zero();
+		const simd4f s2 = simd4f_sub( lanes_abs( expr1 ), expr2 );
+		sat.separated = lanes_or( sat.separated, lanes_greater( s2, zero ) );
+		const simd4f l = simd4f_sqrt( simd4f_add( simd4f_add( simd4f_mul( n1, n1 ), simd4f_mul( n2, n2 ) ), simd4f_mul( n3, n3 ) ) );
+		const simd4f scaled = simd4f_div( s2, l );
+		const simd4f better = lanes_and( lanes_greater( l, zero ), lanes_greater( simd4f_mul( scaled, simd4f_splat( 1.05f ) ), sat.s ) );
+		sat.s = lanes_select( better, scaled, sat.s );
+		sat.code = lanes_select( better, simd4f_splat( code ), sat.code );
+		sat.invert = lanes_select( better, lanes_greater( zero, expr1 ), sat.invert );
+		sat.normal[0] = lanes_select( better, n1, sat.normal[0] );
+		sat.normal[1] = lanes_select( better, n2, sat.normal[1] );
+		sat.normal[2] = lanes_select( better, n3, sat.normal[2] );
+		sat.length = lanes_select( better, l, sat.length );
+	}
+
+	struct SeparatingAxis
+	{
+		bool separated;
+		bool invert;
+		int code;
+		float s;
+		float normal[3];
+	};
+
+	static void SeparatingAxisTest( const CollisionBox * boxes, const CollisionPair * pairs, int count, SeparatingAxis * result )
+	{
+		assert( count >= 1 );
+		assert( count <= 4 );
+
+		// gather into lanes. short batches repeat the last pair so every lane holds valid boxes
+
+		const CollisionBox * a[4];
+		const CollisionBox * b[4];
+		for ( int lane = 0; lane < 4; ++lane )
+		{
+			const CollisionPair & pair = pairs[ lane < count ? lane : count - 1 ];
+			a[lane] = &boxes[pair.a];
+			b[lane] = &boxes[pair.b];
+		}
+
+		simd4f positionA[3], positionB[3], sideA[3], sideB[3], r1[3][3], r2[3][3];
+		GatherBoxes( a, positionA, sideA, r1 );
+		GatherBoxes( b, positionB, sideB, r2 );
+
+		const simd4f half = simd4f_splat( 0.5f );
+
+		simd4f vp[3], vA[3], vB[3];
+		for ( int i = 0; i < 3; ++i )
+		{
+			vp[i] = simd4f_sub( positionB[i], positionA[i] );
+			vA[i] = simd4f_mul( sideA[i], half );
+			vB[i] = simd4f_mul( sideB[i], half );
+		}
+
+		// pp is the vector between centers relative to a. R is the rotation of b relative to a, Q its absolute value
+
+		simd4f pp[3], R[3][3], Q[3][3], pv[3];
+
+		for ( int i = 0; i < 3; ++i )
+		{
+			pp[i] = simd4f_add( simd4f_add( simd4f_mul( r1[0][i], vp[0] ), simd4f_mul( r1[1][i], vp[1] ) ), simd4f_mul( r1[2][i], vp[2] ) );
+			pv[i] = simd4f_add( simd4f_add( simd4f_mul( r2[0][i], vp[0] ), simd4f_mul( r2[1][i], vp[1] ) ), simd4f_mul( r2[2][i], vp[2] ) );
+			for ( int j = 0; j < 3; ++j )
+			{
+				R[i][j] = simd4f_add( simd4f_add( simd4f_mul( r1[0][i], r2[0][j] ), simd4f_mul( r1[1][i], r2[1][j] ) ), simd4f_mul( r1[2][i], r2[2][j] ) );
+				Q[i][j] = lanes_abs( R[i][j] );
+			}
+		}
+
+		SeparatingAxisLanes sat;
+		sat.s = simd4f_splat( -INFINITY );
+		sat.code = simd4f_zero();
+		sat.invert = simd4f_zero();
+		sat.normal[0] = simd4f_zero();
+		sat.normal[1] = simd4f_zero();
+		sat.normal[2] = simd4f_zero();
+		sat.length = simd4f_splat( 1.0f );
+		sat.separated = simd4f_zero();
+
+		#define ADD4( a, b, c, d ) simd4f_add( simd4f_add( simd4f_add( a, b ), c ), d )
+		#define MUL( a, b ) simd4f_mul( a, b )
+		#define NEG( a ) lanes_negate( a )
+
+		const simd4f zero = simd4f_zero();
+
+		// face axes of a, then face axes of b
+
+		TestFaceAxis( sat, pp[0], ADD4( vA[0], MUL( vB[0], Q[0][0] ), MUL( vB[1], Q[0][1] ), MUL( vB[2], Q[0][2] ) ), 1 );
+		TestFaceAxis( sat, pp[1], ADD4( vA[1], MUL( vB[0], Q[1][0] ), MUL( vB[1], Q[1][1] ), MUL( vB[2], Q[1][2] ) ), 2 );
+		TestFaceAxis( sat, pp[2], ADD4( vA[2], MUL( vB[0], Q[2][0] ), MUL( vB[1], Q[2][1] ), MUL( vB[2], Q[2][2] ) ), 3 );
+
+		TestFaceAxis( sat, pv[0], ADD4( MUL( vA[0], Q[0][0] ), MUL( vA[1], Q[1][0] ), MUL( vA[2], Q[2][0] ), vB[0] ), 4 );
+		TestFaceAxis( sat, pv[1], ADD4( MUL( vA[0], Q[0][1] ), MUL( vA[1], Q[1][1] ), MUL( vA[2], Q[2][1] ), vB[1] ), 5 );
+		TestFaceAxis( sat, pv[2], ADD4( MUL( vA[0], Q[0][2] ), MUL( vA[1], Q[1][2] ), MUL( vA[2], Q[2][2] ), vB[2] ), 6 );
+
+		// edges of a crossed with edges of b. parallel edges give the same axis so three per box is enough.
+		// these cost a square root and divide each, so skip them when a face already separates every lane
+
+		if ( !lanes_all( sat.separated ) )
+		{
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[2], R[1][0] ), MUL( pp[1], R[2][0] ) ), ADD4( MUL( vA[1], Q[2][0] ), MUL( vA[2], Q[1][0] ), MUL( vB[1], Q[0][2] ), MUL( vB[2], Q[0][1] ) ), zero, NEG( R[2][0] ), R[1][0], 7 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[2], R[1][1] ), MUL( pp[1], R[2][1] ) ), ADD4( MUL( vA[1], Q[2][1] ), MUL( vA[2], Q[1][1] ), MUL( vB[0], Q[0][2] ), MUL( vB[2], Q[0][0] ) ), zero, NEG( R[2][1] ), R[1][1], 8 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[2], R[1][2] ), MUL( pp[1], R[2][2] ) ), ADD4( MUL( vA[1], Q[2][2] ), MUL( vA[2], Q[1][2] ), MUL( vB[0], Q[0][1] ), MUL( vB[1], Q[0][0] ) ), zero, NEG( R[2][2] ), R[1][2], 9 );
+
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[0], R[2][0] ), MUL( pp[2], R[0][0] ) ), ADD4( MUL( vA[0], Q[2][0] ), MUL( vA[2], Q[0][0] ), MUL( vB[1], Q[1][2] ), MUL( vB[2], Q[1][1] ) ), R[2][0], zero, NEG( R[0][0] ), 10 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[0], R[2][1] ), MUL( pp[2], R[0][1] ) ), ADD4( MUL( vA[0], Q[2][1] ), MUL( vA[2], Q[0][1] ), MUL( vB[0], Q[1][2] ), MUL( vB[2], Q[1][0] ) ), R[2][1], zero, NEG( R[0][1] ), 11 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[0], R[2][2] ), MUL( pp[2], R[0][2] ) ), ADD4( MUL( vA[0], Q[2][2] ), MUL( vA[2], Q[0][2] ), MUL( vB[0], Q[1][1] ), MUL( vB[1], Q[1][0] ) ), R[2][2], zero, NEG( R[0][2] ), 12 );
+
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[1], R[0][0] ), MUL( pp[0], R[1][0] ) ), ADD4( MUL( vA[0], Q[1][0] ), MUL( vA[1], Q[0][0] ), MUL( vB[1], Q[2][2] ), MUL( vB[2], Q[2][1] ) ), NEG( R[1][0] ), R[0][0], zero, 13 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[1], R[0][1] ), MUL( pp[0], R[1][1] ) ), ADD4( MUL( vA[0], Q[1][1] ), MUL( vA[1], Q[0][1] ), MUL( vB[0], Q[2][2] ), MUL( vB[2], Q[2][0] ) ), NEG( R[1][1] ), R[0][1], zero, 14 );
+			TestEdgeAxis( sat, simd4f_sub( MUL( pp[1], R[0][2] ), MUL( pp[0], R[1][2] ) ), ADD4( MUL( vA[0], Q[1][2] ), MUL( vA[1], Q[0][2] ), MUL( vB[0], Q[2][1] ), MUL( vB[1], Q[2][0] ) ), NEG( R[1][2] ), R[0][2], zero, 15 );
+		}
+
+		#undef ADD4
+		#undef MUL
+		#undef NEG
+
+		float s[4], code[4], invert[4], separated[4], normal[3][4];
+		simd4f_ustore4( sat.s, s );
+		simd4f_ustore4( sat.code, code );
+		simd4f_ustore4( sat.invert, invert );
+		simd4f_ustore4( sat.separated, separated );
+		for ( int i = 0; i < 3; ++i )
+			simd4f_ustore4( simd4f_div( sat.normal[i], sat.length ), normal[i] );
+
+		for ( int lane = 0; lane < count; ++lane )
+		{
+			result[lane].separated = lanes_test( separated, lane );
+			result[lane].invert = lanes_test( invert, lane );
+			result[lane].code = (int) code[lane];
+			result[lane].s = s[lane];
+			result[lane].normal[0] = normal[0][lane];
+			result[lane].normal[1] = normal[1][lane];
+			result[lane].normal[2] = normal[2][lane];
+		}
+	}
+
+	// ---------------------------------------------------------------
+
+	// clip the quadrilateral p against the rectangle centered on the origin with half sizes h. returns the
+	// number of points written to ret, 0 to 8. this and CullPoints are ode's intersectRectQuad and cullPoints
+
+	static int IntersectRectQuad( const float h[2], float p[8], float ret[16] )
+	{
+		int nq = 4, nr = 0;
+		float buffer[16];
+		float * q = p;
+		float * r = ret;
+		for ( int dir = 0; dir <= 1; dir++ )
+		{
+			for ( int sign = -1; sign <= 1; sign += 2 )
+			{
+				// chop q along the line xy[dir] = sign*h[dir]
+				float * pq = q;
+				float * pr = r;
+				nr = 0;
+				for ( int i = nq; i > 0; i-- )
+				{
+					if ( sign * pq[dir] < h[dir] )
+					{
+						pr[0] = pq[0];
+						pr[1] = pq[1];
+						pr += 2;
+						nr++;
+						if ( nr & 8 )
+						{
+							q = r;
+							goto done;
+						}
+					}
+					float * nextq = ( i > 1 ) ? pq + 2 : q;
+					if ( ( sign * pq[dir] < h[dir] ) ^ ( sign * nextq[dir] < h[dir] ) )
+					{
+						// this edge crosses the chopping line
+						pr[1-dir] = pq[1-dir] + ( nextq[1-dir] - pq[1-dir] ) / ( nextq[dir] - pq[dir] ) * ( sign * h[dir] - pq[dir] );
+						pr[dir] = sign * h[dir];
+						pr += 2;
+						nr++;
+						if ( nr & 8 )
+						{
+							q = r;
+							goto done;
+						}
+					}
+					pq += 2;
+				}
+				q = r;
+				r = ( q == ret ) ? buffer : ret;
+				nq = nr;
+			}
+		}
+	done:
+		if ( q != ret )
+			memcpy( ret, q, nr * 2 * sizeof( float ) );
+		return nr;
+	}
+
+	// pick m of the n points in p that best spread around their centroid, starting with point i0
+
+	static void CullPoints( int n, const float p[], int m, int i0, int iret[] )
+	{
+		float a, cx, cy, q;
+		if ( n == 1 )
+		{
+			cx = p[0];
+			cy = p[1];
+		}
+		else if ( n == 2 )
+		{
+			cx = 0.5f * ( p[0] + p[2] );
+			cy = 0.5f * ( p[1] + p[3] );
+		}
+		else
+		{
+			a = 0;
+			cx = 0;
+			cy = 0;
+			for ( int i = 0; i < n - 1; i++ )
+			{
+				q = p[i*2] * p[i*2+3] - p[i*2+2] * p[i*2+1];
+				a += q;
+				cx += q * ( p[i*2] + p[i*2+2] );
+				cy += q * ( p[i*2+1] + p[i*2+3] );
+			}
+			q = p[n*2-2] * p[1] - p[0] * p[n*2-1];
+			a = 1.0f / ( 3.0f * ( a + q ) );
+			cx = a * ( cx + q * ( p[n*2-2] + p[0] ) );
+			cy = a * ( cy + q * ( p[n*2-1] + p[1] ) );
+		}
+
+		float A[8];
+		for ( int i = 0; i < n; i++ )
+			A[i] = atan2f( p[i*2+1] - cy, p[i*2] - cx );
+
+		// search for points that have angles closest to A[i0] + i*(2*pi/m)
+
+		int avail[8];
+		for ( int i = 0; i < n; i++ )
+			avail[i] = 1;
+		avail[i0] = 0;
+		iret[0] = i0;
+		iret++;
+		for ( int j = 1; j < m; j++ )
+		{
+			a = (float) ( double( float( j ) ) * ( 2 * M_PI / m ) + A[i0] );
+			if ( a > M_PI )
+				a -= (float) ( 2 * M_PI );
+			float maxdiff = 1e9f;
+			for ( int i = 0; i < n; i++ )
+			{
+				if ( avail[i] )
+				{
+					float diff = fabsf( A[i] - a );
+					if ( diff > M_PI )
+						diff = (float) ( 2 * M_PI - diff );
+					if ( diff < maxdiff )
+					{
+						maxdiff = diff;
+						*iret = i;
+					}
+				}
+			}
+			avail[*iret] = 0;
+			iret++;
+		}
+	}
+
+	static inline float Dot44( const float * a, const float * b )
+	{
+		return a[0] * b[0] + a[4] * b[4] + a[8] * b[8];
+	}
+
+	static inline float Dot14( const float * a, const float * b )
+	{
+		return a[0] * b[0] + a[1] * b[4] + a[2] * b[8];
+	}
+
+	static inline float Dot( const float * a, const float * b )
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+
+	// generate the contact points for a pair of boxes the separating axis test found to be touching.
+	// normal points from a to b here, it is flipped to ode's convention by the caller
+
+	static int BoxBoxContacts( const CollisionBox & box1, const CollisionBox & box2, const SeparatingAxis & sat, int maxContacts, float normal[3], CollisionContact * contacts )
+	{
+		const float * p1 = box1.position;
+		const float * p2 = box2.position;
+		const float * R1 = box1.rotation;
+		const float * R2 = box2.rotation;
+
+		const float A[3] = { box1.side[0] * 0.5f, box1.side[1] * 0.5f, box1.side[2] * 0.5f };
+		const float B[3] = { box2.side[0] * 0.5f, box2.side[1] * 0.5f, box2.side[2] * 0.5f };
+
+		const int code = sat.code;
+
+		if ( code <= 3 )
+		{
+			normal[0] = R1[code-1];
+			normal[1] = R1[4+code-1];
+			normal[2] = R1[8+code-1];
+		}
+		else if ( code <= 6 )
+		{
+			normal[0] = R2[code-4];
+			normal[1] = R2[4+code-4];
+			normal[2] = R2[8+code-4];
+		}
+		else
+		{
+			normal[0] = Dot( R1, sat.normal );
+			normal[1] = Dot( R1 + 4, sat.normal );
+			normal[2] = Dot( R1 + 8, sat.normal );
+		}
+
+		if ( sat.invert )
+		{
+			normal[0] = -normal[0];
+			normal[1] = -normal[1];
+			normal[2] = -normal[2];
+		}
+
+		const float depth = -sat.s;
+
+		if ( code > 6 )
+		{
+			// an edge of a touches an edge of b. find a point on each edge, then the closest points between the edges
+
+			float pa[3], pb[3];
+			for ( int i = 0; i < 3; i++ )
+				pa[i] = p1[i];
+			for ( int j = 0; j < 3; j++ )
+			{
+				const float sign = ( Dot14( normal, R1 + j ) > 0 ) ? 1.0f : -1.0f;
+				for ( int i = 0; i < 3; i++ )
+					pa[i] += sign * A[j] * R1[i*4+j];
+			}
+
+			for ( int i = 0; i < 3; i++ )
+				pb[i] = p2[i];
+			for ( int j = 0; j < 3; j++ )
+			{
+				const float sign = ( Dot14( normal, R2 + j ) > 0 ) ? -1.0f : 1.0f;
+				for ( int i = 0; i < 3; i++ )
+					pb[i] += sign * B[j] * R2[i*4+j];
+			}
+
+			float ua[3], ub[3];
+			for ( int i = 0; i < 3; i++ )
+				ua[i] = R1[( code - 7 ) / 3 + i*4];
+			for ( int i = 0; i < 3; i++ )
+				ub[i] = R2[( code - 7 ) % 3 + i*4];
+
+			const float p[3] = { pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2] };
+			const float uaub = Dot( ua, ub );
+			const float q1 = Dot( ua, p );
+			const float q2 = -Dot( ub, p );
+			float alpha = 0, beta = 0;
+			float d = 1 - uaub * uaub;
+			if ( d > 0.0001f )
+			{
+				d = 1.0f / d;
+				alpha = ( q1 + uaub * q2 ) * d;
+				beta = ( uaub * q1 + q2 ) * d;
+			}
+
+			for ( int i = 0; i < 3; i++ )
+				pa[i] += ua[i] * alpha;
+			for ( int i = 0; i < 3; i++ )
+				pb[i] += ub[i] * beta;
+			for ( int i = 0; i < 3; i++ )
+				contacts[0].position[i] = 0.5f * ( pa[i] + pb[i] );
+			contacts[0].depth = depth;
+			return 1;
+		}
+
+		// a face of one box is the reference face, the closest face of the other box is the incident face.
+		// normal2 points out of the reference box
+
+		const float *Ra, *Rb, *pa, *pb, *Sa, *Sb;
+		float normal2[3];
+		if ( code <= 3 )
+		{
+			Ra = R1; Rb = R2;
+			pa = p1; pb = p2;
+			Sa = A; Sb = B;
+			normal2[0] = normal[0];
+			normal2[1] = normal[1];
+			normal2[2] = normal[2];
+		}
+		else
+		{
+			Ra = R2; Rb = R1;
+			pa = p2; pb = p1;
+			Sa = B; Sb = A;
+			normal2[0] = -normal[0];
+			normal2[1] = -normal[1];
+			normal2[2] = -normal[2];
+		}
+
+		float nr[3], anr[3];
+		nr[0] = Rb[0] * normal2[0] + Rb[4] * normal2[1] + Rb[8] * normal2[2];
+		nr[1] = Rb[1] * normal2[0] + Rb[5] * normal2[1] + Rb[9] * normal2[2];
+		nr[2] = Rb[2] * normal2[0] + Rb[6] * normal2[1] + Rb[10] * normal2[2];
+		anr[0] = fabsf( nr[0] );
+		anr[1] = fabsf( nr[1] );
+		anr[2] = fabsf( nr[2] );
+
+		// the largest component of anr is the incident face normal, a1 and a2 are its other two axes
+
+		int lanr, a1, a2;
+		if ( anr[1] > anr[0] )
+		{
+			if ( anr[1] > anr[2] )
+			{
+				a1 = 0; lanr = 1; a2 = 2;
+			}
+			else
+			{
+				a1 = 0; a2 = 1; lanr = 2;
+			}
+		}
+		else
+		{
+			if ( anr[0] > anr[2] )
+			{
+				lanr = 0; a1 = 1; a2 = 2;
+			}
+			else
+			{
+				a1 = 0; a2 = 1; lanr = 2;
+			}
+		}
+
+		// center of the incident face, relative to the reference box
+
+		float center[3];
+		if ( nr[lanr] < 0 )
+		{
+			for ( int i = 0; i < 3; i++ )
+				center[i] = pb[i] - pa[i] + Sb[lanr] * Rb[i*4+lanr];
+		}
+		else
+		{
+			for ( int i = 0; i < 3; i++ )
+				center[i] = pb[i] - pa[i] - Sb[lanr] * Rb[i*4+lanr];
+		}
+
+		const int codeN = ( code <= 3 ) ? code - 1 : code - 4;
+		const int code1 = ( codeN == 0 ) ? 1 : 0;
+		const int code2 = ( codeN == 2 ) ? 1 : 2;
+
+		// the four corners of the incident face in the reference face's 2d coordinates
+
+		float quad[8];
+		const float c1 = Dot14( center, Ra + code1 );
+		const float c2 = Dot14( center, Ra + code2 );
+		float m11 = Dot44( Ra + code1, Rb + a1 );
+		float m12 = Dot44( Ra + code1, Rb + a2 );
+		float m21 = Dot44( Ra + code2, Rb + a1 );
+		float m22 = Dot44( Ra + code2, Rb + a2 );
+		{
+			const float k1 = m11 * Sb[a1];
+			const float k2 = m21 * Sb[a1];
+			const float k3 = m12 * Sb[a2];
+			const float k4 = m22 * Sb[a2];
+			quad[0] = c1 - k1 - k3;
+			quad[1] = c2 - k2 - k4;
+			quad[2] = c1 - k1 + k3;
+			quad[3] = c2 - k2 + k4;
+			quad[4] = c1 + k1 + k3;
+			quad[5] = c2 + k2 + k4;
+			quad[6] = c1 + k1 - k3;
+			quad[7] = c2 + k2 - k4;
+		}
+
+		const float rect[2] = { Sa[code1], Sa[code2] };
+
+		float ret[16];
+		const int n = IntersectRectQuad( rect, quad, ret );
+		if ( n < 1 )
+			return 0;
+
+		// back to 3d, four clipped points at a time across lanes, then keep only the points below the
+		// reference face. ret is compacted to match
+
+		float x[8], y[8], z[8], d[8];
+		const float det1 = 1.0f / ( m11 * m22 - m12 * m21 );
+		m11 *= det1;
+		m12 *= det1;
+		m21 *= det1;
+		m22 *= det1;
+		{
+			const simd4f vc1 = simd4f_splat( c1 ), vc2 = simd4f_splat( c2 );
+			const simd4f vm11 = simd4f_splat( m11 ), vm12 = simd4f_splat( m12 ), vm21 = simd4f_splat( -m21 ), vm22 = simd4f_splat( m22 );
+			const simd4f depth0 = simd4f_splat( Sa[codeN] );
+			simd4f vcenter[3], u[3], v[3], vnormal[3];
+			for ( int i = 0; i < 3; i++ )
+			{
+				vcenter[i] = simd4f_splat( center[i] );
+				u[i] = simd4f_splat( Rb[i*4+a1] );
+				v[i] = simd4f_splat( Rb[i*4+a2] );
+				vnormal[i] = simd4f_splat( normal2[i] );
+			}
+
+			for ( int j = n; j < ( ( n + 3 ) & ~3 ); j++ )
+			{
+				ret[j*2] = c1;
+				ret[j*2+1] = c2;
+			}
+
+			for ( int j = 0; j < n; j += 4 )
+			{
+				float rx[4], ry[4];
+				for ( int k = 0; k < 4; ++k )
+				{
+					rx[k] = ret[j*2+k*2];
+					ry[k] = ret[j*2+k*2+1];
+				}
+				const simd4f dx = simd4f_sub( simd4f_uload4( rx ), vc1 );
+				const simd4f dy = simd4f_sub( simd4f_uload4( ry ), vc2 );
+				const simd4f k1 = simd4f_sub( simd4f_mul( vm22, dx ), simd4f_mul( vm12, dy ) );
+				const simd4f k2 = simd4f_add( simd4f_mul( vm21, dx ), simd4f_mul( vm11, dy ) );
+				simd4f p[3];
+				for ( int i = 0; i < 3; i++ )
+					p[i] = simd4f_add( simd4f_add( vcenter[i], simd4f_mul( k1, u[i] ) ), simd4f_mul( k2, v[i] ) );
+				const simd4f dot = simd4f_add( simd4f_add( simd4f_mul( vnormal[0], p[0] ), simd4f_mul( vnormal[1], p[1] ) ), simd4f_mul( vnormal[2], p[2] ) );
+				simd4f_ustore4( p[0], x + j );
+				simd4f_ustore4( p[1], y + j );
+				simd4f_ustore4( p[2], z + j );
+				simd4f_ustore4( simd4f_sub( depth0, dot ), d + j );
+			}
+		}
+
+		float point[3*8];
+		float dep[8];
+		int cnum = 0;
+		for ( int j = 0; j < n; j++ )
+		{
+			if ( d[j] >= 0 )
+			{
+				point[cnum*3+0] = x[j];
+				point[cnum*3+1] = y[j];
+				point[cnum*3+2] = z[j];
+				dep[cnum] = d[j];
+				ret[cnum*2] = ret[j*2];
+				ret[cnum*2+1] = ret[j*2+1];
+				cnum++;
+			}
+		}
+		if ( cnum < 1 )
+			return 0;
+
+		int maxc = maxContacts;
+		if ( maxc > cnum )
+			maxc = cnum;
+		if ( maxc < 1 )
+			maxc = 1;
+
+		if ( cnum <= maxc )
+		{
+			for ( int j = 0; j < cnum; j++ )
+			{
+				for ( int i = 0; i < 3; i++ )
+					contacts[j].position[i] = point[j*3+i] + pa[i];
+				contacts[j].depth = dep[j];
+			}
+			return cnum;
+		}
+
+		// more points than wanted. keep the deepest and the ones spread furthest around it
+
+		int i1 = 0;
+		float maxdepth = dep[0];
+		for ( int i = 1; i < cnum; i++ )
+		{
+			if ( dep[i] > maxdepth )
+			{
+				maxdepth = dep[i];
+				i1 = i;
+			}
+		}
+
+		int iret[8];
+		CullPoints( cnum, ret, maxc, i1, iret );
+
+		for ( int j = 0; j < maxc; j++ )
+		{
+			for ( int i = 0; i < 3; i++ )
+				contacts[j].position[i] = point[iret[j]*3+i] + pa[i];
+			contacts[j].depth = dep[iret[j]];
+		}
+		return maxc;
+	}
+
+	void CollideBoxes( const CollisionBox * boxes, const CollisionPair * pairs, int numPairs, int maxContacts, CollisionManifold * manifolds )
+	{
+		assert( boxes );
+		assert( pairs || numPairs == 0 );
+		assert( maxContacts >= 1 );
+
+		for ( int base = 0; base < numPairs; base += 4 )
+		{
+			const int count = ( numPairs - base < 4 ) ? numPairs - base : 4;
+
+			SeparatingAxis sat[4];
+			SeparatingAxisTest( boxes, pairs + base, count, sat );
+
+			for ( int i = 0; i < count; ++i )
+			{
+				CollisionManifold & manifold = manifolds[base+i];
+
+				if ( sat[i].separated || sat[i].code == 0 )
+				{
+					manifold.numContacts = 0;
+					continue;
+				}
+
+				const CollisionPair & pair = pairs[base+i];
+
+				float normal[3];
+				manifold.numContacts = BoxBoxContacts( boxes[pair.a], boxes[pair.b], sat[i], maxContacts, normal, manifold.contacts );
+				manifold.normal[0] = -normal[0];
+				manifold.normal[1] = -normal[1];
+				manifold.normal[2] = -normal[2];
+			}
+		}
+	}
+
+	// ---------------------------------------------------------------
+
+	void CollideBoxesWithPlanes( const CollisionBox * boxes, const CollisionPlane * planes, const CollisionPair * pairs, int numPairs, int maxContacts, CollisionManifold * manifolds )
+	{
+		assert( boxes );
+		assert( planes || numPairs == 0 );
+		assert( pairs || numPairs == 0 );
+		assert( maxContacts >= 1 );
+
+		// not more than 4 contacts per box, the corners of the face lying deepest in the plane
+
+		const int maxc = maxContacts < 4 ? maxContacts : 4;
+
+		for ( int base = 0; base < numPairs; base += 4 )
+		{
+			const int count = ( numPairs - base < 4 ) ? numPairs - base : 4;
+
+			// project the sides onto the plane normal and find the depth and position of the deepest corner,
+			// four boxes at a time. this matches ode's dCollideBoxPlane up to choosing the remaining corners
+
+			float n[3][4], pos[3][4], side[3][4], R[3][3][4], d[4];
+
+			for ( int lane = 0; lane < 4; ++lane )
+			{
+				const CollisionPair & pair = pairs[base + ( lane < count ? lane : count - 1 )];
+				const CollisionBox & box = boxes[pair.a];
+				const CollisionPlane & plane = planes[pair.b];
+				d[lane] = plane.d;
+				for ( int i = 0; i < 3; ++i )
+				{
+					n[i][lane] = plane.normal[i];
+					pos[i][lane] = box.position[i];
+					side[i][lane] = box.side[i];
+					for ( int j = 0; j < 3; ++j )
+						R[i][j][lane] = box.rotation[i*4+j];
+				}
+			}
+
+			simd4f vn[3], vp[3], vside[3], vR[3][3];
+			for ( int i = 0; i < 3; ++i )
+			{
+				vn[i] = simd4f_uload4( n[i] );
+				vp[i] = simd4f_uload4( pos[i] );
+				vside[i] = simd4f_uload4( side[i] );
+				for ( int j = 0; j < 3; ++j )
+					vR[i][j] = simd4f_uload4( R[i][j] );
+			}
+
+			const simd4f zero = simd4f_zero();
+			const simd4f half = simd4f_splat( 0.5f );
+
+			simd4f vA[3], vB[3];
+			for ( int j = 0; j < 3; ++j )
+			{
+				const simd4f Q = simd4f_add( simd4f_add( simd4f_mul( vn[0], vR[0][j] ), simd4f_mul( vn[1], vR[1][j] ) ), simd4f_mul( vn[2], vR[2][j] ) );
+				vA[j] = simd4f_mul( vside[j], Q );
+				vB[j] = lanes_abs( vA[j] );
+			}
+
+			const simd4f dot = simd4f_add( simd4f_add( simd4f_mul( vn[0], vp[0] ), simd4f_mul( vn[1], vp[1] ) ), simd4f_mul( vn[2], vp[2] ) );
+			const simd4f vdepth = simd4f_sub( simd4f_add( simd4f_uload4( d ), simd4f_mul( half, simd4f_add( simd4f_add( vB[0], vB[1] ), vB[2] ) ) ), dot );
+
+			simd4f deepest[3] = { vp[0], vp[1], vp[2] };
+			for ( int j = 0; j < 3; ++j )
+			{
+				const simd4f towards = lanes_greater( vA[j], zero );
+				const simd4f h = simd4f_mul( half, vside[j] );
+				for ( int i = 0; i < 3; ++i )
+				{
+					const simd4f offset = simd4f_mul( h, vR[i][j] );
+					deepest[i] = lanes_select( towards, simd4f_sub( deepest[i], offset ), simd4f_add( deepest[i], offset ) );
+				}
+			}
+
+			float A[3][4], B[3][4], depth[4], p[3][4];
+			simd4f_ustore4( vdepth, depth );
+			for ( int i = 0; i < 3; ++i )
+			{
+				simd4f_ustore4( vA[i], A[i] );
+				simd4f_ustore4( vB[i], B[i] );
+				simd4f_ustore4( deepest[i], p[i] );
+			}
+
+			// walk from the deepest corner along the two sides with the smallest projected length,
+			// then complete the face with a fourth corner if the first three are all in contact
+
+			for ( int lane = 0; lane < count; ++lane )
+			{
+				const CollisionPair & pair = pairs[base+lane];
+				const CollisionBox & box = boxes[pair.a];
+				const CollisionPlane & plane = planes[pair.b];
+				CollisionManifold & manifold = manifolds[base+lane];
+
+				manifold.normal[0] = plane.normal[0];
+				manifold.normal[1] = plane.normal[1];
+				manifold.normal[2] = plane.normal[2];
+
+				if ( depth[lane] < 0 )
+				{
+					manifold.numContacts = 0;
+					continue;
+				}
+
+				CollisionContact * contacts = manifold.contacts;
+				contacts[0].position[0] = p[0][lane];
+				contacts[0].position[1] = p[1][lane];
+				contacts[0].position[2] = p[2][lane];
+				contacts[0].depth = depth[lane];
+				int ret = 1;
+
+				if ( maxc > 1 )
+				{
+					const float b1 = B[0][lane], b2 = B[1][lane], b3 = B[2][lane];
+
+					int first, second;
+					if ( b1 < b2 )
+					{
+						if ( b3 < b1 )
+						{
+							first = 2;
+							second = b1 < b2 ? 0 : 1;
+						}
+						else
+						{
+							first = 0;
+							second = b2 < b3 ? 1 : 2;
+						}
+					}
+					else
+					{
+						if ( b3 < b2 )
+						{
+							first = 2;
+							second = b1 < b2 ? 0 : 1;
+						}
+						else
+						{
+							first = 1;
+							second = b1 < b3 ? 0 : 2;
+						}
+					}
+
+					const int sides[2] = { first, second };
+					for ( int k = 0; k < 2 && ret < maxc; ++k )
+					{
+						const int j = sides[k];
+						const float sideDepth = depth[lane] - B[j][lane];
+						if ( sideDepth < 0 )
+							break;
+						CollisionContact & contact = contacts[ret];
+						for ( int i = 0; i < 3; ++i )
+						{
+							if ( A[j][lane] > 0 )
+								contact.position[i] = p[i][lane] + box.side[j] * box.rotation[i*4+j];
+							else
+								contact.position[i] = p[i][lane] - box.side[j] * box.rotation[i*4+j];
+						}
+						contact.depth = sideDepth;
+						ret++;
+					}
+				}
+
+				if ( maxc == 4 && ret == 3 )
+				{
+					const float d4 = contacts[1].depth + contacts[2].depth - depth[lane];
+					if ( d4 > 0 )
+					{
+						for ( int i = 0; i < 3; ++i )
+							contacts[3].position[i] = contacts[1].position[i] + contacts[2].position[i] - p[i][lane];
+						contacts[3].depth = d4;
+						ret++;
+					}
+				}
+
+				manifold.numContacts = ret;
+			}
+		}
+	}
+}
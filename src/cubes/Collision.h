@@ -0,0 +1,77 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef CUBES_COLLISION_H
+#define CUBES_COLLISION_H
+
+#include "Config.h"
+
+namespace cubes
+{
+	// box-box and box-plane contact generation specialized for cubes. these follow ode's box collider
+	// step for step (same separating axes, same tie breaking, same contact clipping and culling) so the
+	// manifolds they produce are the ones dCollide would, but box pairs are separating axis tested four
+	// at a time across simd lanes, and box-plane pairs likewise test four boxes at once.
+
+	const int MaxCollisionContacts = 8;			// box-box clipping never produces more than 8 points
+
+	struct CollisionBox
+	{
+		float position[4];
+		float rotation[12];						// 3x4 row major, as ode stores it
+		float side[4];							// full side lengths
+	};
+
+	struct CollisionPlane
+	{
+		float normal[3];
+		float d;								// plane is dot(normal,x) = d
+	};
+
+	struct CollisionPair
+	{
+		int a;									// box index
+		int b;									// box index for box pairs, plane index for box-plane pairs
+	};
+
+	struct CollisionContact
+	{
+		float position[3];
+		float depth;
+	};
+
+	struct CollisionManifold
+	{
+		float normal[3];						// same sign as ode: points from b towards a
+		int numContacts;
+		CollisionContact contacts[MaxCollisionContacts];
+	};
+
+	void CollideBoxes( const CollisionBox * boxes, const CollisionPair * pairs, int numPairs, int maxContacts, CollisionManifold * manifolds );
+
+	void CollideBoxesWithPlanes( const CollisionBox * boxes, const CollisionPlane * planes, const CollisionPair * pairs, int numPairs, int maxContacts, CollisionManifold * manifolds );
+}
+
+#endif
@@ -23,6 +23,11 @@
 */
 
 #include "Engine.h"
+#include "vectorial/simd4f.h"
+
+#if defined( VECTORIAL_SSE )
+#include <emmintrin.h>
+#endif
 
 namespace cubes
 {
@@ -53,9 +58,7 @@ namespace cubes
 		uint64_t integer_y = ( compressed_position >> 20 ) & ( (1<<20) - 1 ); 
 		uint64_t integer_z = ( compressed_position       ) & ( (1<<20) - 1 );
 
-		position.x = integer_x / 1024.0f - 512.0f;
-		position.y = integer_y / 1024.0f - 512.0f;
-		position.z = integer_z / 1024.0f - 512.0f;
+		position = math::Vector( integer_x / 1024.0f - 512.0f, integer_y / 1024.0f - 512.0f, integer_z / 1024.0f - 512.0f );
 	}
 
  	void CompressOrientation( const math::Quaternion & orientation, uint32_t & compressed_orientation )
@@ -284,8 +287,314 @@ namespace cubes
 	
 	void DequantizeVector( const int32_t & x, const int32_t & y, const int32_t & z, math::Vector & vector, float res )
 	{
-		vector.x = x / res;
-		vector.y = y / res;
-		vector.z = z / res;
+		vector = math::Vector( x / res, y / res, z / res );
+	}
+
+	// -------------------------------------------------------------
+
+	// batch compression. the sse paths do the same float operations in the same order as the
+	// single object functions, with floor done by truncating and correcting lanes that rounded up,
+	// and the branches on the largest quaternion component replaced by lane selects
+
+	#if defined( VECTORIAL_SSE )
+
+		static inline __m128i lanes_floor( __m128 value )
+		{
+			// exact for |value| < 2^31, which covers every quantized range here
+			const __m128i truncated = _mm_cvttps_epi32( value );
+			const __m128 rounded_up = _mm_cmpgt_ps( _mm_cvtepi32_ps( truncated ), value );
+			return _mm_add_epi32( truncated, _mm_castps_si128( rounded_up ) );
+		}
+
+		static inline __m128 lanes_select( __m128 mask, __m128 a, __m128 b )
+		{
+			return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+		}
+
+		static inline __m128i lanes_select( __m128i mask, __m128i a, __m128i b )
+		{
+			return _mm_or_si128( _mm_and_si128( mask, a ), _mm_andnot_si128( mask, b ) );
+		}
+
+		// four vectors <-> one register per component. each vector is one register already, so this is a transpose
+
+		static inline void LoadVectors( const math::Vector * vectors, __m128 & x, __m128 & y, __m128 & z )
+		{
+			__m128 w;
+			x = vectors[0].value;
+			y = vectors[1].value;
+			z = vectors[2].value;
+			w = vectors[3].value;
+			_MM_TRANSPOSE4_PS( x, y, z, w );
+		}
+
+		static inline void StoreVectors( math::Vector * vectors, __m128 x, __m128 y, __m128 z )
+		{
+			__m128 w = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS( x, y, z, w );
+			vectors[0].value = x;
+			vectors[1].value = y;
+			vectors[2].value = z;
+			vectors[3].value = w;
+		}
+
+		// three registers of x,y,z components -> twelve packed values x0 y0 z0 x1 ...
+
+		static inline void StorePacked( float * values, __m128 x, __m128 y, __m128 z )
+		{
+			const __m128 xy_low = _mm_unpacklo_ps( x, y );		// x0 y0 x1 y1
+			const __m128 xy_high = _mm_unpackhi_ps( x, y );		// x2 y2 x3 y3
+			_mm_storeu_ps( values, _mm_shuffle_ps( xy_low, _mm_shuffle_ps( z, xy_low, _MM_SHUFFLE(2,2,0,0) ), _MM_SHUFFLE(2,0,1,0) ) );
+			_mm_storeu_ps( values + 4, _mm_shuffle_ps( _mm_shuffle_ps( xy_low, z, _MM_SHUFFLE(1,1,3,3) ), xy_high, _MM_SHUFFLE(1,0,2,0) ) );
+			_mm_storeu_ps( values + 8, _mm_shuffle_ps( _mm_shuffle_ps( z, xy_high, _MM_SHUFFLE(2,2,2,2) ), _mm_shuffle_ps( xy_high, z, _MM_SHUFFLE(3,3,3,3) ), _MM_SHUFFLE(2,0,2,0) ) );
+		}
+
+	#endif // #if defined( VECTORIAL_SSE )
+
+	void CompressPositions( const math::Vector * positions, uint64_t * compressed_positions, int count )
+	{
+		int i = 0;
+
+		#if defined( VECTORIAL_SSE )
+
+			const __m128 offset = _mm_set1_ps( 512.0f );
+			const __m128 scale = _mm_set1_ps( 1024.0f );
+			const __m128 half = _mm_set1_ps( 0.5f );
+			const __m128i mask = _mm_set1_epi32( ( 1 << 20 ) - 1 );
+			const __m128i zero = _mm_setzero_si128();
+
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 x, y, z;
+				LoadVectors( positions + i, x, y, z );
+
+				const __m128i integer_x = _mm_and_si128( lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_add_ps( x, offset ), scale ), half ) ), mask );
+				const __m128i integer_y = _mm_and_si128( lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_add_ps( y, offset ), scale ), half ) ), mask );
+				const __m128i integer_z = _mm_and_si128( lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_add_ps( z, offset ), scale ), half ) ), mask );
+
+				// widen to 64 bit lanes, two objects per register
+
+				const __m128i low = _mm_or_si128( _mm_or_si128( _mm_slli_epi64( _mm_unpacklo_epi32( integer_x, zero ), 40 ), _mm_slli_epi64( _mm_unpacklo_epi32( integer_y, zero ), 20 ) ), _mm_unpacklo_epi32( integer_z, zero ) );
+				const __m128i high = _mm_or_si128( _mm_or_si128( _mm_slli_epi64( _mm_unpackhi_epi32( integer_x, zero ), 40 ), _mm_slli_epi64( _mm_unpackhi_epi32( integer_y, zero ), 20 ) ), _mm_unpackhi_epi32( integer_z, zero ) );
+
+				_mm_storeu_si128( (__m128i*) ( compressed_positions + i ), low );
+				_mm_storeu_si128( (__m128i*) ( compressed_positions + i + 2 ), high );
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+
+		for ( ; i < count; ++i )
+			CompressPosition( positions[i], compressed_positions[i] );
+	}
+
+	void DecompressPositions( const uint64_t * compressed_positions, math::Vector * positions, int count )
+	{
+		int i = 0;
+
+		#if defined( VECTORIAL_SSE )
+
+			const __m128i mask = _mm_set1_epi32( ( 1 << 20 ) - 1 );
+			const __m128 scale = _mm_set1_ps( 1024.0f );
+			const __m128 offset = _mm_set1_ps( 512.0f );
+
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				const __m128i low = _mm_loadu_si128( (const __m128i*) ( compressed_positions + i ) );
+				const __m128i high = _mm_loadu_si128( (const __m128i*) ( compressed_positions + i + 2 ) );
+
+				// narrow each shifted 64 bit lane to its low 32 bits, four objects per register
+
+				#define NARROW_LANES( a, b ) _mm_unpacklo_epi64( _mm_shuffle_epi32( a, _MM_SHUFFLE(3,1,2,0) ), _mm_shuffle_epi32( b, _MM_SHUFFLE(3,1,2,0) ) )
+
+				const __m128i integer_x = _mm_and_si128( NARROW_LANES( _mm_srli_epi64( low, 40 ), _mm_srli_epi64( high, 40 ) ), mask );
+				const __m128i integer_y = _mm_and_si128( NARROW_LANES( _mm_srli_epi64( low, 20 ), _mm_srli_epi64( high, 20 ) ), mask );
+				const __m128i integer_z = _mm_and_si128( NARROW_LANES( low, high ), mask );
+
+				#undef NARROW_LANES
+
+				const __m128 x = _mm_sub_ps( _mm_div_ps( _mm_cvtepi32_ps( integer_x ), scale ), offset );
+				const __m128 y = _mm_sub_ps( _mm_div_ps( _mm_cvtepi32_ps( integer_y ), scale ), offset );
+				const __m128 z = _mm_sub_ps( _mm_div_ps( _mm_cvtepi32_ps( integer_z ), scale ), offset );
+
+				StoreVectors( positions + i, x, y, z );
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+
+		for ( ; i < count; ++i )
+			DecompressPosition( compressed_positions[i], positions[i] );
+	}
+
+	void CompressOrientations( const math::Quaternion * orientations, uint32_t * compressed_orientations, int count )
+	{
+		int i = 0;
+
+		#if defined( VECTORIAL_SSE )
+
+			const float minimum = - 1.0f / 1.414214f;		// note: 1.0f / sqrt(2)
+			const float maximum = + 1.0f / 1.414214f;
+
+			const __m128 sign = _mm_set1_ps( -0.0f );
+			const __m128 lane_minimum = _mm_set1_ps( minimum );
+			const __m128 lane_range = _mm_set1_ps( maximum - minimum );
+			const __m128 scale = _mm_set1_ps( 1024.0f );
+			const __m128 half = _mm_set1_ps( 0.5f );
+			const __m128 zero = _mm_setzero_ps();
+
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				#ifdef DEBUG
+				for ( int j = 0; j < 4; ++j )
+				{
+					const float length_squared = orientations[i+j].norm();
+					assert( length_squared >= 1.0f - 0.0001f && length_squared <= 1.0f + 0.0001f );
+				}
+				#endif
+
+				__m128 w = orientations[i].value;
+				__m128 x = orientations[i+1].value;
+				__m128 y = orientations[i+2].value;
+				__m128 z = orientations[i+3].value;
+				_MM_TRANSPOSE4_PS( w, x, y, z );
+
+				// largest absolute component, earlier components win ties
+
+				const __m128 abs_x = _mm_andnot_ps( sign, x );
+				const __m128 abs_y = _mm_andnot_ps( sign, y );
+				const __m128 abs_z = _mm_andnot_ps( sign, z );
+				const __m128 abs_w = _mm_andnot_ps( sign, w );
+
+				__m128 largest_value = abs_x;
+				__m128i largest = _mm_setzero_si128();
+
+				const __m128 y_larger = _mm_cmpgt_ps( abs_y, largest_value );
+				largest_value = lanes_select( y_larger, abs_y, largest_value );
+				largest = lanes_select( _mm_castps_si128( y_larger ), _mm_set1_epi32( 1 ), largest );
+
+				const __m128 z_larger = _mm_cmpgt_ps( abs_z, largest_value );
+				largest_value = lanes_select( z_larger, abs_z, largest_value );
+				largest = lanes_select( _mm_castps_si128( z_larger ), _mm_set1_epi32( 2 ), largest );
+
+				const __m128 w_larger = _mm_cmpgt_ps( abs_w, largest_value );
+				largest = lanes_select( _mm_castps_si128( w_larger ), _mm_set1_epi32( 3 ), largest );
+
+				const __m128 is_x = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_setzero_si128() ) );
+				const __m128 is_y = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 1 ) ) );
+				const __m128 is_z = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 2 ) ) );
+				const __m128 is_w = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 3 ) ) );
+
+				// the three smallest components in x,y,z,w order, negated if the largest is negative
+
+				const __m128 largest_component = lanes_select( is_w, w, lanes_select( is_z, z, lanes_select( is_y, y, x ) ) );
+				const __m128 negate = _mm_and_ps( _mm_cmplt_ps( largest_component, zero ), sign );
+
+				const __m128 a = _mm_xor_ps( lanes_select( is_x, y, x ), negate );
+				const __m128 b = _mm_xor_ps( lanes_select( _mm_or_ps( is_x, is_y ), z, y ), negate );
+				const __m128 c = _mm_xor_ps( lanes_select( is_w, z, w ), negate );
+
+				const __m128i integer_a = lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_sub_ps( a, lane_minimum ), lane_range ), scale ), half ) );
+				const __m128i integer_b = lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_sub_ps( b, lane_minimum ), lane_range ), scale ), half ) );
+				const __m128i integer_c = lanes_floor( _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_sub_ps( c, lane_minimum ), lane_range ), scale ), half ) );
+
+				const __m128i compressed = _mm_or_si128( _mm_or_si128( _mm_slli_epi32( largest, 30 ), _mm_slli_epi32( integer_a, 20 ) ), _mm_or_si128( _mm_slli_epi32( integer_b, 10 ), integer_c ) );
+
+				_mm_storeu_si128( (__m128i*) ( compressed_orientations + i ), compressed );
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+
+		for ( ; i < count; ++i )
+			CompressOrientation( orientations[i], compressed_orientations[i] );
+	}
+
+	void DecompressOrientations( const uint32_t * compressed_orientations, math::Quaternion * orientations, int count )
+	{
+		int i = 0;
+
+		#if defined( VECTORIAL_SSE )
+
+			const float minimum = - 1.0f / 1.414214f;		// note: 1.0f / sqrt(2)
+			const float maximum = + 1.0f / 1.414214f;
+
+			const __m128i mask = _mm_set1_epi32( ( 1 << 10 ) - 1 );
+			const __m128 lane_minimum = _mm_set1_ps( minimum );
+			const __m128 lane_range = _mm_set1_ps( maximum - minimum );
+			const __m128 scale = _mm_set1_ps( 1024.0f );
+			const __m128 one = _mm_set1_ps( 1.0f );
+			const __m128 zero = _mm_setzero_ps();
+
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				const __m128i compressed = _mm_loadu_si128( (const __m128i*) ( compressed_orientations + i ) );
+
+				const __m128i largest = _mm_srli_epi32( compressed, 30 );
+
+				const __m128 a = _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_cvtepi32_ps( _mm_and_si128( _mm_srli_epi32( compressed, 20 ), mask ) ), scale ), lane_range ), lane_minimum );
+				const __m128 b = _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_cvtepi32_ps( _mm_and_si128( _mm_srli_epi32( compressed, 10 ), mask ) ), scale ), lane_range ), lane_minimum );
+				const __m128 c = _mm_add_ps( _mm_mul_ps( _mm_div_ps( _mm_cvtepi32_ps( _mm_and_si128( compressed, mask ) ), scale ), lane_range ), lane_minimum );
+
+				const __m128 d = _mm_sqrt_ps( _mm_sub_ps( _mm_sub_ps( _mm_sub_ps( one, _mm_mul_ps( a, a ) ), _mm_mul_ps( b, b ) ), _mm_mul_ps( c, c ) ) );
+
+				const __m128 is_x = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_setzero_si128() ) );
+				const __m128 is_y = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 1 ) ) );
+				const __m128 is_z = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 2 ) ) );
+				const __m128 is_w = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 3 ) ) );
+
+				__m128 x = lanes_select( is_x, d, a );
+				__m128 y = lanes_select( is_x, a, lanes_select( is_y, d, b ) );
+				__m128 z = lanes_select( _mm_or_ps( is_x, is_y ), b, lanes_select( is_z, d, c ) );
+				__m128 w = lanes_select( is_w, d, c );
+
+				// normalize, with zero length going to identity
+
+				const __m128 length = _mm_sqrt_ps( _mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( w, w ), _mm_mul_ps( x, x ) ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ) );
+				const __m128 zero_length = _mm_cmpeq_ps( length, zero );
+				const __m128 inverse = _mm_div_ps( one, length );
+
+				x = _mm_andnot_ps( zero_length, _mm_mul_ps( x, inverse ) );
+				y = _mm_andnot_ps( zero_length, _mm_mul_ps( y, inverse ) );
+				z = _mm_andnot_ps( zero_length, _mm_mul_ps( z, inverse ) );
+				w = lanes_select( zero_length, one, _mm_mul_ps( w, inverse ) );
+
+				_MM_TRANSPOSE4_PS( w, x, y, z );
+				orientations[i].value = w;
+				orientations[i+1].value = x;
+				orientations[i+2].value = y;
+				orientations[i+3].value = z;
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+
+		for ( ; i < count; ++i )
+			DecompressOrientation( compressed_orientations[i], orientations[i] );
+	}
+
+	void QuantizeVectors( const math::Vector * vectors, int32_t * quantized, int count, float res )
+	{
+		// output is packed x,y,z, three values per vector
+
+		int i = 0;
+
+		#if defined( VECTORIAL_SSE )
+
+			const __m128 scale = _mm_set1_ps( res );
+			const __m128 half = _mm_set1_ps( 0.5f );
+
+			for ( ; i + 4 <= count; i += 4 )
+			{
+				__m128 x, y, z;
+				LoadVectors( vectors + i, x, y, z );
+
+				const __m128i integer_x = lanes_floor( _mm_add_ps( _mm_mul_ps( x, scale ), half ) );
+				const __m128i integer_y = lanes_floor( _mm_add_ps( _mm_mul_ps( y, scale ), half ) );
+				const __m128i integer_z = lanes_floor( _mm_add_ps( _mm_mul_ps( z, scale ), half ) );
+
+				StorePacked( (float*) ( quantized + i * 3 ), _mm_castsi128_ps( integer_x ), _mm_castsi128_ps( integer_y ), _mm_castsi128_ps( integer_z ) );
+			}
+
+		#endif // #if defined( VECTORIAL_SSE )
+
+		for ( ; i < count; ++i )
+			QuantizeVector( vectors[i], quantized[i*3], quantized[i*3+1], quantized[i*3+2], res );
 	}
 }
@@ -43,66 +43,125 @@ namespace cubes
 		Used to track n most important active objects to send,
 		so we know which objects to include in each packet while
 		distributing fairly according to priority and last time sent.
+		Each client has its own accumulators, so one server can
+		decide what goes in every client's packet from one set.
+		Selecting the top k objects partitions around the kth
+		before sorting just those k, so it costs O(n + k log k).
+		Ties go to the lower index, so a selection always matches
+		the start of a full sort.
 	*/
 
 	class PrioritySet
 	{
 	public:
+
+		PrioritySet( int numClients = 1 )
+		{
+			assert( numClients >= 1 );
+			accumulators.resize( numClients );
+		}
 		
 		void Clear()
 		{
-			entries.clear();
+			for ( int i = 0; i < (int) accumulators.size(); ++i )
+				accumulators[i].clear();
 			sorted_entries.clear();
 		}
 		
 		void AddObject( int activeIndex )
 		{
-			assert( activeIndex == (int) entries.size() );
-			ObjectEntry entry;
-			entry.activeIndex = activeIndex;
-			entry.accumulator = 0.0f;
-			entries.push_back( entry );
+			assert( activeIndex == GetNumObjects() );
+			(void) activeIndex;
+			for ( int i = 0; i < (int) accumulators.size(); ++i )
+				accumulators[i].push_back( 0.0f );
 		}
 		
 		void RemoveObject( int index )
 		{
 			assert( index >= 0 );
-			assert( index < (int) entries.size() );
-			const int last = (int) entries.size() - 1;
-			if ( index != last )
+			assert( index < GetNumObjects() );
+			for ( int i = 0; i < (int) accumulators.size(); ++i )
 			{
-				entries[index] = entries[last];
-				entries[index].activeIndex = index;
+				std::vector<float> & client = accumulators[i];
+				client[index] = client.back();
+				client.pop_back();
 			}
-			entries.resize( entries.size() - 1 );
 		}
 
 		int GetNumObjects() const
 		{
-			return (int) entries.size();
+			return (int) accumulators[0].size();
+		}
+
+		int GetNumClients() const
+		{
+			return (int) accumulators.size();
 		}
 
 		void SetAccumulator( int index, float accumulator )
 		{
-			assert( index >= 0 );
-			assert( index < (int) entries.size() );
-			entries[index].accumulator = accumulator;
+			SetAccumulator( 0, index, accumulator );
 		}
 		
 		float GetAccumulator( int index ) const
 		{
+			return GetAccumulator( 0, index );
+		}
+
+		void SetAccumulator( int client, int index, float accumulator )
+		{
+			assert( client >= 0 );
+			assert( client < GetNumClients() );
+			assert( index >= 0 );
+			assert( index < GetNumObjects() );
+			accumulators[client][index] = accumulator;
+		}
+		
+		float GetAccumulator( int client, int index ) const
+		{
+			assert( client >= 0 );
+			assert( client < GetNumClients() );
 			assert( index >= 0 );
-			assert( index < (int) entries.size() );
-			return entries[index].accumulator;
+			assert( index < GetNumObjects() );
+			return accumulators[client][index];
+		}
+
+		// adds priority * deltaTime to every accumulator of the client. priority has one entry per object
+		void Accumulate( int client, const float * priority, float deltaTime )
+		{
+			assert( client >= 0 );
+			assert( client < GetNumClients() );
+			const int count = GetNumObjects();
+			float * accumulator = count ? &accumulators[client][0] : NULL;
+			for ( int i = 0; i < count; ++i )
+				accumulator[i] += priority[i] * deltaTime;
 		}
 		
 		void SortObjects()
 		{
-			sorted_entries.resize( entries.size() );
-			ObjectEntry * src = &entries[0];
-			ObjectEntry * dst = &sorted_entries[0];
-			memcpy( dst, src, sizeof(ObjectEntry) * entries.size() );
-			std::sort( sorted_entries.begin(), sorted_entries.end() );
+			SelectObjects( 0, GetNumObjects() );
+		}
+
+		// sorts the count objects with the highest accumulators for the client, returns how many there are
+		int SelectObjects( int client, int count )
+		{
+			assert( client >= 0 );
+			assert( client < GetNumClients() );
+			assert( count >= 0 );
+			const std::vector<float> & accumulator = accumulators[client];
+			const int numObjects = GetNumObjects();
+			sorted_entries.resize( numObjects );
+			for ( int i = 0; i < numObjects; ++i )
+			{
+				sorted_entries[i].activeIndex = i;
+				sorted_entries[i].accumulator = accumulator[i];
+			}
+			count = core::min( count, numObjects );
+			if ( count < numObjects )
+				std::nth_element( sorted_entries.begin(), sorted_entries.begin() + count, sorted_entries.end() );
+			std::sort( sorted_entries.begin(), sorted_entries.begin() + count );
+			sorted_entries.resize( count );
+			return count;
 		}
 
  		int GetSortedObject( int index, float & priority ) const
@@ -121,12 +180,12 @@ namespace cubes
 			float accumulator;
 			bool operator < ( const ObjectEntry & other ) const
 			{
-				return accumulator > other.accumulator;
+				return accumulator > other.accumulator || ( accumulator == other.accumulator && activeIndex < other.activeIndex );
 			}
 		};
 
-		std::vector<ObjectEntry> entries;
-		std::vector<ObjectEntry> sorted_entries;		// IMPORTANT: we just copy then sort, entries are small.
+		std::vector< std::vector<float> > accumulators;		// per-client, indexed by active index
+		std::vector<ObjectEntry> sorted_entries;
 	};
 	
 	// helper functions for compression
@@ -139,6 +198,17 @@ namespace cubes
 
 	void QuantizeVector( const math::Vector & vector, int32_t & x, int32_t & y, int32_t & z, float res );
 	void DequantizeVector( const int32_t & x, const int32_t & y, const int32_t & z, math::Vector & vector, float res );
+
+	// batch versions of the above, four objects at a time on sse. results are bit identical to the single object versions.
+	// quantized vectors are stored x,y,z per vector
+
+	void CompressPositions( const math::Vector * positions, uint64_t * compressed_positions, int count );
+	void DecompressPositions( const uint64_t * compressed_positions, math::Vector * positions, int count );
+
+	void CompressOrientations( const math::Quaternion * orientations, uint32_t * compressed_orientations, int count );
+	void DecompressOrientations( const uint32_t * compressed_orientations, math::Quaternion * orientations, int count );
+
+	void QuantizeVectors( const math::Vector * vectors, int32_t * quantized, int count, float res );
 }
 
 #endif
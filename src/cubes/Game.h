@@ -105,6 +105,14 @@ namespace game
 		}
 	};
 	
+	/*
+		Push and pull only affect objects within these distances of the
+		player, so they are also the proximity grid query radius.
+	*/
+
+	const float PushRadius = 2.0f;
+	const float PullRadius = 1.8f;
+
 	/*
 		Flags enable/disable various bits of game code that we may not
 		always want enabled in different demos or test programs.
@@ -154,9 +162,12 @@ namespace game
 		Game instance.
 		Lets us have multiple game world instances running in the same app.
 		(Templates let us have different database and active object structs.)
+		Active objects live in ActiveObjectStorage and are accessed by index,
+		so storage may be array of structures or structure of arrays.
+		Functions returning ActiveObject pointers need array of structures.
 	*/
 
-	template <typename DatabaseObject, typename ActiveObject> class Instance : public Interface
+	template <typename DatabaseObject, typename ActiveObject, typename ActiveObjectStorage> class Instance : public Interface
 	{
 	public:
 		
@@ -189,17 +200,49 @@ namespace game
 		}
 		
 		Instance( const Config & config = Config() )
+		{
+			world = NULL;
+			activationSystem = new ActivationSystem( config.maxObjects, config.activationDistance, config.cellWidth, config.cellHeight, config.cellSize, config.initialObjectsPerCell, config.initialActiveObjects, config.deactivationTime );
+			objects = new DatabaseObject[config.maxObjects];
+			objectCount = 0;
+			Create( config );
+		}
+
+		/*
+			Runs on a world file instead of objects added at initialize time.
+			The file sets the grid and object count, overriding the config.
+			Database objects are read from the mapping, and written to the
+			world file's overlay of changed objects.
+			The world file must stay open for the lifetime of the instance.
+		*/
+
+		Instance( const Config & config, activation::WorldFile & world )
+		{
+			assert( world.IsOpen() );
+			assert( world.GetObjectBytes() == sizeof( DatabaseObject ) );
+			this->world = &world;
+			activationSystem = new ActivationSystem( world, config.activationDistance, config.initialObjectsPerCell, config.initialActiveObjects, config.deactivationTime );
+			objects = NULL;
+			objectCount = world.GetObjectCount();
+			Config worldConfig = config;
+			worldConfig.maxObjects = objectCount + 1;
+			worldConfig.cellWidth = world.GetWidth();
+			worldConfig.cellHeight = world.GetHeight();
+			worldConfig.cellSize = world.GetCellSize();
+			Create( worldConfig );
+		}
+
+	private:
+
+		void Create( const Config & config )
 		{
 			this->listener = &dummyListener;
 			this->config = config;
 			initialized = false;
 			initializing = false;
 			flags = 0;
-			activationSystem = new ActivationSystem( config.maxObjects, config.activationDistance, config.cellWidth, config.cellHeight, config.cellSize, config.initialObjectsPerCell, config.initialActiveObjects, config.deactivationTime );
 			simulation = new Simulation();
 			simulation->Initialize( config.simConfig );
-			objects = new DatabaseObject[config.maxObjects];
-			objectCount = 0;
 			localPlayerId = -1;
 			origin = math::Vector(0,0,0);
 			for ( int i = 0; i < MaxPlayers; ++i )
@@ -210,13 +253,17 @@ namespace game
 				playerFocus[i] = 0;
 			}
 			activeObjects.Allocate( config.initialActiveObjects );
+			proximityGridValid = false;
 		}
+
+	public:
 		
 		~Instance()
 		{
 			if ( initialized )
 				Shutdown();
-			delete [] objects;
+			if ( !world )
+				delete [] objects;
 			delete simulation;
 			delete activationSystem;
 		}
@@ -230,6 +277,7 @@ namespace game
 				
 		ObjectId AddObject( DatabaseObject & object, float x, float y )
 		{
+			assert( !world );
 			int id = objectCount + 1;
 			assert( id < config.maxObjects );
 			objects[id] = object;
@@ -401,6 +449,8 @@ namespace game
 
 		void Update( float deltaTime = 0.1f )
 		{
+			proximityGridValid = false;
+
 			for ( int i = 0; i < MaxPlayers; ++i )
 				ProcessPlayerInput( i, deltaTime );
 
@@ -433,8 +483,7 @@ namespace game
 			count = activeObjects.GetCount();
 			for ( int i = 0; i < count; ++i )
 			{
-				ActiveObject & activeObject = activeObjects.GetObject( i );
-				*objects = activeObject;
+				activeObjects.LoadObject( i, *objects );
 				objects++;
 			}
 		}
@@ -462,11 +511,18 @@ namespace game
 			return activeObjects.FindObject( id );
 		}
 		
-		DatabaseObject & GetDatabaseObject( ObjectId id )
+		const DatabaseObject & GetDatabaseObject( ObjectId id ) const
+		{
+			assert( id > 0 );
+			assert( id < (ObjectId) config.maxObjects );
+			return world ? *(const DatabaseObject*) world->GetObjectData( id ) : objects[id];
+		}
+
+		DatabaseObject & ModifyDatabaseObject( ObjectId id )
 		{
 			assert( id > 0 );
 			assert( id < (ObjectId) config.maxObjects );
-			return objects[id];
+			return world ? *(DatabaseObject*) world->ModifyObjectData( id ) : objects[id];
 		}
 		
 		ActiveObject & GetActiveObject( int activeIndex )
@@ -485,6 +541,17 @@ namespace game
 		{
 			return activeObjects.GetCount();
 		}
+
+		const activation::StreamStats & GetStreamStats() const
+		{
+			return activationSystem->GetStreamStats();
+		}
+
+		const activation::ActivationSystem & GetActivationSystem() const
+		{
+			assert( activationSystem );
+			return *activationSystem;
+		}
 		
 		bool IsObjectActive( ObjectId id )
 		{
@@ -498,16 +565,16 @@ namespace game
 		{
 			assert( id > 0 );
 			assert( id <= (ObjectId) objectCount );
-			ActiveObject * activeObject = activeObjects.FindObject( id );
-			if ( activeObject )
+			const int activeIndex = activeObjects.FindIndex( id );
+			if ( activeIndex >= 0 )
 			{
 				// active object
-				object = *activeObject;
+				activeObjects.LoadObject( activeIndex, object );
 			}
 			else
 			{
 				// inactive object
-				objects[id].DatabaseToActive( object );
+				GetDatabaseObject( id ).DatabaseToActive( object );
 				object.activeId = 0;
 				object.id = id;
 			}
@@ -517,22 +584,118 @@ namespace game
 		{
 			assert( id > 0 );
 			assert( id <= (ObjectId) objectCount );
-			ActiveObject * activeObject = activeObjects.FindObject( id );
-			if ( activeObject )
+			const int activeIndex = activeObjects.FindIndex( id );
+			if ( activeIndex >= 0 )
 			{
 				// active object
-				ActiveId activeId = activeObject->activeId;
-				*activeObject = object;
-				activeObject->activeId = activeId;
-				activationSystem->MoveActiveObject( activeId, object.position.x, object.position.y );
+				ActiveId activeId = activeObjects.GetActiveId( activeIndex );
+				ActiveObject activeObject = object;
+				activeObject.activeId = activeId;
+				activeObjects.StoreObject( activeIndex, activeObject );
+				activationSystem->MoveActiveObject( activeIndex, object.position.x, object.position.y );
 			}
 			else
 			{
 				// inactive object
-				objects[id].ActiveToDatabase( object );
+				ModifyDatabaseObject( id ).ActiveToDatabase( object );
 				activationSystem->MoveDatabaseObject( id, object.position.x, object.position.y );
 			}
 		}
+
+		/*
+			Snapshot of the instance for rollback: active objects, simulation,
+			the activation system's active set including pending deactivation
+			timers, and the per-player state carried from one update to the next.
+			Restoring puts back the objects that were active, in the same order.
+			Database objects are not part of it: an object that was activated
+			since keeps the database state it was activated with.
+		*/
+
+		struct State
+		{
+			uint32_t frame[MaxPlayers];
+			math::Vector origin;
+			std::vector<ActiveObject> activeObjects;
+			SimulationState simulation;
+			ActivationSystem::State activation;
+		};
+
+		void SaveState( State & state ) const
+		{
+			for ( int i = 0; i < MaxPlayers; ++i )
+				state.frame[i] = frame[i];
+			state.origin = origin;
+			state.activeObjects.resize( activeObjects.GetCount() );
+			for ( int i = 0; i < activeObjects.GetCount(); ++i )
+				activeObjects.LoadObject( i, state.activeObjects[i] );
+			simulation->SaveState( state.simulation );
+			activationSystem->SaveState( state.activation );
+		}
+
+		void RestoreState( const State & state )
+		{
+			for ( int i = 0; i < MaxPlayers; ++i )
+				frame[i] = state.frame[i];
+			origin = state.origin;
+
+			// active indices must match the activation system's, which comes back in the saved order. if objects
+			// were activated or deactivated since, rebuild the active objects in that order and tell the listener
+
+			const int numActive = (int) state.activeObjects.size();
+
+			bool sameObjects = numActive == activeObjects.GetCount();
+			for ( int i = 0; i < numActive && sameObjects; ++i )
+				sameObjects = activeObjects.GetId( i ) == state.activeObjects[i].id;
+
+			activationSystem->RestoreState( state.activation );
+
+			deactivatedObjects.clear();
+
+			if ( !sameObjects )
+			{
+				for ( int i = activeObjects.GetCount() - 1; i >= 0; --i )
+				{
+					const ObjectId id = activeObjects.GetId( i );
+					listener->OnObjectDeactivated( id, i );
+					if ( !activationSystem->IsActive( id ) )
+						deactivatedObjects.push_back( id );
+				}
+
+				activeObjects.Clear();
+
+				for ( int i = 0; i < numActive; ++i )
+				{
+					const ObjectId id = state.activeObjects[i].id;
+					activeObjects.Insert( id );
+					listener->OnObjectActivated( id, i );
+				}
+			}
+
+			for ( int i = 0; i < numActive; ++i )
+			{
+				activeObjects.StoreObject( i, state.activeObjects[i] );
+				float x,y;
+				activeObjects.GetPositionXY( i, x, y );
+				activationSystem->MoveActiveObject( i, x, y );
+			}
+
+			// simulation objects live in slots by active id, so this adds and removes them to match too
+
+			simulation->RestoreState( state.simulation );
+
+			// objects activated since the snapshot go back to where the database has them. this only activates
+			// one again if the database disagrees with the snapshot, in which case the next update picks it up
+
+			for ( int i = 0; i < (int) deactivatedObjects.size(); ++i )
+			{
+				const ObjectId id = deactivatedObjects[i];
+				ActiveObject activeObject = ActiveObject();
+				GetDatabaseObject( id ).DatabaseToActive( activeObject );
+				activationSystem->MoveDatabaseObject( id, activeObject.position.x, activeObject.position.y );
+			}
+
+			proximityGridValid = false;
+		}
 				
 	protected:
 		
@@ -548,9 +711,9 @@ namespace game
 
 			int playerObjectId = playerFocus[playerId];
 
-			ActiveObject * activePlayerObject = activeObjects.FindObject( playerObjectId );
+			const int playerIndex = activeObjects.FindIndex( playerObjectId );
 
-			if ( activePlayerObject )
+			if ( playerIndex >= 0 )
 			{			
 				// apply strafing force to player cube
 				
@@ -563,11 +726,11 @@ namespace game
 
 				if ( !input[playerId].push )
 				{
-					if ( activePlayerObject->linearVelocity.dot( force[playerId] ) < 0 )
+					if ( activeObjects.GetLinearVelocity( playerIndex ).dot( force[playerId] ) < 0 )
 						force[playerId] *= 2.0f;
 				}
 
- 				ActiveId playerActiveId = activePlayerObject->activeId;
+ 				ActiveId playerActiveId = activeObjects.GetActiveId( playerIndex );
 
 				simulation->ApplyForce( playerActiveId, force[playerId] );
 
@@ -582,7 +745,7 @@ namespace game
 						float wobble_y = sin(frame[playerId]*0.1+2) + sin(frame[playerId]*0.05f+4) + sin(frame[playerId]+11);
 						float wobble_z = sin(frame[playerId]*0.1+3) + sin(frame[playerId]*0.05f+5) + sin(frame[playerId]+12);
 						math::Vector wobble_force = math::Vector( wobble_x, wobble_y, wobble_z ) * 2.0f;
-						simulation->ApplyForce( activePlayerObject->activeId, wobble_force );
+						simulation->ApplyForce( playerActiveId, wobble_force );
 					}
 					
 					// bobbing torque on player cube
@@ -591,7 +754,7 @@ namespace game
 						float wobble_y = sin(frame[playerId]*0.09+5) + sin(frame[playerId]*0.045f+16) + sin(frame[playerId]*1.11f);
 						float wobble_z = sin(frame[playerId]*0.05+4) + sin(frame[playerId]*0.055f+9) + sin(frame[playerId]*1.12f);
 						math::Vector torque = math::Vector( wobble_x, wobble_y, wobble_z ) * 1.5f;
-						simulation->ApplyTorque( activePlayerObject->activeId, torque );
+						simulation->ApplyTorque( playerActiveId, torque );
 					}
 					
 					// calculate velocity tilt for player cube
@@ -613,42 +776,64 @@ namespace game
 					
 					// stay upright torque on player cube
 					{
-						math::Vector currentUp = activePlayerObject->orientation.transform( math::Vector(0,0,1) );
+						math::Vector currentUp = activeObjects.GetOrientation( playerIndex ).transform( math::Vector(0,0,1) );
 						math::Vector axis = targetUp.cross( currentUp );
 			 			float angle = math::acos( targetUp.dot( currentUp ) );
 						if ( angle > 0.5f )
 							angle = 0.5f;
 						math::Vector torque = - 100 * axis * angle;
-						simulation->ApplyTorque( activePlayerObject->activeId, torque );
+						simulation->ApplyTorque( playerActiveId, torque );
 					}
 					
 					// apply damping to player cube
-					activePlayerObject->angularVelocity *= 0.95f;
-					activePlayerObject->linearVelocity.x *= 0.96f;
-					activePlayerObject->linearVelocity.y *= 0.96f;
-					activePlayerObject->linearVelocity.z *= 0.999f;
+					math::Vector angularVelocity = activeObjects.GetAngularVelocity( playerIndex );
+					math::Vector linearVelocity = activeObjects.GetLinearVelocity( playerIndex );
+					angularVelocity *= 0.95f;
+					linearVelocity.x *= 0.96f;
+					linearVelocity.y *= 0.96f;
+					linearVelocity.z *= 0.999f;
+					activeObjects.SetAngularVelocity( playerIndex, angularVelocity );
+					activeObjects.SetLinearVelocity( playerIndex, linearVelocity );
 				}
 				
-				math::Vector push_origin = activePlayerObject->position;
+				math::Vector push_origin = activeObjects.GetPosition( playerIndex );
 				push_origin.z = -0.1f;
 
-				// iterate across active objects
+				// iterate across active objects near the push or pull point. each object gets at most
+				// one force here, so visiting them in grid order instead of index order gives the same result
+
 				if ( push || pull )
 				{
-					for ( int i = 0; i < activeObjects.GetCount(); ++i )
+					if ( !proximityGridValid )
 					{
-						ActiveObject * activeObject = &activeObjects.GetObject( i );
+						proximityGrid.Begin( activeObjects.GetCount() );
+						for ( int i = 0; i < activeObjects.GetCount(); ++i )
+						{
+							float x,y;
+							activeObjects.GetPositionXY( i, x, y );
+							proximityGrid.Insert( i, x, y );
+						}
+						proximityGrid.End();
+						proximityGridValid = true;
+					}
 
-						const int authority = activeObject->authority;
-						const float mass = simulation->GetObjectMass( activeObject->activeId );
+					const math::Vector & query_origin = push ? push_origin : origin;
+					proximityGrid.Query( query_origin.x, query_origin.y, push ? PushRadius : PullRadius, nearbyObjects );
+
+					for ( int j = 0; j < (int) nearbyObjects.size(); ++j )
+					{
+						const int i = nearbyObjects[j];
+						const ActiveId activeId = activeObjects.GetActiveId( i );
+						const int authority = activeObjects.GetAuthority( i );
+						const float mass = simulation->GetObjectMass( activeId );
 
 						if ( push )
 						{
-							math::Vector difference = activeObject->position - push_origin;
-							if ( activeObject == activePlayerObject )
+							math::Vector difference = activeObjects.GetPosition( i ) - push_origin;
+							if ( i == playerIndex )
 								difference.z -= 0.7f;
 							float distanceSquared = difference.lengthSquared();
-							if ( distanceSquared > 0.01f * 0.01f && distanceSquared < 4.0f )
+							if ( distanceSquared > 0.01f * 0.01f && distanceSquared < PushRadius * PushRadius )
 							{
 								float distance = math::sqrt( distanceSquared );
 								math::Vector direction = difference / distance;
@@ -656,26 +841,26 @@ namespace game
 								if ( magnitude > 500.0f )
 									magnitude = 500.0f;
 								math::Vector push_force = direction * magnitude;
-								if ( activeObject != activePlayerObject )
+								if ( i != playerIndex )
 									push_force *= mass;
 								else if ( pull )
 									push_force *= 20;
 
 								if ( authority == MaxPlayers || playerId == authority )
 								{
-									simulation->ApplyForce( activeObject->activeId, push_force );
-									activeObject->authority = playerId;
-									activeObject->authorityTime = 0;
+									simulation->ApplyForce( activeId, push_force );
+									activeObjects.SetAuthority( i, playerId );
+									activeObjects.SetAuthorityTime( i, 0 );
 								}
 							}
 						}
 						else if ( pull )
 						{
-							if ( activeObject != activePlayerObject )
+							if ( i != playerIndex )
 							{
-								math::Vector difference = activeObject->position - origin;
+								math::Vector difference = activeObjects.GetPosition( i ) - origin;
 								float distanceSquared = difference.lengthSquared();
-								const float effectiveRadiusSquared = 1.8f * 1.8f;
+								const float effectiveRadiusSquared = PullRadius * PullRadius;
 								if ( distanceSquared > 0.2f*0.2f && distanceSquared < effectiveRadiusSquared )
 								{
 									float distance = math::sqrt( distanceSquared );
@@ -686,9 +871,9 @@ namespace game
 									math::Vector pull_force = - direction * magnitude;
 									if ( authority == playerId || authority == MaxPlayers )
 									{
-										simulation->ApplyForce( activeObject->activeId, pull_force * mass );
-										activeObject->authority = playerId;
-										activeObject->authorityTime = 0;
+										simulation->ApplyForce( activeId, pull_force * mass );
+										activeObjects.SetAuthority( i, playerId );
+										activeObjects.SetAuthorityTime( i, 0 );
 									}
 								}
 							}
@@ -704,12 +889,17 @@ namespace game
 			{
 				int playerObjectId = playerFocus[localPlayerId];
 
-				ActiveObject * activePlayerObject = activeObjects.FindObject( playerObjectId );
+				const int playerIndex = activeObjects.FindIndex( playerObjectId );
 
-				if ( activePlayerObject )
-					activePlayerObject->GetPosition( origin );
+				if ( playerIndex >= 0 )
+				{
+					ActiveObject activePlayerObject;
+					activeObjects.LoadObject( playerIndex, activePlayerObject );
+					activePlayerObject.GetPosition( origin );
+					activeObjects.StoreObject( playerIndex, activePlayerObject );
+				}
 				else
-					objects[playerObjectId].GetPosition( origin );
+					GetDatabaseObject( playerObjectId ).GetPosition( origin );
 			}
 			else
 			{
@@ -722,9 +912,8 @@ namespace game
 			#ifdef DEBUG
 			for ( int i = 0; i < activeObjects.GetCount(); ++i )
 			{
-				ActiveObject & activeObject = activeObjects.GetObject( i );
-				assert( activeObject.id >= 1 );
-				assert( activeObject.id <= (ObjectId) objectCount );
+				assert( activeObjects.GetId( i ) >= 1 );
+				assert( activeObjects.GetId( i ) <= (ObjectId) objectCount );
 			}
 			#endif
 			activationSystem->Validate();
@@ -741,28 +930,31 @@ namespace game
 				const activation::Event & event = activationSystem->GetEvent(i);
 				if ( event.type == activation::Event::Activate )
 				{
-					ActiveObject * activeObject = &activeObjects.InsertObject( event.id );
-					assert( activeObject );
-					objects[event.id].DatabaseToActive( *activeObject );
+					const int activeIndex = activeObjects.Insert( event.id );
+					ActiveObject activeObject = ActiveObject();
+					GetDatabaseObject( event.id ).DatabaseToActive( activeObject );
 
-					listener->OnObjectActivated( event.id, (int) ( activeObject - &activeObjects.GetObject(0) ) );
+					listener->OnObjectActivated( event.id, activeIndex );
 
 					SimulationObjectState simInitialState;
-					activeObject->ActiveToSimulation( simInitialState );
-					activeObject->id = event.id;
-					activeObject->activeId = simulation->AddObject( simInitialState );
+					activeObject.ActiveToSimulation( simInitialState );
+					activeObject.id = event.id;
+					activeObject.activeId = simulation->AddObject( simInitialState );
+					activeObjects.StoreObject( activeIndex, activeObject );
 				}
 				else
 				{
-					ActiveObject * activeObject = activeObjects.FindObject( event.id );
-					assert( activeObject );
+					const int activeIndex = activeObjects.FindIndex( event.id );
+					assert( activeIndex >= 0 );
 
-					listener->OnObjectDeactivated( event.id, (int) ( activeObject - &activeObjects.GetObject(0) ) );
+					listener->OnObjectDeactivated( event.id, activeIndex );
 
-					objects[event.id].ActiveToDatabase( *activeObject );
+					ActiveObject activeObject;
+					activeObjects.LoadObject( activeIndex, activeObject );
+					ModifyDatabaseObject( event.id ).ActiveToDatabase( activeObject );
 						
-					simulation->RemoveObject( activeObject->activeId );
-					activeObjects.DeleteObject( activeObject );
+					simulation->RemoveObject( activeObject.activeId );
+					activeObjects.DeleteObject( activeIndex );
 				}
 			}
 
@@ -785,11 +977,9 @@ namespace game
 
 			for ( int i = 0; i < numActiveObjects; ++i )
 			{
-				ActiveObject * activeObject = &activeObjects.GetObject( i );
-				assert( activeObject );
 				SimulationObjectState objectState;
-				activeObject->ActiveToSimulation( objectState );
-				simulation->SetObjectState( activeObject->activeId, objectState, true );
+				activeObjects.ActiveToSimulation( i, objectState );
+				simulation->SetObjectState( activeObjects.GetActiveId( i ), objectState, true );
 			}
 			
 			simulation->Update( deltaTime, GetFlag( FLAG_Pause ) );
@@ -797,52 +987,40 @@ namespace game
 			if ( GetFlag( FLAG_Pause ) )
 				return;
 				
-            const vectorial::vec3f position_min( -PositionBoundXY, -PositionBoundXY, 0 );
-            const vectorial::vec3f position_max( +PositionBoundXY, +PositionBoundXY, PositionBoundZ );
-
 			for ( int i = 0; i < numActiveObjects; ++i )
 			{
-				ActiveObject * activeObject = &activeObjects.GetObject( i );
-				assert( activeObject );
-				
 				SimulationObjectState simObjectState;
-				simulation->GetObjectState( activeObject->activeId, simObjectState );
-				
-				activeObject->SimulationToActive( simObjectState );
-
-				vectorial::vec3f position( activeObject->position.x, activeObject->position.y, activeObject->position.z );
-
-				position = vectorial::clamp( position, position_min, position_max );
+				simulation->GetObjectState( activeObjects.GetActiveId( i ), simObjectState );
+				activeObjects.SimulationToActive( i, simObjectState );
+			}
 
-				activeObject->position = math::Vector( position.x(), position.y(), position.z() );
+			activeObjects.ClampPositions( math::Vector( -PositionBoundXY, -PositionBoundXY, 0 ), math::Vector( +PositionBoundXY, +PositionBoundXY, PositionBoundZ ) );
 
+			for ( int i = 0; i < numActiveObjects; ++i )
+			{
 				float x,y;
-				activeObject->GetPositionXY( x, y );
-				int activeIndex = activeObject - &activeObjects.GetObject( 0 );
-				activationSystem->MoveActiveObject( activeIndex, x, y );
+				activeObjects.GetPositionXY( i, x, y );
+				activationSystem->MoveActiveObject( i, x, y );
 			}
 		}
 		
 		void ConstructViewPacket()
 		{
-			ActiveObject * localPlayerActiveObject = activeObjects.FindObject( playerFocus[localPlayerId] );
-			if ( localPlayerActiveObject )
+			const int localPlayerIndex = activeObjects.FindIndex( playerFocus[localPlayerId] );
+			if ( localPlayerIndex >= 0 )
 			{
 				viewPacket.origin = origin;
 				viewPacket.objectCount = 1;
 
-				localPlayerActiveObject->ActiveToView( viewPacket.object[0], localPlayerId, false );
+				activeObjects.ActiveToView( localPlayerIndex, viewPacket.object[0], localPlayerId, false );
 
 				int index = 1;
 				for ( int i = 0; i < activeObjects.GetCount() && index < MaxViewObjects; ++i )
 				{
-					ActiveObject * activeObject = &activeObjects.GetObject( i );
-					assert( activeObject );
-					if ( activeObject == localPlayerActiveObject )
+					if ( i == localPlayerIndex )
 						continue;
-					int activeIndex = activeObject - &activeObjects.GetObject( 0 );
-					const bool pendingDeactivation = activationSystem->IsPendingDeactivation( activeIndex );
-					activeObject->ActiveToView( viewPacket.object[index], activeObject->authority, pendingDeactivation );
+					const bool pendingDeactivation = activationSystem->IsPendingDeactivation( i );
+					activeObjects.ActiveToView( i, viewPacket.object[index], activeObjects.GetAuthority( i ), pendingDeactivation );
 					index++;
 				}
 
@@ -863,34 +1041,31 @@ namespace game
 			int maxActiveId = 0;
 			for ( int i = 0; i < activeObjects.GetCount(); ++i )
 			{
-				ActiveObject & activeObject = activeObjects.GetObject( i );
-				if ( activeObject.id >= 1 && activeObject.id <= (uint32_t) MaxPlayers )
+				const ObjectId id = activeObjects.GetId( i );
+				if ( id >= 1 && id <= (uint32_t) MaxPlayers )
 				{
-					activeObject.authority = activeObject.id - 1;
-					activeObject.authorityTime = 0;
+					activeObjects.SetAuthority( i, id - 1 );
+					activeObjects.SetAuthorityTime( i, 0 );
 				}
-				else if ( activeObject.enabled )
+				else if ( activeObjects.IsEnabled( i ) )
 				{
-					activeObject.authorityTime = 0;
+					activeObjects.SetAuthorityTime( i, 0 );
 				}
 				else
 				{
-					activeObject.authorityTime++;
-					if ( activeObject.authorityTime > 100 )
-						activeObject.authority = MaxPlayers;
+					activeObjects.SetAuthorityTime( i, activeObjects.GetAuthorityTime( i ) + 1 );
+					if ( activeObjects.GetAuthorityTime( i ) > 100 )
+						activeObjects.SetAuthority( i, MaxPlayers );
 				}
-				if ( activeObject.activeId > (ActiveId) maxActiveId )
-					maxActiveId = activeObject.activeId;
+				if ( activeObjects.GetActiveId( i ) > (ActiveId) maxActiveId )
+					maxActiveId = activeObjects.GetActiveId( i );
 			}
 
 			// build map from active id to active index
 			
 			std::vector<int> activeIdToIndex( maxActiveId + 1 );
 			for ( int i = 0; i < activeObjects.GetCount(); ++i )
-			{
-				ActiveObject & activeObject = activeObjects.GetObject( i );
-				activeIdToIndex[activeObject.activeId] = i;
-			}
+				activeIdToIndex[activeObjects.GetActiveId( i )] = i;
 			
 			// interaction based authority for active objects
 
@@ -906,18 +1081,18 @@ namespace game
 
 					for ( int i = 0; i < activeObjects.GetCount(); ++i )
 					{
-						ActiveObject & activeObject = activeObjects.GetObject( i );
-						const int activeId = activeObject.activeId;
+						const int activeId = activeObjects.GetActiveId( i );
+						const int authority = activeObjects.GetAuthority( i );
 						assert( activeId >= 0 );
 						assert( activeId < (int) ignores.size() );
 						assert( activeId < (int) interacting.size() );
-						if ( activeObject.authority == playerId )
+						if ( authority == playerId )
 						{
 							interacting[activeId] = true;
 							assert( head < activeObjects.GetCount() );
-							queue[head++] = activeObject.activeId;
+							queue[head++] = activeId;
 						}
-						else if ( activeObject.authority != MaxPlayers || activeObject.enabled == 0 )
+						else if ( authority != MaxPlayers || !activeObjects.IsEnabled( i ) )
 						{
 							ignores[activeId] = true;
 						}
@@ -925,7 +1100,7 @@ namespace game
 					
 					while ( head != tail )
 					{
-						const std::vector<uint16_t> & objectInteractions = simulation->GetObjectInteractions( queue[tail] );
+						const SimulationInteractions objectInteractions = simulation->GetObjectInteractions( queue[tail] );
 						for ( int i = 0; i < (int) objectInteractions.size(); ++i )
 						{
 							const int activeId = objectInteractions[i];
@@ -946,12 +1121,12 @@ namespace game
 						if ( interacting[i] )
 						{
 							int index = activeIdToIndex[i];
-							ActiveObject & activeObject = activeObjects.GetObject( index );
-							if ( activeObject.authority == MaxPlayers || activeObject.authority == playerId )
+							const int authority = activeObjects.GetAuthority( index );
+							if ( authority == MaxPlayers || authority == playerId )
 							{
-								activeObject.authority = playerId;
-								if ( activeObject.enabled )
-									activeObject.authorityTime = 0;
+								activeObjects.SetAuthority( index, playerId );
+								if ( activeObjects.IsEnabled( index ) )
+									activeObjects.SetAuthorityTime( index, 0 );
 							}
 						}
 					}
@@ -982,12 +1157,19 @@ namespace game
 		Simulation * simulation;
 		ActivationSystem * activationSystem;
 		
+		activation::WorldFile * world;
 		DatabaseObject * objects;
 		
 		Listener * listener;
 		Listener dummyListener;
 
-        activation::Set<ActiveObject> activeObjects;
+        ActiveObjectStorage activeObjects;
+
+        activation::ProximityGrid proximityGrid;
+        bool proximityGridValid;
+
+        std::vector<int> nearbyObjects;
+        std::vector<ObjectId> deactivatedObjects;
 
         view::Packet viewPacket;
 	};
@@ -29,6 +29,7 @@
 #include "Engine.h"
 #include "Simulation.h"
 #include "ViewObject.h"
+#include "vectorial/vec3f.h"
 
 namespace hypercube
 {
@@ -39,7 +40,7 @@ namespace hypercube
 
 	struct ActiveObject
 	{
- 		uint64_t id : 20;
+ 		uint64_t id : 32;
 		uint64_t activeId : 16;
  		uint64_t enabled : 1;
 		uint64_t player : 1;
@@ -107,7 +108,7 @@ namespace hypercube
 		uint32_t session : 8;
 		uint32_t player : 1;
 		
-		void DatabaseToActive( ActiveObject & activeObject )
+		void DatabaseToActive( ActiveObject & activeObject ) const
 		{
  			activeObject.enabled = enabled;
 			activeObject.player = player;
@@ -126,11 +127,424 @@ namespace hypercube
 			CompressOrientation( activeObject.orientation, orientation );
 		}
 
-		void GetPosition( math::Vector & _position )
+		void GetPosition( math::Vector & _position ) const
 		{
 			DecompressPosition( position, _position );
 		}
 	};
+
+	/*
+		Active object storage for game::Instance.
+
+		The instance only touches active objects through these index based
+		accessors, so it runs on either layout: ActiveObjectSet keeps whole
+		ActiveObject structs together (array of structures), ActiveObjectArrays
+		keeps each field in its own array (structure of arrays). Hot loops like
+		the push/pull force loop and the position clamp only read a few fields
+		per object, so the arrays layout streams less memory through the cache.
+	*/
+
+	class ActiveObjectSet : public activation::Set<ActiveObject>
+	{
+	public:
+
+		int Insert( ObjectId id )
+		{
+			InsertObject( id );
+			return count - 1;
+		}
+
+		void LoadObject( int index, ActiveObject & object ) const
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			object = objects[index];
+		}
+
+		void StoreObject( int index, const ActiveObject & object )
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			objects[index] = object;
+		}
+
+		ObjectId GetId( int index ) const { return objects[index].id; }
+		ActiveId GetActiveId( int index ) const { return objects[index].activeId; }
+		bool IsEnabled( int index ) const { return objects[index].enabled; }
+		int GetAuthority( int index ) const { return objects[index].authority; }
+		void SetAuthority( int index, int authority ) { objects[index].authority = authority; }
+		int GetAuthorityTime( int index ) const { return objects[index].authorityTime; }
+		void SetAuthorityTime( int index, int authorityTime ) { objects[index].authorityTime = authorityTime; }
+		math::Vector GetPosition( int index ) const { return objects[index].position; }
+		math::Quaternion GetOrientation( int index ) const { return objects[index].orientation; }
+		math::Vector GetLinearVelocity( int index ) const { return objects[index].linearVelocity; }
+		void SetLinearVelocity( int index, const math::Vector & linearVelocity ) { objects[index].linearVelocity = linearVelocity; }
+		math::Vector GetAngularVelocity( int index ) const { return objects[index].angularVelocity; }
+		void SetAngularVelocity( int index, const math::Vector & angularVelocity ) { objects[index].angularVelocity = angularVelocity; }
+
+		void GetPositionXY( int index, float & x, float & y ) const
+		{
+			objects[index].GetPositionXY( x, y );
+		}
+
+		void ActiveToSimulation( int index, SimulationObjectState & simulationObject ) const
+		{
+			objects[index].ActiveToSimulation( simulationObject );
+		}
+
+		void SimulationToActive( int index, const SimulationObjectState & simulationObject )
+		{
+			objects[index].SimulationToActive( simulationObject );
+		}
+
+		void ActiveToView( int index, view::ObjectState & viewObjectState, int authority, bool pendingDeactivation ) const
+		{
+			objects[index].ActiveToView( viewObjectState, authority, pendingDeactivation );
+		}
+
+		void ClampPositions( const math::Vector & min, const math::Vector & max )
+		{
+			const vectorial::vec3f position_min = math::to_vec3f( min );
+			const vectorial::vec3f position_max = math::to_vec3f( max );
+			for ( int i = 0; i < count; ++i )
+			{
+				ActiveObject & activeObject = objects[i];
+				vectorial::vec3f position = math::to_vec3f( activeObject.position );
+				position = vectorial::clamp( position, position_min, position_max );
+				activeObject.position = math::to_vector( position );
+			}
+		}
+	};
+
+	class ActiveObjectArrays
+	{
+	public:
+
+		ActiveObjectArrays()
+		{
+			count = 0;
+			size = 0;
+			minimumSize = 0;
+			capacity = 0;
+			memory = NULL;
+			orientation = NULL;
+			x = y = z = NULL;
+			linearVelocity = NULL;
+			angularVelocity = NULL;
+			ids = NULL;
+			activeIds = NULL;
+			enabled = NULL;
+			player = NULL;
+			authority = NULL;
+			authorityTime = NULL;
+		}
+
+		~ActiveObjectArrays()
+		{
+			Free();
+		}
+
+		void Allocate( int initialSize )
+		{
+			assert( memory == NULL );
+			assert( initialSize > 0 );
+			count = 0;
+			minimumSize = initialSize;
+			Resize( initialSize );
+		}
+
+		void Free()
+		{
+			delete [] memory;
+			memory = NULL;
+			idIndex.Free();
+			count = 0;
+			size = 0;
+			capacity = 0;
+		}
+
+		void Clear()
+		{
+			count = 0;
+			idIndex.Clear();
+		}
+
+		int Insert( ObjectId id )
+		{
+			if ( count >= size )
+				Resize( size * 2 );
+			ids[count] = id;
+			idIndex.Insert( id, count );
+			return count++;
+		}
+
+		void DeleteObject( int index )
+		{
+			assert( count >= 1 );
+			assert( index >= 0 );
+			assert( index < count );
+			int last = count - 1;
+			idIndex.Delete( ids, index, last );
+			if ( index != last )
+				Copy( index, last );
+			count--;
+
+			// same policy as activation::Set: shrink at a quarter full, never below the initial size
+			if ( count < size/4 && size/2 >= minimumSize )
+				Resize( size / 2 );
+		}
+
+		int FindIndex( ObjectId id ) const
+		{
+			return idIndex.Find( ids, count, id );
+		}
+
+		void LoadObject( int index, ActiveObject & object ) const
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			object.id = ids[index];
+			object.activeId = activeIds[index];
+			object.enabled = enabled[index];
+			object.player = player[index];
+			object.authority = authority[index];
+			object.authorityTime = authorityTime[index];
+			object.orientation = orientation[index];
+			object.position = math::Vector( x[index], y[index], z[index] );
+			object.linearVelocity = linearVelocity[index];
+			object.angularVelocity = angularVelocity[index];
+		}
+
+		void StoreObject( int index, const ActiveObject & object )
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			assert( ids[index] == object.id );		// the id is fixed on insert, it keys the index
+			activeIds[index] = object.activeId;
+			enabled[index] = object.enabled;
+			player[index] = object.player;
+			authority[index] = object.authority;
+			authorityTime[index] = object.authorityTime;
+			orientation[index] = object.orientation;
+			x[index] = object.position.x;
+			y[index] = object.position.y;
+			z[index] = object.position.z;
+			linearVelocity[index] = object.linearVelocity;
+			angularVelocity[index] = object.angularVelocity;
+		}
+
+		ObjectId GetId( int index ) const { return ids[index]; }
+		ActiveId GetActiveId( int index ) const { return activeIds[index]; }
+		bool IsEnabled( int index ) const { return enabled[index] != 0; }
+		int GetAuthority( int index ) const { return authority[index]; }
+		void SetAuthority( int index, int _authority ) { authority[index] = _authority; }
+		int GetAuthorityTime( int index ) const { return authorityTime[index]; }
+		void SetAuthorityTime( int index, int _authorityTime ) { authorityTime[index] = _authorityTime; }
+		math::Vector GetPosition( int index ) const { return math::Vector( x[index], y[index], z[index] ); }
+		math::Quaternion GetOrientation( int index ) const { return orientation[index]; }
+		math::Vector GetLinearVelocity( int index ) const { return linearVelocity[index]; }
+		void SetLinearVelocity( int index, const math::Vector & _linearVelocity ) { linearVelocity[index] = _linearVelocity; }
+		math::Vector GetAngularVelocity( int index ) const { return angularVelocity[index]; }
+		void SetAngularVelocity( int index, const math::Vector & _angularVelocity ) { angularVelocity[index] = _angularVelocity; }
+
+		void GetPositionXY( int index, float & _x, float & _y ) const
+		{
+			_x = x[index];
+			_y = y[index];
+		}
+
+		void ActiveToSimulation( int index, SimulationObjectState & simulationObject ) const
+		{
+			simulationObject.position = math::Vector( x[index], y[index], z[index] );
+			simulationObject.orientation = orientation[index];
+			simulationObject.linearVelocity = linearVelocity[index];
+			simulationObject.angularVelocity = angularVelocity[index];
+			simulationObject.enabled = enabled[index] != 0;
+			simulationObject.scale = player[index] ? PlayerCubeSize : NonPlayerCubeSize;
+		}
+
+		void SimulationToActive( int index, const SimulationObjectState & simulationObject )
+		{
+			x[index] = simulationObject.position.x;
+			y[index] = simulationObject.position.y;
+			z[index] = simulationObject.position.z;
+			orientation[index] = simulationObject.orientation;
+			linearVelocity[index] = simulationObject.linearVelocity;
+			angularVelocity[index] = simulationObject.angularVelocity;
+			enabled[index] = simulationObject.enabled;
+		}
+
+		void ActiveToView( int index, view::ObjectState & viewObjectState, int _authority, bool pendingDeactivation ) const
+		{
+			viewObjectState.id = ids[index];
+			viewObjectState.authority = _authority;
+			viewObjectState.position = math::Vector( x[index], y[index], z[index] );
+			viewObjectState.orientation = orientation[index];
+			viewObjectState.enabled = enabled[index] != 0;
+			viewObjectState.linearVelocity = linearVelocity[index];
+			viewObjectState.angularVelocity = angularVelocity[index];
+			viewObjectState.scale = player[index] ? PlayerCubeSize : NonPlayerCubeSize;
+			viewObjectState.pendingDeactivation = pendingDeactivation;
+		}
+
+		void ClampPositions( const math::Vector & min, const math::Vector & max )
+		{
+			// capacity is padded to a multiple of four, so the last group of four never runs off the end
+
+			ClampArray( x, min.x, max.x );
+			ClampArray( y, min.y, max.y );
+			ClampArray( z, min.z, max.z );
+		}
+
+		const float * GetPositionX() const { return x; }
+		const float * GetPositionY() const { return y; }
+		const float * GetPositionZ() const { return z; }
+
+		int GetCount() const
+		{
+			return count;
+		}
+
+		int GetSize() const
+		{
+			return size;
+		}
+
+		int GetBytes() const
+		{
+			return capacity * BytesPerObject + idIndex.GetBytes();
+		}
+
+	protected:
+
+		enum { BytesPerObject = sizeof( math::Quaternion ) + sizeof( float ) * 3 + sizeof( math::Vector ) * 2 + sizeof( uint32_t ) + sizeof( uint16_t ) + 4 };
+
+		void ClampArray( float * values, float min, float max )
+		{
+			#if defined( VECTORIAL_SSE )
+
+				// operand order matches vectorial::clamp exactly, including signed zero and NaN
+
+				const simd4f value_min = simd4f_splat( min );
+				const simd4f value_max = simd4f_splat( max );
+				for ( int i = 0; i < count; i += 4 )
+				{
+					simd4f value = simd4f_uload4( values + i );
+					value = _mm_max_ps( value_min, value );
+					value = _mm_min_ps( value_max, value );
+					simd4f_ustore4( value, values + i );
+				}
+
+			#else // #if defined( VECTORIAL_SSE )
+
+				for ( int i = 0; i < count; ++i )
+					values[i] = vectorial::clamp( values[i], min, max );
+
+			#endif // #if defined( VECTORIAL_SSE )
+		}
+
+		void Copy( int dest, int source )
+		{
+			ids[dest] = ids[source];
+			activeIds[dest] = activeIds[source];
+			enabled[dest] = enabled[source];
+			player[dest] = player[source];
+			authority[dest] = authority[source];
+			authorityTime[dest] = authorityTime[source];
+			orientation[dest] = orientation[source];
+			x[dest] = x[source];
+			y[dest] = y[source];
+			z[dest] = z[source];
+			linearVelocity[dest] = linearVelocity[source];
+			angularVelocity[dest] = angularVelocity[source];
+		}
+
+		template <typename T> T * Carve( uint8_t * & p, int n )
+		{
+			T * array = (T*) p;
+			p += sizeof(T) * n;
+			return array;
+		}
+
+		void Resize( int newSize )
+		{
+			assert( newSize >= 1 );
+			assert( count <= newSize );
+
+			// one block per resize. widest fields first so every array starts 16 byte aligned
+
+			const int newCapacity = ( newSize + 3 ) & ~3;
+			uint8_t * newMemory = new uint8_t[newCapacity * BytesPerObject + 15];
+			memset( newMemory, 0, newCapacity * BytesPerObject + 15 );
+			uint8_t * p = (uint8_t*) ( ( uintptr_t( newMemory ) + 15 ) & ~uintptr_t(15) );
+
+			math::Quaternion * newOrientation = Carve<math::Quaternion>( p, newCapacity );
+			float * newX = Carve<float>( p, newCapacity );
+			float * newY = Carve<float>( p, newCapacity );
+			float * newZ = Carve<float>( p, newCapacity );
+			math::Vector * newLinearVelocity = Carve<math::Vector>( p, newCapacity );
+			math::Vector * newAngularVelocity = Carve<math::Vector>( p, newCapacity );
+			uint32_t * newIds = Carve<uint32_t>( p, newCapacity );
+			uint16_t * newActiveIds = Carve<uint16_t>( p, newCapacity );
+			uint8_t * newEnabled = Carve<uint8_t>( p, newCapacity );
+			uint8_t * newPlayer = Carve<uint8_t>( p, newCapacity );
+			uint8_t * newAuthority = Carve<uint8_t>( p, newCapacity );
+			uint8_t * newAuthorityTime = Carve<uint8_t>( p, newCapacity );
+
+			if ( memory )
+			{
+				memcpy( newOrientation, orientation, sizeof( math::Quaternion ) * count );
+				memcpy( newX, x, sizeof( float ) * count );
+				memcpy( newY, y, sizeof( float ) * count );
+				memcpy( newZ, z, sizeof( float ) * count );
+				memcpy( newLinearVelocity, linearVelocity, sizeof( math::Vector ) * count );
+				memcpy( newAngularVelocity, angularVelocity, sizeof( math::Vector ) * count );
+				memcpy( newIds, ids, sizeof( uint32_t ) * count );
+				memcpy( newActiveIds, activeIds, sizeof( uint16_t ) * count );
+				memcpy( newEnabled, enabled, count );
+				memcpy( newPlayer, player, count );
+				memcpy( newAuthority, authority, count );
+				memcpy( newAuthorityTime, authorityTime, count );
+				delete [] memory;
+			}
+
+			memory = newMemory;
+			orientation = newOrientation;
+			x = newX;
+			y = newY;
+			z = newZ;
+			linearVelocity = newLinearVelocity;
+			angularVelocity = newAngularVelocity;
+			ids = newIds;
+			activeIds = newActiveIds;
+			enabled = newEnabled;
+			player = newPlayer;
+			authority = newAuthority;
+			authorityTime = newAuthorityTime;
+			size = newSize;
+			capacity = newCapacity;
+			idIndex.Rebuild( ids, count, size );
+		}
+
+		int count;
+		int size;
+		int minimumSize;
+		int capacity;
+		uint8_t * memory;
+		math::Quaternion * orientation;
+		float * x;
+		float * y;
+		float * z;
+		math::Vector * linearVelocity;
+		math::Vector * angularVelocity;
+		uint32_t * ids;
+		uint16_t * activeIds;
+		uint8_t * enabled;
+		uint8_t * player;
+		uint8_t * authority;
+		uint8_t * authorityTime;
+		activation::IdIndex idIndex;
+	};
 }
 
 #endif
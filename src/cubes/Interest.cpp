@@ -0,0 +1,327 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "Interest.h"
+#include <algorithm>
+#include <math.h>
+
+namespace cubes
+{
+	static const int InitialEntriesPerClient = 64;
+
+	InterestManager::InterestManager( int maxClients, const InterestConfig & config )
+	{
+		assert( maxClients >= 1 );
+		assert( config.relevanceRadius > 0.0f );
+		assert( config.viewAngle >= 0.0f && config.viewAngle <= math::pi );
+		this->config = config;
+		this->maxClients = maxClients;
+		frame = 0;
+		clients = new Client[maxClients];
+		for ( int i = 0; i < maxClients; ++i )
+		{
+			Client & client = clients[i];
+			client.connected = false;
+			client.x = 0.0f;
+			client.y = 0.0f;
+			client.dirX = 0.0f;
+			client.dirY = 0.0f;
+			client.focus = 0;
+		}
+	}
+
+	InterestManager::~InterestManager()
+	{
+		delete [] clients;
+		clients = NULL;
+	}
+
+	void InterestManager::AddClient( int clientIndex )
+	{
+		Client & client = GetClient( clientIndex );
+		assert( !client.connected );
+		client.connected = true;
+		client.x = 0.0f;
+		client.y = 0.0f;
+		client.dirX = 0.0f;
+		client.dirY = 0.0f;
+		client.focus = 0;
+		client.entries.Allocate( InitialEntriesPerClient );
+	}
+
+	void InterestManager::RemoveClient( int clientIndex )
+	{
+		Client & client = GetClient( clientIndex );
+		assert( client.connected );
+		client.connected = false;
+		client.entries.Free();
+		client.interactions.clear();
+	}
+
+	bool InterestManager::IsClientConnected( int clientIndex ) const
+	{
+		return GetClient( clientIndex ).connected;
+	}
+
+	void InterestManager::SetClientView( int clientIndex, float x, float y, float dirX, float dirY )
+	{
+		Client & client = GetClient( clientIndex );
+		client.x = x;
+		client.y = y;
+		const float length = sqrtf( dirX * dirX + dirY * dirY );
+		if ( length > 0.0f )
+		{
+			client.dirX = dirX / length;
+			client.dirY = dirY / length;
+		}
+		else
+		{
+			client.dirX = 0.0f;
+			client.dirY = 0.0f;
+		}
+	}
+
+	void InterestManager::SetClientFocus( int clientIndex, ObjectId id )
+	{
+		GetClient( clientIndex ).focus = id;
+	}
+
+	void InterestManager::OnInteraction( int clientIndex, ObjectId id )
+	{
+		Client & client = GetClient( clientIndex );
+		assert( client.connected );
+
+		// only existing entries have a valid active index, so an object that is not relevant
+		// yet is not inserted here, where SelectObjects could see it before the next update
+
+		Entry * entry = client.entries.FindObject( id );
+		if ( entry )
+			entry->interactionTime = config.interactionTime;
+		else
+			client.interactions.push_back( id );
+	}
+
+	void InterestManager::Update( const activation::ActivationSystem & activationSystem, float deltaTime )
+	{
+		frame++;
+		stats = InterestStats();
+		for ( int i = 0; i < maxClients; ++i )
+		{
+			if ( clients[i].connected )
+				UpdateClient( clients[i], activationSystem, deltaTime );
+		}
+	}
+
+	void InterestManager::UpdateClient( Client & client, const activation::ActivationSystem & activationSystem, float deltaTime )
+	{
+		const float radius = config.relevanceRadius;
+		const float radiusSquared = radius * radius;
+		const float inverseRadius = 1.0f / radius;
+		const float viewCosine = cosf( config.viewAngle * 0.5f );
+		const bool hasView = client.dirX != 0.0f || client.dirY != 0.0f;
+
+		std::sort( client.interactions.begin(), client.interactions.end() );
+
+		// only the cells overlapping the bounding square of the relevance circle are walked,
+		// and of those, cells whose nearest point is outside the circle are skipped entirely
+
+		const float inverseCellSize = 1.0f / activationSystem.GetCellSize();
+		const float boundX = activationSystem.GetBoundX();
+		const float boundY = activationSystem.GetBoundY();
+		const int width = activationSystem.GetWidth();
+		const int height = activationSystem.GetHeight();
+
+		const int ix1 = math::clamp( (int) math::floor( ( client.x - radius + boundX ) * inverseCellSize ), 0, width - 1 );
+		const int ix2 = math::clamp( (int) math::floor( ( client.x + radius + boundX ) * inverseCellSize ), 0, width - 1 );
+		const int iy1 = math::clamp( (int) math::floor( ( client.y - radius + boundY ) * inverseCellSize ), 0, height - 1 );
+		const int iy2 = math::clamp( (int) math::floor( ( client.y + radius + boundY ) * inverseCellSize ), 0, height - 1 );
+
+		for ( int iy = iy1; iy <= iy2; ++iy )
+		{
+			for ( int ix = ix1; ix <= ix2; ++ix )
+			{
+				const activation::Cell & cell = *activationSystem.GetCellAtIndex( ix, iy );
+
+				const float nearestX = core::max( 0.0f, core::max( cell.x1 - client.x, client.x - cell.x2 ) );
+				const float nearestY = core::max( 0.0f, core::max( cell.y1 - client.y, client.y - cell.y2 ) );
+				if ( nearestX * nearestX + nearestY * nearestY > radiusSquared )
+					continue;
+
+				if ( !cell.resident )
+					continue;
+
+				stats.cellsVisited++;
+
+				const int count = cell.objects.GetCount();
+				if ( count == 0 )
+					continue;
+
+				const activation::CellObject * objects = cell.objects.GetObjectArray();
+
+				stats.objectsTested += count;
+
+				for ( int i = 0; i < count; ++i )
+				{
+					const activation::CellObject & cellObject = objects[i];
+					if ( !cellObject.active )
+						continue;
+
+					const float dx = cellObject.x - client.x;
+					const float dy = cellObject.y - client.y;
+					const float distanceSquared = dx * dx + dy * dy;
+					if ( distanceSquared > radiusSquared )
+						continue;
+
+					const float distance = sqrtf( distanceSquared );
+
+					Entry & entry = FindOrInsertEntry( client, cellObject.id );
+					entry.activeIndex = cellObject.activeObjectIndex;
+					entry.frame = frame;
+
+					float priority = config.basePriority + config.distancePriority * ( 1.0f - distance * inverseRadius );
+
+					if ( !hasView || dx * client.dirX + dy * client.dirY >= viewCosine * distance )
+						priority += config.visiblePriority;
+
+					if ( entry.interactionTime > 0.0f )
+					{
+						priority += config.interactionPriority;
+						entry.interactionTime = core::max( 0.0f, entry.interactionTime - deltaTime );
+					}
+
+					if ( cellObject.id == client.focus )
+						priority += config.focusPriority;
+
+					entry.accumulator += priority * deltaTime;
+				}
+			}
+		}
+
+		client.interactions.clear();
+
+		// objects not seen this update are no longer relevant. walk backwards so the
+		// entry swapped into a deleted slot has already been checked
+
+		for ( int i = client.entries.GetCount() - 1; i >= 0; --i )
+		{
+			if ( client.entries.GetObject( i ).frame != frame )
+				client.entries.DeleteObject( i );
+		}
+
+		stats.relevantObjects += client.entries.GetCount();
+	}
+
+	int InterestManager::GetNumRelevantObjects( int clientIndex ) const
+	{
+		return GetClient( clientIndex ).entries.GetCount();
+	}
+
+	bool InterestManager::IsRelevant( int clientIndex, ObjectId id ) const
+	{
+		const Client & client = GetClient( clientIndex );
+		return client.connected && client.entries.FindIndex( id ) >= 0;
+	}
+
+	float InterestManager::GetAccumulator( int clientIndex, ObjectId id ) const
+	{
+		const Client & client = GetClient( clientIndex );
+		if ( !client.connected )
+			return 0.0f;
+		const Entry * entry = client.entries.FindObject( id );
+		return entry ? entry->accumulator : 0.0f;
+	}
+
+	void InterestManager::ResetAccumulator( int clientIndex, ObjectId id )
+	{
+		Client & client = GetClient( clientIndex );
+		assert( client.connected );
+		Entry * entry = client.entries.FindObject( id );
+		if ( entry )
+			entry->accumulator = 0.0f;
+	}
+
+	int InterestManager::SelectObjects( int clientIndex, int count )
+	{
+		assert( count >= 0 );
+		Client & client = GetClient( clientIndex );
+		assert( client.connected );
+		const int numEntries = client.entries.GetCount();
+		selected_entries.resize( numEntries );
+		for ( int i = 0; i < numEntries; ++i )
+		{
+			const Entry & entry = client.entries.GetObject( i );
+			selected_entries[i].id = client.entries.GetId( i );
+			selected_entries[i].activeIndex = entry.activeIndex;
+			selected_entries[i].accumulator = entry.accumulator;
+		}
+		count = core::min( count, numEntries );
+		if ( count < numEntries )
+			std::nth_element( selected_entries.begin(), selected_entries.begin() + count, selected_entries.end() );
+		std::sort( selected_entries.begin(), selected_entries.begin() + count );
+		selected_entries.resize( count );
+		return count;
+	}
+
+	ObjectId InterestManager::GetSelectedObject( int index, float & priority ) const
+	{
+		assert( index >= 0 );
+		assert( index < (int) selected_entries.size() );
+		priority = selected_entries[index].accumulator;
+		return selected_entries[index].id;
+	}
+
+	int InterestManager::GetSelectedActiveIndex( int index ) const
+	{
+		assert( index >= 0 );
+		assert( index < (int) selected_entries.size() );
+		return selected_entries[index].activeIndex;
+	}
+
+	InterestManager::Client & InterestManager::GetClient( int clientIndex )
+	{
+		assert( clientIndex >= 0 );
+		assert( clientIndex < maxClients );
+		return clients[clientIndex];
+	}
+
+	const InterestManager::Client & InterestManager::GetClient( int clientIndex ) const
+	{
+		assert( clientIndex >= 0 );
+		assert( clientIndex < maxClients );
+		return clients[clientIndex];
+	}
+
+	InterestManager::Entry & InterestManager::FindOrInsertEntry( Client & client, ObjectId id )
+	{
+		Entry * existing = client.entries.FindObject( id );
+		if ( existing )
+			return *existing;
+		Entry & entry = client.entries.InsertObject( id );
+		entry.accumulator = 0.0f;
+		entry.interactionTime = std::binary_search( client.interactions.begin(), client.interactions.end(), id ) ? config.interactionTime : 0.0f;
+		entry.activeIndex = -1;
+		entry.frame = frame;
+		return entry;
+	}
+}
@@ -0,0 +1,193 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CUBES_INTEREST_H
+#define CUBES_INTEREST_H
+
+#include "Activation.h"
+#include <vector>
+
+namespace cubes
+{
+	using activation::ObjectId;
+
+	/*
+		Priority terms for interest management.
+		An object is relevant to a client while it is active and within
+		the relevance radius of the client. Each relevant object gains
+		priority * deltaTime per update in the client's accumulator.
+	*/
+
+	struct InterestConfig
+	{
+		float relevanceRadius;				// objects further away than this are not sent to the client at all
+		float basePriority;					// every relevant object gets this
+		float distancePriority;				// extra priority that falls off linearly to zero at the relevance radius
+		float visiblePriority;				// extra priority inside the client view cone
+		float viewAngle;					// full angle of the view cone in radians, at most pi
+		float interactionPriority;			// extra priority for objects the client recently interacted with
+		float interactionTime;				// how long an interaction boost lasts in seconds
+		float focusPriority;				// extra priority for the object the client controls
+
+		InterestConfig()
+		{
+			relevanceRadius = 32.0f;
+			basePriority = 1.0f;
+			distancePriority = 10.0f;
+			visiblePriority = 10.0f;
+			viewAngle = math::pi / 2;
+			interactionPriority = 100.0f;
+			interactionTime = 1.0f;
+			focusPriority = 1000000.0f;
+		}
+	};
+
+	struct InterestStats
+	{
+		int cellsVisited;					// cells walked last update, summed over clients
+		int objectsTested;					// cell objects distance tested last update
+		int relevantObjects;				// relevant objects last update, summed over clients
+
+		InterestStats()
+		{
+			cellsVisited = 0;
+			objectsTested = 0;
+			relevantObjects = 0;
+		}
+	};
+
+	/*
+		Per-client interest management over the activation grid.
+		Each client keeps a set of the objects relevant to it, keyed by
+		object id, with a priority accumulator per object. Updates only
+		walk the grid cells that overlap the relevance circle of each
+		client, and objects that stop being relevant are dropped along
+		with their accumulator, so the cost scales with the number of
+		relevant objects per client rather than total objects x clients.
+	*/
+
+	class InterestManager
+	{
+	public:
+
+		InterestManager( int maxClients, const InterestConfig & config = InterestConfig() );
+
+		~InterestManager();
+
+		void AddClient( int client );
+
+		void RemoveClient( int client );
+
+		bool IsClientConnected( int client ) const;
+
+		int GetMaxClients() const
+		{
+			return maxClients;
+		}
+
+		// direction need not be normalized. zero direction sees everything
+		void SetClientView( int client, float x, float y, float dirX = 0.0f, float dirY = 0.0f );
+
+		void SetClientFocus( int client, ObjectId id );
+
+		// boosts the object for the client for config.interactionTime seconds. objects that
+		// are not relevant yet pick up the boost if they become relevant on the next update
+		void OnInteraction( int client, ObjectId id );
+
+		void Update( const activation::ActivationSystem & activationSystem, float deltaTime );
+
+		int GetNumRelevantObjects( int client ) const;
+
+		bool IsRelevant( int client, ObjectId id ) const;
+
+		float GetAccumulator( int client, ObjectId id ) const;
+
+		void ResetAccumulator( int client, ObjectId id );
+
+		// sorts the count relevant objects with the highest accumulators for the client, returns how many there are
+		int SelectObjects( int client, int count );
+
+		ObjectId GetSelectedObject( int index, float & priority ) const;
+
+		// active index of a selected object, valid until the activation system next updates
+		int GetSelectedActiveIndex( int index ) const;
+
+		const InterestConfig & GetConfig() const
+		{
+			return config;
+		}
+
+		const InterestStats & GetStats() const
+		{
+			return stats;
+		}
+
+	private:
+
+		struct Entry
+		{
+			float accumulator;
+			float interactionTime;
+			int activeIndex;
+			uint32_t frame;
+		};
+
+		struct Client
+		{
+			bool connected;
+			float x,y;
+			float dirX,dirY;
+			ObjectId focus;
+			activation::Set<Entry> entries;
+			std::vector<ObjectId> interactions;		// boosts waiting for the object to become relevant
+		};
+
+		struct SelectedEntry
+		{
+			ObjectId id;
+			int activeIndex;
+			float accumulator;
+			bool operator < ( const SelectedEntry & other ) const
+			{
+				return accumulator > other.accumulator || ( accumulator == other.accumulator && id < other.id );
+			}
+		};
+
+		void UpdateClient( Client & client, const activation::ActivationSystem & activationSystem, float deltaTime );
+
+		Client & GetClient( int client );
+		const Client & GetClient( int client ) const;
+
+		Entry & FindOrInsertEntry( Client & client, ObjectId id );
+
+		InterestConfig config;
+		InterestStats stats;
+		int maxClients;
+		uint32_t frame;
+		Client * clients;
+		std::vector<SelectedEntry> selected_entries;
+	};
+}
+
+#endif
@@ -26,6 +26,10 @@
 #define MATHEMATICS_H
 
 #include "Config.h"
+#include "core/Random.h"
+#include "vectorial/simd4f.h"
+#include "vectorial/vec3f.h"
+#include "vectorial/quat4f.h"
 
 #include <math.h>
 #include <float.h>
@@ -200,17 +204,17 @@ namespace math
 
 	// random numbers
 	
+	// these draw from the calling thread's default core random generator
+
 	inline void init_random( int seed )
 	{
-		srand( seed );
+		core::random_seed( seed );
 	}
 
 	inline int random( int maximum )
 	{
 		assert( maximum > 0 );
-		int randomNumber = 0;
-		randomNumber = rand() % maximum;
-		return randomNumber;
+		return (int) core::default_random_generator().GetUint32( maximum );
 	}
 
 	inline float random_float( float min, float max )
@@ -227,7 +231,36 @@ namespace math
 		return random(100) <= percent;
 	}
 
-	// vector class
+	// lane helpers missing from vectorial
+
+	#if defined( VECTORIAL_SSE )
+
+		template <int a, int b, int c, int d> inline simd4f lanes_shuffle( simd4f v )
+		{
+			return _mm_shuffle_ps( v, v, _MM_SHUFFLE( d, c, b, a ) );
+		}
+
+	#else // #if defined( VECTORIAL_SSE )
+
+		template <int a, int b, int c, int d> inline simd4f lanes_shuffle( simd4f v )
+		{
+			float values[4];
+			simd4f_ustore4( v, values );
+			return simd4f_create( values[a], values[b], values[c], values[d] );
+		}
+
+	#endif // #if defined( VECTORIAL_SSE )
+
+	/*
+		Vector class.
+
+		Backed by one simd4f, with x,y,z in the first three lanes so it
+		converts to and from vectorial::vec3f without touching memory.
+		The fourth lane is padding. It is zero when built from components.
+
+		Every operation does the same float operations in the same order
+		as the scalar version did, so results are bit identical.
+	*/
 
 	class Vector
 	{
@@ -240,51 +273,46 @@ namespace math
 	    // construct vector from x,y,z components.
 
 	    Vector(float _x, float _y, float _z)
-			: x( _x ), y( _y ), z( _z ) {}
+			: value( simd4f_create( _x, _y, _z, 0.0f ) ) {}
+
+	    // construct vector from simd lanes.
+
+	    explicit Vector(simd4f _value)
+			: value( _value ) {}
 
 	    // set vector to zero.
 
 	    void zero()
 	    {
-	        x = 0;
-	        y = 0;
-	        z = 0;
+	        value = simd4f_zero();
 	    }
 
 	    // negate vector.
 
 		void negate()
 		{
-			x = -x;
-			y = -y;
-			z = -z;
+			value = simd4f_mul( value, simd4f_splat( -1.0f ) );
 		}
 
 	    // add another vector to this vector.
 
 	    void add(const Vector &vector)
 	    {
-	        x += vector.x;
-	        y += vector.y;
-	        z += vector.z;
+	        value = simd4f_add( value, vector.value );
 	    }
 
 	    // subtract another vector from this vector.
 
 	    void subtract(const Vector &vector)
 	    {
-	        x -= vector.x;
-	        y -= vector.y;
-	        z -= vector.z;
+	        value = simd4f_sub( value, vector.value );
 	    }
 
 	    // multiply this vector by a scalar.
 
 	    void multiply(float scalar)
 	    {
-	        x *= scalar;
-	        y *= scalar;
-	        z *= scalar;
+	        value = simd4f_mul( value, simd4f_splat( scalar ) );
 	    }
 
 	    // divide this vector by a scalar.
@@ -293,46 +321,43 @@ namespace math
 		{
 			assert(scalar!=0);
 			const float inv = 1.0f / scalar;
-			x *= inv;
-			y *= inv;
-			z *= inv;
+			value = simd4f_mul( value, simd4f_splat( inv ) );
 		}
 
 	    // calculate dot product of this vector with another vector.
 
 	    float dot(const Vector &vector) const
 	    {
-	        return x * vector.x + y * vector.y + z * vector.z;
+	        const simd4f product = simd4f_mul( value, vector.value );
+	        return simd4f_get_x( product ) + simd4f_get_y( product ) + simd4f_get_z( product );
 	    }
 
 	    // calculate cross product of this vector with another vector.
 
 		Vector cross(const Vector &vector) const
 	    {
-	        return Vector(y * vector.z - z * vector.y, z * vector.x - x * vector.z, x * vector.y - y * vector.x);
+	        return Vector( simd4f_cross3( value, vector.value ) );
 	    }
 
 	    // calculate cross product of this vector with another vector, store result in parameter.
 
 		void cross(const Vector &vector, Vector &result) const
 	    {
-	        result.x = y * vector.z - z * vector.y;
-	        result.y = z * vector.x - x * vector.z;
-	        result.z = x * vector.y - y * vector.x;
+	        result.value = simd4f_cross3( value, vector.value );
 	    }
 
 	    // calculate length of vector squared
 
 	    float lengthSquared() const
 	    {
-	        return x*x + y*y + z*z;
+	        return dot( *this );
 	    }
 
 	    // calculate length of vector.
 
 	    float length() const
 	    {
-			return sqrt(x*x + y*y + z*z);
+			return sqrt( lengthSquared() );
 	    }
 
 	    float length2d() const
@@ -344,13 +369,11 @@ namespace math
 
 	    Vector& normalize()
 	    {
-	        const float magnitude = sqrt(x*x + y*y + z*z);
+	        const float magnitude = length();
 	        if (magnitude>epsilon)
 	        {
 	            const float scale = 1.0f / magnitude;
-	            x *= scale;
-	            y *= scale;
-	            z *= scale;
+	            value = simd4f_mul( value, simd4f_splat( scale ) );
 	        }
 			return *this;
 	    }
@@ -421,96 +444,89 @@ namespace math
 		friend inline Vector operator*(float s, const Vector &a);
 		friend inline Vector& operator*=(float s, Vector &a);
 
-	    float x;        // x component of vector
-	    float y;        // y component of vector
-	    float z;        // z component of vector
+		union
+		{
+			simd4f value;       // x,y,z,w lanes
+			struct
+			{
+			    float x;        // x component of vector
+			    float y;        // y component of vector
+			    float z;        // z component of vector
+			    float w;        // padding
+			};
+		};
 	};
 
   	inline Vector operator-(const Vector &a)
 	{
-		return Vector(-a.x, -a.y, -a.z);
+		return Vector( simd4f_mul( a.value, simd4f_splat( -1.0f ) ) );
 	}
   
 	inline Vector operator+(const Vector &a, const Vector &b)
 	{
-		return Vector(a.x+b.x, a.y+b.y, a.z+b.z);
+		return Vector( simd4f_add( a.value, b.value ) );
 	}
 
 	inline Vector operator-(const Vector &a, const Vector &b)
 	{
-		return Vector(a.x-b.x, a.y-b.y, a.z-b.z);
+		return Vector( simd4f_sub( a.value, b.value ) );
 	}
 
 	inline Vector operator*(const Vector &a, const Vector &b)
 	{
-		return Vector(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+		return Vector( simd4f_cross3( a.value, b.value ) );
 	}
 
 	inline Vector& operator+=(Vector &a, const Vector &b)
 	{
-		a.x += b.x;
-		a.y += b.y;
-		a.z += b.z;
+		a.value = simd4f_add( a.value, b.value );
 		return a;
 	}
 
 	inline Vector& operator-=(Vector &a, const Vector &b)
 	{
-		a.x -= b.x;
-		a.y -= b.y;
-		a.z -= b.z;
+		a.value = simd4f_sub( a.value, b.value );
 		return a;
 	}
 
 	inline Vector& operator*=(Vector &a, const Vector &b)
 	{
-		const float cx = a.y * b.z - a.z * b.y;
-		const float cy = a.z * b.x - a.x * b.z;
-		const float cz = a.x * b.y - a.y * b.x;
-		a.x = cx;
-		a.y = cy;
-		a.z = cz;
+		a.value = simd4f_cross3( a.value, b.value );
 		return a;
 	}
 
 	inline Vector operator*(const Vector &a, float s)
 	{
-		return Vector(a.x*s, a.y*s, a.z*s);
+		return Vector( simd4f_mul( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Vector operator/(const Vector &a, float s)
 	{
 		assert(s!=0);
-		return Vector(a.x/s, a.y/s, a.z/s);
+		return Vector( simd4f_div( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Vector& operator*=(Vector &a, float s)
 	{
-		a.x *= s;
-		a.y *= s;
-		a.z *= s;
+		a.value = simd4f_mul( a.value, simd4f_splat( s ) );
 		return a;
 	}
 
 	inline Vector& operator/=(Vector &a, float s)
 	{
 		assert(s!=0);
-		a.x /= s;
-		a.y /= s;
-		a.z /= s;
+		a.value = simd4f_div( a.value, simd4f_splat( s ) );
 		return a;
 	}
 
 	inline Vector operator*(float s, const Vector &a)
 	{
-		return Vector(a.x*s, a.y*s, a.z*s);
+		return Vector( simd4f_mul( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Vector& operator*=(float s, Vector &a)
 	{
-		a.x *= s;
-		a.y *= s;
-		a.z *= s;
+		a.value = simd4f_mul( a.value, simd4f_splat( s ) );
 		return a;
 	}
 
@@ -1415,6 +1431,25 @@ namespace math
 	// anticipated uses of quaternions are unit length representing
 	// a rotation 2*acos(w) about the axis (x,y,z).
 
+	// quaternion product on lanes w,x,y,z. each lane sums its four terms in the same order as the scalar form
+
+	inline simd4f quaternion_multiply( simd4f a, simd4f b )
+	{
+		const simd4f t0 = simd4f_mul( simd4f_splat_x( a ), b );
+		const simd4f t1 = simd4f_mul( simd4f_mul( simd4f_splat_y( a ), lanes_shuffle<1,0,3,2>( b ) ), simd4f_create( -1.0f, +1.0f, -1.0f, +1.0f ) );
+		const simd4f t2 = simd4f_mul( simd4f_mul( simd4f_splat_z( a ), lanes_shuffle<2,3,0,1>( b ) ), simd4f_create( -1.0f, +1.0f, +1.0f, -1.0f ) );
+		const simd4f t3 = simd4f_mul( simd4f_mul( simd4f_splat_w( a ), lanes_shuffle<3,2,1,0>( b ) ), simd4f_create( -1.0f, -1.0f, +1.0f, +1.0f ) );
+		return simd4f_add( simd4f_add( simd4f_add( t0, t1 ), t2 ), t3 );
+	}
+
+	/*
+		Quaternion class.
+
+		Backed by one simd4f with lanes in w,x,y,z order, the same
+		order ode and the compressed orientation code use. Converting
+		to vectorial::quat4f (x,y,z,w) is a single shuffle.
+	*/
+
 	class Quaternion
 	{
 	public:
@@ -1426,12 +1461,12 @@ namespace math
 		// construct quaternion from real component w and imaginary x,y,z.
 
 		Quaternion( float w, float x, float y, float z )
-		{
-			this->w = w;
-			this->x = x;
-			this->y = y;
-			this->z = z;
-		}
+			: value( simd4f_create( w, x, y, z ) ) {}
+
+		// construct quaternion from simd lanes in w,x,y,z order.
+
+		explicit Quaternion( simd4f _value )
+			: value( _value ) {}
 
 		// construct quaternion from angle-axis
 
@@ -1440,10 +1475,7 @@ namespace math
 			const float a = angle * 0.5f;
 			const float s = (float) sin( a );
 			const float c = (float) cos( a );
-			w = c;
-			x = axis.x * s;
-			y = axis.y * s;
-			z = axis.z * s;
+			value = simd4f_create( c, axis.x * s, axis.y * s, axis.z * s );
 		}
 
 		// construct quaternion from rotation matrix.
@@ -1542,50 +1574,35 @@ namespace math
 
 		void zero()
 		{
-			w = 0;
-			x = 0;
-			y = 0;
-			z = 0;
+			value = simd4f_zero();
 		}
 
 		// set quaternion to identity.
 
 		void identity()
 		{
-			w = 1;
-			x = 0;
-			y = 0;
-			z = 0;
+			value = simd4f_create( 1, 0, 0, 0 );
 		}
 
 		// add another quaternion to this quaternion.
 
 		void add( const Quaternion & q )
 		{
-			w += q.w;
-			x += q.x;
-			y += q.y;
-			z += q.z;
+			value = simd4f_add( value, q.value );
 		}
 
 		// subtract another quaternion from this quaternion.
 
 		void subtract( const Quaternion & q )
 		{
-			w -= q.w;
-			x -= q.x;
-			y -= q.y;
-			z -= q.z;
+			value = simd4f_sub( value, q.value );
 		}
 
 		// multiply this quaternion by a scalar.
 
 		void multiply( float s  )
 		{
-			w *= s;
-			x *= s;
-			y *= s;
-			z *= s;
+			value = simd4f_mul( value, simd4f_splat( s ) );
 		}
 
 		// divide this quaternion by a scalar.
@@ -1594,69 +1611,57 @@ namespace math
 		{
 			assert( s != 0 );
 			const float inv = 1.0f / s;
-			w *= inv;
-			x *= inv;
-			y *= inv;
-			z *= inv;
+			value = simd4f_mul( value, simd4f_splat( inv ) );
 		}
 
 		// multiply this quaternion with another quaternion.
 
 		void multiply( const Quaternion & q )
 		{
-			const float rw = w*q.w - x*q.x - y*q.y - z*q.z;
-			const float rx = w*q.x + x*q.w + y*q.z - z*q.y;
-			const float ry = w*q.y - x*q.z + y*q.w + z*q.x;
-			const float rz = w*q.z + x*q.y - y*q.x + z*q.w;
-			w = rw;
-			x = rx;
-			y = ry;
-			z = rz;
+			value = quaternion_multiply( value, q.value );
 		}
 
 		// multiply this quaternion with another quaternion and store result in parameter.
 
 		void multiply( const Quaternion & q, Quaternion & result ) const
 		{
-			result.w = w*q.w - x*q.x - y*q.y - z*q.z;
-			result.x = w*q.x + x*q.w + y*q.z - z*q.y;
-			result.y = w*q.y - x*q.z + y*q.w + z*q.x;
-			result.z = w*q.z + x*q.y - y*q.x + z*q.w;
+			result.value = quaternion_multiply( value, q.value );
 		}
 
 		// dot product of two quaternions.
 
  		float dot( const Quaternion & q ) const
 		{
-			return w*q.w + x*q.x + y*q.y + z*q.z;
+			const simd4f product = simd4f_mul( value, q.value );
+			return simd4f_get_x( product ) + simd4f_get_y( product ) + simd4f_get_z( product ) + simd4f_get_w( product );
 		}
 
 		// calculate conjugate of quaternion.
 
 		Quaternion conjugate()
 		{
-			return Quaternion( w, -x, -y, -z );
+			return Quaternion( simd4f_mul( value, simd4f_create( +1.0f, -1.0f, -1.0f, -1.0f ) ) );
 		}
 
 		// calculate conjugate of quaternion and store result in parameter.
 
 		void conjugate( Quaternion & result ) const
 		{
-			result = Quaternion( w, -x, -y, -z );
+			result.value = simd4f_mul( value, simd4f_create( +1.0f, -1.0f, -1.0f, -1.0f ) );
 		}
 		
 		// calculate length of quaternion
 
 		float length() const
 		{
-			return sqrt( w*w + x*x + y*y + z*z );
+			return sqrt( norm() );
 		}
 
 		// calculate norm of quaternion.
 
 		float norm() const
 		{
-			return w*w + x*x + y*y + z*z;
+			return dot( *this );
 		}
 
 		// normalize quaternion.
@@ -1667,18 +1672,12 @@ namespace math
 
 			if (length == 0)
 			{
-				w = 1;
-				x = 0;
-				y = 0;
-				z = 0;
+				identity();
 			}
 			else
 			{
 				float inv = 1.0f / length;
-				x = x * inv;
-				y = y * inv;
-				z = z * inv;
-				w = w * inv;
+				value = simd4f_mul( value, simd4f_splat( inv ) );
 			}
 		}
 
@@ -1724,7 +1723,7 @@ namespace math
 		{
 			const float n = norm();
 			assert( n != 0 );
-			return Quaternion( w/n, -x/n, -y/n, -z/n ); 
+			return Quaternion( simd4f_div( simd4f_mul( value, simd4f_create( +1.0f, -1.0f, -1.0f, -1.0f ) ), simd4f_splat( n ) ) );
 		}
 
 		// calculate inverse of quaternion and store result in parameter.
@@ -1732,7 +1731,7 @@ namespace math
 		void inverse( Quaternion & result ) const
 		{
 			const float n = norm();
-			result = Quaternion( w/n, -x/n, -y/n, -z/n );
+			result.value = simd4f_div( simd4f_mul( value, simd4f_create( +1.0f, -1.0f, -1.0f, -1.0f ) ), simd4f_splat( n ) );
 		}
 
 		// equals operator
@@ -1787,51 +1786,49 @@ namespace math
 		friend inline Quaternion & operator /= ( Quaternion & a, float s );
 		friend inline Quaternion & operator *= ( float s, Quaternion & a );
 
-		float w;        // w component of quaternion
-		float x;        // x component of quaternion
-		float y;        // y component of quaternion
-		float z;        // z component of quaternion
+		union
+		{
+			simd4f value;       // w,x,y,z lanes
+			struct
+			{
+				float w;        // w component of quaternion
+				float x;        // x component of quaternion
+				float y;        // y component of quaternion
+				float z;        // z component of quaternion
+			};
+		};
 	};
 
 
 	inline Quaternion operator - ( const Quaternion & a )
 	{
-		return Quaternion( -a.w, -a.x, -a.y, -a.z );
+		return Quaternion( simd4f_mul( a.value, simd4f_splat( -1.0f ) ) );
 	}
 
 	inline Quaternion operator + ( const Quaternion & a, const Quaternion & b )
 	{
-		return Quaternion( a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z );
+		return Quaternion( simd4f_add( a.value, b.value ) );
 	}
 
 	inline Quaternion operator - ( const Quaternion & a, const Quaternion & b )
 	{
-		return Quaternion( a.w - b.w, a.x - b.x, a.y - b.y, a.z - b.z );
+		return Quaternion( simd4f_sub( a.value, b.value ) );
 	}
 
 	inline Quaternion operator * ( const Quaternion & a, const Quaternion & b )
 	{
-		return Quaternion( a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z, 
-						   a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
-						   a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
-						   a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w );
+		return Quaternion( quaternion_multiply( a.value, b.value ) );
 	}
 
 	inline Quaternion & operator += ( Quaternion & a, const Quaternion & b )
 	{
-		a.w += b.w;
-		a.x += b.x;
-		a.y += b.y;
-		a.z += b.z;
+		a.add( b );
 		return a;
 	}
 
 	inline Quaternion & operator -= ( Quaternion & a, const Quaternion & b )
 	{
-		a.w -= b.w;
-		a.x -= b.x;
-		a.y -= b.y;
-		a.z -= b.z;
+		a.subtract( b );
 		return a;
 	}
 
@@ -1863,12 +1860,12 @@ namespace math
 
 	inline Quaternion operator * ( const Quaternion & a, float s )
 	{
-		return Quaternion( a.w * s, a.x * s, a.y * s, a.z * s );
+		return Quaternion( simd4f_mul( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Quaternion operator / ( const Quaternion & a, float s )
 	{
-		return Quaternion( a.w / s, a.x / s, a.y / s, a.z / s );
+		return Quaternion( simd4f_div( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Quaternion & operator *= ( Quaternion & a, float s )
@@ -1885,7 +1882,7 @@ namespace math
 
 	inline Quaternion operator * ( float s, const Quaternion & a )
 	{
-		return Quaternion( a.w * s, a.x * s, a.y * s, a.z * s );
+		return Quaternion( simd4f_mul( a.value, simd4f_splat( s ) ) );
 	}
 
 	inline Quaternion & operator *= ( float s, Quaternion & a )
@@ -1901,7 +1898,7 @@ namespace math
 		
 		Quaternion b = _b;
 
-		float cosine = a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z;
+		float cosine = a.dot( b );
 		if ( cosine < 0 )
 			b = -b;
 
@@ -1957,28 +1954,38 @@ inline Quaternion slerp( const Quaternion & a, const Quaternion & b, float t )
 		assert( t >= 0 );
 		assert( t <= 1 );
 
-		float cosine = a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z;
+		float cosine = a.dot( b );
 
-		Quaternion output;
-		if ( cosine >= 0 ) 
-		{ 
-			output.w = a.w + ( b.w - a.w ) * t;
-			output.x = a.x + ( b.x - a.x ) * t;
-			output.y = a.y + ( b.y - a.y ) * t;
-			output.z = a.z + ( b.z - a.z ) * t;
-		}
-		else
-		{
-			output.w = a.w + ( -b.w - a.w ) * t;
-			output.x = a.x + ( -b.x - a.x ) * t;
-			output.y = a.y + ( -b.y - a.y ) * t;
-			output.z = a.z + ( -b.z - a.z ) * t;
-		}
+		const simd4f target = cosine >= 0 ? b.value : simd4f_mul( b.value, simd4f_splat( -1.0f ) );
+
+		Quaternion output( simd4f_add( a.value, simd4f_mul( simd4f_sub( target, a.value ), simd4f_splat( t ) ) ) );
 
 		output.normalize();
 
 		return output;
 	}
+
+	// convert to and from vectorial. vector lanes already match vec3f, quaternion lanes are shuffled between w,x,y,z and x,y,z,w
+
+	inline vectorial::vec3f to_vec3f( const Vector & vector )
+	{
+		return vectorial::vec3f( vector.value );
+	}
+
+	inline Vector to_vector( const vectorial::vec3f & vector )
+	{
+		return Vector( vector.value );
+	}
+
+	inline vectorial::quat4f to_quat4f( const Quaternion & quaternion )
+	{
+		return vectorial::quat4f( vectorial::vec4f( lanes_shuffle<1,2,3,0>( quaternion.value ) ) );
+	}
+
+	inline Quaternion to_quaternion( const vectorial::quat4f & quaternion )
+	{
+		return Quaternion( lanes_shuffle<3,0,1,2>( quaternion.value ) );
+	}
     
     // build 4x4 transform matrix from position, orientation and scale
     
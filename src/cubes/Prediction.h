@@ -0,0 +1,294 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CUBES_PREDICTION_H
+#define CUBES_PREDICTION_H
+
+#include "Game.h"
+#include "core/Core.h"
+#include <vector>
+
+namespace game
+{
+	/*
+		Client side prediction config.
+		History is how many frames of input and state are kept, so
+		authoritative state older than that can't be reconciled.
+		Resimulation is capped per update so a late packet can't stall
+		the client. A correction that needs more frames than the budget
+		is skipped and the next, more recent one is waited for instead.
+	*/
+
+	struct PredictionConfig
+	{
+		int historySize;
+		int maxResimulatedFrames;
+
+		PredictionConfig()
+		{
+			historySize = 64;
+			maxResimulatedFrames = 16;
+		}
+	};
+
+	/*
+		Prediction stats, accumulated since the prediction was created.
+		Correction error is how far the corrected objects moved at the 
+		current frame once authoritative state was applied and pending 
+		inputs were resimulated on top of it.
+	*/
+
+	struct PredictionStats
+	{
+		uint64_t numCorrections;
+		uint64_t numSkippedCorrections;
+		uint64_t numResimulatedFrames;
+		int maxResimulatedFrames;
+
+		float lastPositionError;
+		float maxPositionError;
+		double totalPositionError;
+
+		float lastOrientationError;				// radians
+		float maxOrientationError;
+		double totalOrientationError;
+
+		uint64_t lastResimulateTime;			// nanoseconds to rewind and resimulate
+		uint64_t maxResimulateTime;
+		uint64_t totalResimulateTime;
+
+		PredictionStats()
+		{
+			memset( this, 0, sizeof( PredictionStats ) );
+		}
+	};
+
+	/*
+		Predicts the local player's game instance ahead of the server.
+		Each update remembers the input and the instance state it was 
+		applied to. When authoritative state for an earlier frame arrives, 
+		the instance is rewound to that frame, the authoritative state is 
+		applied and the inputs since are resimulated to get back to now.
+		Frames count up from zero when the prediction is created and must
+		match the frames the server stamps its state with. Resimulating
+		only lands where the original frames did if contacts don't depend
+		on the broadphase's history, so the instance's simulation must be
+		configured with SortBroadphasePairs.
+	*/
+
+	template <typename DatabaseObject, typename ActiveObject, typename ActiveObjectStorage> class Prediction
+	{
+	public:
+
+		typedef Instance<DatabaseObject, ActiveObject, ActiveObjectStorage> GameInstance;
+
+		Prediction( GameInstance * instance, const PredictionConfig & config = PredictionConfig() )
+		{
+			assert( instance );
+			assert( config.historySize > 0 );
+			assert( config.maxResimulatedFrames >= 0 );
+			assert( instance->GetConfig().simConfig.SortBroadphasePairs );
+			this->instance = instance;
+			this->config = config;
+			history.resize( config.historySize );
+			frame = 0;
+			pending = false;
+			pendingFrame = 0;
+		}
+
+		uint32_t GetFrame() const
+		{
+			return frame;
+		}
+
+		const PredictionStats & GetStats() const
+		{
+			return stats;
+		}
+
+		/*
+			Authoritative state for some objects at the start of a frame.
+			Only the most recent state is kept until the next update.
+		*/
+
+		void SetAuthoritativeState( uint32_t frame, const ActiveObject * objects, int count )
+		{
+			assert( objects || count == 0 );
+			if ( pending && frame <= pendingFrame )
+				return;
+			pending = true;
+			pendingFrame = frame;
+			authoritative.assign( objects, objects + count );
+		}
+
+		void Update( const Input & input, float deltaTime )
+		{
+			// resimulating moves the random seed on, so put back the seed this frame was to be simulated with
+
+			const unsigned long randomSeed = Simulation::GetRandomSeed();
+
+			if ( Reconcile() )
+				Simulation::SetRandomSeed( randomSeed );
+
+			Frame & entry = history[frame % history.size()];
+			entry.frame = frame;
+			entry.input = input;
+			entry.deltaTime = deltaTime;
+			instance->SaveState( entry.state );
+
+			Step( entry );
+
+			frame++;
+		}
+
+	protected:
+
+		struct Frame
+		{
+			uint32_t frame;
+			Input input;
+			float deltaTime;
+			typename GameInstance::State state;
+
+			Frame()
+			{
+				frame = 0xFFFFFFFF;
+				deltaTime = 0.0f;
+			}
+		};
+
+		void Step( const Frame & entry )
+		{
+			assert( instance->GetLocalPlayer() >= 0 );
+			instance->SetPlayerInput( instance->GetLocalPlayer(), entry.input );
+			instance->Update( entry.deltaTime );
+		}
+
+		bool Reconcile()
+		{
+			if ( !pending )
+				return false;
+
+			pending = false;
+
+			// skip state from the future, state older than the history and corrections over budget
+
+			const int numFrames = int( frame - pendingFrame );
+
+			if ( pendingFrame > frame || numFrames > config.maxResimulatedFrames || numFrames >= (int) history.size() )
+			{
+				stats.numSkippedCorrections++;
+				return false;
+			}
+
+			const int count = (int) authoritative.size();
+
+			predicted.resize( count );
+			for ( int i = 0; i < count; ++i )
+				instance->GetObjectState( authoritative[i].id, predicted[i] );
+
+			const uint64_t start = core::nanoseconds();
+
+			// rewind, including any objects activated or deactivated since
+
+			if ( numFrames > 0 )
+			{
+				const Frame & base = history[pendingFrame % history.size()];
+				assert( base.frame == pendingFrame );
+				instance->RestoreState( base.state );
+			}
+
+			for ( int i = 0; i < count; ++i )
+				instance->SetObjectState( authoritative[i].id, authoritative[i] );
+
+			// resimulate pending inputs, replacing the predicted history with the corrected one.
+			// each frame keeps the random seed it was first simulated with
+
+			for ( uint32_t f = pendingFrame; f != frame; ++f )
+			{
+				Frame & entry = history[f % history.size()];
+				const unsigned long randomSeed = entry.state.simulation.randomSeed;
+				instance->SaveState( entry.state );
+				entry.state.simulation.randomSeed = randomSeed;
+				Simulation::SetRandomSeed( randomSeed );
+				Step( entry );
+			}
+
+			const uint64_t time = core::nanoseconds() - start;
+
+			// measure how far the correction moved objects at the current frame
+
+			float positionError = 0.0f;
+			float orientationError = 0.0f;
+
+			for ( int i = 0; i < count; ++i )
+			{
+				ActiveObject corrected;
+				instance->GetObjectState( authoritative[i].id, corrected );
+				const float distance = ( corrected.position - predicted[i].position ).length();
+				const float dot = math::clamp( math::abs( corrected.orientation.dot( predicted[i].orientation ) ), 0.0f, 1.0f );
+				const float angle = 2.0f * math::acos( dot );
+				positionError = core::max( positionError, distance );
+				orientationError = core::max( orientationError, angle );
+			}
+
+			stats.numCorrections++;
+			stats.numResimulatedFrames += numFrames;
+			stats.maxResimulatedFrames = core::max( stats.maxResimulatedFrames, numFrames );
+
+			stats.lastPositionError = positionError;
+			stats.maxPositionError = core::max( stats.maxPositionError, positionError );
+			stats.totalPositionError += positionError;
+
+			stats.lastOrientationError = orientationError;
+			stats.maxOrientationError = core::max( stats.maxOrientationError, orientationError );
+			stats.totalOrientationError += orientationError;
+
+			stats.lastResimulateTime = time;
+			stats.maxResimulateTime = core::max( stats.maxResimulateTime, time );
+			stats.totalResimulateTime += time;
+
+			return true;
+		}
+
+	private:
+
+		GameInstance * instance;
+
+		PredictionConfig config;
+
+		PredictionStats stats;
+
+		uint32_t frame;
+
+		std::vector<Frame> history;
+
+		bool pending;
+		uint32_t pendingFrame;
+		std::vector<ActiveObject> authoritative;
+		std::vector<ActiveObject> predicted;
+	};
+}
+
+#endif
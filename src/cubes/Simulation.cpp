@@ -23,11 +23,184 @@
 */
 
 #include "Simulation.h"
+#include "Collision.h"
+#include "core/Core.h"
+#include "tinycthread/tinycthread.h"
+#include "vectorial/simd4f.h"
 #define dSINGLE
 #include <ode/ode.h>
+#include <utility>
 
 namespace cubes
 {	
+	// uniform grid broadphase over the xy plane. cubes live on a flat world so z is left to the bounding
+	// box test. each object is counting sorted into a hashed bucket for every cell its box overlaps, and
+	// a pair is only reported from the cell holding the min corner of the overlap of the two boxes, so
+	// pairs sharing several cells are reported once without a set to dedupe them.
+
+	class GridBroadphase
+	{
+	public:
+
+		GridBroadphase()
+		{
+			SetCellSize( 2.0f );
+			bucketMask = 0;
+		}
+
+		void SetCellSize( float cellSize )
+		{
+			assert( cellSize > 0.0f );
+			inverseCellSize = 1.0f / cellSize;
+		}
+
+		void Collide( const dGeomID * geoms, int count, void * data, dNearCallback * callback )
+		{
+			// gather bounds. they are stored as x,y,z,0 so the overlap test is a single compare per side
+
+			boundsMin.resize( count * 4 );
+			boundsMax.resize( count * 4 );
+			cells.resize( count * 4 );
+
+			int numEntries = 0;
+
+			for ( int i = 0; i < count; ++i )
+			{
+				dReal aabb[6];
+				dGeomGetAABB( geoms[i], aabb );
+
+				float * min = &boundsMin[i*4];
+				float * max = &boundsMax[i*4];
+				min[0] = aabb[0]; min[1] = aabb[2]; min[2] = aabb[4]; min[3] = 0.0f;
+				max[0] = aabb[1]; max[1] = aabb[3]; max[2] = aabb[5]; max[3] = 0.0f;
+
+				int * cell = &cells[i*4];
+				cell[0] = (int) floorf( min[0] * inverseCellSize );
+				cell[1] = (int) floorf( min[1] * inverseCellSize );
+				cell[2] = (int) floorf( max[0] * inverseCellSize );
+				cell[3] = (int) floorf( max[1] * inverseCellSize );
+
+				numEntries += ( cell[2] - cell[0] + 1 ) * ( cell[3] - cell[1] + 1 );
+			}
+
+			// counting sort cell entries by bucket. entries stay in increasing object order within each bucket
+
+			int numBuckets = 64;
+			while ( numBuckets < numEntries * 2 )
+				numBuckets *= 2;
+
+			bucketMask = numBuckets - 1;
+			bucketStart.assign( numBuckets + 1, 0 );
+
+			for ( int i = 0; i < count; ++i )
+			{
+				const int * cell = &cells[i*4];
+				for ( int iy = cell[1]; iy <= cell[3]; ++iy )
+					for ( int ix = cell[0]; ix <= cell[2]; ++ix )
+						bucketStart[GetBucket( ix, iy ) + 1]++;
+			}
+
+			for ( int i = 0; i < numBuckets; ++i )
+				bucketStart[i+1] += bucketStart[i];
+
+			bucketOffset.assign( bucketStart.begin(), bucketStart.end() - 1 );
+			entries.resize( numEntries );
+
+			for ( int i = 0; i < count; ++i )
+			{
+				const int * cell = &cells[i*4];
+				for ( int iy = cell[1]; iy <= cell[3]; ++iy )
+				{
+					for ( int ix = cell[0]; ix <= cell[2]; ++ix )
+					{
+						Entry & entry = entries[bucketOffset[GetBucket( ix, iy )]++];
+						entry.x = ix;
+						entry.y = iy;
+						entry.index = i;
+					}
+				}
+			}
+
+			// report overlapping pairs sharing a cell. different cells may hash to the same bucket, so check the cell too
+
+			for ( int bucket = 0; bucket < numBuckets; ++bucket )
+			{
+				const int end = bucketStart[bucket+1];
+
+				for ( int i = bucketStart[bucket]; i < end; ++i )
+				{
+					const Entry & a = entries[i];
+
+					for ( int j = i + 1; j < end; ++j )
+					{
+						const Entry & b = entries[j];
+
+						if ( a.x != b.x || a.y != b.y )
+							continue;
+
+						if ( !Overlap( a.index, b.index ) )
+							continue;
+
+						const int * cellA = &cells[a.index*4];
+						const int * cellB = &cells[b.index*4];
+						if ( core::max( cellA[0], cellB[0] ) != a.x || core::max( cellA[1], cellB[1] ) != a.y )
+							continue;
+
+						callback( data, geoms[a.index], geoms[b.index] );
+					}
+				}
+			}
+		}
+
+	private:
+
+		struct Entry
+		{
+			int x;
+			int y;
+			int index;
+		};
+
+		int GetBucket( int ix, int iy ) const
+		{
+			const uint32_t hash = ( uint32_t( ix ) * 73856093U ) ^ ( uint32_t( iy ) * 19349663U );
+			return int( hash & bucketMask );
+		}
+
+		bool Overlap( int a, int b ) const
+		{
+			#if defined( VECTORIAL_SSE )
+
+				const simd4f minA = simd4f_uload4( &boundsMin[a*4] );
+				const simd4f maxA = simd4f_uload4( &boundsMax[a*4] );
+				const simd4f minB = simd4f_uload4( &boundsMin[b*4] );
+				const simd4f maxB = simd4f_uload4( &boundsMax[b*4] );
+				const simd4f separated = _mm_or_ps( _mm_cmpgt_ps( minA, maxB ), _mm_cmpgt_ps( minB, maxA ) );
+				return _mm_movemask_ps( separated ) == 0;
+
+			#else // #if defined( VECTORIAL_SSE )
+
+				const float * minA = &boundsMin[a*4];
+				const float * maxA = &boundsMax[a*4];
+				const float * minB = &boundsMin[b*4];
+				const float * maxB = &boundsMax[b*4];
+				return minA[0] <= maxB[0] && minB[0] <= maxA[0] &&
+				       minA[1] <= maxB[1] && minB[1] <= maxA[1] &&
+				       minA[2] <= maxB[2] && minB[2] <= maxA[2];
+
+			#endif // #if defined( VECTORIAL_SSE )
+		}
+
+		float inverseCellSize;
+		uint32_t bucketMask;
+		std::vector<float> boundsMin;
+		std::vector<float> boundsMax;
+		std::vector<int> cells;
+		std::vector<int> bucketStart;
+		std::vector<int> bucketOffset;
+		std::vector<Entry> entries;
+	};
+
 	// simulation internal implementation
 	
 	const int MaxContacts = 16;
@@ -39,6 +212,11 @@ namespace cubes
 			world = 0;
 			space = 0;
 			contacts = 0;
+			threading = 0;
+			threadPool = 0;
+			numIslands = 0;
+			numBroadphasePairs = 0;
+			collisionTime = 0;
 		}
 		
 		~SimulationImpl()
@@ -49,15 +227,27 @@ namespace cubes
 				dWorldDestroy( world );
 			if ( space )
 				dSpaceDestroy( space );
+			if ( threadPool )
+			{
+				dThreadingImplementationShutdownProcessing( threading );
+				dThreadingThreadPoolWaitIdleState( threadPool );
+				dThreadingFreeThreadPool( threadPool );
+			}
+			if ( threading )
+				dThreadingFreeImplementation( threading );
 				
 			contacts = 0;
 			world = 0;
 			space = 0;
+			threading = 0;
+			threadPool = 0;
 		}
 		
 		dWorldID world;
 		dSpaceID space;
 		dJointGroupID contacts;
+		dThreadingImplementationID threading;
+		dThreadingThreadPoolID threadPool;
 
 		struct ObjectData
 		{
@@ -83,10 +273,87 @@ namespace cubes
 		SimulationConfig config;
 		std::vector<dGeomID> planes;
 		std::vector<ObjectData> objects;
-		std::vector< std::vector<uint16_t> > interactions;
+
+		// interaction graph in compressed sparse row form: the objects touched by object i are
+		// interactionIds[interactionStart[i]] .. interactionIds[interactionStart[i+1]-1]. it is rebuilt
+		// from the pairs found by collision each update, reusing capacity so steady state does not allocate
+
+		struct InteractionPair
+		{
+			uint16_t a;
+			uint16_t b;
+		};
+
+		std::vector<InteractionPair> interactionPairs;
+		std::vector<int> interactionStart;
+		std::vector<uint16_t> interactionIds;
+
+		int numIslands;
+		std::vector<SimulationIslandStats> islands;
+
+		std::vector<dBodyID> stateBodies;			// scratch for SaveState
+
+		GridBroadphase grid;
+		std::vector<dGeomID> gridGeoms;
+
+		int numBroadphasePairs;
+		uint64_t collisionTime;
+
+		// pairs from the broadphase are queued, and contacts are generated for them in that order. with the box
+		// narrowphase contacts are generated in batches, otherwise by calling dCollide for each pair in turn.
+		// the order ode spaces report pairs in depends on their history, not just on where objects are now, so a
+		// simulation restored from a saved state could create its joints in a different order and resimulate
+		// differently. with SortBroadphasePairs the pairs are sorted by the geom data of both geoms first
+
+		enum CandidateType
+		{
+			CANDIDATE_BoxBox,
+			CANDIDATE_BoxPlane,
+			CANDIDATE_PlaneBox
+		};
+
+		struct Candidate
+		{
+			uint64_t key;
+			dGeomID o1;
+			dGeomID o2;
+			CandidateType type;
+			int index;
+		};
+
+		std::vector<Candidate> candidates;
+		std::vector<Candidate> sortedCandidates;
+		std::vector<int> candidateStart;
+		std::vector<CollisionBox> collisionBoxes;				// indexed by object id
+		std::vector<CollisionPlane> collisionPlanes;			// indexed by plane
+		std::vector<CollisionPair> boxPairs;
+		std::vector<CollisionPair> planePairs;
+		std::vector<CollisionManifold> boxManifolds;
+		std::vector<CollisionManifold> planeManifolds;
 
 	    dContact contact[MaxContacts];			
 
+		static void IslandStepCallback( void * data, unsigned islandIndex, unsigned bodyCount, unsigned jointCount, int finished )
+		{
+			// IMPORTANT: called from whichever thread steps the island. each island only touches its own stats
+
+			SimulationImpl * simulation = (SimulationImpl*) data;
+
+			assert( simulation );
+			assert( islandIndex < simulation->islands.size() );
+
+			SimulationIslandStats & island = simulation->islands[islandIndex];
+
+			if ( !finished )
+			{
+				island.numBodies = bodyCount;
+				island.numJoints = jointCount;
+				island.time = core::nanoseconds();
+			}
+			else
+				island.time = core::nanoseconds() - island.time;
+		}
+
 		void UpdateInteractionPairs( dBodyID b1, dBodyID b2 )
 		{
 			if ( !b1 || !b2 )
@@ -95,8 +362,45 @@ namespace cubes
 			uint64_t objectId1 = reinterpret_cast<uint64_t>( dBodyGetData( b1 ) );
 			uint64_t objectId2 = reinterpret_cast<uint64_t>( dBodyGetData( b2 ) );
 
-			interactions[objectId1].push_back( (uint16_t) objectId2 );
-			interactions[objectId2].push_back( (uint16_t) objectId1 );
+			InteractionPair pair;
+			pair.a = (uint16_t) objectId1;
+			pair.b = (uint16_t) objectId2;
+			interactionPairs.push_back( pair );
+		}
+
+		void BuildInteractionGraph()
+		{
+			// count interactions per object
+
+			const int numObjects = (int) objects.size();
+
+			interactionStart.assign( numObjects + 1, 0 );
+
+			for ( int i = 0; i < (int) interactionPairs.size(); ++i )
+			{
+				interactionStart[interactionPairs[i].a + 1]++;
+				interactionStart[interactionPairs[i].b + 1]++;
+			}
+
+			for ( int i = 0; i < numObjects; ++i )
+				interactionStart[i+1] += interactionStart[i];
+
+			// fill in pair order so each object sees its interactions in the order they were found
+
+			interactionIds.resize( interactionPairs.size() * 2 );
+
+			for ( int i = 0; i < (int) interactionPairs.size(); ++i )
+			{
+				const InteractionPair & pair = interactionPairs[i];
+				interactionIds[interactionStart[pair.a]++] = pair.b;
+				interactionIds[interactionStart[pair.b]++] = pair.a;
+			}
+
+			// filling advanced each start to the next object's start, so shift them back
+
+			for ( int i = numObjects; i > 0; --i )
+				interactionStart[i] = interactionStart[i-1];
+			interactionStart[0] = 0;
 		}
 
 		static void NearCallback( void * data, dGeomID o1, dGeomID o2 )
@@ -105,24 +409,299 @@ namespace cubes
 
 			assert( simulation );
 
+			simulation->numBroadphasePairs++;
+
+			simulation->QueueCandidate( o1, o2 );
+		}
+
+		void CreateContacts( dGeomID o1, dGeomID o2, int numc )
+		{
+			if ( !numc )
+				return;
+
 		    dBodyID b1 = dGeomGetBody( o1 );
 		    dBodyID b2 = dGeomGetBody( o2 );
 
-			if ( int numc = dCollide( o1, o2, MaxContacts, &simulation->contact[0].geom, sizeof(dContact) ) )
+	        for ( int i = 0; i < numc; i++ )
+	        {
+	            dJointID c = dJointCreateContact( world, contacts, contact+i );
+	            dJointAttach( c, b1, b2 );
+	        }
+	
+			UpdateInteractionPairs( b1, b2 );
+		}
+
+		// every geom in the space is an object's box or a plane. geom data tags which, with the object id
+		// or plane index above the tag bit, so candidates are sorted without calling back into ode
+
+		static void * GetObjectGeomData( uint64_t id )
+		{
+			return (void*) ( id << 1 );
+		}
+
+		static void * GetPlaneGeomData( uint64_t index )
+		{
+			return (void*) ( ( index << 1 ) | 1 );
+		}
+
+		// create the body and box geom for an object in a free slot. its state is set by the caller
+
+		void CreateObject( uint64_t id, float scale )
+		{
+			assert( id < objects.size() );
+			assert( !objects[id].exists() );
+
+			objects[id].body = dBodyCreate( world );
+
+			assert( objects[id].body );
+
+			dMass mass;
+			const float density = 1.0f;
+			dMassSetBox( &mass, density, scale, scale, scale );
+			dBodySetMass( objects[id].body, &mass );
+			dBodySetData( objects[id].body, (void*) id );
+
+			// setup geom and attach to body
+
+			objects[id].scale = scale;
+			objects[id].geom = dCreateBox( space, scale, scale, scale );
+
+			dGeomSetBody( objects[id].geom, objects[id].body );	
+			dGeomSetData( objects[id].geom, GetObjectGeomData( id ) );
+		}
+
+		void QueueCandidate( dGeomID o1, dGeomID o2 )
+		{
+			uint64_t data1 = reinterpret_cast<uint64_t>( dGeomGetData( o1 ) );
+			uint64_t data2 = reinterpret_cast<uint64_t>( dGeomGetData( o2 ) );
+
+			if ( ( data1 & 1 ) && ( data2 & 1 ) )
+				return;
+
+			// sorted, the geom with the lower tag always goes first, whichever way round the broadphase found them
+
+			if ( config.SortBroadphasePairs && data2 < data1 )
 			{
-		        for ( int i = 0; i < numc; i++ )
-		        {
-		            dJointID c = dJointCreateContact( simulation->world, simulation->contacts, simulation->contact+i );
-		            dJointAttach( c, b1, b2 );
-		        }
-		
-				simulation->UpdateInteractionPairs( b1, b2 );
+				std::swap( o1, o2 );
+				std::swap( data1, data2 );
+			}
+
+			Candidate candidate;
+			candidate.key = ( data1 << 32 ) | data2;
+			candidate.o1 = o1;
+			candidate.o2 = o2;
+			candidate.type = CANDIDATE_BoxBox;
+			candidate.index = 0;
+			candidates.push_back( candidate );
+		}
+
+		// counting sort on the first geom's tag, then insertion sort on the second within each run. every object
+		// only touches a handful of others, so the runs are short and this is much cheaper than a comparison sort
+
+		void SortCandidates()
+		{
+			const int numTags = (int) ( core::max( objects.size(), planes.size() ) * 2 + 2 );
+
+			candidateStart.assign( numTags + 1, 0 );
+
+			for ( int i = 0; i < (int) candidates.size(); ++i )
+				candidateStart[( candidates[i].key >> 32 ) + 1]++;
+
+			for ( int i = 0; i < numTags; ++i )
+				candidateStart[i+1] += candidateStart[i];
+
+			sortedCandidates.resize( candidates.size() );
+
+			for ( int i = 0; i < (int) candidates.size(); ++i )
+				sortedCandidates[candidateStart[candidates[i].key >> 32]++] = candidates[i];
+
+			for ( int i = 1; i < (int) sortedCandidates.size(); ++i )
+			{
+				const Candidate candidate = sortedCandidates[i];
+				int j = i;
+				while ( j > 0 && sortedCandidates[j-1].key > candidate.key )
+				{
+					sortedCandidates[j] = sortedCandidates[j-1];
+					j--;
+				}
+				sortedCandidates[j] = candidate;
+			}
+
+			candidates.swap( sortedCandidates );
+		}
+
+		// split candidates into box-box and box-plane pairs for the batched narrowphase
+
+		void GatherCollisionPairs()
+		{
+			for ( int i = 0; i < (int) candidates.size(); ++i )
+			{
+				Candidate & candidate = candidates[i];
+
+				const uint64_t data1 = candidate.key >> 32;
+				const uint64_t data2 = candidate.key & 0xFFFFFFFF;
+
+				const bool plane1 = ( data1 & 1 ) != 0;
+				const bool plane2 = ( data2 & 1 ) != 0;
+
+				CollisionPair pair;
+
+				if ( !plane1 && !plane2 )
+				{
+					pair.a = int( data1 >> 1 );
+					pair.b = int( data2 >> 1 );
+					candidate.type = CANDIDATE_BoxBox;
+					candidate.index = (int) boxPairs.size();
+					boxPairs.push_back( pair );
+				}
+				else
+				{
+					pair.a = int( ( plane1 ? data2 : data1 ) >> 1 );
+					pair.b = int( ( plane1 ? data1 : data2 ) >> 1 );
+					candidate.type = plane1 ? CANDIDATE_PlaneBox : CANDIDATE_BoxPlane;
+					candidate.index = (int) planePairs.size();
+					planePairs.push_back( pair );
+				}
+			}
+		}
+
+		void GatherCollisionBoxes()
+		{
+			collisionBoxes.resize( objects.size() );
+
+			for ( int i = 0; i < (int) objects.size(); ++i )
+			{
+				if ( !objects[i].exists() )
+					continue;
+
+				const dReal * position = dGeomGetPosition( objects[i].geom );
+				const dReal * rotation = dGeomGetRotation( objects[i].geom );
+
+				CollisionBox & box = collisionBoxes[i];
+				box.position[0] = position[0];
+				box.position[1] = position[1];
+				box.position[2] = position[2];
+				box.position[3] = 0.0f;
+				memcpy( box.rotation, rotation, sizeof( box.rotation ) );
+				box.side[0] = objects[i].scale;
+				box.side[1] = objects[i].scale;
+				box.side[2] = objects[i].scale;
+				box.side[3] = 0.0f;
 			}
 		}
+
+		void GenerateContacts()
+		{
+			if ( !config.BoxNarrowphase )
+			{
+				for ( int i = 0; i < (int) candidates.size(); ++i )
+				{
+					const Candidate & candidate = candidates[i];
+					CreateContacts( candidate.o1, candidate.o2, dCollide( candidate.o1, candidate.o2, MaxContacts, &contact[0].geom, sizeof(dContact) ) );
+				}
+				return;
+			}
+
+			boxManifolds.resize( boxPairs.size() );
+			planeManifolds.resize( planePairs.size() );
+
+			if ( !boxPairs.empty() )
+				CollideBoxes( &collisionBoxes[0], &boxPairs[0], (int) boxPairs.size(), MaxContacts, &boxManifolds[0] );
+
+			if ( !planePairs.empty() )
+				CollideBoxesWithPlanes( &collisionBoxes[0], &collisionPlanes[0], &planePairs[0], (int) planePairs.size(), MaxContacts, &planeManifolds[0] );
+
+			for ( int i = 0; i < (int) candidates.size(); ++i )
+			{
+				const Candidate & candidate = candidates[i];
+
+				const CollisionManifold & manifold = ( candidate.type == CANDIDATE_BoxBox ) ? boxManifolds[candidate.index] : planeManifolds[candidate.index];
+
+				// plane first means the pair is reversed from how the manifold was generated, as dCollide does
+
+				const float sign = ( candidate.type == CANDIDATE_PlaneBox ) ? -1.0f : 1.0f;
+
+				for ( int j = 0; j < manifold.numContacts; ++j )
+				{
+					dContactGeom & geom = contact[j].geom;
+					geom.pos[0] = manifold.contacts[j].position[0];
+					geom.pos[1] = manifold.contacts[j].position[1];
+					geom.pos[2] = manifold.contacts[j].position[2];
+					geom.normal[0] = sign * manifold.normal[0];
+					geom.normal[1] = sign * manifold.normal[1];
+					geom.normal[2] = sign * manifold.normal[2];
+					geom.depth = manifold.contacts[j].depth;
+					geom.g1 = candidate.o1;
+					geom.g2 = candidate.o2;
+					geom.side1 = -1;
+					geom.side2 = -1;
+				}
+
+				CreateContacts( candidate.o1, candidate.o2, manifold.numContacts );
+			}
+		}
+
+		void Collide()
+		{
+			candidates.clear();
+			boxPairs.clear();
+			planePairs.clear();
+
+			if ( config.BoxNarrowphase )
+				GatherCollisionBoxes();
+
+			Broadphase();
+
+			if ( config.SortBroadphasePairs )
+				SortCandidates();
+
+			if ( config.BoxNarrowphase )
+				GatherCollisionPairs();
+
+			GenerateContacts();
+		}
+
+		void Broadphase()
+		{
+			if ( config.Broadphase != BROADPHASE_Grid )
+			{
+				dSpaceCollide( space, this, NearCallback );
+				return;
+			}
+
+			gridGeoms.clear();
+			for ( int i = 0; i < (int) objects.size(); ++i )
+			{
+				if ( objects[i].exists() )
+					gridGeoms.push_back( objects[i].geom );
+			}
+
+			// planes are infinite so they stay out of the grid and are tested against every object
+
+			for ( int i = 0; i < (int) gridGeoms.size(); ++i )
+			{
+				for ( int j = 0; j < (int) planes.size(); ++j )
+					NearCallback( this, gridGeoms[i], planes[j] );
+			}
+
+			if ( !gridGeoms.empty() )
+				grid.Collide( &gridGeoms[0], (int) gridGeoms.size(), this, NearCallback );
+		}
 	};
 
 	// ------------------------------------------
 	
+	// ode init/close is reference counted across all simulations. simulations may be created
+	// and destroyed from different threads, so the count is guarded by a lazily created mutex.
+
+	static once_flag initOnce = ONCE_FLAG_INIT;
+	static mtx_t initMutex;
+
+	static void CreateInitMutex()
+	{
+		mtx_init( &initMutex, mtx_plain );
+	}
+
 	int * Simulation::GetInitCount()
 	{
 		static int initCount = 0;
@@ -131,10 +710,14 @@ namespace cubes
 
 	Simulation::Simulation()
 	{
+		call_once( &initOnce, CreateInitMutex );
+		mtx_lock( &initMutex );
 		int * initCount = GetInitCount();
 		if ( *initCount == 0 )
-			dInitODE();
+			dInitODE2( 0 );
 		(*initCount)++;
+		mtx_unlock( &initMutex );
+		InitializeThread();
 		impl = new SimulationImpl();
 	}
 	
@@ -142,10 +725,28 @@ namespace cubes
 	{
 		delete impl;
 		impl = NULL;
+		mtx_lock( &initMutex );
 		int * initCount = GetInitCount();
 		(*initCount)--;
 		if ( *initCount == 0 )
 			dCloseODE();
+		mtx_unlock( &initMutex );
+	}
+
+	void Simulation::InitializeThread()
+	{
+		// IMPORTANT: ode requires its per-thread data to be allocated on every thread that steps a world
+		dAllocateODEDataForThread( dAllocateMaskAll );
+	}
+
+	unsigned long Simulation::GetRandomSeed()
+	{
+		return dRandGetSeed();
+	}
+
+	void Simulation::SetRandomSeed( unsigned long seed )
+	{
+		dRandSetSeed( seed );
 	}
 
 	void Simulation::Initialize( const SimulationConfig & config )
@@ -155,10 +756,59 @@ namespace cubes
 		// create simulation
 
 		impl->world = dWorldCreate();
+
+		// IMPORTANT: each world gets its own threading implementation. the default one is shared by all worlds
+		// and is not safe to use when simulations are stepped in parallel on different threads.
+		if ( config.IslandThreads > 1 )
+		{
+			// islands are solved on a pool of worker threads plus the thread calling update
+
+			impl->threading = dThreadingAllocateMultiThreadedImplementation();
+			impl->threadPool = dThreadingAllocateThreadPool( config.IslandThreads - 1, 0, dAllocateMaskAll, NULL );
+			dThreadingThreadPoolServeMultiThreadedImplementation( impl->threadPool, impl->threading );
+		}
+		else
+			impl->threading = dThreadingAllocateSelfThreadedImplementation();
+		dWorldSetStepThreadingImplementation( impl->world, dThreadingImplementationGetFunctions( impl->threading ), impl->threading );
+		dWorldSetStepIslandsProcessingMaxThreadCount( impl->world, config.IslandThreads > 1 ? config.IslandThreads : 1 );
+
+		// island stats are only gathered when islands are solved in parallel. with the callback set ODE
+		// seeds each island separately, which would change single threaded results
+		if ( config.IslandThreads > 1 )
+			dWorldSetIslandStepCallback( impl->world, SimulationImpl::IslandStepCallback, impl );
+
 	    impl->contacts = dJointGroupCreate( 0 );
-	    dVector3 center = { 0,0,0 };
-	    dVector3 extents = { 100,100,100 };
-	    impl->space = dQuadTreeSpaceCreate( 0, center, extents, 10 );
+
+		switch ( config.Broadphase )
+		{
+			case BROADPHASE_QuadTree:
+			{
+			    dVector3 center = { 0,0,0 };
+			    dVector3 extents = { 100,100,100 };
+			    impl->space = dQuadTreeSpaceCreate( 0, center, extents, 10 );
+			}
+			break;
+
+			case BROADPHASE_SweepAndPrune:
+				impl->space = dSweepAndPruneSpaceCreate( 0, dSAP_AXES_XYZ );
+				break;
+
+			case BROADPHASE_Hash:
+			{
+				// hash cells are powers of two. smallest cell is the configured cell size rounded down, up to 16x that
+
+				const int level = (int) floorf( log2f( config.BroadphaseCellSize ) );
+				impl->space = dHashSpaceCreate( 0 );
+				dHashSpaceSetLevels( impl->space, level, level + 4 );
+			}
+			break;
+
+			case BROADPHASE_Grid:
+				// the space only owns the geoms. pairs come from the grid
+				impl->space = dSimpleSpaceCreate( 0 );
+				impl->grid.SetCellSize( config.BroadphaseCellSize );
+				break;
+		}
 
 		// configure world
 
@@ -186,12 +836,17 @@ namespace cubes
 
 	void Simulation::Update( float deltaTime, bool paused )
 	{		
-		impl->interactions.clear();
-		
-		impl->interactions.resize( impl->objects.size() );
+		impl->interactionPairs.clear();
+
+		impl->numIslands = 0;
+		impl->numBroadphasePairs = 0;
+		impl->collisionTime = 0;
 
 		if ( paused )
+		{
+			impl->BuildInteractionGraph();
 			return;
+		}
 
 		// IMPORTANT: do this *first* before updating simulation then at rest calculations
 		// will work properly with rough quantization (quantized state is fed in prior to update)
@@ -253,12 +908,33 @@ namespace cubes
 
 		dJointGroupEmpty( impl->contacts );
 
-		dSpaceCollide( impl->space, impl, SimulationImpl::NearCallback );
+		const uint64_t collisionStart = core::nanoseconds();
+
+		impl->Collide();
+
+		impl->collisionTime = core::nanoseconds() - collisionStart;
+
+		impl->BuildInteractionGraph();
+
+		// every island has at least one body, so there can't be more islands than objects.
+		// the stats are kept from frame to frame and only the islands stepped last update are cleared
+
+		SimulationIslandStats emptyIsland = { 0, 0, 0 };
+		if ( impl->islands.size() < impl->objects.size() )
+			impl->islands.resize( impl->objects.size(), emptyIsland );
+		for ( int i = 0; i < (int) impl->islands.size() && impl->islands[i].numBodies > 0; ++i )
+			impl->islands[i] = emptyIsland;
 
 		if ( impl->config.QuickStep )
 			dWorldQuickStep( impl->world, deltaTime );
 		else
 			dWorldStep( impl->world, deltaTime );
+
+		// islands are numbered contiguously from zero
+
+		impl->numIslands = 0;
+		while ( impl->numIslands < (int) impl->islands.size() && impl->islands[impl->numIslands].numBodies > 0 )
+			impl->numIslands++;
 	}
 	
 	int Simulation::AddObject( const SimulationObjectState & initialObjectState )
@@ -280,24 +956,9 @@ namespace cubes
 			impl->objects.resize( id + 1 );
 		}
 
-		// setup object body
-
-		impl->objects[id].body = dBodyCreate( impl->world );
+		// setup object body and geom
 
-		assert( impl->objects[id].body );
-
-		dMass mass;
-		const float density = 1.0f;
-		dMassSetBox( &mass, density, initialObjectState.scale, initialObjectState.scale, initialObjectState.scale );
-		dBodySetMass( impl->objects[id].body, &mass );
-		dBodySetData( impl->objects[id].body, (void*) id );
-
-		// setup geom and attach to body
-
-		impl->objects[id].scale = initialObjectState.scale;
-		impl->objects[id].geom = dCreateBox( impl->space, initialObjectState.scale, initialObjectState.scale, initialObjectState.scale );
-
-		dGeomSetBody( impl->objects[id].geom, impl->objects[id].body );	
+		impl->CreateObject( id, initialObjectState.scale );
 
 		// set object state
 
@@ -387,11 +1048,126 @@ namespace cubes
 		}
 	}
 
-	const std::vector<uint16_t> & Simulation::GetObjectInteractions( int id ) const
+	void Simulation::SaveState( SimulationState & state ) const
+	{
+		state.randomSeed = dRandGetSeed();
+
+		const int numObjects = (int) impl->objects.size();
+
+		state.bodies.resize( numObjects );
+		impl->stateBodies.resize( numObjects );
+
+		for ( int i = 0; i < numObjects; ++i )
+		{
+			const SimulationImpl::ObjectData & object = impl->objects[i];
+			SimulationBodyState & body = state.bodies[i];
+
+			impl->stateBodies[i] = object.body;
+
+			if ( !object.exists() )
+			{
+				memset( &body, 0, sizeof( body ) );
+				continue;
+			}
+
+			// enabled follows the rest timer, as in GetObjectState. the next update sets every body's
+			// enabled flag from its timer before stepping, so the body's own flag is not needed
+
+			body.timeAtRest = object.timeAtRest;
+			body.scale = object.scale;
+			body.exists = 1;
+			body.enabled = object.timeAtRest < impl->config.RestTime;
+		}
+
+		// then the bodies are copied straight into the records in one pass inside ode,
+		// position, orientation and velocities being the first 13 floats of each record
+
+		if ( numObjects > 0 )
+		{
+			assert( sizeof( dReal ) == sizeof( float ) );
+			assert( &state.bodies[0].angularVelocity[0] == &state.bodies[0].position[0] + 10 );
+			dBodyGetStates( &impl->stateBodies[0], numObjects, state.bodies[0].position, sizeof( SimulationBodyState ) / sizeof( float ) );
+		}
+	}
+
+	void Simulation::RestoreState( const SimulationState & state )
+	{
+		const int numBodies = (int) state.bodies.size();
+
+		// remove objects that were not there when the state was saved, or have changed size since
+
+		for ( int i = 0; i < (int) impl->objects.size(); ++i )
+		{
+			if ( !impl->objects[i].exists() )
+				continue;
+
+			if ( i >= numBodies || !state.bodies[i].exists || state.bodies[i].scale != impl->objects[i].scale )
+				RemoveObject( i );
+		}
+
+		if ( (int) impl->objects.size() < numBodies )
+			impl->objects.resize( numBodies );
+
+		for ( int i = 0; i < numBodies; ++i )
+		{
+			const SimulationBodyState & body = state.bodies[i];
+
+			if ( !body.exists )
+				continue;
+
+			if ( !impl->objects[i].exists() )
+				impl->CreateObject( i, body.scale );
+
+			SimulationImpl::ObjectData & object = impl->objects[i];
+
+			dBodySetState( object.body, body.position, body.orientation, body.linearVelocity, body.angularVelocity );
+
+			object.timeAtRest = body.timeAtRest;
+
+			if ( body.enabled )
+				dBodyEnable( object.body );
+			else
+				dBodyDisable( object.body );
+		}
+
+		dRandSetSeed( state.randomSeed );
+	}
+
+	SimulationInteractions Simulation::GetObjectInteractions( int id ) const
 	{
 		assert( id >= 0 );
-		assert( id < (int) impl->interactions.size() );
-		return impl->interactions[id];
+		assert( id + 1 < (int) impl->interactionStart.size() );
+		SimulationInteractions interactions;
+		interactions.ids = impl->interactionIds.empty() ? NULL : &impl->interactionIds[0] + impl->interactionStart[id];
+		interactions.count = impl->interactionStart[id+1] - impl->interactionStart[id];
+		return interactions;
+	}
+
+	int Simulation::GetNumInteractionPairs() const
+	{
+		return (int) impl->interactionPairs.size();
+	}
+
+	int Simulation::GetNumBroadphasePairs() const
+	{
+		return impl->numBroadphasePairs;
+	}
+
+	uint64_t Simulation::GetCollisionTime() const
+	{
+		return impl->collisionTime;
+	}
+
+	int Simulation::GetNumIslands() const
+	{
+		return impl->numIslands;
+	}
+
+	const SimulationIslandStats & Simulation::GetIslandStats( int index ) const
+	{
+		assert( index >= 0 );
+		assert( index < impl->numIslands );
+		return impl->islands[index];
 	}
 
 	void Simulation::ApplyForce( int id, const math::Vector & force )
@@ -422,7 +1198,20 @@ namespace cubes
 
 	void Simulation::AddPlane( const math::Vector & normal, float d )
 	{
-		impl->planes.push_back( dCreatePlane( impl->space, normal.x, normal.y, normal.z, d ) );
+		dGeomID plane = dCreatePlane( impl->space, normal.x, normal.y, normal.z, d );
+		dGeomSetData( plane, SimulationImpl::GetPlaneGeomData( impl->planes.size() ) );
+		impl->planes.push_back( plane );
+
+		// ode normalizes the plane so read it back rather than using what was passed in
+
+		dVector4 params;
+		dGeomPlaneGetParams( plane, params );
+		CollisionPlane collisionPlane;
+		collisionPlane.normal[0] = params[0];
+		collisionPlane.normal[1] = params[1];
+		collisionPlane.normal[2] = params[2];
+		collisionPlane.d = params[3];
+		impl->collisionPlanes.push_back( collisionPlane );
 	}
 
 	void Simulation::Reset()
@@ -437,5 +1226,6 @@ namespace cubes
 			dGeomDestroy( impl->planes[i] );
 
 		impl->planes.clear();
+		impl->collisionPlanes.clear();
 	}
 }
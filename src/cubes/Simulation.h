@@ -31,6 +31,16 @@
 
 namespace cubes
 {	
+	// broadphase used to find pairs of objects that may be touching
+
+	enum SimulationBroadphase
+	{
+		BROADPHASE_QuadTree,			// ode quadtree space over a fixed 200x200 area
+		BROADPHASE_SweepAndPrune,		// ode sweep and prune space, sorted along x then y then z
+		BROADPHASE_Hash,				// ode multi-resolution hash space
+		BROADPHASE_Grid					// uniform grid over the xy plane, with simd bounding box tests
+	};
+
 	// simulation config
 
 	struct SimulationConfig
@@ -49,6 +59,11 @@ namespace cubes
 		float RestTime;
 		float LinearRestThresholdSquared;
 		float AngularRestThresholdSquared;
+		int IslandThreads;
+		SimulationBroadphase Broadphase;
+		float BroadphaseCellSize;
+		bool BoxNarrowphase;
+		bool SortBroadphasePairs;			// contacts in an order that only depends on the current state, as rollback needs
 
 		SimulationConfig()
 		{
@@ -66,9 +81,25 @@ namespace cubes
 			RestTime = 0.1f;
 			LinearRestThresholdSquared = 0.25f * 0.25f;
 			AngularRestThresholdSquared = 0.25f * 0.25f;
+			IslandThreads = 1;
+			Broadphase = BROADPHASE_QuadTree;
+			BroadphaseCellSize = 2.0f;
+			BoxNarrowphase = true;
+			SortBroadphasePairs = false;
 		}  
 	};
 
+	// per-island stats from the last update. islands are groups of awake bodies connected by contacts,
+	// they share no bodies so they are solved independently and in parallel when IslandThreads > 1.
+	// stats are only gathered in that case, otherwise there are no islands to report
+
+	struct SimulationIslandStats
+	{
+		int numBodies;
+		int numJoints;
+		uint64_t time;			// nanoseconds spent solving this island
+	};
+
 	// new simulation state
 
 	struct SimulationObjectState
@@ -81,6 +112,50 @@ namespace cubes
 		math::Vector angularVelocity;
 	};
 
+	// snapshot of every object slot, saved and restored in bulk for rollback and fast-forward.
+	// one flat record per slot so saving and restoring are straight copies with no per-object
+	// conversion. restoring reproduces the saved simulation bit for bit, including the seed of
+	// ode's random number generator used by quickstep, so resimulating gives the same result
+
+	struct SimulationBodyState
+	{
+		float position[3];
+		float orientation[4];			// w, x, y, z as stored by ode
+		float linearVelocity[3];
+		float angularVelocity[3];
+		float timeAtRest;
+		float scale;
+		uint8_t exists;
+		uint8_t enabled;
+	};
+
+	struct SimulationState
+	{
+		unsigned long randomSeed;
+		std::vector<SimulationBodyState> bodies;			// indexed by object id
+	};
+
+	// objects touched by an object during the last update. points into the simulation's
+	// flat interaction graph, so it is only valid until the next update
+
+	struct SimulationInteractions
+	{
+		const uint16_t * ids;
+		int count;
+
+		int size() const
+		{
+			return count;
+		}
+
+		uint16_t operator [] ( int index ) const
+		{
+			assert( index >= 0 );
+			assert( index < count );
+			return ids[index];
+		}
+	};
+
 	// simulation class with dynamic object allocation
 
 	class Simulation
@@ -92,6 +167,15 @@ namespace cubes
 		Simulation();
 		~Simulation();
 
+		static void InitializeThread();
+
+		// seed of ode's random number generator, which quickstep uses to order constraints. the
+		// generator is thread local, so this is the seed for simulations updated on the calling thread
+
+		static unsigned long GetRandomSeed();
+
+		static void SetRandomSeed( unsigned long seed );
+
 		void Initialize( const SimulationConfig & config = SimulationConfig() );
 
 		void Update( float deltaTime, bool paused = false );
@@ -108,10 +192,27 @@ namespace cubes
 
 		void SetObjectState( int id, const SimulationObjectState & objectState, bool ignoreEnabledFlag = false );
 
-		const std::vector<uint16_t> & GetObjectInteractions( int id ) const;
+		// save and restore all objects at once. restore removes objects added since the save and recreates removed
+		// ones in their original slots. contacts and interactions from the last update are not part of the state
+
+		void SaveState( SimulationState & state ) const;
+
+		void RestoreState( const SimulationState & state );
+
+		SimulationInteractions GetObjectInteractions( int id ) const;
 
 		int GetNumInteractionPairs() const;
 
+		// pairs the broadphase passed to contact generation last update, and nanoseconds spent on both
+
+		int GetNumBroadphasePairs() const;
+
+		uint64_t GetCollisionTime() const;
+
+		int GetNumIslands() const;
+
+		const SimulationIslandStats & GetIslandStats( int index ) const;
+
 		void ApplyForce( int id, const math::Vector & force );
 
 		void ApplyTorque( int id, const math::Vector & torque );
@@ -23,205 +23,400 @@
 */
 
 #include "View.h"
+#include "vectorial/simd4f.h"
+#include <algorithm>
+#include <string.h>
 
 namespace view
 {
-	void ObjectManager::Reset()
-	{
-		for ( object_map::iterator itor = objects.begin(); itor != objects.end(); ++itor )
+	// compares four lanes at once, returning one bit per lane that differs
+
+	#if defined( VECTORIAL_SSE )
+
+		static inline int lanes_changed( simd4f a, simd4f b ) { return _mm_movemask_ps( _mm_cmpneq_ps( a, b ) ); }
+
+	#else // #if defined( VECTORIAL_SSE )
+
+		static inline int lanes_changed( simd4f a, simd4f b )
 		{
-			Object * object = itor->second;
-			assert( object );
-			delete object;
+			float x[4], y[4];
+			simd4f_ustore4( a, x );
+			simd4f_ustore4( b, y );
+			int mask = 0;
+			for ( int i = 0; i < 4; ++i )
+				mask |= ( x[i] != y[i] ) ? ( 1 << i ) : 0;
+			return mask;
 		}
-		objects.clear();
+
+	#endif // #if defined( VECTORIAL_SSE )
+
+	static inline bool lanes_none( const uint8_t * flags )
+	{
+		uint32_t bits;
+		memcpy( &bits, flags, sizeof( bits ) );
+		return bits == 0;
 	}
 
-	void ObjectManager::UpdateObjects( ObjectUpdate updates[], int updateCount )
+	static inline bool lanes_all( const uint8_t * flags )
 	{
-		assert( updates );
+		uint32_t bits;
+		memcpy( &bits, flags, sizeof( bits ) );
+		return bits == 0x01010101;
+	}
 
-		// 1. mark all objects as pending removal
-		//  - allows us to detect deleted objects in O(n) instead of O(n^2)
+	// ------------------------------------------------------
 
-		// todo: convert to bit array
-		// todo: hot/cold split for "remove" flag.
+	void ObjectManager::Arrays::Resize( int size )
+	{
+		// round up to whole groups of four so the blends never need a scalar tail
+
+		const int padded = ( size + 3 ) & ~3;
+
+		id.resize( padded );
+		authority.resize( padded );
+		scale.resize( padded );
+		r.resize( padded );
+		g.resize( padded );
+		b.resize( padded );
+		a.resize( padded );
+		target_r.resize( padded );
+		target_g.resize( padded );
+		target_b.resize( padded );
+		tightness.resize( padded );
+		blend_time.resize( padded );
+		blend_start.resize( padded );
+		blend_finish.resize( padded );
+		visible.resize( padded );
+		blending.resize( padded );
+		settled.resize( padded );
+		position.resize( padded );
+		orientation.resize( padded );
+	}
 
-		for ( object_map::iterator itor = objects.begin(); itor != objects.end(); ++itor )
-		{
- 			Object * object = itor->second;
-			assert( object );
-			object->remove = true;
-		}
+	void ObjectManager::Arrays::Clear( int index )
+	{
+		// padding lanes are at rest and never blend, so the group checks skip them
+
+		id[index] = 0;
+		authority[index] = 0;
+		scale[index] = 1.0f;
+		r[index] = g[index] = b[index] = a[index] = 0.0f;
+		target_r[index] = target_g[index] = target_b[index] = 0.0f;
+		tightness[index] = 0.0f;
+		blend_time[index] = blend_start[index] = blend_finish[index] = 0.0f;
+		visible[index] = 0;
+		blending[index] = 0;
+		settled[index] = 1;
+		position[index] = vectorial::vec3f::zero();
+		orientation[index] = vectorial::quat4f::identity();
+	}
 
-		// 2. pass over all cubes in new render state
-		//  - add cube if does not exist, update if exists
-		//  - clear remove flag for each entry we touch
+	void ObjectManager::Arrays::Copy( int index, const Arrays & from, int fromIndex )
+	{
+		id[index] = from.id[fromIndex];
+		authority[index] = from.authority[fromIndex];
+		scale[index] = from.scale[fromIndex];
+		r[index] = from.r[fromIndex];
+		g[index] = from.g[fromIndex];
+		b[index] = from.b[fromIndex];
+		a[index] = from.a[fromIndex];
+		target_r[index] = from.target_r[fromIndex];
+		target_g[index] = from.target_g[fromIndex];
+		target_b[index] = from.target_b[fromIndex];
+		tightness[index] = from.tightness[fromIndex];
+		blend_time[index] = from.blend_time[fromIndex];
+		blend_start[index] = from.blend_start[fromIndex];
+		blend_finish[index] = from.blend_finish[fromIndex];
+		visible[index] = from.visible[fromIndex];
+		blending[index] = from.blending[fromIndex];
+		settled[index] = from.settled[fromIndex];
+		position[index] = from.position[fromIndex];
+		orientation[index] = from.orientation[fromIndex];
+	}
 
-		for ( int i = 0; i < (int) updateCount; ++i )
-		{
-			object_map::iterator itor = objects.find( updates[i].id );
+	void ObjectManager::Arrays::Add( int index, const ObjectUpdate & update )
+	{
+		id[index] = update.id;
+		position[index] = update.position;
+		orientation[index] = update.orientation;
+		scale[index] = update.scale;
+		a[index] = 0.0f;
+		visible[index] = 0;
+		blending[index] = 0;
+		blend_time[index] = blend_start[index] = blend_finish[index] = 0.0f;
+
+		SetAuthority( index, update.authority );
+
+		r[index] = target_r[index];
+		g[index] = target_g[index];
+		b[index] = target_b[index];
+	}
+
+	void ObjectManager::Arrays::Update( int index, const ObjectUpdate & update )
+	{
+		if ( authority[index] != (int) update.authority )
+			SetAuthority( index, update.authority );
 
-			if ( itor == objects.end() )
+		position[index] = update.position;
+		orientation[index] = update.orientation;
+		scale[index] = update.scale;
+
+		if ( !blending[index] )
+		{
+			if ( visible[index] && !update.visible )
 			{
-				// add new view object
-
-				Object * object = new Object();
-
-				object->id = updates[i].id;
-				object->authority = updates[i].authority;
-				object->position = updates[i].position;
-				object->orientation = updates[i].orientation;
-				object->scale = updates[i].scale;
-				getAuthorityColor( object->authority, object->r, object->g, object->b, MaxPlayers );
-				object->a = 0.0f;
-				object->visible = false;
-				
-				uint32_t id = updates[i].id;
-
-				objects.insert( std::make_pair( id, object ) );
+				// start fade out
+				blending[index] = 1;
+				blend_start[index] = 1.0f;
+				blend_finish[index] = 0.0f;
+				blend_time[index] = 0.0f;
 			}
-			else
+			else if ( !visible[index] && update.visible )
 			{
-				// update existing
+				// start fade in
+				blending[index] = 1;
+				blend_start[index] = 0.0f;
+				blend_finish[index] = 1.0f;
+				blend_time[index] = 0.0f;
+			}
+		}
+	}
 
-				Object * object = itor->second;
+	void ObjectManager::Arrays::SetAuthority( int index, int newAuthority )
+	{
+		// the color blend target only changes with authority, so this is the only thing that wakes an object at rest
 
-				assert( object );
+		authority[index] = newAuthority;
+		getAuthorityColor( newAuthority, target_r[index], target_g[index], target_b[index], MaxPlayers );
+		tightness[index] = ( newAuthority == 0 ) ? ColorChangeTightnessAuthority : ColorChangeTightnessDefault;
+		settled[index] = 0;
+	}
 
-				object->authority = updates[i].authority;
+	// ------------------------------------------------------
 
-				object->position = updates[i].position;
-				object->orientation = updates[i].orientation;
-				object->scale = updates[i].scale;
-				
-				object->remove = false;
+	ObjectManager::ObjectManager()
+	{
+		numObjects = 0;
+		current = 0;
+	}
 
-				if ( !object->blending )
-				{
-					if ( object->visible && !updates[i].visible )
-					{
-						// start fade out
-						object->blending = true;
-						object->blend_start = 1.0f;
-						object->blend_finish = 0.0f;
-						object->blend_time = 0.0f;
-					}
-					else if ( !object->visible && updates[i].visible )
-					{
-						// start fade in
-						object->blending = true;
-						object->blend_start = 0.0f;
-						object->blend_finish = 1.0f;
-						object->blend_time = 0.0f;
-					}
-				}
-			}
+	void ObjectManager::Reset()
+	{
+		numObjects = 0;
+		current = 0;
+		arrays[0].Resize( 0 );
+		arrays[1].Resize( 0 );
+	}
+
+	void ObjectManager::UpdateObjects( const ObjectUpdate updates[], int updateCount )
+	{
+		assert( updates || updateCount == 0 );
+		assert( updateCount >= 0 );
+
+		// 1. sort updates by id
+		//  - packets usually arrive in id order already, so only sort when they don't
+		//  - the update index sits in the low bits so updates with the same id keep packet order
+
+		order.resize( updateCount );
+
+		bool sorted = true;
+
+		for ( int i = 0; i < updateCount; ++i )
+		{
+			order[i] = ( uint64_t( updates[i].id ) << 32 ) | uint32_t( i );
+			if ( i > 0 && order[i] < order[i-1] )
+				sorted = false;
 		}
 
-		// delete objects that do not exist in update
+		if ( !sorted )
+			std::sort( order.begin(), order.end() );
+
+		// 2. same set of ids as last time: update in place
+
+		Arrays & from = arrays[current];
+
+		bool same = updateCount == numObjects;
+
+		for ( int i = 0; same && i < updateCount; ++i )
+			same = uint32_t( order[i] >> 32 ) == from.id[i];
 
-		object_map::iterator itor = objects.begin();
-		while ( itor != objects.end() )
+		if ( same )
 		{
-			Object * object = itor->second;
-			assert( object );
-			if ( object->remove )
+			for ( int i = 0; i < updateCount; ++i )
+				from.Update( i, updates[ order[i] & 0xFFFFFFFF ] );
+			return;
+		}
+
+		// 3. otherwise merge the sorted updates with the sorted objects into the other arrays
+		//  - objects without an update are removed, updates without an object are added
+		//  - O(n) with no per-object allocation
+
+		Arrays & to = arrays[current^1];
+
+		to.Resize( updateCount );
+
+		int count = 0;
+		int index = 0;
+
+		for ( int i = 0; i < updateCount; ++i )
+		{
+			const ObjectUpdate & update = updates[ order[i] & 0xFFFFFFFF ];
+
+			if ( count > 0 && to.id[count-1] == update.id )
 			{
-				delete object;
-				objects.erase( itor++ );
+				to.Update( count - 1, update );
+				continue;
+			}
+
+			while ( index < numObjects && from.id[index] < update.id )
+				index++;
+
+			if ( index < numObjects && from.id[index] == update.id )
+			{
+				to.Copy( count, from, index++ );
+				to.Update( count, update );
 			}
 			else
 			{
-				++itor;
+				to.Add( count, update );
 			}
+
+			count++;
 		}
+
+		for ( int i = count; i < (int) to.id.size(); ++i )
+			to.Clear( i );
+
+		numObjects = count;
+		current ^= 1;
 	}
 	
 	void ObjectManager::Update( float deltaTime )
 	{
-		for ( object_map::iterator itor = objects.begin(); itor != objects.end(); ++itor )
-		{
- 			Object * object = itor->second;
+		Arrays & o = arrays[current];
 
-			assert( object );
+		// update alpha blend. fades are rare so groups of four with nothing fading are skipped
 
-			// update alpha blend
+		for ( int i = 0; i < numObjects; i += 4 )
+		{
+			if ( lanes_none( &o.blending[i] ) )
+				continue;
 
-			if ( object->blending )
+			for ( int j = i; j < i + 4; ++j )
 			{
-				object->blend_time += deltaTime * 4.0f;
+				if ( !o.blending[j] )
+					continue;
+
+				o.blend_time[j] += deltaTime * 4.0f;
 
-				if ( object->blend_time > 1.0f )
+				if ( o.blend_time[j] > 1.0f )
 				{
-					object->a = object->blend_finish;
-					object->visible = object->blend_finish != 0.0f;
-					object->blending = false;
+					o.a[j] = o.blend_finish[j];
+					o.visible[j] = o.blend_finish[j] != 0.0f;
+					o.blending[j] = 0;
 				}
 				else
 				{
-					const float t = object->blend_time;
+					const float t = o.blend_time[j];
 					const float t2 = t*t;
 					const float t3 = t2*t;
-					object->a = 3*t2 - 2*t3;
-					if ( object->visible )
-					 	object->a = 1.0f - object->a;
+					o.a[j] = 3*t2 - 2*t3;
+					if ( o.visible[j] )
+					 	o.a[j] = 1.0f - o.a[j];
 				}
 			}
+		}
+
+		// update color blend four objects at a time
+		//  - an object is at rest once a blend step no longer changes its color
+		//  - the target and tightness only change with authority, so it stays at rest until then
 
-			// update color blend
+		for ( int i = 0; i < numObjects; i += 4 )
+		{
+			if ( lanes_all( &o.settled[i] ) )
+				continue;
+
+			const simd4f tightness = simd4f_uload4( &o.tightness[i] );
+
+			const simd4f r = simd4f_uload4( &o.r[i] );
+			const simd4f g = simd4f_uload4( &o.g[i] );
+			const simd4f b = simd4f_uload4( &o.b[i] );
 
-			const float tightness = ( object->authority == 0 ) ? ColorChangeTightnessAuthority : ColorChangeTightnessDefault;
+			const simd4f new_r = simd4f_add( r, simd4f_mul( simd4f_sub( simd4f_uload4( &o.target_r[i] ), r ), tightness ) );
+			const simd4f new_g = simd4f_add( g, simd4f_mul( simd4f_sub( simd4f_uload4( &o.target_g[i] ), g ), tightness ) );
+			const simd4f new_b = simd4f_add( b, simd4f_mul( simd4f_sub( simd4f_uload4( &o.target_b[i] ), b ), tightness ) );
 
-			float target_r, target_g, target_b;
-			getAuthorityColor( object->authority, target_r, target_g, target_b, MaxPlayers );
+			simd4f_ustore4( new_r, &o.r[i] );
+			simd4f_ustore4( new_g, &o.g[i] );
+			simd4f_ustore4( new_b, &o.b[i] );
 
-			object->r += ( target_r - object->r ) * tightness;
-			object->g += ( target_g - object->g ) * tightness;
-			object->b += ( target_b - object->b ) * tightness;
+			const int changed = lanes_changed( r, new_r ) | lanes_changed( g, new_g ) | lanes_changed( b, new_b );
+
+			for ( int j = 0; j < 4; ++j )
+				o.settled[i+j] = ( changed & ( 1 << j ) ) == 0;
 		}
 	}
 
-	Object * ObjectManager::GetObject( unsigned int id )
+	int ObjectManager::FindObject( unsigned int id ) const
 	{
-		object_map::iterator itor = objects.find( id );
-		if ( itor != objects.end() )
-			return itor->second;
+		const Arrays & o = arrays[current];
+		const std::vector<uint32_t>::const_iterator itor = std::lower_bound( o.id.begin(), o.id.begin() + numObjects, id );
+		if ( itor != o.id.begin() + numObjects && *itor == id )
+			return int( itor - o.id.begin() );
 		else
-			return NULL;
+			return -1;
+	}
+
+	bool ObjectManager::GetObject( unsigned int id, Object & object ) const
+	{
+		const int index = FindObject( id );
+		if ( index < 0 )
+			return false;
+
+		const Arrays & o = arrays[current];
+
+		object.id = o.id[index];
+		object.authority = o.authority[index];
+		object.scale = o.scale[index];
+		object.r = o.r[index];
+		object.g = o.g[index];
+		object.b = o.b[index];
+		object.a = o.a[index];
+		object.visible = o.visible[index] != 0;
+		object.blending = o.blending[index] != 0;
+		object.position = o.position[index];
+		object.orientation = o.orientation[index];
+
+		return true;
 	}
 
-    void ObjectManager::GetRenderState( Cubes & renderState, const vectorial::vec3f * position_error, const vectorial::quat4f * orientation_error )
+    void ObjectManager::GetRenderState( Cubes & renderState, const vectorial::vec3f * position_error, const vectorial::quat4f * orientation_error ) const
     {
-        renderState.numCubes = (int) objects.size();
+        renderState.numCubes = numObjects;
 
         assert( renderState.numCubes <= MaxViewObjects );
 
-        unsigned int i = 0;
-        for ( object_map::iterator itor = objects.begin(); itor != objects.end(); ++itor )
-        {
-            Object * object = itor->second;
-            assert( object );
+        const Arrays & o = arrays[current];
 
-            const int id = object->id;
+        for ( int i = 0; i < numObjects; ++i )
+        {
+            const int id = o.id[i];
 
-            vectorial::mat4f translation = vectorial::mat4f::translation( object->position + ( position_error ? position_error[id] : vectorial::vec3f(0,0,0) ) );
-            vectorial::mat4f rotation = vectorial::mat4f::rotation( object->orientation * ( orientation_error ? orientation_error[id] : vectorial::quat4f(0,0,0,1) ) );
-            vectorial::mat4f scale = vectorial::mat4f::scale( object->scale * 0.5f );
+            vectorial::mat4f translation = vectorial::mat4f::translation( o.position[i] + ( position_error ? position_error[id] : vectorial::vec3f(0,0,0) ) );
+            vectorial::mat4f rotation = vectorial::mat4f::rotation( o.orientation[i] * ( orientation_error ? orientation_error[id] : vectorial::quat4f(0,0,0,1) ) );
+            vectorial::mat4f scale = vectorial::mat4f::scale( o.scale[i] * 0.5f );
 
-            vectorial::mat4f inv_translation = vectorial::mat4f::translation( - ( object->position + ( position_error ? position_error[id] : vectorial::vec3f(0,0,0) ) ) );
+            vectorial::mat4f inv_translation = vectorial::mat4f::translation( - ( o.position[i] + ( position_error ? position_error[id] : vectorial::vec3f(0,0,0) ) ) );
             vectorial::mat4f inv_rotation = transpose( rotation );
-            vectorial::mat4f inv_scale = vectorial::mat4f::scale( 1.0f / ( object->scale * 0.5f ) );
+            vectorial::mat4f inv_scale = vectorial::mat4f::scale( 1.0f / ( o.scale[i] * 0.5f ) );
 
             renderState.cube[i].transform = translation * rotation * scale;
             renderState.cube[i].inverse_transform = inv_rotation * inv_translation * inv_scale;
             
-            renderState.cube[i].r = object->r;
-            renderState.cube[i].g = object->g;
-            renderState.cube[i].b = object->b;
-            renderState.cube[i].a = object->a;
-
-            i++;
+            renderState.cube[i].r = o.r[i];
+            renderState.cube[i].g = o.g[i];
+            renderState.cube[i].b = o.b[i];
+            renderState.cube[i].a = o.a[i];
         }
     }
 
@@ -299,8 +494,8 @@ namespace view
 		{
 			updates[i].id = viewPacket.object[i].id;
 			updates[i].authority = viewPacket.object[i].authority;
-			updates[i].position = vectorial::vec3f( viewPacket.object[i].position.x, viewPacket.object[i].position.y, viewPacket.object[i].position.z );
-			updates[i].orientation = vectorial::quat4f( viewPacket.object[i].orientation.x, viewPacket.object[i].orientation.y, viewPacket.object[i].orientation.z, viewPacket.object[i].orientation.w );
+			updates[i].position = math::to_vec3f( viewPacket.object[i].position );
+			updates[i].orientation = math::to_quat4f( viewPacket.object[i].orientation );
 			updates[i].scale = viewPacket.object[i].scale;
 			updates[i].visible = !viewPacket.object[i].pendingDeactivation;
 		}
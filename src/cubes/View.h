@@ -30,7 +30,7 @@
 #include "vectorial/mat4f.h"
 #include "vectorial/quat4f.h"
 #include "core/Core.h"
-#include <map>
+#include <vector>
 
 namespace view
 {
@@ -57,7 +57,7 @@ namespace view
 		vectorial::vec3f position;
 		vectorial::quat4f orientation;
 		float scale;
- 		uint32_t id : 20;
+ 		uint32_t id : 30;
 		uint32_t authority : core::BitsRequired<0,MaxPlayers+1>::result;
 		uint32_t visible : 1;
 	};
@@ -66,53 +66,95 @@ namespace view
 	{
 		Object()
 		{
-			this->id = 0;
+			id = 0;
 			authority = 0;
-			remove = 0;
-			visible = 0;
-			blending = 0;
+			scale = 1.0f;
+			r = g = b = a = 0.0f;
+			visible = false;
+			blending = false;
 		}
 
 		unsigned int id;
 		int authority;
 		float scale;
 		float r,g,b,a;
-		bool remove;
 		bool visible;
 		bool blending;
-		float blend_time;
-		float blend_start;
-		float blend_finish;
 
 		vectorial::vec3f position;
 		vectorial::quat4f orientation;
-		vectorial::vec3f linear_velocity;
-		vectorial::vec3f angular_velocity;
 	};
 
 	/*	
 		Manages the set of objects on the view-side which is typically
-		a copy following the set of objects in the simulation active set
+		a copy following the set of objects in the simulation active set.
+
+		Objects are kept as a structure of arrays sorted by id, so each
+		set of updates is merged in a single pass and the per-frame alpha
+		and color blends run four objects at a time. Once an object's color
+		stops changing it is at rest and is skipped until its authority
+		changes, so a view full of settled cubes costs next to nothing.
 	*/
 	
 	class ObjectManager
 	{
 	public:
 
+		ObjectManager();
+
 		void Reset();
 
-		void UpdateObjects( ObjectUpdate updates[], int updateCount );
+		void UpdateObjects( const ObjectUpdate updates[], int updateCount );
 		
 		void Update( float deltaTime );
 
-		Object * GetObject( unsigned int id );
+		int GetNumObjects() const
+		{
+			return numObjects;
+		}
 
-		void GetRenderState( Cubes & renderState, const vectorial::vec3f * position_error, const vectorial::quat4f * orientation_error );
+		bool GetObject( unsigned int id, Object & object ) const;
+
+		void GetRenderState( Cubes & renderState, const vectorial::vec3f * position_error, const vectorial::quat4f * orientation_error ) const;
 
 	private:
 
-		typedef std::map<unsigned int, Object*> object_map;
-		object_map objects;
+		struct Arrays
+		{
+			std::vector<uint32_t> id;
+			std::vector<int> authority;
+			std::vector<float> scale;
+			std::vector<float> r, g, b, a;
+			std::vector<float> target_r, target_g, target_b;
+			std::vector<float> tightness;
+			std::vector<float> blend_time;
+			std::vector<float> blend_start;
+			std::vector<float> blend_finish;
+			std::vector<uint8_t> visible;
+			std::vector<uint8_t> blending;
+			std::vector<uint8_t> settled;
+			std::vector<vectorial::vec3f> position;
+			std::vector<vectorial::quat4f> orientation;
+
+			void Resize( int size );
+
+			void Clear( int index );
+
+			void Copy( int index, const Arrays & from, int fromIndex );
+
+			void Add( int index, const ObjectUpdate & update );
+
+			void Update( int index, const ObjectUpdate & update );
+
+			void SetAuthority( int index, int newAuthority );
+		};
+
+		int FindObject( unsigned int id ) const;
+
+		int numObjects;
+		int current;
+		Arrays arrays[2];
+		std::vector<uint64_t> order;
 	};
 
 	// camera object
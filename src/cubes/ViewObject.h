@@ -37,9 +37,9 @@ namespace view
 		math::Vector position;
 		math::Vector linearVelocity;
 		math::Vector angularVelocity;
+		uint32_t id;
 		uint32_t pendingDeactivation : 1;
 		uint32_t enabled : 1;
-		uint32_t id : 20;
 		uint32_t owner : 3;
 		uint32_t authority : 3;
 		float scale;
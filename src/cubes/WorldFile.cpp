@@ -0,0 +1,359 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "WorldFile.h"
+#include "Mathematics.h"
+#include <stdio.h>
+
+#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace activation
+{
+	static uint64_t AlignSection( uint64_t offset )
+	{
+		return ( offset + 15 ) & ~uint64_t( 15 );
+	}
+
+	static bool WritePadding( FILE * file, uint64_t & offset )
+	{
+		const uint8_t zero[16] = { 0 };
+		const uint64_t aligned = AlignSection( offset );
+		const size_t bytes = size_t( aligned - offset );
+		offset = aligned;
+		return bytes == 0 || fwrite( zero, 1, bytes, file ) == bytes;
+	}
+
+	WorldFileWriter::WorldFileWriter( int width, int height, float cellSize, int objectBytes )
+	{
+		assert( width > 0 );
+		assert( height > 0 );
+		assert( cellSize > 0.0f );
+		assert( objectBytes > 0 );
+		this->width = width;
+		this->height = height;
+		this->cellSize = cellSize;
+		this->objectBytes = objectBytes;
+	}
+
+	void WorldFileWriter::AddObject( float x, float y, const void * object )
+	{
+		positions.push_back( x );
+		positions.push_back( y );
+		const uint8_t * bytes = (const uint8_t*) object;
+		data.insert( data.end(), bytes, bytes + objectBytes );
+	}
+
+	int WorldFileWriter::GetCellIndex( float x, float y ) const
+	{
+		// IMPORTANT: must match the activation system cell lookup exactly, including float rounding
+		const float bound_x = width / 2 * cellSize;
+		const float bound_y = height / 2 * cellSize;
+		const float inverse_size = 1.0f / cellSize;
+		assert( x >= -bound_x );
+		assert( x <= +bound_x );
+		assert( y >= -bound_y );
+		assert( y <= +bound_y );
+		const int ix = math::clamp( (int) math::floor( ( x + bound_x ) * inverse_size ), 0, width - 1 );
+		const int iy = math::clamp( (int) math::floor( ( y + bound_y ) * inverse_size ), 0, height - 1 );
+		return iy * width + ix;
+	}
+
+	bool WorldFileWriter::Write( const char * filename )
+	{
+		const int objectCount = GetObjectCount();
+		const int numCells = width * height;
+
+		// counting sort objects by cell. objects in the same cell keep the order they were added in
+
+		std::vector<uint32_t> cellStart( numCells + 1, 0 );
+		std::vector<int> objectCell( objectCount );
+		for ( int i = 0; i < objectCount; ++i )
+		{
+			objectCell[i] = GetCellIndex( positions[i*2], positions[i*2+1] );
+			cellStart[objectCell[i]+1]++;
+		}
+		for ( int i = 0; i < numCells; ++i )
+			cellStart[i+1] += cellStart[i];
+
+		std::vector<uint32_t> cellOffset( cellStart.begin(), cellStart.end() - 1 );
+		std::vector<int> order( objectCount );
+		ids.resize( objectCount );
+		for ( int i = 0; i < objectCount; ++i )
+		{
+			const uint32_t index = cellOffset[objectCell[i]]++;
+			order[index] = i;
+			ids[i] = index + 1;
+		}
+
+		WorldFileHeader header;
+		memset( &header, 0, sizeof( header ) );
+		header.magic = WorldFileHeader::Magic;
+		header.version = WorldFileHeader::Version;
+		header.width = width;
+		header.height = height;
+		header.cellSize = cellSize;
+		header.objectCount = objectCount;
+		header.objectBytes = objectBytes;
+		header.cellOffset = AlignSection( sizeof( WorldFileHeader ) );
+		header.objectOffset = AlignSection( header.cellOffset + sizeof( uint32_t ) * ( numCells + 1 ) );
+		header.dataOffset = AlignSection( header.objectOffset + sizeof( WorldObject ) * uint64_t( objectCount + 1 ) );
+		header.fileBytes = header.dataOffset + uint64_t( objectBytes ) * ( objectCount + 1 );
+
+		FILE * file = fopen( filename, "wb" );
+		if ( !file )
+			return false;
+
+		bool ok = fwrite( &header, sizeof( header ), 1, file ) == 1;
+
+		uint64_t offset = sizeof( header );
+		ok = ok && WritePadding( file, offset );
+		ok = ok && fwrite( &cellStart[0], sizeof( uint32_t ), numCells + 1, file ) == size_t( numCells + 1 );
+		offset += sizeof( uint32_t ) * ( numCells + 1 );
+		ok = ok && WritePadding( file, offset );
+
+		WorldObject object;
+		memset( &object, 0, sizeof( object ) );
+		ok = ok && fwrite( &object, sizeof( object ), 1, file ) == 1;
+		for ( int cellIndex = 0; cellIndex < numCells && ok; ++cellIndex )
+		{
+			for ( uint32_t index = cellStart[cellIndex]; index < cellStart[cellIndex+1] && ok; ++index )
+			{
+				const int i = order[index];
+				object.x = positions[i*2];
+				object.y = positions[i*2+1];
+				object.cellIndex = cellIndex;
+				object.homeCellIndex = cellIndex;
+				object.disabled = 0;
+				ok = fwrite( &object, sizeof( object ), 1, file ) == 1;
+			}
+		}
+		offset += sizeof( WorldObject ) * uint64_t( objectCount + 1 );
+		ok = ok && WritePadding( file, offset );
+
+		std::vector<uint8_t> zero( objectBytes, 0 );
+		ok = ok && fwrite( &zero[0], objectBytes, 1, file ) == 1;
+		for ( int index = 0; index < objectCount && ok; ++index )
+			ok = fwrite( &data[order[index]*size_t(objectBytes)], objectBytes, 1, file ) == 1;
+		offset += uint64_t( objectBytes ) * ( objectCount + 1 );
+		assert( !ok || offset == header.fileBytes );
+
+		if ( fclose( file ) != 0 )
+			ok = false;
+
+		return ok;
+	}
+
+	WorldFile::WorldFile()
+	{
+		header = NULL;
+		cellStart = NULL;
+		objects = NULL;
+		data = NULL;
+		mapping = NULL;
+		mappingBytes = 0;
+		#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+		fileHandle = NULL;
+		mappingHandle = NULL;
+		#endif
+		changedCount = 0;
+		changedSize = 0;
+	}
+
+	WorldFile::~WorldFile()
+	{
+		Close();
+	}
+
+	bool WorldFile::Open( const char * filename )
+	{
+		assert( !IsOpen() );
+
+		#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+			HANDLE file = CreateFileA( filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+			if ( file == INVALID_HANDLE_VALUE )
+				return false;
+			LARGE_INTEGER fileSize;
+			HANDLE fileMapping = NULL;
+			if ( GetFileSizeEx( file, &fileSize ) && fileSize.QuadPart >= (LONGLONG) sizeof( WorldFileHeader ) )
+				fileMapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+			if ( !fileMapping )
+			{
+				CloseHandle( file );
+				return false;
+			}
+			fileHandle = file;
+			mappingHandle = fileMapping;
+			mappingBytes = fileSize.QuadPart;
+			mapping = MapViewOfFile( fileMapping, FILE_MAP_READ, 0, 0, 0 );
+			if ( !mapping )
+			{
+				Close();
+				return false;
+			}
+
+		#else // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+			const int file = open( filename, O_RDONLY );
+			if ( file < 0 )
+				return false;
+			struct stat sb;
+			if ( fstat( file, &sb ) != 0 || sb.st_size < (off_t) sizeof( WorldFileHeader ) )
+			{
+				close( file );
+				return false;
+			}
+			mappingBytes = sb.st_size;
+			mapping = mmap( NULL, mappingBytes, PROT_READ, MAP_SHARED, file, 0 );
+			close( file );
+			if ( mapping == MAP_FAILED )
+			{
+				mapping = NULL;
+				return false;
+			}
+
+		#endif // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+		const uint8_t * base = (const uint8_t*) mapping;
+		const WorldFileHeader * fileHeader = (const WorldFileHeader*) base;
+		const uint64_t numCells = uint64_t( fileHeader->width ) * fileHeader->height;
+		const uint64_t numObjects = uint64_t( fileHeader->objectCount ) + 1;
+		if ( fileHeader->magic != WorldFileHeader::Magic ||
+			 fileHeader->version != WorldFileHeader::Version ||
+			 fileHeader->fileBytes != mappingBytes ||
+			 numCells == 0 ||
+			 fileHeader->cellOffset + sizeof( uint32_t ) * ( numCells + 1 ) > fileHeader->objectOffset ||
+			 fileHeader->objectOffset + sizeof( WorldObject ) * numObjects > fileHeader->dataOffset ||
+			 fileHeader->dataOffset + uint64_t( fileHeader->objectBytes ) * numObjects > mappingBytes ||
+			 ( ( fileHeader->cellOffset | fileHeader->objectOffset | fileHeader->dataOffset ) & 15 ) != 0 )
+		{
+			Close();
+			return false;
+		}
+
+		header = fileHeader;
+		cellStart = (const uint32_t*) ( base + header->cellOffset );
+		objects = (const WorldObject*) ( base + header->objectOffset );
+		data = base + header->dataOffset;
+
+		if ( cellStart[0] != 0 || cellStart[numCells] != header->objectCount )
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void WorldFile::Close()
+	{
+		#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+		if ( mapping )
+			UnmapViewOfFile( mapping );
+		if ( mappingHandle )
+			CloseHandle( mappingHandle );
+		if ( fileHandle )
+			CloseHandle( fileHandle );
+		fileHandle = NULL;
+		mappingHandle = NULL;
+		#else
+		if ( mapping )
+			munmap( mapping, mappingBytes );
+		#endif
+		header = NULL;
+		cellStart = NULL;
+		objects = NULL;
+		data = NULL;
+		mapping = NULL;
+		mappingBytes = 0;
+		changedCount = 0;
+		changedSize = 0;
+		std::vector<uint32_t>().swap( changedIds );
+		std::vector<WorldObject>().swap( changedObjects );
+		std::vector<uint8_t>().swap( changedData );
+		changedIndex.Free();
+	}
+
+	int WorldFile::Modify( ObjectId id )
+	{
+		assert( header );
+		assert( id > 0 );
+		assert( id <= header->objectCount );
+		int index = FindChanged( id );
+		if ( index >= 0 )
+			return index;
+		if ( changedCount == changedSize )
+			ResizeChanged( core::max( changedSize * 2, (int) MinimumChangedSize ) );
+		const size_t objectBytes = header->objectBytes;
+		index = changedCount++;
+		changedIds[index] = id;
+		changedObjects[index] = objects[id];
+		memcpy( changedData.data() + index * objectBytes, data + id * objectBytes, objectBytes );
+		changedIndex.Insert( id, index );
+		return index;
+	}
+
+	void WorldFile::Revert( ObjectId id )
+	{
+		const int index = FindChanged( id );
+		if ( index < 0 )
+			return;
+		const size_t objectBytes = header->objectBytes;
+		if ( memcmp( &changedObjects[index], &objects[id], sizeof( WorldObject ) ) != 0 || memcmp( changedData.data() + index * objectBytes, data + id * objectBytes, objectBytes ) != 0 )
+			return;
+		const int last = changedCount - 1;
+		changedIndex.Delete( &changedIds[0], index, last );
+		if ( index != last )
+		{
+			changedIds[index] = changedIds[last];
+			changedObjects[index] = changedObjects[last];
+			memcpy( changedData.data() + index * objectBytes, changedData.data() + last * objectBytes, objectBytes );
+		}
+		changedCount--;
+
+		// shrink at a quarter full, as activation sets do
+		if ( changedCount < changedSize/4 && changedSize/2 >= MinimumChangedSize )
+			ResizeChanged( changedSize/2 );
+	}
+
+	void WorldFile::ResizeChanged( int size )
+	{
+		assert( size >= changedCount );
+		changedSize = size;
+		changedIds.resize( size );
+		changedObjects.resize( size );
+		changedData.resize( size * size_t( header->objectBytes ) );
+		changedIds.shrink_to_fit();
+		changedObjects.shrink_to_fit();
+		changedData.shrink_to_fit();
+		changedIndex.Rebuild( &changedIds[0], changedCount, size );
+	}
+}
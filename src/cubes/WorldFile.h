@@ -0,0 +1,418 @@
+/*
+    Networked Physics Demo
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CUBES_WORLD_FILE_H
+#define CUBES_WORLD_FILE_H
+
+#include "core/Core.h"
+#include <assert.h>
+#include <vector>
+
+namespace activation
+{
+	typedef uint32_t ObjectId;
+
+	/*
+		Hashed id -> index lookup for unordered sets that keep their ids
+		in a plain array. Indices are only hashed once the set is at least
+		MinimumHashedSize big, smaller sets (eg. most grid cells) just scan
+		their ids, which is cheaper. The owner passes its id array in,
+		so the same index serves array of structures and structure of
+		arrays storage alike, as well as the world file's changed objects.
+	*/
+
+	class IdIndex
+	{
+	public:
+
+		enum { MinimumHashedSize = 32 };
+
+		IdIndex()
+		{
+			slotMask = 0;
+			slots = NULL;
+		}
+
+		~IdIndex()
+		{
+			Free();
+		}
+
+		void Free()
+		{
+			delete [] slots;
+			slots = NULL;
+			slotMask = 0;
+		}
+
+		void Clear()
+		{
+			if ( slots )
+				memset( slots, 0xFF, sizeof( int ) * ( slotMask + 1 ) );
+		}
+
+		// call whenever the id array is reallocated to size entries
+		void Rebuild( const uint32_t * ids, int count, int size )
+		{
+			Free();
+			if ( size < MinimumHashedSize )
+				return;
+			int numSlots = 1;
+			while ( numSlots < size * 2 )
+				numSlots *= 2;
+			slots = new int[numSlots];
+			slotMask = numSlots - 1;
+			memset( slots, 0xFF, sizeof( int ) * numSlots );
+			for ( int i = 0; i < count; ++i )
+				InsertSlot( ids[i], i );
+		}
+
+		int Find( const uint32_t * ids, int count, ObjectId id ) const
+		{
+			if ( slots )
+			{
+				for ( uint32_t slot = GetSlot( id ); slots[slot] >= 0; slot = ( slot + 1 ) & slotMask )
+				{
+					if ( ids[slots[slot]] == id )
+						return slots[slot];
+				}
+				return -1;
+			}
+			for ( int i = 0; i < count; ++i )
+				if ( ids[i] == id )
+					return i;
+			return -1;
+		}
+
+		// id has just been stored at ids[index]
+		void Insert( ObjectId id, int index )
+		{
+			if ( slots )
+				InsertSlot( id, index );
+		}
+
+		// deletes ids[index] by moving the last id into its place. call before the owner moves its arrays
+		void Delete( const uint32_t * ids, int index, int last )
+		{
+			if ( !slots )
+				return;
+			DeleteSlot( ids, ids[index] );
+			if ( index != last )
+				MoveSlot( ids[last], last, index );
+		}
+
+		int GetBytes() const
+		{
+			return slots ? sizeof( int ) * ( slotMask + 1 ) : 0;
+		}
+
+	protected:
+
+		// open addressing with linear probing. each slot holds an index into the arrays or -1,
+		// and the table is kept at most half full so probes stay short
+
+		uint32_t GetSlot( ObjectId id ) const
+		{
+			return ( id * 2654435769U ) & slotMask;
+		}
+
+		void InsertSlot( ObjectId id, int index )
+		{
+			uint32_t slot = GetSlot( id );
+			while ( slots[slot] >= 0 )
+				slot = ( slot + 1 ) & slotMask;
+			slots[slot] = index;
+		}
+
+		void MoveSlot( ObjectId id, int from, int to )
+		{
+			uint32_t slot = GetSlot( id );
+			while ( slots[slot] != from )
+			{
+				assert( slots[slot] >= 0 );
+				slot = ( slot + 1 ) & slotMask;
+			}
+			slots[slot] = to;
+		}
+
+		void DeleteSlot( const uint32_t * ids, ObjectId id )
+		{
+			uint32_t hole = GetSlot( id );
+			while ( ids[slots[hole]] != id )
+			{
+				assert( slots[hole] >= 0 );
+				hole = ( hole + 1 ) & slotMask;
+			}
+
+			// shift later entries of the probe run back into the hole, unless that would move one before its home slot
+			uint32_t slot = ( hole + 1 ) & slotMask;
+			while ( slots[slot] >= 0 )
+			{
+				const uint32_t home = GetSlot( ids[slots[slot]] );
+				if ( ( ( slot - home ) & slotMask ) >= ( ( slot - hole ) & slotMask ) )
+				{
+					slots[hole] = slots[slot];
+					hole = slot;
+				}
+				slot = ( slot + 1 ) & slotMask;
+			}
+			slots[hole] = -1;
+		}
+
+		uint32_t slotMask;
+		int * slots;
+	};
+
+	/*
+		Per-object entry in a world file, indexed by object id.
+		Object ids are handed out in cell order, so the objects that
+		start in a cell have consecutive ids. The current cell and
+		position change at runtime, in memory only, as objects move
+		between cells and as cells are evicted.
+	*/
+
+	struct WorldObject
+	{
+		float x,y;
+		uint32_t cellIndex;
+		uint32_t homeCellIndex : 31;				// the cell whose id range this object is in
+		uint32_t disabled : 1;
+	};
+
+	/*
+		World files are written offline and mapped at runtime:
+
+			header
+			uint32_t cellStart[width*height+1]		objects starting in cell i have ids cellStart[i]+1 .. cellStart[i+1]
+			WorldObject objects[objectCount+1]		indexed by id, entry zero is unused
+			uint8_t data[(objectCount+1)*objectBytes]	one database object per id, entry zero is unused
+
+		Sections start on 16 byte boundaries.
+	*/
+
+	struct WorldFileHeader
+	{
+		enum { Magic = 0x57425543, Version = 1 };		// "CUBW"
+
+		uint32_t magic;
+		uint32_t version;
+		uint32_t width;
+		uint32_t height;
+		float cellSize;
+		uint32_t objectCount;
+		uint32_t objectBytes;
+		uint32_t padding;
+		uint64_t cellOffset;
+		uint64_t objectOffset;
+		uint64_t dataOffset;
+		uint64_t fileBytes;
+	};
+
+	/*
+		Builds a world file from objects added in any order.
+		Objects are sorted by the activation cell containing them,
+		so ids are only known once the file is written.
+	*/
+
+	class WorldFileWriter
+	{
+	public:
+
+		WorldFileWriter( int width, int height, float cellSize, int objectBytes );
+
+		void AddObject( float x, float y, const void * data );
+
+		bool Write( const char * filename );
+
+		// id assigned to the nth object added, valid after writing
+		ObjectId GetObjectId( int index ) const
+		{
+			assert( index >= 0 );
+			assert( index < (int) ids.size() );
+			return ids[index];
+		}
+
+		int GetObjectCount() const
+		{
+			return (int) positions.size() / 2;
+		}
+
+	private:
+
+		int GetCellIndex( float x, float y ) const;
+
+		int width;
+		int height;
+		float cellSize;
+		int objectBytes;
+		std::vector<float> positions;
+		std::vector<uint8_t> data;
+		std::vector<ObjectId> ids;
+	};
+
+	/*
+		A world file mapped into memory, read only. Nothing is read up
+		front: pages come in as cells are loaded and, as they are never
+		written, the OS is free to drop them again. Objects changed at
+		runtime are copied out to a hashed overlay the first time they
+		change and are read from there after that. Revert drops an object
+		from the overlay once it matches the file again, so the overlay
+		only grows with the number of objects that are different.
+	*/
+
+	class WorldFile
+	{
+	public:
+
+		WorldFile();
+		~WorldFile();
+
+		bool Open( const char * filename );
+
+		void Close();
+
+		bool IsOpen() const
+		{
+			return header != NULL;
+		}
+
+		int GetWidth() const
+		{
+			assert( header );
+			return header->width;
+		}
+
+		int GetHeight() const
+		{
+			assert( header );
+			return header->height;
+		}
+
+		float GetCellSize() const
+		{
+			assert( header );
+			return header->cellSize;
+		}
+
+		int GetObjectCount() const
+		{
+			assert( header );
+			return header->objectCount;
+		}
+
+		int GetObjectBytes() const
+		{
+			assert( header );
+			return header->objectBytes;
+		}
+
+		// objects starting in the cell have ids first+1 .. first+count
+		void GetCellObjects( int cellIndex, ObjectId & first, int & count ) const
+		{
+			assert( header );
+			assert( cellIndex >= 0 );
+			assert( cellIndex < (int) ( header->width * header->height ) );
+			first = cellStart[cellIndex];
+			count = cellStart[cellIndex+1] - cellStart[cellIndex];
+		}
+
+		const WorldObject & GetObject( ObjectId id ) const
+		{
+			assert( header );
+			assert( id > 0 );
+			assert( id <= header->objectCount );
+			const int index = FindChanged( id );
+			return index >= 0 ? changedObjects[index] : objects[id];
+		}
+
+		const void * GetObjectData( ObjectId id ) const
+		{
+			assert( header );
+			assert( id > 0 );
+			assert( id <= header->objectCount );
+			const int index = FindChanged( id );
+			return index >= 0 ? changedData.data() + index * size_t(header->objectBytes) : data + id * size_t(header->objectBytes);
+		}
+
+		// the object and its data as they are now, to be changed in place
+
+		WorldObject & ModifyObject( ObjectId id )
+		{
+			const int index = Modify( id );
+			return changedObjects[index];
+		}
+
+		void * ModifyObjectData( ObjectId id )
+		{
+			const int index = Modify( id );
+			return changedData.data() + index * size_t(header->objectBytes);
+		}
+
+		// drops the object from the overlay if it is the same as in the file again
+
+		void Revert( ObjectId id );
+
+		int GetChangedCount() const
+		{
+			return changedCount;
+		}
+
+		int GetBytes() const
+		{
+			return changedSize * int( sizeof( uint32_t ) + sizeof( WorldObject ) + ( header ? header->objectBytes : 0 ) ) + changedIndex.GetBytes();
+		}
+
+	private:
+
+		enum { MinimumChangedSize = 64 };
+
+		int FindChanged( ObjectId id ) const
+		{
+			return changedCount ? changedIndex.Find( &changedIds[0], changedCount, id ) : -1;
+		}
+
+		int Modify( ObjectId id );
+
+		void ResizeChanged( int size );
+
+		const WorldFileHeader * header;
+		const uint32_t * cellStart;
+		const WorldObject * objects;
+		const uint8_t * data;
+		void * mapping;
+		uint64_t mappingBytes;
+		#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+		void * fileHandle;
+		void * mappingHandle;
+		#endif
+		int changedCount;
+		int changedSize;
+		std::vector<uint32_t> changedIds;
+		std::vector<WorldObject> changedObjects;
+		std::vector<uint8_t> changedData;
+		IdIndex changedIndex;
+	};
+}
+
+#endif
@@ -12,12 +12,19 @@
 #include "protocol/SequenceBuffer.h"
 #include "protocol/PacketFactory.h"
 #include "network/Simulator.h"
+#if PACKET_COMPRESSION
+#include "PacketDictionary.h"
+#endif // #if PACKET_COMPRESSION
 
 static const int LeftPort = 1000;
 static const int RightPort = 1001;
 static const int MaxSnapshots = 256;
 static const int MaxPacketSize = 64 * 1024;         // this has to be really large for the worst case!
 
+#if PACKET_SAMPLES
+static FILE * packet_samples = nullptr;
+#endif // #if PACKET_SAMPLES
+
 enum Context
 {
     CONTEXT_SNAPSHOT_SLIDING_WINDOW,                // send snapshots (for serialize write)
@@ -267,6 +274,15 @@ struct CompressionInternal
         snapshot_sequence_buffer = CORE_NEW( allocator, SnapshotSequenceBuffer, allocator, MaxSnapshots );
         networkSimulatorConfig.packetFactory = &packet_factory;
         networkSimulatorConfig.maxPacketSize = MaxPacketSize;
+#if PACKET_COMPRESSION
+        network::PacketCompressorConfig compressorConfig;
+        compressorConfig.allocator = &allocator;
+        compressorConfig.dictionary = compression_dictionary;
+        compressorConfig.dictionarySize = sizeof( compression_dictionary );
+        compressorConfig.maxPacketSize = MaxPacketSize;
+        compressor = CORE_NEW( allocator, network::PacketCompressor, compressorConfig );
+        networkSimulatorConfig.compressor = compressor;
+#endif // #if PACKET_COMPRESSION
         network_simulator = CORE_NEW( allocator, network::Simulator, networkSimulatorConfig );
         context[0] = snapshot_sliding_window;
         context[1] = snapshot_sequence_buffer;
@@ -279,6 +295,11 @@ struct CompressionInternal
         CORE_ASSERT( network_simulator );
         typedef network::Simulator NetworkSimulator;
         CORE_DELETE( *allocator, NetworkSimulator, network_simulator );
+#if PACKET_COMPRESSION
+        typedef network::PacketCompressor PacketCompressor;
+        CORE_DELETE( *allocator, PacketCompressor, compressor );
+        compressor = nullptr;
+#endif // #if PACKET_COMPRESSION
         CORE_DELETE( *allocator, SnapshotSlidingWindow, snapshot_sliding_window );
         CORE_DELETE( *allocator, SnapshotSequenceBuffer, snapshot_sequence_buffer );
         network_simulator = nullptr;
@@ -292,6 +313,9 @@ struct CompressionInternal
         network_simulator->Reset();
         network_simulator->ClearStates();
         network_simulator->AddState( { mode_data.latency, mode_data.jitter, mode_data.packet_loss } );
+#if PACKET_COMPRESSION
+        compressor->ResetCounters();
+#endif // #if PACKET_COMPRESSION
         snapshot_sliding_window->Reset();
         snapshot_sequence_buffer->Reset();
         send_sequence = 0;
@@ -307,6 +331,9 @@ struct CompressionInternal
     float send_accumulator;
     const void * context[2];
     network::Simulator * network_simulator;
+#if PACKET_COMPRESSION
+    network::PacketCompressor * compressor;
+#endif // #if PACKET_COMPRESSION
     SnapshotSlidingWindow * snapshot_sliding_window;
     SnapshotSequenceBuffer * snapshot_sequence_buffer;
     CompressionPacketFactory packet_factory;
@@ -323,10 +350,20 @@ CompressionDemo::CompressionDemo( core::Allocator & allocator )
     m_internal = nullptr;
     m_settings = CORE_NEW( *m_allocator, CubesSettings );
     m_compression = CORE_NEW( *m_allocator, CompressionInternal, *m_allocator, compression_mode_data[GetMode()] );
+
+#if PACKET_SAMPLES
+    packet_samples = fopen( "output/compression_packets.bin", "wb" );
+#endif // #if PACKET_SAMPLES
 }
 
 CompressionDemo::~CompressionDemo()
 {
+#if PACKET_SAMPLES
+    if ( packet_samples )
+        fclose( packet_samples );
+    packet_samples = nullptr;
+#endif // #if PACKET_SAMPLES
+
     Shutdown();
     CORE_DELETE( *m_allocator, CompressionInternal, m_compression );
     CORE_DELETE( *m_allocator, CubesSettings, m_settings );
@@ -398,7 +435,13 @@ void CompressionDemo::Update()
         auto & snapshot = m_compression->snapshot_sliding_window->Insert( sequence );
 
         if ( GetSnapshot( game_instance, snapshot ) )
+        {
+#if PACKET_SAMPLES
+            WritePacketSample( packet_samples, snapshot_packet, m_compression->context, MaxPacketSize );
+#endif // #if PACKET_SAMPLES
+
             m_compression->network_simulator->SendPacket( network::Address( "::1", RightPort ), snapshot_packet );
+        }
         else
             m_compression->packet_factory.Destroy( snapshot_packet );
     }
@@ -505,6 +548,19 @@ void CompressionDemo::Render()
         font->DrawText( text_x, text_y, bandwidth_string, Color( 0.27f,0.81f,1.0f ) );
         font->End();
     }
+
+#if PACKET_COMPRESSION
+    char compression_string[256];
+    GetCompressionString( *m_compression->compressor, compression_string, (int) sizeof( compression_string ) );
+    if ( font )
+    {
+        const float text_x = ( global.displayWidth - font->GetTextWidth( compression_string ) ) / 2;
+        const float text_y = 5 + font->GetLineHeight();
+        font->Begin();
+        font->DrawText( text_x, text_y, compression_string, Color( 0.27f,0.81f,1.0f ) );
+        font->End();
+    }
+#endif // #if PACKET_COMPRESSION
 }
 
 bool CompressionDemo::KeyEvent( int key, int scancode, int action, int mods )
@@ -4,6 +4,11 @@
 #include "Console.h"
 #include "ShaderManager.h"
 
+static void InitializeSimulationThread( void * /*context*/ )
+{
+    cubes::Simulation::InitializeThread();
+}
+
 void CubesInternal::Initialize( core::Allocator & allocator, const CubesConfig & _config, const CubesSettings * _settings )
 {
     config = _config;
@@ -18,50 +23,12 @@ void CubesInternal::Initialize( core::Allocator & allocator, const CubesConfig &
     {
         simulation = CORE_NEW_ARRAY( allocator, CubesSimulation, config.num_simulations );
 
-        game::Config game_config;
-
-        game_config.maxObjects = CubeSteps * CubeSteps + MaxPlayers + 1;      // note: +1 because 0 is null (or possibly "world")
-        game_config.deactivationTime = 0.5f;
-        game_config.cellSize = 2.0f;
-        game_config.cellWidth = int( CubeSteps / game_config.cellSize + 2 * 2 );     // note: double so we have some extra space at the edge of the world
-        game_config.cellHeight = game_config.cellWidth;
-        game_config.activationDistance = 100.0f;
-
-        game_config.simConfig.ERP = config.soften_simulation ? 0.5f : 0.25f;
-        game_config.simConfig.CFM = config.soften_simulation ? 0.01f : 0.001f;
-        game_config.simConfig.MaxIterations = 64;
-        game_config.simConfig.MaximumCorrectingVelocity = config.soften_simulation ? 1.0f : 250.0f;
-        game_config.simConfig.ContactSurfaceLayer = 0.01f;
-        game_config.simConfig.Elasticity = 0.0f;
-        game_config.simConfig.LinearDrag = 0.001f;
-        game_config.simConfig.AngularDrag = 0.001f;
-        game_config.simConfig.Friction = 200.0f;
-
         for ( int i = 0; i < config.num_simulations; ++i )
         {
-            simulation[i].game_instance = CORE_NEW( allocator, GameInstance, game_config );
-
-            simulation[i].game_instance->InitializeBegin();
-
-            simulation[i].game_instance->AddPlane( math::Vector(0,0,1), 0 );
-
-            AddCube( simulation[i].game_instance, 1, vectorial::vec3f(0,0,10) );
-
-            const float origin = -CubeSteps / 2.0f;
-            const float z = hypercube::NonPlayerCubeSize / 2.0f;
-            const int count = CubeSteps;
-            for ( int y = 0; y < count; ++y )
-                for ( int x = 0; x < count; ++x )
-                    AddCube( simulation[i].game_instance, 0, vectorial::vec3f(x+origin+0.5f,y+origin+0.5f,z) );
-
-            simulation[i].game_instance->InitializeEnd();
+            simulation[i].game_instance = CreateCubesGameInstance( allocator, config.soften_simulation );
 
             simulation[i].game_instance->OnPlayerJoined( 0 );
             simulation[i].game_instance->SetLocalPlayer( 0 );
-            simulation[i].game_instance->SetPlayerFocus( 0, 1 );
-
-            simulation[i].game_instance->SetFlag( game::FLAG_Push );
-            simulation[i].game_instance->SetFlag( game::FLAG_Pull );
         }
     }
     else
@@ -69,6 +36,18 @@ void CubesInternal::Initialize( core::Allocator & allocator, const CubesConfig &
         simulation = nullptr;
     }
 
+    // simulations are independent of each other, so step them in parallel when there is more than one
+
+    job_system = nullptr;
+
+    if ( config.num_simulations > 1 )
+    {
+        core::JobSystemConfig job_config;
+        job_config.num_threads = core::min( config.num_simulations, core::get_num_cores() ) - 1;
+        job_config.thread_start = InitializeSimulationThread;
+        job_system = CORE_NEW( allocator, core::JobSystem, job_config );
+    }
+
 #ifdef CLIENT
 
     // create views
@@ -90,6 +69,12 @@ void CubesInternal::Initialize( core::Allocator & allocator, const CubesConfig &
 
 void CubesInternal::Free( core::Allocator & allocator )
 {
+    if ( job_system )
+    {
+        CORE_DELETE( allocator, JobSystem, job_system );
+        job_system = nullptr;
+    }
+
     if ( simulation )
     {
         for ( int i = 0; i < config.num_simulations; ++i )
@@ -113,7 +98,7 @@ void CubesInternal::Free( core::Allocator & allocator )
 #endif // #ifdef CLIENT
 }
 
-void CubesInternal::AddCube( GameInstance * game_instance, int player, const vectorial::vec3f & position )
+static void AddCubeToInstance( GameInstance * game_instance, int player, const vectorial::vec3f & position )
 {
     hypercube::DatabaseObject object;
     math::Vector stupid_position( position.x(), position.y(), position.z() );
@@ -127,12 +112,94 @@ void CubesInternal::AddCube( GameInstance * game_instance, int player, const vec
         game_instance->DisableObject( id );
 }
 
+GameInstance * CreateCubesGameInstance( core::Allocator & allocator, bool soften_simulation )
+{
+    game::Config game_config;
+
+    game_config.maxObjects = CubeSteps * CubeSteps + MaxPlayers + 1;      // note: +1 because 0 is null (or possibly "world")
+    game_config.deactivationTime = 0.5f;
+    game_config.cellSize = 2.0f;
+    game_config.cellWidth = int( CubeSteps / game_config.cellSize + 2 * 2 );     // note: double so we have some extra space at the edge of the world
+    game_config.cellHeight = game_config.cellWidth;
+    game_config.activationDistance = 100.0f;
+
+    game_config.simConfig.ERP = soften_simulation ? 0.5f : 0.25f;
+    game_config.simConfig.CFM = soften_simulation ? 0.01f : 0.001f;
+    game_config.simConfig.MaxIterations = 64;
+    game_config.simConfig.MaximumCorrectingVelocity = soften_simulation ? 1.0f : 250.0f;
+    game_config.simConfig.ContactSurfaceLayer = 0.01f;
+    game_config.simConfig.Elasticity = 0.0f;
+    game_config.simConfig.LinearDrag = 0.001f;
+    game_config.simConfig.AngularDrag = 0.001f;
+    game_config.simConfig.Friction = 200.0f;
+
+    GameInstance * game_instance = CORE_NEW( allocator, GameInstance, game_config );
+
+    game_instance->InitializeBegin();
+
+    game_instance->AddPlane( math::Vector(0,0,1), 0 );
+
+    AddCubeToInstance( game_instance, 1, vectorial::vec3f(0,0,10) );
+
+    const float origin = -CubeSteps / 2.0f;
+    const float z = hypercube::NonPlayerCubeSize / 2.0f;
+    const int count = CubeSteps;
+    for ( int y = 0; y < count; ++y )
+        for ( int x = 0; x < count; ++x )
+            AddCubeToInstance( game_instance, 0, vectorial::vec3f(x+origin+0.5f,y+origin+0.5f,z) );
+
+    game_instance->InitializeEnd();
+
+    game_instance->SetPlayerFocus( 0, 1 );
+
+    game_instance->SetFlag( game::FLAG_Push );
+    game_instance->SetFlag( game::FLAG_Pull );
+
+    return game_instance;
+}
+
+void CubesInternal::AddCube( GameInstance * game_instance, int player, const vectorial::vec3f & position )
+{
+    AddCubeToInstance( game_instance, player, position );
+}
+
 extern "C" 
 {
     extern unsigned long dRandGetSeed();
     extern void dRandSetSeed( unsigned int seed );
 }
 
+void CubesInternal::UpdateSimulation( int simulation_index, const CubesUpdateConfigPerSim & sim_config, float deltaTime )
+{
+    CubesSimulation & sim = simulation[simulation_index];
+
+    for ( int j = 0; j < sim_config.num_frames; ++j )
+    { 
+        sim.game_instance->SetPlayerInput( 0, sim_config.frame_input[j] );
+
+        // note: the ode random seed is thread local, so this is safe with simulations stepping in parallel
+        if ( settings->deterministic )
+            dRandSetSeed( sim.frame );
+
+        sim.game_instance->Update( deltaTime );
+
+        sim.frame++;
+    }
+}
+
+struct UpdateSimulationJobData
+{
+    CubesInternal * cubes;
+    const CubesUpdateConfig * update_config;
+    float deltaTime;
+};
+
+static void UpdateSimulationJob( void * data, int index )
+{
+    UpdateSimulationJobData * job_data = (UpdateSimulationJobData*) data;
+    job_data->cubes->UpdateSimulation( index, job_data->update_config->sim[index], job_data->deltaTime );
+}
+
 void CubesInternal::Update( const CubesUpdateConfig & update_config )
 {
     const float deltaTime = (float) global.timeBase.deltaTime;
@@ -144,19 +211,18 @@ void CubesInternal::Update( const CubesUpdateConfig & update_config )
 
     if ( simulation )
     {
-        for ( int i = 0; i < config.num_simulations; ++i )
+        if ( job_system )
         {
-            for ( int j = 0; j < update_config.sim[i].num_frames; ++j )
-            { 
-                simulation[i].game_instance->SetPlayerInput( 0, update_config.sim[i].frame_input[j] );
-
-                if ( settings->deterministic )
-                    dRandSetSeed( simulation[i].frame );
-
-                simulation[i].game_instance->Update( deltaTime );
-
-                simulation[i].frame++;
-            }
+            UpdateSimulationJobData data;
+            data.cubes = this;
+            data.update_config = &update_config;
+            data.deltaTime = deltaTime;
+            job_system->Run( UpdateSimulationJob, &data, config.num_simulations );
+        }
+        else
+        {
+            for ( int i = 0; i < config.num_simulations; ++i )
+                UpdateSimulation( i, update_config.sim[i], deltaTime );
         }
     }
 
@@ -177,9 +243,9 @@ void CubesInternal::Update( const CubesUpdateConfig & update_config )
 
             view[i].objects.Update( deltaTime );
 
-            view::Object * player = view[i].objects.GetObject( 1 );
+            view::Object player;
 
-            vectorial::vec3f origin = player ? player->position : vectorial::vec3f(0,0,0);
+            vectorial::vec3f origin = view[i].objects.GetObject( 1, player ) ? player.position : vectorial::vec3f(0,0,0);
 
             vectorial::vec3f lookat = origin - vectorial::vec3f(0,0,1);
 
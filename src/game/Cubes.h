@@ -2,6 +2,7 @@
 #define GAME_CUBES_H
 
 #include "core/Memory.h"
+#include "core/JobSystem.h"
 #include "cubes/Game.h"
 #include "cubes/View.h"
 #include "cubes/Hypercube.h"
@@ -12,7 +13,12 @@ const int MaxViews = 4;
 const int MaxSimulations = 4;
 const int MaxSimFrames = 4;
 
-typedef game::Instance<hypercube::DatabaseObject, hypercube::ActiveObject> GameInstance;
+typedef game::Instance<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectSet> GameInstance;
+
+// creates a game instance with the standard cubes world: ground plane, player cube and CubeSteps x CubeSteps grid of cubes.
+// the player is not joined. that's up to the caller.
+
+extern GameInstance * CreateCubesGameInstance( core::Allocator & allocator, bool soften_simulation = false );
 
 struct CubeInstance
 {
@@ -169,6 +175,8 @@ struct CubesInternal
 
     CubesSimulation * simulation;
 
+    core::JobSystem * job_system;
+
 #ifdef CLIENT
 
     CubesView * view;
@@ -185,6 +193,8 @@ struct CubesInternal
 
     void Update( const CubesUpdateConfig & update_config );
 
+    void UpdateSimulation( int simulation_index, const CubesUpdateConfigPerSim & sim_config, float deltaTime );
+
 #ifdef CLIENT
 
     bool Clear();
@@ -6,6 +6,7 @@
 #include "Global.h"
 #include "Render.h"
 #include "Console.h"
+#include "GameClient.h"
 
 CubesDemo::CubesDemo( core::Allocator & allocator )
 {
@@ -58,6 +59,11 @@ void CubesDemo::Update()
     update_config.sim[0].num_frames = 1;
     update_config.sim[0].frame_input[0] = m_internal->GetLocalInput();
 
+    // when connected to a server, drive our room there with the same input
+
+    if ( global.client && global.client->IsConnected() )
+        global.client->SendInput( m_internal->simulation[0].frame, update_config.sim[0].frame_input[0] );
+
     m_internal->Update( update_config );
 }
 
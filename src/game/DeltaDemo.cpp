@@ -13,12 +13,27 @@
 #include "protocol/SequenceBuffer.h"
 #include "protocol/PacketFactory.h"
 #include "network/Simulator.h"
+#if STATIC_DELTA_TABLES
+#include "DeltaTables.h"
+#endif // #if STATIC_DELTA_TABLES
+#if PACKET_COMPRESSION
+#include "PacketDictionary.h"
+#endif // #if PACKET_COMPRESSION
+#if ENTROPY_CODED_SNAPSHOTS
+#include "protocol/EntropyStream.h"
+#endif // #if ENTROPY_CODED_SNAPSHOTS
 
 static const int LeftPort = 1000;
 static const int RightPort = 1001;
 static const int MaxSnapshots = 256;
 static const int MaxPacketSize = 64 * 1024;         // this has to be really large for the worst case!
 
+#if ENTROPY_CODED_SNAPSHOTS
+
+static uint8_t entropy_buffer[MaxPacketSize];
+
+#endif // #if ENTROPY_CODED_SNAPSHOTS
+
 #if DELTA_DATA
 
 struct DeltaData
@@ -36,6 +51,12 @@ static FILE * delta_data = nullptr;
 
 #endif // #if DELTA_DATA
 
+#if PACKET_SAMPLES
+
+static FILE * packet_samples = nullptr;
+
+#endif // #if PACKET_SAMPLES
+
 #if DELTA_STATS
 
 static const int MaxPositionDelta = 1024;
@@ -213,6 +234,32 @@ template <typename Stream> void serialize_offset( Stream & stream, int & offset,
     }
 }
 
+#if STATIC_DELTA_TABLES
+
+template <typename Stream> void serialize_delta_huffman( Stream & stream, int & delta, const protocol::HuffmanTable & table )
+{
+    int magnitude;
+    bool negative;
+
+    if ( Stream::IsWriting )
+    {
+        magnitude = abs( delta );
+        negative = delta < 0;
+    }
+
+    serialize_huffman( stream, magnitude, table );
+
+    if ( magnitude != 0 )
+        serialize_bool( stream, negative );
+    else
+        negative = false;
+
+    if ( Stream::IsReading )
+        delta = negative ? -magnitude : magnitude;
+}
+
+#endif // #if STATIC_DELTA_TABLES
+
 template <typename Stream> void serialize_relative_position( Stream & stream,
                                                              int & position_x,
                                                              int & position_y,
@@ -252,6 +299,33 @@ template <typename Stream> void serialize_relative_position( Stream & stream,
 
     serialize_bool( stream, relative_position );
 
+#if STATIC_DELTA_TABLES
+
+    if ( relative_position )
+    {
+        int offset_x, offset_y, offset_z;
+
+        if ( Stream::IsWriting )
+        {
+            offset_x = position_x - base_position_x;
+            offset_y = position_y - base_position_y;
+            offset_z = position_z - base_position_z;
+        }
+
+        serialize_delta_huffman( stream, offset_x, delta_position_x_table );
+        serialize_delta_huffman( stream, offset_y, delta_position_y_table );
+        serialize_delta_huffman( stream, offset_z, delta_position_z_table );
+
+        if ( Stream::IsReading )
+        {
+            position_x = base_position_x + offset_x;
+            position_y = base_position_y + offset_y;
+            position_z = base_position_z + offset_z;
+        }
+    }
+
+#else // #if STATIC_DELTA_TABLES
+
     if ( relative_position )
     {
         serialize_bool( stream, relative_position_small_x );
@@ -301,6 +375,9 @@ template <typename Stream> void serialize_relative_position( Stream & stream,
             position_z = base_position_z + offset_z;
         }
     }
+
+#endif // #if STATIC_DELTA_TABLES
+
     else
     {
         serialize_int( stream, position_x, -QuantizedPositionBoundXY, +QuantizedPositionBoundXY - 1 );
@@ -380,6 +457,34 @@ template <typename Stream> void serialize_relative_orientation( Stream & stream,
 
     serialize_bool( stream, relative_orientation );
 
+#if STATIC_DELTA_TABLES
+
+    if ( relative_orientation )
+    {
+        int offset_a, offset_b, offset_c;
+
+        if ( Stream::IsWriting )
+        {
+            offset_a = orientation.integer_a - base_orientation.integer_a;
+            offset_b = orientation.integer_b - base_orientation.integer_b;
+            offset_c = orientation.integer_c - base_orientation.integer_c;
+        }
+
+        serialize_delta_huffman( stream, offset_a, delta_smallest_three_a_table );
+        serialize_delta_huffman( stream, offset_b, delta_smallest_three_b_table );
+        serialize_delta_huffman( stream, offset_c, delta_smallest_three_c_table );
+
+        if ( Stream::IsReading )
+        {
+            orientation.largest = base_orientation.largest;
+            orientation.integer_a = base_orientation.integer_a + offset_a;
+            orientation.integer_b = base_orientation.integer_b + offset_b;
+            orientation.integer_c = base_orientation.integer_c + offset_c;
+        }
+    }
+
+#else // #if STATIC_DELTA_TABLES
+
     if ( relative_orientation )
     {
         serialize_bool( stream, small_a );
@@ -430,6 +535,9 @@ template <typename Stream> void serialize_relative_orientation( Stream & stream,
             orientation.integer_c = base_orientation.integer_c + offset_c;
         }
     }
+
+#endif // #if STATIC_DELTA_TABLES
+
     else 
     {
         serialize_object( stream, orientation );
@@ -708,10 +816,6 @@ struct DeltaSnapshotPacket : public protocol::Packet
 
     PROTOCOL_SERIALIZE_OBJECT( stream )
     {
-        auto quantized_snapshot_sliding_window = (QuantizedSnapshotSlidingWindow*) stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SLIDING_WINDOW );
-        auto quantized_snapshot_sequence_buffer = (QuantizedSnapshotSequenceBuffer*) stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SEQUENCE_BUFFER );
-        auto quantized_initial_snapshot = (QuantizedSnapshot*) stream.GetContext( CONTEXT_QUANTIZED_INITIAL_SNAPSHOT );
-
         serialize_uint16( stream, sequence );
 
         serialize_int( stream, delta_mode, 0, DELTA_NUM_MODES - 1 );
@@ -721,6 +825,55 @@ struct DeltaSnapshotPacket : public protocol::Packet
         if ( !initial )
             serialize_uint16( stream, base_sequence );
 
+#if ENTROPY_CODED_SNAPSHOTS
+
+        // range code the cubes into a buffer of their own, then send that buffer as bytes
+
+        const void * context[] =
+        {
+            stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SLIDING_WINDOW ),
+            stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SEQUENCE_BUFFER ),
+            stream.GetContext( CONTEXT_QUANTIZED_INITIAL_SNAPSHOT )
+        };
+
+        int entropy_bytes = 0;
+
+        if ( Stream::IsWriting )
+        {
+            protocol::EntropyWriteStream entropy_stream( entropy_buffer, MaxPacketSize );
+            entropy_stream.SetContext( context );
+            SerializeCubes( entropy_stream );
+            entropy_stream.Flush();
+            CORE_ASSERT( !entropy_stream.IsOverflow() );
+            entropy_bytes = entropy_stream.GetBytesProcessed();
+        }
+
+        serialize_int( stream, entropy_bytes, 0, MaxPacketSize );
+
+        serialize_bytes( stream, entropy_buffer, entropy_bytes );
+
+        if ( Stream::IsReading )
+        {
+            protocol::EntropyReadStream entropy_stream( entropy_buffer, entropy_bytes );
+            entropy_stream.SetContext( context );
+            SerializeCubes( entropy_stream );
+            if ( entropy_stream.IsOverflow() || entropy_stream.Aborted() )
+                stream.Abort();
+        }
+
+#else // #if ENTROPY_CODED_SNAPSHOTS
+
+        SerializeCubes( stream );
+
+#endif // #if ENTROPY_CODED_SNAPSHOTS
+    }
+
+    template <typename Stream> void SerializeCubes( Stream & stream )
+    {
+        auto quantized_snapshot_sliding_window = (QuantizedSnapshotSlidingWindow*) stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SLIDING_WINDOW );
+        auto quantized_snapshot_sequence_buffer = (QuantizedSnapshotSequenceBuffer*) stream.GetContext( CONTEXT_QUANTIZED_SNAPSHOT_SEQUENCE_BUFFER );
+        auto quantized_initial_snapshot = (QuantizedSnapshot*) stream.GetContext( CONTEXT_QUANTIZED_INITIAL_SNAPSHOT );
+
         QuantizedCubeState * quantized_cubes = nullptr;
 
         if ( Stream::IsWriting )
@@ -1350,6 +1503,15 @@ struct DeltaInternal
         quantized_snapshot_sequence_buffer = CORE_NEW( allocator, QuantizedSnapshotSequenceBuffer, allocator, MaxSnapshots );
         networkSimulatorConfig.packetFactory = &packet_factory;
         networkSimulatorConfig.maxPacketSize = MaxPacketSize;
+#if PACKET_COMPRESSION
+        network::PacketCompressorConfig compressorConfig;
+        compressorConfig.allocator = &allocator;
+        compressorConfig.dictionary = delta_dictionary;
+        compressorConfig.dictionarySize = sizeof( delta_dictionary );
+        compressorConfig.maxPacketSize = MaxPacketSize;
+        compressor = CORE_NEW( allocator, network::PacketCompressor, compressorConfig );
+        networkSimulatorConfig.compressor = compressor;
+#endif // #if PACKET_COMPRESSION
         network_simulator = CORE_NEW( allocator, network::Simulator, networkSimulatorConfig );
         context[0] = quantized_snapshot_sliding_window;
         context[1] = quantized_snapshot_sequence_buffer;
@@ -1363,6 +1525,11 @@ struct DeltaInternal
         CORE_ASSERT( network_simulator );
         typedef network::Simulator NetworkSimulator;
         CORE_DELETE( *allocator, NetworkSimulator, network_simulator );
+#if PACKET_COMPRESSION
+        typedef network::PacketCompressor PacketCompressor;
+        CORE_DELETE( *allocator, PacketCompressor, compressor );
+        compressor = nullptr;
+#endif // #if PACKET_COMPRESSION
         CORE_DELETE( *allocator, QuantizedSnapshotSlidingWindow, quantized_snapshot_sliding_window );
         CORE_DELETE( *allocator, QuantizedSnapshotSequenceBuffer, quantized_snapshot_sequence_buffer );
         network_simulator = nullptr;
@@ -1376,6 +1543,9 @@ struct DeltaInternal
         network_simulator->Reset();
         network_simulator->ClearStates();
         network_simulator->AddState( { mode_data.latency, mode_data.jitter, mode_data.packet_loss } );
+#if PACKET_COMPRESSION
+        compressor->ResetCounters();
+#endif // #if PACKET_COMPRESSION
         quantized_snapshot_sliding_window->Reset();
         quantized_snapshot_sequence_buffer->Reset();
         send_sequence = 0;
@@ -1391,6 +1561,9 @@ struct DeltaInternal
     float send_accumulator;
     const void * context[3];
     network::Simulator * network_simulator;
+#if PACKET_COMPRESSION
+    network::PacketCompressor * compressor;
+#endif // #if PACKET_COMPRESSION
     QuantizedSnapshotSlidingWindow * quantized_snapshot_sliding_window;
     QuantizedSnapshotSequenceBuffer * quantized_snapshot_sequence_buffer;
     DeltaPacketFactory packet_factory;
@@ -1535,6 +1708,12 @@ DeltaDemo::DeltaDemo( core::Allocator & allocator )
     delta_data = fopen( "output/delta_data.bin", "wb" );
 
 #endif // #if DELTA_DATA
+
+#if PACKET_SAMPLES
+
+    packet_samples = fopen( "output/delta_packets.bin", "wb" );
+
+#endif // #if PACKET_SAMPLES
 }
 
 DeltaDemo::~DeltaDemo()
@@ -1545,6 +1724,14 @@ DeltaDemo::~DeltaDemo()
 
 #endif // #if DELTA_DATA
 
+#if PACKET_SAMPLES
+
+    if ( packet_samples )
+        fclose( packet_samples );
+    packet_samples = nullptr;
+
+#endif // #if PACKET_SAMPLES
+
 
 #if DELTA_STATS
 
@@ -1644,6 +1831,10 @@ void DeltaDemo::Update()
 
         if ( GetQuantizedSnapshot( game_instance, snapshot ) )
         {
+#if PACKET_SAMPLES
+            WritePacketSample( packet_samples, snapshot_packet, m_delta->context, MaxPacketSize );
+#endif // #if PACKET_SAMPLES
+
             m_delta->network_simulator->SendPacket( network::Address( "::1", RightPort ), snapshot_packet );
 
 #if DELTA_DATA
@@ -1706,8 +1897,7 @@ void DeltaDemo::Update()
             CORE_ASSERT( quantized_snapshot );
     
             Snapshot snapshot;
-            for ( int i = 0; i < NumCubes; ++i )
-                quantized_snapshot->cubes[i].Save( snapshot.cubes[i] );
+            DequantizeCubeStates( quantized_snapshot->cubes, snapshot.cubes, NumCubes );
 
             m_delta->interpolation_buffer.AddSnapshot( global.timeBase.time, snapshot_packet->sequence, snapshot.cubes );
 
@@ -1787,6 +1977,19 @@ void DeltaDemo::Render()
         font->DrawText( text_x, text_y, bandwidth_string, Color( 0.27f,0.81f,1.0f ) );
         font->End();
     }
+
+#if PACKET_COMPRESSION
+    char compression_string[256];
+    GetCompressionString( *m_delta->compressor, compression_string, (int) sizeof( compression_string ) );
+    if ( font )
+    {
+        const float text_x = ( global.displayWidth - font->GetTextWidth( compression_string ) ) / 2;
+        const float text_y = 5 + font->GetLineHeight();
+        font->Begin();
+        font->DrawText( text_x, text_y, compression_string, Color( 0.27f,0.81f,1.0f ) );
+        font->End();
+    }
+#endif // #if PACKET_COMPRESSION
 }
 
 bool DeltaDemo::KeyEvent( int key, int scancode, int action, int mods )
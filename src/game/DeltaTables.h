@@ -0,0 +1,1302 @@
+// generated by tools/Entropy/EntropyTool.cpp. do not edit!
+
+#ifndef GAME_DELTA_TABLES_H
+#define GAME_DELTA_TABLES_H
+
+#include "protocol/Huffman.h"
+
+const int delta_position_symbols = 1024;
+
+static const uint8_t delta_position_x_lengths[1024] =
+{
+    4,4,4,5,5,5,5,6,6,6,6,6,6,6,6,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,9,9,8,8,9,9,9,8,9,9,9,
+    8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,10,9,9,9,9,9,9,10,9,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,10,
+    10,10,10,10,10,11,11,10,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,12,11,11,
+    11,11,11,11,11,11,12,11,12,12,12,12,11,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,12,
+    13,12,12,13,12,13,13,13,13,13,13,13,12,12,13,13,
+    13,13,13,13,13,13,13,13,13,14,13,12,13,13,13,13,
+    13,13,13,13,14,13,14,14,13,13,13,14,13,13,13,13,
+    13,14,15,14,13,13,13,13,14,14,14,14,14,15,13,14,
+    14,14,14,15,13,14,14,14,14,14,13,14,13,14,15,14,
+    14,15,14,14,13,14,14,15,14,15,14,14,14,14,14,14,
+    14,14,15,15,14,15,14,14,15,14,15,15,15,15,14,15,
+    15,15,15,14,15,14,15,15,15,15,15,15,15,15,15,15,
+    14,15,15,16,16,16,15,14,15,15,15,15,16,15,15,15,
+    15,14,15,15,16,16,15,15,16,15,15,15,16,15,15,15,
+    15,15,15,15,15,15,15,15,15,16,15,15,15,15,16,15,
+    16,16,16,16,16,15,16,16,16,15,16,15,16,15,16,15,
+    16,16,15,16,15,15,15,16,15,15,15,16,15,15,16,16,
+    16,15,16,15,15,16,16,16,15,16,16,16,16,16,15,15,
+    16,16,16,16,16,15,15,16,15,16,16,15,15,15,15,16,
+    15,16,16,16,16,16,15,16,16,15,16,15,16,16,16,16,
+    16,16,16,16,16,15,15,16,15,16,16,16,16,15,15,16,
+    16,16,15,16,16,16,15,16,16,16,15,15,16,16,16,15,
+    16,16,16,16,16,16,15,16,16,16,16,16,15,16,16,16,
+    16,15,16,16,16,16,15,16,16,16,16,16,16,16,16,16,
+    16,15,16,15,16,16,16,16,16,15,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,15,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,15,16,16,16,
+    16,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_position_x_codes[1024] =
+{
+    0,1,2,6,7,8,9,20,21,22,23,24,25,26,27,56,
+    57,58,59,60,61,62,63,64,65,66,67,68,138,139,140,141,
+    142,143,144,145,146,147,148,149,150,151,152,153,154,155,156,157,
+    158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,
+    174,175,176,177,178,366,367,179,180,368,369,370,181,371,372,373,
+    182,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,
+    389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,
+    405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,420,
+    421,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,
+    437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,
+    453,922,454,455,456,457,458,459,923,460,924,925,926,927,928,929,
+    930,931,932,933,934,935,936,937,938,939,940,941,942,943,944,945,
+    946,947,948,949,950,951,952,953,954,955,956,957,958,959,1934,960,
+    961,962,963,964,965,1935,1936,966,1937,1938,1939,1940,1941,1942,1943,1944,
+    1945,1946,1947,1948,1949,1950,1951,1952,1953,1954,1955,1956,1957,1958,1959,1960,
+    1961,1962,1963,1964,1965,1966,1967,1968,1969,1970,1971,1972,1973,3968,1974,1975,
+    1976,1977,1978,1979,1980,1981,3969,1982,3970,3971,3972,3973,1983,3974,3975,3976,
+    3977,3978,3979,3980,3981,3982,3983,3984,3985,3986,3987,3988,3989,3990,3991,3992,
+    3993,3994,3995,3996,3997,3998,3999,4000,4001,4002,4003,4004,4005,4006,8028,4007,
+    8029,4008,4009,8030,4010,8031,8032,8033,8034,8035,8036,8037,4011,4012,8038,8039,
+    8040,8041,8042,8043,8044,8045,8046,8047,8048,16152,8049,4013,8050,8051,8052,8053,
+    8054,8055,8056,8057,16153,8058,16154,16155,8059,8060,8061,16156,8062,8063,8064,8065,
+    8066,16157,32400,16158,8067,8068,8069,8070,16159,16160,16161,16162,16163,32401,8071,16164,
+    16165,16166,16167,32402,8072,16168,16169,16170,16171,16172,8073,16173,8074,16174,32403,16175,
+    16176,32404,16177,16178,8075,16179,16180,32405,16181,32406,16182,16183,16184,16185,16186,16187,
+    16188,16189,32407,32408,16190,32409,16191,16192,32410,16193,32411,32412,32413,32414,16194,32415,
+    32416,32417,32418,16195,32419,16196,32420,32421,32422,32423,32424,32425,32426,32427,32428,32429,
+    16197,32430,32431,65034,65035,65036,32432,16198,32433,32434,32435,32436,65037,32437,32438,32439,
+    32440,16199,32441,32442,65038,65039,32443,32444,65040,32445,32446,32447,65041,32448,32449,32450,
+    32451,32452,32453,32454,32455,32456,32457,32458,32459,65042,32460,32461,32462,32463,65043,32464,
+    65044,65045,65046,65047,65048,32465,65049,65050,65051,32466,65052,32467,65053,32468,65054,32469,
+    65055,65056,32470,65057,32471,32472,32473,65058,32474,32475,32476,65059,32477,32478,65060,65061,
+    65062,32479,65063,32480,32481,65064,65065,65066,32482,65067,65068,65069,65070,65071,32483,32484,
+    65072,65073,65074,65075,65076,32485,32486,65077,32487,65078,65079,32488,32489,32490,32491,65080,
+    32492,65081,65082,65083,65084,65085,32493,65086,65087,32494,65088,32495,65089,65090,65091,65092,
+    65093,65094,65095,65096,65097,32496,32497,65098,32498,65099,65100,65101,65102,32499,32500,65103,
+    65104,65105,32501,65106,65107,65108,32502,65109,65110,65111,32503,32504,65112,65113,65114,32505,
+    65115,65116,65117,65118,65119,65120,32506,65121,65122,65123,65124,65125,32507,65126,65127,65128,
+    65129,32508,65130,65131,65132,65133,32509,65134,65135,65136,65137,65138,65139,65140,65141,65142,
+    65143,32510,65144,32511,65145,65146,65147,65148,65149,32512,65150,65151,65152,65153,65154,65155,
+    65156,65157,65158,65159,65160,65161,65162,65163,65164,65165,65166,65167,65168,65169,65170,65171,
+    65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,65184,65185,65186,65187,
+    65188,65189,65190,65191,32513,65192,65193,65194,65195,65196,65197,65198,65199,65200,65201,65202,
+    65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,32514,65215,65216,65217,
+    65218,32515,65219,65220,65221,65222,65223,65224,65225,65226,65227,65228,65229,65230,65231,65232,
+    65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,65247,65248,
+    65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,65264,
+    32516,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_position_x_symbols[1024] =
+{
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+    64,65,66,67,68,71,72,76,80,69,70,73,74,75,77,78,
+    79,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,
+    128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+    144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+    160,162,163,164,165,166,167,169,161,168,170,171,172,173,174,175,
+    176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,191,
+    192,193,194,195,196,197,198,199,200,201,202,203,204,205,207,208,
+    209,210,211,212,215,206,213,214,216,217,218,219,220,221,222,223,
+    224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,
+    240,241,242,243,244,245,246,247,248,249,250,251,252,254,255,256,
+    257,258,259,260,261,263,268,253,262,264,265,266,267,269,270,271,
+    272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,
+    288,289,290,291,292,293,294,295,296,297,298,299,300,301,303,305,
+    306,308,316,317,331,302,304,307,309,310,311,312,313,314,315,318,
+    319,320,321,322,323,324,325,326,327,328,330,332,333,334,335,336,
+    337,338,339,341,344,345,346,348,349,350,351,352,356,357,358,359,
+    366,372,378,380,388,329,340,342,343,347,353,355,360,361,362,363,
+    364,367,368,369,370,373,374,375,376,377,379,381,383,384,386,387,
+    389,390,392,394,395,396,397,398,399,400,401,404,406,407,409,414,
+    419,421,432,439,449,354,365,371,382,385,391,393,402,403,405,408,
+    410,411,412,413,415,416,417,418,420,422,423,424,425,426,427,428,
+    429,430,431,433,434,438,440,441,442,443,445,446,447,448,450,451,
+    454,455,457,458,459,461,462,463,464,465,466,467,468,469,470,471,
+    472,474,475,476,477,479,485,489,491,493,495,498,500,501,502,504,
+    505,506,508,509,513,515,516,520,526,527,533,534,536,539,540,541,
+    542,544,550,553,555,565,566,568,573,574,578,582,586,587,591,598,
+    604,609,614,625,627,633,676,700,705,752,435,436,437,444,452,453,
+    456,460,473,478,480,481,482,483,484,486,487,488,490,492,494,496,
+    497,499,503,507,510,511,512,514,517,518,519,521,522,523,524,525,
+    528,529,530,531,532,535,537,538,543,545,546,547,548,549,551,552,
+    554,556,557,558,559,560,561,562,563,564,567,569,570,571,572,575,
+    576,577,579,580,581,583,584,585,588,589,590,592,593,594,595,596,
+    597,599,600,601,602,603,605,606,607,608,610,611,612,613,615,616,
+    617,618,619,620,621,622,623,624,626,628,629,630,631,632,634,635,
+    636,637,638,639,640,641,642,643,644,645,646,647,648,649,650,651,
+    652,653,654,655,656,657,658,659,660,661,662,663,664,665,666,667,
+    668,669,670,671,672,673,674,675,677,678,679,680,681,682,683,684,
+    685,686,687,688,689,690,691,692,693,694,695,696,697,698,699,701,
+    702,703,704,706,707,708,709,710,711,712,713,714,715,716,717,718,
+    719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,
+    735,736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,
+    751,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_position_x_table =
+{
+    1024,
+    delta_position_x_lengths,
+    delta_position_x_codes,
+    delta_position_x_symbols,
+    { 0, 0, 0, 0, 0, 6, 20, 56, 138, 366, 922, 1934, 3968, 8028, 16152, 32400, 65034 },
+    { 0, 0, 0, 0, 0, 3, 7, 15, 28, 73, 168, 213, 263, 309, 357, 405, 522 },
+    { 0, 0, 0, 0, 3, 4, 8, 13, 45, 95, 45, 50, 46, 48, 48, 117, 502 }
+};
+
+static const uint8_t delta_position_y_lengths[1024] =
+{
+    4,4,4,5,5,5,5,6,6,6,6,6,6,6,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,9,8,8,8,8,8,8,
+    9,8,9,9,9,8,9,8,8,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,10,9,10,9,10,10,
+    9,9,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,9,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,11,10,10,10,10,10,10,10,10,
+    10,10,11,10,11,11,10,10,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,12,12,11,11,12,
+    12,11,11,11,11,12,11,11,12,12,12,12,12,12,12,12,
+    12,11,12,11,12,12,12,12,12,11,12,11,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,13,13,12,
+    12,13,13,12,12,13,13,13,13,13,12,13,13,13,12,13,
+    13,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+    13,13,13,13,13,14,14,13,13,13,13,13,13,14,14,13,
+    13,13,13,13,13,14,13,14,13,14,14,14,14,14,13,13,
+    14,14,14,14,13,14,14,14,15,14,14,13,14,14,14,14,
+    14,13,13,14,14,14,14,14,13,14,14,15,14,15,15,15,
+    14,15,13,14,15,15,15,14,15,14,15,14,14,15,14,15,
+    14,15,14,14,14,14,14,15,14,15,15,15,14,14,15,15,
+    15,14,15,15,15,15,14,15,15,15,15,14,14,15,15,15,
+    14,15,15,15,15,14,15,15,14,15,14,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,16,15,
+    16,16,16,16,16,15,16,15,16,16,16,16,16,16,16,16,
+    16,15,15,16,16,16,16,16,16,16,16,16,16,15,16,16,
+    15,16,16,16,16,16,16,16,16,16,16,16,15,16,15,15,
+    16,16,16,16,16,16,16,16,15,15,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,15,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,15,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_position_y_codes[1024] =
+{
+    0,1,2,6,7,8,9,20,21,22,23,24,25,26,54,55,
+    56,57,58,59,60,61,62,63,64,65,66,134,135,136,137,138,
+    139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,154,
+    155,156,157,158,159,160,161,162,163,348,164,165,166,167,168,169,
+    349,170,350,351,352,171,353,172,173,354,355,356,357,358,359,360,
+    361,362,363,364,365,366,367,368,369,370,371,372,373,374,375,376,
+    377,378,379,380,381,382,383,384,385,386,387,388,389,390,391,392,
+    393,394,395,396,397,398,399,400,401,402,403,404,405,406,407,408,
+    409,410,411,412,413,414,415,416,417,418,419,420,421,422,423,424,
+    425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,
+    441,442,443,444,445,446,447,448,449,450,912,451,913,452,914,915,
+    453,454,916,917,918,919,920,921,922,923,924,925,926,927,928,929,
+    930,931,932,933,934,935,936,937,455,938,939,940,941,942,943,944,
+    945,946,947,948,949,950,951,1930,952,953,954,955,956,957,958,959,
+    960,961,1931,962,1932,1933,963,964,1934,1935,1936,1937,1938,1939,1940,1941,
+    1942,1943,1944,1945,1946,1947,1948,1949,1950,1951,1952,1953,1954,1955,1956,1957,
+    1958,1959,1960,1961,1962,1963,1964,1965,1966,1967,1968,3962,3963,1969,1970,3964,
+    3965,1971,1972,1973,1974,3966,1975,1976,3967,3968,3969,3970,3971,3972,3973,3974,
+    3975,1977,3976,1978,3977,3978,3979,3980,3981,1979,3982,1980,3983,3984,3985,3986,
+    3987,3988,3989,3990,3991,3992,3993,3994,3995,3996,3997,3998,3999,8014,8015,4000,
+    4001,8016,8017,4002,4003,8018,8019,8020,8021,8022,4004,8023,8024,8025,4005,8026,
+    8027,4006,8028,8029,8030,8031,8032,8033,8034,8035,8036,8037,8038,8039,8040,8041,
+    8042,8043,8044,8045,8046,16138,16139,8047,8048,8049,8050,8051,8052,16140,16141,8053,
+    8054,8055,8056,8057,8058,16142,8059,16143,8060,16144,16145,16146,16147,16148,8061,8062,
+    16149,16150,16151,16152,8063,16153,16154,16155,32390,16156,16157,8064,16158,16159,16160,16161,
+    16162,8065,8066,16163,16164,16165,16166,16167,8067,16168,16169,32391,16170,32392,32393,32394,
+    16171,32395,8068,16172,32396,32397,32398,16173,32399,16174,32400,16175,16176,32401,16177,32402,
+    16178,32403,16179,16180,16181,16182,16183,32404,16184,32405,32406,32407,16185,16186,32408,32409,
+    32410,16187,32411,32412,32413,32414,16188,32415,32416,32417,32418,16189,16190,32419,32420,32421,
+    16191,32422,32423,32424,32425,16192,32426,32427,16193,32428,16194,32429,32430,32431,32432,32433,
+    32434,32435,32436,32437,32438,32439,32440,32441,32442,32443,32444,32445,32446,32447,32448,32449,
+    32450,32451,32452,32453,32454,32455,32456,32457,32458,32459,32460,32461,32462,32463,32464,32465,
+    32466,32467,32468,32469,32470,32471,32472,32473,32474,32475,32476,32477,32478,32479,32480,32481,
+    32482,32483,32484,32485,32486,32487,32488,32489,32490,32491,32492,32493,32494,32495,32496,32497,
+    32498,32499,32500,32501,32502,32503,32504,32505,32506,32507,32508,32509,32510,32511,32512,32513,
+    32514,32515,32516,32517,32518,32519,32520,32521,32522,32523,32524,32525,32526,32527,32528,32529,
+    32530,32531,32532,32533,32534,32535,32536,32537,32538,32539,32540,32541,32542,32543,65116,32544,
+    65117,65118,65119,65120,65121,32545,65122,32546,65123,65124,65125,65126,65127,65128,65129,65130,
+    65131,32547,32548,65132,65133,65134,65135,65136,65137,65138,65139,65140,65141,32549,65142,65143,
+    32550,65144,65145,65146,65147,65148,65149,65150,65151,65152,65153,65154,32551,65155,32552,32553,
+    65156,65157,65158,65159,65160,65161,65162,65163,32554,32555,65164,65165,65166,65167,65168,65169,
+    65170,65171,65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,65184,65185,
+    65186,65187,65188,65189,65190,65191,65192,65193,65194,65195,65196,65197,65198,65199,65200,65201,
+    65202,65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,65215,65216,65217,
+    65218,65219,65220,65221,65222,65223,65224,32556,65225,65226,65227,65228,65229,65230,65231,65232,
+    65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,32557,65247,
+    65248,65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,
+    65264,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_position_y_symbols[1024] =
+{
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,58,59,60,61,62,63,65,
+    69,71,72,57,64,66,67,68,70,73,74,75,76,77,78,79,
+    80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,127,
+    128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+    144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+    160,161,162,163,164,165,166,167,168,169,171,173,176,177,200,170,
+    172,174,175,178,179,180,181,182,183,184,185,186,187,188,189,190,
+    191,192,193,194,195,196,197,198,199,201,202,203,204,205,206,207,
+    208,209,210,211,212,213,214,216,217,218,219,220,221,222,223,224,
+    225,227,230,231,215,226,228,229,232,233,234,235,236,237,238,239,
+    240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,
+    256,257,258,259,260,261,262,263,264,265,266,269,270,273,274,275,
+    276,278,279,289,291,297,299,267,268,271,272,277,280,281,282,283,
+    284,285,286,287,288,290,292,293,294,295,296,298,300,301,302,303,
+    304,305,306,307,308,309,310,311,312,313,314,315,316,319,320,323,
+    324,330,334,337,317,318,321,322,325,326,327,328,329,331,332,333,
+    335,336,338,339,340,341,342,343,344,345,346,347,348,349,350,351,
+    352,353,354,355,356,359,360,361,362,363,364,367,368,369,370,371,
+    372,374,376,382,383,388,395,401,402,408,418,357,358,365,366,373,
+    375,377,378,379,380,381,384,385,386,387,389,390,391,393,394,396,
+    397,398,399,400,403,404,405,406,407,409,410,412,416,419,423,425,
+    427,428,430,432,434,435,436,437,438,440,444,445,449,454,459,460,
+    464,469,472,474,392,411,413,414,415,417,420,421,422,424,426,429,
+    431,433,439,441,442,443,446,447,448,450,451,452,453,455,456,457,
+    458,461,462,463,465,466,467,468,470,471,473,475,476,477,478,479,
+    480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,
+    496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,
+    512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,
+    528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,
+    544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,
+    560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,
+    576,577,578,579,580,581,582,583,584,585,586,587,588,589,591,597,
+    599,609,610,621,624,636,638,639,648,649,711,734,590,592,593,594,
+    595,596,598,600,601,602,603,604,605,606,607,608,611,612,613,614,
+    615,616,617,618,619,620,622,623,625,626,627,628,629,630,631,632,
+    633,634,635,637,640,641,642,643,644,645,646,647,650,651,652,653,
+    654,655,656,657,658,659,660,661,662,663,664,665,666,667,668,669,
+    670,671,672,673,674,675,676,677,678,679,680,681,682,683,684,685,
+    686,687,688,689,690,691,692,693,694,695,696,697,698,699,700,701,
+    702,703,704,705,706,707,708,709,710,712,713,714,715,716,717,718,
+    719,720,721,722,723,724,725,726,727,728,729,730,731,732,733,735,
+    736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,
+    752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_position_y_table =
+{
+    1024,
+    delta_position_y_lengths,
+    delta_position_y_codes,
+    delta_position_y_symbols,
+    { 0, 0, 0, 0, 0, 6, 20, 54, 134, 348, 912, 1930, 3962, 8014, 16138, 32390, 65116 },
+    { 0, 0, 0, 0, 0, 3, 7, 14, 27, 67, 175, 228, 279, 324, 379, 436, 604 },
+    { 0, 0, 0, 0, 3, 4, 7, 13, 40, 108, 53, 51, 45, 55, 57, 168, 420 }
+};
+
+static const uint8_t delta_position_z_lengths[1024] =
+{
+    4,4,4,4,5,5,5,5,5,6,6,6,6,6,6,6,
+    6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,8,7,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+    8,8,8,9,8,9,8,8,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,10,10,9,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+    11,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,12,11,11,11,12,11,12,11,
+    12,11,11,12,11,12,12,12,12,12,12,12,12,12,12,12,
+    13,12,12,12,12,12,12,12,12,12,12,12,12,12,13,12,
+    12,12,12,12,12,13,13,13,13,13,12,12,13,13,13,13,
+    13,13,14,13,13,13,13,13,13,13,13,13,13,13,13,13,
+    14,13,13,13,14,13,13,14,14,14,14,14,14,14,13,15,
+    15,14,14,14,14,15,14,14,14,14,14,14,13,14,14,14,
+    14,14,14,14,14,14,14,14,14,15,14,14,14,15,15,15,
+    15,14,15,15,14,15,14,14,15,15,15,15,15,15,14,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,14,15,
+    15,15,15,15,15,16,15,16,16,16,16,15,16,15,16,15,
+    15,15,15,16,15,15,16,15,15,16,16,15,15,16,16,16,
+    15,15,16,16,16,16,16,16,16,16,15,16,16,15,15,16,
+    15,16,16,15,16,16,16,16,15,16,16,16,16,16,16,16,
+    16,16,15,15,16,16,15,16,15,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,15,
+    16,16,16,15,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,15,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,15,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_position_z_codes[1024] =
+{
+    0,1,2,3,8,9,10,11,12,26,27,28,29,30,31,32,
+    33,34,70,71,72,73,74,75,76,77,78,79,80,81,82,83,
+    84,85,174,86,175,176,177,178,179,180,181,182,183,184,185,186,
+    187,188,189,190,191,192,193,194,195,196,197,198,199,200,201,202,
+    203,204,205,418,206,419,207,208,420,421,422,423,424,425,426,427,
+    428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,
+    444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,
+    460,461,462,463,464,465,466,467,468,940,941,469,942,943,944,945,
+    946,947,948,949,950,951,952,953,954,955,956,957,958,959,960,961,
+    962,963,964,965,966,967,968,969,970,971,972,973,974,975,976,977,
+    1962,978,979,980,1963,1964,1965,1966,1967,1968,1969,1970,1971,1972,1973,1974,
+    1975,1976,1977,1978,1979,1980,1981,1982,3982,1983,1984,1985,3983,1986,3984,1987,
+    3985,1988,1989,3986,1990,3987,3988,3989,3990,3991,3992,3993,3994,3995,3996,3997,
+    8038,3998,3999,4000,4001,4002,4003,4004,4005,4006,4007,4008,4009,4010,8039,4011,
+    4012,4013,4014,4015,4016,8040,8041,8042,8043,8044,4017,4018,8045,8046,8047,8048,
+    8049,8050,16142,8051,8052,8053,8054,8055,8056,8057,8058,8059,8060,8061,8062,8063,
+    16143,8064,8065,8066,16144,8067,8068,16145,16146,16147,16148,16149,16150,16151,8069,32366,
+    32367,16152,16153,16154,16155,32368,16156,16157,16158,16159,16160,16161,8070,16162,16163,16164,
+    16165,16166,16167,16168,16169,16170,16171,16172,16173,32369,16174,16175,16176,32370,32371,32372,
+    32373,16177,32374,32375,16178,32376,16179,16180,32377,32378,32379,32380,32381,32382,16181,32383,
+    32384,32385,32386,32387,32388,32389,32390,32391,32392,32393,32394,32395,32396,32397,32398,32399,
+    32400,32401,32402,32403,32404,32405,32406,32407,32408,32409,32410,32411,32412,32413,16182,32414,
+    32415,32416,32417,32418,32419,64898,32420,64899,64900,64901,64902,32421,64903,32422,64904,32423,
+    32424,32425,32426,64905,32427,32428,64906,32429,32430,64907,64908,32431,32432,64909,64910,64911,
+    32433,32434,64912,64913,64914,64915,64916,64917,64918,64919,32435,64920,64921,32436,32437,64922,
+    32438,64923,64924,32439,64925,64926,64927,64928,32440,64929,64930,64931,64932,64933,64934,64935,
+    64936,64937,32441,32442,64938,64939,32443,64940,32444,64941,64942,64943,64944,64945,64946,64947,
+    64948,64949,64950,64951,64952,64953,64954,64955,64956,64957,64958,64959,64960,64961,64962,32445,
+    64963,64964,64965,32446,64966,64967,64968,64969,64970,64971,64972,64973,64974,64975,64976,64977,
+    64978,64979,64980,64981,64982,64983,64984,64985,64986,64987,64988,64989,64990,64991,64992,64993,
+    64994,64995,64996,64997,64998,64999,65000,65001,65002,65003,65004,65005,65006,32447,65007,65008,
+    65009,65010,65011,65012,65013,65014,65015,65016,65017,65018,65019,65020,65021,65022,65023,65024,
+    65025,65026,65027,65028,65029,65030,65031,65032,65033,65034,65035,65036,65037,65038,65039,65040,
+    65041,65042,65043,65044,65045,65046,65047,65048,65049,65050,65051,65052,65053,65054,65055,65056,
+    65057,65058,65059,65060,65061,65062,65063,65064,65065,65066,65067,65068,65069,65070,65071,65072,
+    65073,65074,65075,65076,32448,65077,65078,65079,65080,65081,65082,65083,65084,65085,65086,65087,
+    65088,65089,65090,65091,65092,65093,65094,65095,65096,65097,65098,65099,65100,65101,65102,65103,
+    65104,65105,65106,65107,65108,65109,65110,65111,65112,65113,65114,65115,65116,65117,65118,65119,
+    65120,65121,65122,65123,65124,65125,65126,65127,65128,65129,65130,65131,65132,65133,65134,65135,
+    65136,65137,65138,65139,65140,65141,65142,65143,65144,65145,65146,65147,65148,65149,65150,65151,
+    65152,65153,65154,65155,65156,65157,65158,65159,65160,65161,65162,65163,65164,65165,65166,65167,
+    65168,65169,65170,65171,65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,
+    65184,65185,65186,65187,65188,65189,65190,65191,65192,65193,65194,65195,65196,65197,65198,65199,
+    65200,65201,65202,65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,65215,
+    65216,65217,65218,65219,65220,65221,65222,65223,65224,65225,65226,65227,65228,65229,65230,65231,
+    65232,65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,65247,
+    65248,65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,
+    65264,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_position_z_symbols[1024] =
+{
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,35,34,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+    64,65,66,68,70,71,67,69,72,73,74,75,76,77,78,79,
+    80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,123,121,122,124,125,126,127,
+    128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+    144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+    161,162,163,160,164,165,166,167,168,169,170,171,172,173,174,175,
+    176,177,178,179,180,181,182,183,185,186,187,189,191,193,194,196,
+    184,188,190,192,195,197,198,199,200,201,202,203,204,205,206,207,
+    209,210,211,212,213,214,215,216,217,218,219,220,221,223,224,225,
+    226,227,228,234,235,208,222,229,230,231,232,233,236,237,238,239,
+    240,241,243,244,245,246,247,248,249,250,251,252,253,254,255,257,
+    258,259,261,262,270,284,242,256,260,263,264,265,266,267,268,269,
+    273,274,275,276,278,279,280,281,282,283,285,286,287,288,289,290,
+    291,292,293,294,295,296,298,299,300,305,308,310,311,318,350,271,
+    272,277,297,301,302,303,304,306,307,309,312,313,314,315,316,317,
+    319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,
+    335,336,337,338,339,340,341,342,343,344,345,346,347,348,349,351,
+    352,353,354,355,356,358,363,365,367,368,369,370,372,373,375,376,
+    379,380,384,385,394,397,398,400,403,408,418,419,422,424,447,451,
+    493,564,357,359,360,361,362,364,366,371,374,377,378,381,382,383,
+    386,387,388,389,390,391,392,393,395,396,399,401,402,404,405,406,
+    407,409,410,411,412,413,414,415,416,417,420,421,423,425,426,427,
+    428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,
+    444,445,446,448,449,450,452,453,454,455,456,457,458,459,460,461,
+    462,463,464,465,466,467,468,469,470,471,472,473,474,475,476,477,
+    478,479,480,481,482,483,484,485,486,487,488,489,490,491,492,494,
+    495,496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,
+    511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,
+    527,528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,
+    543,544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,
+    559,560,561,562,563,565,566,567,568,569,570,571,572,573,574,575,
+    576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,
+    592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,
+    608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,
+    624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,
+    640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,
+    656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,
+    672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,
+    688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,
+    704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,
+    720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,
+    736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,
+    752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_position_z_table =
+{
+    1024,
+    delta_position_z_lengths,
+    delta_position_z_codes,
+    delta_position_z_symbols,
+    { 0, 0, 0, 0, 0, 8, 26, 70, 174, 418, 940, 1962, 3982, 8038, 16142, 32366, 64898 },
+    { 0, 0, 0, 0, 0, 4, 9, 18, 35, 70, 122, 163, 192, 229, 262, 303, 386 },
+    { 0, 0, 0, 0, 4, 5, 9, 17, 35, 52, 41, 29, 37, 33, 41, 83, 638 }
+};
+
+const int delta_smallest_three_symbols = 1024;
+
+static const uint8_t delta_smallest_three_a_lengths[1024] =
+{
+    4,3,4,5,5,5,5,5,5,5,6,6,6,6,6,6,
+    6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,10,10,9,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,11,10,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,12,12,12,11,12,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,
+    12,12,13,12,12,13,12,12,12,12,13,12,12,13,12,12,
+    12,12,12,12,12,12,13,12,12,12,12,12,12,12,12,13,
+    12,12,12,12,12,13,12,13,12,13,12,12,12,12,12,12,
+    12,13,13,12,13,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,13,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,13,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    13,13,12,13,13,13,13,13,13,13,13,13,13,14,13,13,
+    13,13,14,13,14,13,13,14,13,14,13,13,13,14,13,14,
+    13,14,14,13,14,14,14,15,14,14,15,14,14,14,15,14,
+    15,15,15,15,14,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_smallest_three_a_codes[1024] =
+{
+    2,0,3,8,9,10,11,12,13,14,30,31,32,33,34,35,
+    36,37,38,39,40,82,83,84,85,86,87,88,89,90,91,92,
+    93,94,95,96,97,98,99,100,202,203,204,205,206,207,208,209,
+    210,211,212,213,214,215,216,217,218,219,220,442,443,444,445,446,
+    447,448,449,450,451,452,453,454,455,456,457,458,920,921,459,922,
+    923,924,925,926,927,928,929,930,931,932,933,934,1872,935,1873,1874,
+    1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,
+    1891,1892,1893,1894,3794,3795,3796,1895,3797,1896,3798,3799,3800,3801,3802,3803,
+    3804,3805,3806,3807,3808,3809,3810,3811,3812,3813,3814,3815,3816,3817,3818,3819,
+    3820,3821,3822,3823,3824,3825,3826,3827,3828,3829,3830,3831,3832,3833,3834,8060,
+    3835,3836,8061,3837,3838,8062,3839,3840,3841,3842,8063,3843,3844,8064,3845,3846,
+    3847,3848,3849,3850,3851,3852,8065,3853,3854,3855,3856,3857,3858,3859,3860,8066,
+    3861,3862,3863,3864,3865,8067,3866,8068,3867,8069,3868,3869,3870,3871,3872,3873,
+    3874,8070,8071,3875,8072,3876,3877,3878,3879,3880,3881,3882,3883,3884,3885,3886,
+    3887,3888,3889,3890,3891,3892,3893,3894,3895,3896,3897,3898,3899,3900,3901,3902,
+    3903,3904,3905,3906,3907,3908,3909,3910,3911,3912,3913,3914,3915,3916,3917,3918,
+    3919,3920,3921,3922,3923,3924,3925,3926,3927,3928,3929,3930,3931,3932,3933,3934,
+    3935,3936,3937,3938,3939,3940,3941,3942,3943,3944,3945,3946,3947,3948,3949,3950,
+    3951,3952,3953,3954,3955,3956,3957,3958,3959,3960,3961,3962,3963,3964,3965,3966,
+    3967,3968,3969,3970,3971,3972,3973,3974,3975,3976,3977,3978,3979,3980,3981,3982,
+    3983,3984,8073,3985,3986,3987,3988,3989,3990,3991,3992,3993,3994,3995,3996,3997,
+    3998,8074,3999,4000,4001,4002,4003,4004,4005,4006,4007,4008,4009,4010,4011,4012,
+    4013,4014,4015,4016,4017,4018,4019,4020,4021,4022,4023,4024,4025,4026,4027,4028,
+    8075,8076,4029,8077,8078,8079,8080,8081,8082,8083,8084,8085,8086,16202,8087,8088,
+    8089,8090,16203,8091,16204,8092,8093,16205,8094,16206,8095,8096,8097,16207,8098,16208,
+    8099,16209,16210,8100,16211,16212,16213,32442,16214,16215,32443,16216,16217,16218,32444,16219,
+    32445,32446,32447,32448,16220,32449,32450,32451,32452,32453,32454,32455,32456,32457,32458,32459,
+    32460,32461,32462,32463,32464,32465,32466,32467,32468,32469,32470,32471,32472,32473,32474,32475,
+    32476,32477,32478,32479,32480,32481,32482,32483,64968,64969,64970,64971,64972,64973,64974,64975,
+    64976,64977,64978,64979,64980,64981,64982,64983,64984,64985,64986,64987,64988,64989,64990,64991,
+    64992,64993,64994,64995,64996,64997,64998,64999,65000,65001,65002,65003,65004,65005,65006,65007,
+    65008,65009,65010,65011,65012,65013,65014,65015,65016,65017,65018,65019,65020,65021,65022,65023,
+    65024,65025,65026,65027,65028,65029,65030,65031,65032,65033,65034,65035,65036,65037,65038,65039,
+    65040,65041,65042,65043,65044,65045,65046,65047,65048,65049,65050,65051,65052,65053,65054,65055,
+    65056,65057,65058,65059,65060,65061,65062,65063,65064,65065,65066,65067,65068,65069,65070,65071,
+    65072,65073,65074,65075,65076,65077,65078,65079,65080,65081,65082,65083,65084,65085,65086,65087,
+    65088,65089,65090,65091,65092,65093,65094,65095,65096,65097,65098,65099,65100,65101,65102,65103,
+    65104,65105,65106,65107,65108,65109,65110,65111,65112,65113,65114,65115,65116,65117,65118,65119,
+    65120,65121,65122,65123,65124,65125,65126,65127,65128,65129,65130,65131,65132,65133,65134,65135,
+    65136,65137,65138,65139,65140,65141,65142,65143,65144,65145,65146,65147,65148,65149,65150,65151,
+    65152,65153,65154,65155,65156,65157,65158,65159,65160,65161,65162,65163,65164,65165,65166,65167,
+    65168,65169,65170,65171,65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,
+    65184,65185,65186,65187,65188,65189,65190,65191,65192,65193,65194,65195,65196,65197,65198,65199,
+    65200,65201,65202,65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,65215,
+    65216,65217,65218,65219,65220,65221,65222,65223,65224,65225,65226,65227,65228,65229,65230,65231,
+    65232,65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,65247,
+    65248,65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,
+    65264,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_smallest_three_a_symbols[1024] =
+{
+    1,0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+    64,65,66,67,68,69,70,71,72,73,74,75,78,76,77,79,
+    80,81,82,83,84,85,86,87,88,89,90,91,93,92,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,119,121,116,117,118,120,122,123,124,125,126,127,
+    128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,
+    144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,160,
+    161,163,164,166,167,168,169,171,172,174,175,176,177,178,179,180,
+    181,183,184,185,186,187,188,189,190,192,193,194,195,196,198,200,
+    202,203,204,205,206,207,208,211,213,214,215,216,217,218,219,220,
+    221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,236,
+    237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,
+    253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,
+    269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,
+    285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,
+    301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,
+    317,318,319,320,321,323,324,325,326,327,328,329,330,331,332,333,
+    334,335,336,338,339,340,341,342,343,344,345,346,347,348,349,350,
+    351,352,353,354,355,356,357,358,359,360,361,362,363,364,365,366,
+    367,370,159,162,165,170,173,182,191,197,199,201,209,210,212,322,
+    337,368,369,371,372,373,374,375,376,377,378,379,380,382,383,384,
+    385,387,389,390,392,394,395,396,398,400,403,381,386,388,391,393,
+    397,399,401,402,404,405,406,408,409,411,412,413,415,420,407,410,
+    414,416,417,418,419,421,422,423,424,425,426,427,428,429,430,431,
+    432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,
+    448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,
+    464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,
+    480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,
+    496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,
+    512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,
+    528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,
+    544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,
+    560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,
+    576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,
+    592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,
+    608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,
+    624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,
+    640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,
+    656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,
+    672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,
+    688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,
+    704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,
+    720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,
+    736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,
+    752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_smallest_three_a_table =
+{
+    1024,
+    delta_smallest_three_a_lengths,
+    delta_smallest_three_a_codes,
+    delta_smallest_three_a_symbols,
+    { 0, 0, 0, 0, 2, 8, 30, 82, 202, 442, 920, 1872, 3794, 8060, 16202, 32442, 64968 },
+    { 0, 0, 0, 0, 1, 3, 10, 21, 40, 59, 77, 93, 118, 354, 395, 414, 456 },
+    { 0, 0, 0, 1, 2, 7, 11, 19, 19, 18, 16, 25, 236, 41, 19, 42, 568 }
+};
+
+static const uint8_t delta_smallest_three_b_lengths[1024] =
+{
+    4,3,4,5,5,5,5,5,5,6,6,6,6,6,6,6,
+    6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,8,9,9,8,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,10,9,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,12,11,11,12,12,12,12,
+    12,12,12,11,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,13,12,12,12,12,12,12,12,12,12,12,
+    13,12,12,13,12,12,12,12,12,12,12,12,13,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,13,13,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,13,12,12,12,12,13,12,12,12,12,
+    12,12,12,12,12,13,13,13,13,12,13,12,12,12,12,12,
+    12,12,13,12,13,12,13,12,12,13,12,13,13,12,12,12,
+    12,13,12,13,12,12,12,13,12,13,12,12,13,12,13,12,
+    12,12,12,12,13,12,12,12,12,13,12,12,13,12,13,12,
+    12,12,13,13,12,12,13,13,13,12,13,13,13,13,13,13,
+    13,13,13,13,13,13,13,13,14,13,14,13,13,14,13,14,
+    14,15,14,14,15,14,14,14,14,14,14,14,14,13,14,14,
+    14,14,15,14,14,15,14,14,14,15,14,15,15,15,15,15,
+    15,15,15,15,15,14,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_smallest_three_b_codes[1024] =
+{
+    2,0,3,8,9,10,11,12,13,28,29,30,31,32,33,34,
+    35,36,37,38,39,80,81,82,83,84,85,86,87,88,89,90,
+    91,92,93,94,95,96,97,98,99,100,101,204,205,206,207,208,
+    209,210,211,212,213,214,215,216,217,218,219,220,444,445,221,446,
+    447,448,449,450,451,452,453,454,455,456,457,458,459,460,924,461,
+    925,926,927,928,929,930,931,932,933,934,935,936,937,938,939,1880,
+    1881,1882,1883,1884,1885,1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,1896,
+    1897,1898,1899,1900,1901,1902,1903,1904,1905,3818,1906,1907,3819,3820,3821,3822,
+    3823,3824,3825,1908,3826,3827,3828,3829,3830,3831,3832,3833,3834,3835,3836,3837,
+    3838,3839,3840,3841,3842,3843,3844,3845,3846,3847,3848,3849,3850,3851,3852,3853,
+    3854,3855,3856,3857,3858,8044,3859,3860,3861,3862,3863,3864,3865,3866,3867,3868,
+    8045,3869,3870,8046,3871,3872,3873,3874,3875,3876,3877,3878,8047,3879,3880,3881,
+    3882,3883,3884,3885,3886,3887,3888,3889,3890,3891,3892,3893,3894,3895,3896,3897,
+    3898,3899,3900,3901,3902,3903,3904,3905,3906,3907,3908,3909,3910,3911,3912,3913,
+    3914,3915,3916,3917,3918,3919,3920,3921,3922,3923,3924,3925,3926,3927,3928,3929,
+    3930,3931,3932,3933,3934,3935,3936,3937,3938,3939,3940,3941,3942,3943,3944,3945,
+    3946,3947,8048,8049,3948,3949,3950,3951,3952,3953,3954,3955,3956,3957,3958,3959,
+    3960,3961,3962,3963,3964,3965,8050,3966,3967,3968,3969,8051,3970,3971,3972,3973,
+    3974,3975,3976,3977,3978,8052,8053,8054,8055,3979,8056,3980,3981,3982,3983,3984,
+    3985,3986,8057,3987,8058,3988,8059,3989,3990,8060,3991,8061,8062,3992,3993,3994,
+    3995,8063,3996,8064,3997,3998,3999,8065,4000,8066,4001,4002,8067,4003,8068,4004,
+    4005,4006,4007,4008,8069,4009,4010,4011,4012,8070,4013,4014,8071,4015,8072,4016,
+    4017,4018,8073,8074,4019,4020,8075,8076,8077,4021,8078,8079,8080,8081,8082,8083,
+    8084,8085,8086,8087,8088,8089,8090,8091,16194,8092,16195,8093,8094,16196,8095,16197,
+    16198,32440,16199,16200,32441,16201,16202,16203,16204,16205,16206,16207,16208,8096,16209,16210,
+    16211,16212,32442,16213,16214,32443,16215,16216,16217,32444,16218,32445,32446,32447,32448,32449,
+    32450,32451,32452,32453,32454,16219,32455,32456,32457,32458,32459,32460,32461,32462,32463,32464,
+    32465,32466,32467,32468,32469,32470,32471,32472,32473,32474,32475,32476,32477,32478,64958,64959,
+    64960,64961,64962,64963,64964,64965,64966,64967,64968,64969,64970,64971,64972,64973,64974,64975,
+    64976,64977,64978,64979,64980,64981,64982,64983,64984,64985,64986,64987,64988,64989,64990,64991,
+    64992,64993,64994,64995,64996,64997,64998,64999,65000,65001,65002,65003,65004,65005,65006,65007,
+    65008,65009,65010,65011,65012,65013,65014,65015,65016,65017,65018,65019,65020,65021,65022,65023,
+    65024,65025,65026,65027,65028,65029,65030,65031,65032,65033,65034,65035,65036,65037,65038,65039,
+    65040,65041,65042,65043,65044,65045,65046,65047,65048,65049,65050,65051,65052,65053,65054,65055,
+    65056,65057,65058,65059,65060,65061,65062,65063,65064,65065,65066,65067,65068,65069,65070,65071,
+    65072,65073,65074,65075,65076,65077,65078,65079,65080,65081,65082,65083,65084,65085,65086,65087,
+    65088,65089,65090,65091,65092,65093,65094,65095,65096,65097,65098,65099,65100,65101,65102,65103,
+    65104,65105,65106,65107,65108,65109,65110,65111,65112,65113,65114,65115,65116,65117,65118,65119,
+    65120,65121,65122,65123,65124,65125,65126,65127,65128,65129,65130,65131,65132,65133,65134,65135,
+    65136,65137,65138,65139,65140,65141,65142,65143,65144,65145,65146,65147,65148,65149,65150,65151,
+    65152,65153,65154,65155,65156,65157,65158,65159,65160,65161,65162,65163,65164,65165,65166,65167,
+    65168,65169,65170,65171,65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,
+    65184,65185,65186,65187,65188,65189,65190,65191,65192,65193,65194,65195,65196,65197,65198,65199,
+    65200,65201,65202,65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,65215,
+    65216,65217,65218,65219,65220,65221,65222,65223,65224,65225,65226,65227,65228,65229,65230,65231,
+    65232,65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,65247,
+    65248,65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,
+    65264,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_smallest_three_b_symbols[1024] =
+{
+    1,0,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,57,58,59,62,60,61,63,
+    64,65,66,67,68,69,70,71,72,73,74,75,76,77,79,78,
+    80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,122,123,131,121,124,125,126,
+    127,128,129,130,132,133,134,135,136,137,138,139,140,141,142,143,
+    144,145,146,147,148,149,150,151,152,153,154,155,156,157,158,159,
+    160,161,162,163,164,166,167,168,169,170,171,172,173,174,175,177,
+    178,180,181,182,183,184,185,186,187,189,190,191,192,193,194,195,
+    196,197,198,199,200,201,202,203,204,205,206,207,208,209,210,211,
+    212,213,214,215,216,217,218,219,220,221,222,223,224,225,226,227,
+    228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,
+    244,245,246,247,248,249,250,251,252,253,254,255,256,257,260,261,
+    262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,
+    279,280,281,282,284,285,286,287,288,289,290,291,292,297,299,300,
+    301,302,303,304,305,307,309,311,312,314,317,318,319,320,322,324,
+    325,326,328,330,331,333,335,336,337,338,339,341,342,343,344,346,
+    347,349,351,352,353,356,357,361,165,176,179,188,258,259,278,283,
+    293,294,295,296,298,306,308,310,313,315,316,321,323,327,329,332,
+    334,340,345,348,350,354,355,358,359,360,362,363,364,365,366,367,
+    368,369,370,371,372,373,374,375,377,379,380,382,397,376,378,381,
+    383,384,386,387,389,390,391,392,393,394,395,396,398,399,400,401,
+    403,404,406,407,408,410,421,385,388,402,405,409,411,412,413,414,
+    415,416,417,418,419,420,422,423,424,425,426,427,428,429,430,431,
+    432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,
+    448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,
+    464,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,
+    480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,
+    496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,
+    512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,
+    528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,
+    544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,
+    560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,
+    576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,
+    592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,
+    608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,
+    624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,
+    640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,
+    656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,
+    672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,
+    688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,
+    704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,
+    720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,
+    736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,
+    752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_smallest_three_b_table =
+{
+    1024,
+    delta_smallest_three_b_lengths,
+    delta_smallest_three_b_codes,
+    delta_smallest_three_b_symbols,
+    { 0, 0, 0, 0, 2, 8, 28, 80, 204, 444, 924, 1880, 3818, 8044, 16194, 32440, 64958 },
+    { 0, 0, 0, 0, 1, 3, 9, 21, 43, 61, 79, 95, 124, 328, 381, 407, 446 },
+    { 0, 0, 0, 1, 2, 6, 12, 22, 18, 18, 16, 29, 204, 53, 26, 39, 578 }
+};
+
+static const uint8_t delta_smallest_three_c_lengths[1024] =
+{
+    3,3,4,5,5,5,5,6,6,6,6,6,6,6,6,6,
+    6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,
+    8,8,8,8,8,8,8,8,8,8,8,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,10,10,
+    10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,12,12,11,11,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,13,12,12,12,12,12,12,12,12,12,13,12,12,
+    12,12,12,12,12,12,12,12,12,13,12,13,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,11,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,11,12,12,11,12,12,12,
+    12,12,11,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,13,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,13,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,13,12,13,13,13,13,
+    13,13,13,13,13,13,13,13,13,13,13,13,13,14,13,14,
+    14,13,13,13,14,14,14,13,14,14,14,13,13,13,14,14,
+    14,14,14,14,14,14,15,15,14,14,15,15,14,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+    15,15,15,15,15,15,15,15,15,15,16,16,16,15,16,15,
+    16,15,15,16,16,16,15,16,16,16,15,15,16,16,16,16,
+    15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+    16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+};
+
+static const uint16_t delta_smallest_three_c_codes[1024] =
+{
+    0,1,4,10,11,12,13,28,29,30,31,32,33,34,35,36,
+    37,38,39,80,81,82,83,84,85,86,87,88,89,90,91,92,
+    93,94,95,96,97,98,99,200,201,202,203,204,205,206,207,208,
+    209,210,211,212,213,214,215,216,217,218,219,440,441,442,443,444,
+    445,446,447,448,449,450,451,452,453,454,455,456,457,458,918,919,
+    920,921,922,923,924,925,926,927,928,929,930,931,932,933,1868,1869,
+    1870,1871,1872,1873,1874,1875,1876,1877,1878,1879,1880,1881,1882,1883,1884,1885,
+    1886,1887,1888,1889,1890,1891,1892,1893,1894,1895,3806,3807,1896,1897,3808,3809,
+    3810,3811,3812,3813,3814,3815,3816,3817,3818,3819,3820,3821,3822,3823,3824,3825,
+    3826,3827,3828,8068,3829,3830,3831,3832,3833,3834,3835,3836,3837,8069,3838,3839,
+    3840,3841,3842,3843,3844,3845,3846,3847,3848,8070,3849,8071,3850,3851,3852,3853,
+    3854,3855,3856,3857,3858,3859,3860,3861,3862,3863,3864,3865,3866,3867,3868,3869,
+    3870,3871,3872,3873,3874,3875,3876,3877,3878,3879,3880,3881,3882,3883,3884,3885,
+    3886,3887,3888,3889,3890,3891,1898,3892,3893,3894,3895,3896,3897,3898,3899,3900,
+    3901,3902,3903,3904,3905,3906,3907,3908,3909,3910,3911,3912,3913,3914,3915,3916,
+    3917,3918,3919,3920,3921,3922,3923,3924,3925,1899,3926,3927,1900,3928,3929,3930,
+    3931,3932,1901,3933,3934,3935,3936,3937,3938,3939,3940,3941,3942,3943,3944,3945,
+    3946,1902,3947,3948,3949,3950,3951,3952,3953,3954,3955,3956,3957,3958,3959,3960,
+    3961,3962,3963,3964,3965,3966,3967,8072,3968,3969,3970,3971,3972,3973,3974,3975,
+    3976,3977,3978,3979,3980,3981,3982,3983,3984,3985,3986,3987,3988,3989,3990,3991,
+    3992,3993,3994,3995,3996,3997,3998,8073,3999,4000,4001,4002,4003,4004,4005,4006,
+    4007,4008,4009,4010,4011,4012,4013,4014,4015,4016,4017,4018,4019,4020,4021,4022,
+    4023,4024,4025,4026,4027,4028,4029,4030,4031,4032,8074,4033,8075,8076,8077,8078,
+    8079,8080,8081,8082,8083,8084,8085,8086,8087,8088,8089,8090,8091,16200,8092,16201,
+    16202,8093,8094,8095,16203,16204,16205,8096,16206,16207,16208,8097,8098,8099,16209,16210,
+    16211,16212,16213,16214,16215,16216,32440,32441,16217,16218,32442,32443,16219,32444,32445,32446,
+    32447,32448,32449,32450,32451,32452,32453,32454,32455,32456,32457,32458,32459,32460,32461,32462,
+    32463,32464,32465,32466,32467,32468,32469,32470,32471,32472,64962,64963,64964,32473,64965,32474,
+    64966,32475,32476,64967,64968,64969,32477,64970,64971,64972,32478,32479,64973,64974,64975,64976,
+    32480,64977,64978,64979,64980,64981,64982,64983,64984,64985,64986,64987,64988,64989,64990,64991,
+    64992,64993,64994,64995,64996,64997,64998,64999,65000,65001,65002,65003,65004,65005,65006,65007,
+    65008,65009,65010,65011,65012,65013,65014,65015,65016,65017,65018,65019,65020,65021,65022,65023,
+    65024,65025,65026,65027,65028,65029,65030,65031,65032,65033,65034,65035,65036,65037,65038,65039,
+    65040,65041,65042,65043,65044,65045,65046,65047,65048,65049,65050,65051,65052,65053,65054,65055,
+    65056,65057,65058,65059,65060,65061,65062,65063,65064,65065,65066,65067,65068,65069,65070,65071,
+    65072,65073,65074,65075,65076,65077,65078,65079,65080,65081,65082,65083,65084,65085,65086,65087,
+    65088,65089,65090,65091,65092,65093,65094,65095,65096,65097,65098,65099,65100,65101,65102,65103,
+    65104,65105,65106,65107,65108,65109,65110,65111,65112,65113,65114,65115,65116,65117,65118,65119,
+    65120,65121,65122,65123,65124,65125,65126,65127,65128,65129,65130,65131,65132,65133,65134,65135,
+    65136,65137,65138,65139,65140,65141,65142,65143,65144,65145,65146,65147,65148,65149,65150,65151,
+    65152,65153,65154,65155,65156,65157,65158,65159,65160,65161,65162,65163,65164,65165,65166,65167,
+    65168,65169,65170,65171,65172,65173,65174,65175,65176,65177,65178,65179,65180,65181,65182,65183,
+    65184,65185,65186,65187,65188,65189,65190,65191,65192,65193,65194,65195,65196,65197,65198,65199,
+    65200,65201,65202,65203,65204,65205,65206,65207,65208,65209,65210,65211,65212,65213,65214,65215,
+    65216,65217,65218,65219,65220,65221,65222,65223,65224,65225,65226,65227,65228,65229,65230,65231,
+    65232,65233,65234,65235,65236,65237,65238,65239,65240,65241,65242,65243,65244,65245,65246,65247,
+    65248,65249,65250,65251,65252,65253,65254,65255,65256,65257,65258,65259,65260,65261,65262,65263,
+    65264,65265,65266,65267,65268,65269,65270,65271,65272,65273,65274,65275,65276,65277,65278,65279,
+    65280,65281,65282,65283,65284,65285,65286,65287,65288,65289,65290,65291,65292,65293,65294,65295,
+    65296,65297,65298,65299,65300,65301,65302,65303,65304,65305,65306,65307,65308,65309,65310,65311,
+    65312,65313,65314,65315,65316,65317,65318,65319,65320,65321,65322,65323,65324,65325,65326,65327,
+    65328,65329,65330,65331,65332,65333,65334,65335,65336,65337,65338,65339,65340,65341,65342,65343,
+    65344,65345,65346,65347,65348,65349,65350,65351,65352,65353,65354,65355,65356,65357,65358,65359,
+    65360,65361,65362,65363,65364,65365,65366,65367,65368,65369,65370,65371,65372,65373,65374,65375,
+    65376,65377,65378,65379,65380,65381,65382,65383,65384,65385,65386,65387,65388,65389,65390,65391,
+    65392,65393,65394,65395,65396,65397,65398,65399,65400,65401,65402,65403,65404,65405,65406,65407,
+    65408,65409,65410,65411,65412,65413,65414,65415,65416,65417,65418,65419,65420,65421,65422,65423,
+    65424,65425,65426,65427,65428,65429,65430,65431,65432,65433,65434,65435,65436,65437,65438,65439,
+    65440,65441,65442,65443,65444,65445,65446,65447,65448,65449,65450,65451,65452,65453,65454,65455,
+    65456,65457,65458,65459,65460,65461,65462,65463,65464,65465,65466,65467,65468,65469,65470,65471,
+    65472,65473,65474,65475,65476,65477,65478,65479,65480,65481,65482,65483,65484,65485,65486,65487,
+    65488,65489,65490,65491,65492,65493,65494,65495,65496,65497,65498,65499,65500,65501,65502,65503,
+    65504,65505,65506,65507,65508,65509,65510,65511,65512,65513,65514,65515,65516,65517,65518,65519,
+    65520,65521,65522,65523,65524,65525,65526,65527,65528,65529,65530,65531,65532,65533,65534,65535,
+};
+
+static const uint16_t delta_smallest_three_c_symbols[1024] =
+{
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+    32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,
+    48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+    64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,
+    80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,
+    96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,
+    112,113,114,115,116,117,118,119,120,121,124,125,214,249,252,258,
+    273,122,123,126,127,128,129,130,131,132,133,134,135,136,137,138,
+    139,140,141,142,143,144,145,146,148,149,150,151,152,153,154,155,
+    156,158,159,160,161,162,163,164,165,166,167,168,170,172,173,174,
+    175,176,177,178,179,180,181,182,183,184,185,186,187,188,189,190,
+    191,192,193,194,195,196,197,198,199,200,201,202,203,204,205,206,
+    207,208,209,210,211,212,213,215,216,217,218,219,220,221,222,223,
+    224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,
+    240,241,242,243,244,245,246,247,248,250,251,253,254,255,256,257,
+    259,260,261,262,263,264,265,266,267,268,269,270,271,272,274,275,
+    276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,
+    292,293,294,296,297,298,299,300,301,302,303,304,305,306,307,308,
+    309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,
+    325,326,328,329,330,331,332,333,334,335,336,337,338,339,340,341,
+    342,343,344,345,346,347,348,349,350,351,352,353,354,355,356,357,
+    358,359,360,361,363,147,157,169,171,295,327,362,364,365,366,367,
+    368,369,370,371,372,373,374,375,376,377,378,379,380,382,385,386,
+    387,391,395,396,397,381,383,384,388,389,390,392,393,394,398,399,
+    400,401,402,403,404,405,408,409,412,406,407,410,411,413,414,415,
+    416,417,418,419,420,421,422,423,424,425,426,427,428,429,430,431,
+    432,433,434,435,436,437,438,439,440,441,445,447,449,450,454,458,
+    459,464,442,443,444,446,448,451,452,453,455,456,457,460,461,462,
+    463,465,466,467,468,469,470,471,472,473,474,475,476,477,478,479,
+    480,481,482,483,484,485,486,487,488,489,490,491,492,493,494,495,
+    496,497,498,499,500,501,502,503,504,505,506,507,508,509,510,511,
+    512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,527,
+    528,529,530,531,532,533,534,535,536,537,538,539,540,541,542,543,
+    544,545,546,547,548,549,550,551,552,553,554,555,556,557,558,559,
+    560,561,562,563,564,565,566,567,568,569,570,571,572,573,574,575,
+    576,577,578,579,580,581,582,583,584,585,586,587,588,589,590,591,
+    592,593,594,595,596,597,598,599,600,601,602,603,604,605,606,607,
+    608,609,610,611,612,613,614,615,616,617,618,619,620,621,622,623,
+    624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,639,
+    640,641,642,643,644,645,646,647,648,649,650,651,652,653,654,655,
+    656,657,658,659,660,661,662,663,664,665,666,667,668,669,670,671,
+    672,673,674,675,676,677,678,679,680,681,682,683,684,685,686,687,
+    688,689,690,691,692,693,694,695,696,697,698,699,700,701,702,703,
+    704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,
+    720,721,722,723,724,725,726,727,728,729,730,731,732,733,734,735,
+    736,737,738,739,740,741,742,743,744,745,746,747,748,749,750,751,
+    752,753,754,755,756,757,758,759,760,761,762,763,764,765,766,767,
+    768,769,770,771,772,773,774,775,776,777,778,779,780,781,782,783,
+    784,785,786,787,788,789,790,791,792,793,794,795,796,797,798,799,
+    800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,
+    816,817,818,819,820,821,822,823,824,825,826,827,828,829,830,831,
+    832,833,834,835,836,837,838,839,840,841,842,843,844,845,846,847,
+    848,849,850,851,852,853,854,855,856,857,858,859,860,861,862,863,
+    864,865,866,867,868,869,870,871,872,873,874,875,876,877,878,879,
+    880,881,882,883,884,885,886,887,888,889,890,891,892,893,894,895,
+    896,897,898,899,900,901,902,903,904,905,906,907,908,909,910,911,
+    912,913,914,915,916,917,918,919,920,921,922,923,924,925,926,927,
+    928,929,930,931,932,933,934,935,936,937,938,939,940,941,942,943,
+    944,945,946,947,948,949,950,951,952,953,954,955,956,957,958,959,
+    960,961,962,963,964,965,966,967,968,969,970,971,972,973,974,975,
+    976,977,978,979,980,981,982,983,984,985,986,987,988,989,990,991,
+    992,993,994,995,996,997,998,999,1000,1001,1002,1003,1004,1005,1006,1007,
+    1008,1009,1010,1011,1012,1013,1014,1015,1016,1017,1018,1019,1020,1021,1022,1023,
+};
+
+static const protocol::HuffmanTable delta_smallest_three_c_table =
+{
+    1024,
+    delta_smallest_three_c_lengths,
+    delta_smallest_three_c_codes,
+    delta_smallest_three_c_symbols,
+    { 0, 0, 0, 0, 4, 10, 28, 80, 200, 440, 918, 1868, 3806, 8068, 16200, 32440, 64962 },
+    { 0, 0, 0, 0, 2, 3, 7, 19, 39, 59, 78, 94, 129, 357, 389, 409, 450 },
+    { 0, 0, 0, 2, 1, 4, 12, 20, 20, 19, 16, 35, 228, 32, 20, 41, 574 }
+};
+
+#endif // #ifndef GAME_DELTA_TABLES_H
@@ -55,6 +55,8 @@ static void game_init()
 
     srand( seed );
 
+    core::random_seed( seed );
+
     global.console = CORE_NEW( allocator, Console, allocator );
     global.fontManager = CORE_NEW( allocator, FontManager, allocator );
     global.shaderManager = CORE_NEW( allocator, ShaderManager, allocator );
@@ -369,13 +371,55 @@ int main( int argc, char * argv[] )
 // ===================================================================================================================
 
 #include "GameServer.h"
+#include <string.h>
+
+static const double RoomStatsInterval = 5.0;
+
+static void print_room_stats( GameServer * server, uint64_t tick_time, uint64_t max_tick_time, int ticks )
+{
+    RoomManager * roomManager = server->GetRoomManager();
+
+    RoomStats stats;
+    roomManager->GetStats( stats );
+
+    const double tick_budget = 1000.0 / TickRate;
+    const double average_tick = ticks ? tick_time / 1000000.0 / ticks : 0.0;
+
+    printf( "%.3f: %d rooms, %d players, %d threads | tick avg %.2fms max %.2fms (%.0f%% of budget) | room avg %.2fms min %.2fms max %.2fms\n",
+        server->GetTime(),
+        roomManager->GetNumRooms(),
+        roomManager->GetNumPlayers(),
+        roomManager->GetNumThreads(),
+        average_tick,
+        max_tick_time / 1000000.0,
+        average_tick / tick_budget * 100.0,
+        stats.GetAverageMilliseconds(),
+        stats.min_time / 1000000.0,
+        stats.max_time / 1000000.0 );
+
+    roomManager->ClearStats();
+}
 
-int main( int /*argc*/, char ** /*argv*/ )
+int main( int argc, char ** argv )
 {
     srand( (uint32_t) time( nullptr ) );
 
     global.timeBase.deltaTime = 1.0 / TickRate;
 
+    // usage: Server [-rooms N] [-threads N] [-bots]
+
+    RoomConfig roomConfig;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        if ( strcmp( argv[i], "-rooms" ) == 0 && i + 1 < argc )
+            roomConfig.num_rooms = core::clamp( atoi( argv[++i] ), 1, MaxRooms );
+        else if ( strcmp( argv[i], "-threads" ) == 0 && i + 1 < argc )
+            roomConfig.num_threads = atoi( argv[++i] ) - 1;
+        else if ( strcmp( argv[i], "-bots" ) == 0 )
+            roomConfig.bots = true;
+    }
+
     core::memory::initialize();
     
     if ( !network::InitializeNetwork() )
@@ -384,7 +428,7 @@ int main( int /*argc*/, char ** /*argv*/ )
         return 1;
     }
 
-    auto server = CreateGameServer( core::memory::default_allocator(), ServerPort, MaxClients );
+    auto server = CreateGameServer( core::memory::default_allocator(), ServerPort, MaxClients, roomConfig );
 
     if ( !server )
     {
@@ -392,15 +436,44 @@ int main( int /*argc*/, char ** /*argv*/ )
         return 1;
     }
     
-    printf( "%.3f: Started game server on port %d\n", global.timeBase.time, ServerPort );
+    printf( "%.3f: Started game server on port %d with %d rooms\n", global.timeBase.time, ServerPort, roomConfig.num_rooms );
+
+    double last_stats_time = 0.0;
+    uint64_t tick_time = 0;
+    uint64_t max_tick_time = 0;
+    int ticks = 0;
 
     while ( true )
     {
-        // ...
+        const uint64_t tick_start = core::nanoseconds();
 
         server->Update( global.timeBase );
 
-        core::sleep_milliseconds( (int) ( global.timeBase.deltaTime * 1000.0 ) );
+        server->UpdateRooms( (float) global.timeBase.deltaTime );
+
+        const uint64_t tick_finish = core::nanoseconds();
+
+        const uint64_t this_tick_time = tick_finish - tick_start;
+        tick_time += this_tick_time;
+        if ( this_tick_time > max_tick_time )
+            max_tick_time = this_tick_time;
+        ticks++;
+
+        if ( global.timeBase.time - last_stats_time >= RoomStatsInterval )
+        {
+            print_room_stats( server, tick_time, max_tick_time, ticks );
+            last_stats_time = global.timeBase.time;
+            tick_time = 0;
+            max_tick_time = 0;
+            ticks = 0;
+        }
+
+        // sleep for whatever is left of the tick once the rooms have been stepped
+
+        const double tick_milliseconds = this_tick_time / 1000000.0;
+        const double sleep_milliseconds = global.timeBase.deltaTime * 1000.0 - tick_milliseconds;
+        if ( sleep_milliseconds > 0.0 )
+            core::sleep_milliseconds( (int) sleep_milliseconds );
 
         global.timeBase.time += global.timeBase.deltaTime;
     }
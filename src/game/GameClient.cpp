@@ -37,6 +37,29 @@ double GameClient::GetTime() const
     return GetTimeBase().time;
 }
 
+bool GameClient::SendInput( uint32_t frame, const game::Input & input )
+{
+    if ( !IsConnected() )
+        return false;
+
+    auto messageChannel = static_cast<protocol::ReliableMessageChannel*>( GetConnection()->GetChannel( 0 ) );
+    if ( !messageChannel->CanSendMessage() )
+        return false;
+
+    auto channelStructure = static_cast<GameChannelStructure*>( GetConfig().channelStructure );
+
+    auto message = (InputMessage*) channelStructure->GetConfig().messageFactory->Create( MESSAGE_INPUT );
+    if ( !message )
+        return false;
+
+    message->frame = frame;
+    message->input = input;
+
+    messageChannel->SendMessage( message );
+
+    return true;
+}
+
 void GameClient::OnConnect( const network::Address & address )
 {
     char buffer[256];
@@ -4,6 +4,7 @@
 #define GAME_CLIENT_H
 
 #include "clientServer/Client.h"
+#include "cubes/Game.h"
 
 extern class GameClient * CreateGameClient( core::Allocator & allocator, int clientPort = 0 );
 
@@ -19,6 +20,8 @@ public:
 
     double GetTime() const;
 
+    bool SendInput( uint32_t frame, const game::Input & input );
+
 protected:
 
     friend GameClient * CreateGameClient( core::Allocator & allocator, int clientPort );
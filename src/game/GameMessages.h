@@ -6,11 +6,13 @@
 #include "protocol/MessageFactory.h"
 #include "clientServer/ClientServerEnums.h"
 #include "GameContext.h"
+#include "cubes/Game.h"
 
 enum MessageType
 {
     MESSAGE_BLOCK = protocol::BlockMessageType,
     MESSAGE_TEST,
+    MESSAGE_INPUT,
     NUM_MESSAGE_TYPES
 };
 
@@ -54,6 +56,28 @@ struct TestMessage : public protocol::Message
     int value;
 };
 
+struct InputMessage : public protocol::Message
+{
+    InputMessage() : Message( MESSAGE_INPUT )
+    {
+        frame = 0;
+    }
+
+    PROTOCOL_SERIALIZE_OBJECT( stream )
+    {
+        serialize_bits( stream, frame, 32 );
+        serialize_bool( stream, input.left );
+        serialize_bool( stream, input.right );
+        serialize_bool( stream, input.up );
+        serialize_bool( stream, input.down );
+        serialize_bool( stream, input.push );
+        serialize_bool( stream, input.pull );
+    }
+
+    uint32_t frame;
+    game::Input input;
+};
+
 class GameMessageFactory : public protocol::MessageFactory
 {
     core::Allocator * m_allocator;
@@ -74,6 +98,7 @@ protected:
         {
             case MESSAGE_BLOCK:     return CORE_NEW( *m_allocator, protocol::BlockMessage );
             case MESSAGE_TEST:      return CORE_NEW( *m_allocator, TestMessage );
+            case MESSAGE_INPUT:     return CORE_NEW( *m_allocator, InputMessage );
             default:
                 return nullptr;
         }
@@ -6,16 +6,22 @@
 #include "GamePackets.h"
 #include "GameMessages.h"
 #include "GameChannelStructure.h"
+#include "RoomManager.h"
 #include "network/BSDSocket.h"
 #include "network/Simulator.h"
 
 class GameServer : public clientServer::Server
 {
+    RoomManager * m_roomManager;
+
 public:
 
-    GameServer( const clientServer::ServerConfig & config ) : Server( config )
+    GameServer( const clientServer::ServerConfig & config, RoomManager * roomManager ) : Server( config )
     {
         CORE_ASSERT( config.serverData );
+        CORE_ASSERT( roomManager );
+
+        m_roomManager = roomManager;
 
         SetContext( clientServer::CONTEXT_USER, config.serverData->GetData() );
     }
@@ -25,11 +31,67 @@ public:
         return GetTimeBase().time;
     }
 
+    RoomManager * GetRoomManager()
+    {
+        return m_roomManager;
+    }
+
+    void UpdateRooms( float deltaTime )
+    {
+        ReceiveInputMessages();
+
+        m_roomManager->Update( deltaTime );
+    }
+
 protected:
 
+    void ReceiveInputMessages()
+    {
+        auto channelStructure = static_cast<GameChannelStructure*>( GetConfig().channelStructure );
+
+        auto messageFactory = channelStructure->GetConfig().messageFactory;
+
+        for ( int i = 0; i < GetConfig().maxClients; ++i )
+        {
+            if ( GetClientState( i ) != clientServer::SERVER_CLIENT_STATE_CONNECTED )
+                continue;
+
+            auto connection = GetClientConnection( i );
+            auto messageChannel = static_cast<protocol::ReliableMessageChannel*>( connection->GetChannel( 0 ) );
+
+            while ( true )
+            {
+                auto message = messageChannel->ReceiveMessage();
+                if ( !message )
+                    break;
+
+                if ( message->GetType() == MESSAGE_INPUT )
+                {
+                    auto inputMessage = (InputMessage*) message;
+                    m_roomManager->SetInput( i, inputMessage->frame, inputMessage->input );
+                }
+
+                messageFactory->Release( message );
+            }
+        }
+    }
+
     void OnClientStateChange( int clientIndex, clientServer::ServerClientState previous, clientServer::ServerClientState current ) override
     {
         printf( "%.3f: Client %d state change: %s -> %s\n", GetTime(), clientIndex, GetServerClientStateName( previous ), GetServerClientStateName( current ) );
+
+        if ( current == clientServer::SERVER_CLIENT_STATE_CONNECTED )
+        {
+            const int roomIndex = m_roomManager->JoinRoom( clientIndex );
+            if ( roomIndex != -1 )
+                printf( "%.3f: Client %d joined room %d\n", GetTime(), clientIndex, roomIndex );
+            else
+                printf( "%.3f: Client %d could not join a room. all rooms are full\n", GetTime(), clientIndex );
+        }
+        else if ( previous == clientServer::SERVER_CLIENT_STATE_CONNECTED )
+        {
+            m_roomManager->LeaveRoom( clientIndex );
+        }
     }
 
     void OnClientDataReceived( int clientIndex, const protocol::Block & block ) override
@@ -43,7 +105,7 @@ protected:
     }
 };
 
-GameServer * CreateGameServer( core::Allocator & allocator, int serverPort, int maxClients )
+GameServer * CreateGameServer( core::Allocator & allocator, int serverPort, int maxClients, const RoomConfig & roomConfig = RoomConfig() )
 {
     auto packetFactory = CORE_NEW( allocator, GamePacketFactory, allocator );
 
@@ -69,8 +131,8 @@ GameServer * CreateGameServer( core::Allocator & allocator, int serverPort, int
             data[i] = ( 10 + i ) % 256;
 
         auto gameContext = (GameContext*) data;
-        gameContext->value_min = -1 - ( rand() % 100000000 );
-        gameContext->value_max = rand() % 1000000000;
+        gameContext->value_min = -1 - core::random_int( 0, 100000000 - 1 );
+        gameContext->value_max = core::random_int( 0, 1000000000 - 1 );
     }
 
     clientServer::ServerConfig serverConfig;
@@ -80,7 +142,9 @@ GameServer * CreateGameServer( core::Allocator & allocator, int serverPort, int
     serverConfig.networkInterface = networkInterface;
     serverConfig.networkSimulator = networkSimulator;
 
-    return CORE_NEW( allocator, GameServer, serverConfig );
+    auto roomManager = CORE_NEW( allocator, RoomManager, allocator, roomConfig );
+
+    return CORE_NEW( allocator, GameServer, serverConfig, roomManager );
 }
 
 void DestroyGameServer( core::Allocator & allocator, GameServer * server )
@@ -89,10 +153,13 @@ void DestroyGameServer( core::Allocator & allocator, GameServer * server )
 
     clientServer::ServerConfig config = server->GetConfig();
 
+    RoomManager * roomManager = server->GetRoomManager();
+
     typedef network::Interface NetworkInterface;
     typedef network::Simulator NetworkSimulator;
 
     CORE_DELETE( allocator, GameServer, server );
+    CORE_DELETE( allocator, RoomManager, roomManager );
     CORE_DELETE( allocator, ChannelStructure, config.channelStructure );
     CORE_DELETE( allocator, NetworkInterface, config.networkInterface );
     CORE_DELETE( allocator, NetworkSimulator, config.networkSimulator );
@@ -0,0 +1,1040 @@
+// generated by tools/PacketDictionary/PacketDictionaryTool.cpp. do not edit!
+
+#ifndef GAME_PACKET_DICTIONARY_H
+#define GAME_PACKET_DICTIONARY_H
+
+#include <stdint.h>
+
+static const uint8_t compression_dictionary[16384] =
+{
+    106,16,0,78,82,112,12,102,145,207,109,175,176,15,97,177,219,15,171,142,236,110,230,53,14,207,214,243,204,14,91,222,
+    244,46,68,152,12,79,101,120,51,8,85,94,249,151,248,177,209,7,0,10,208,215,88,96,228,199,233,194,211,151,68,252,
+    75,102,248,166,1,145,1,233,1,43,249,76,148,215,245,134,196,181,233,171,7,255,18,92,156,225,232,99,107,216,249,28,
+    168,1,13,144,55,236,105,112,253,163,145,143,142,200,150,194,37,195,38,64,106,142,120,193,4,254,71,62,73,229,126,235,
+    221,111,50,125,54,246,36,120,144,1,50,64,238,127,4,4,230,150,5,36,141,204,230,19,177,204,17,161,12,144,1,178,
+    165,45,32,128,46,96,32,226,148,60,31,25,100,198,79,25,128,12,144,145,201,2,1,100,234,2,21,249,41,249,72,55,
+    161,235,241,84,194,67,100,112,3,34,85,154,9,242,246,12,242,217,71,59,224,181,235,66,207,145,181,27,230,125,184,113,
+    251,225,226,90,176,129,77,255,180,129,127,190,205,133,43,177,2,1,96,55,4,1,0,64,249,0,0,160,0,0,0,52,
+    32,3,100,52,40,65,0,25,239,192,23,77,71,62,78,125,239,223,89,113,25,32,75,247,9,2,200,0,7,6,175,193,
+    242,177,226,124,4,247,99,57,0,25,66,128,16,64,6,200,240,3,230,84,79,1,241,54,145,221,24,147,200,254,245,115,
+    126,181,106,21,103,183,191,192,119,231,24,97,128,231,124,170,21,100,35,25,4,4,197,106,231,83,86,14,112,171,125,36,
+    254,220,210,130,74,221,168,175,197,219,123,156,88,16,0,0,1,144,94,40,145,143,91,221,3,248,225,174,166,117,200,241,
+    14,250,222,167,121,21,2,110,211,199,189,39,1,157,18,26,235,191,127,147,10,250,201,135,64,148,1,247,200,71,251,31,
+    3,13,8,234,167,181,33,43,8,110,212,39,159,27,2,140,216,71,8,182,2,114,8,246,214,233,31,11,7,14,225,135,
+    21,12,0,107,21,244,33,143,228,115,19,250,231,11,101,89,242,171,146,84,231,203,65,195,242,227,115,5,189,131,166,141,
+    189,219,242,108,192,3,236,16,8,6,33,237,4,242,27,230,242,65,129,254,249,225,131,85,243,133,32,98,249,125,63,33,
+    80,60,74,62,1,8,144,85,187,251,93,5,216,81,189,2,223,67,35,249,164,223,62,127,172,86,125,22,83,108,247,10,
+    45,225,108,228,176,128,252,254,48,9,204,89,79,201,238,35,248,103,46,145,193,234,253,3,192,0,0,88,62,0,0,144,
+    244,106,16,132,129,124,241,131,227,255,2,186,99,123,220,47,17,189,69,144,182,135,146,79,152,99,206,204,39,146,228,186,
+    193,172,48,65,201,161,72,62,114,228,47,224,233,179,105,247,244,11,226,4,83,152,13,249,163,160,127,125,116,12,18,240,
+    16,96,62,233,176,184,229,81,15,66,131,119,117,179,122,145,116,69,77,32,117,90,114,33,116,54,104,73,65,0,104,54,
+    193,153,145,116,62,151,190,188,188,141,118,70,217,153,36,151,224,5,197,197,226,17,88,146,7,113,39,120,5,63,32,66,
+    88,225,7,46,98,5,57,231,94,4,67,30,49,249,132,42,192,129,27,19,99,23,164,96,1,8,44,137,204,228,115,149,
+    0,15,65,87,0,90,176,128,0,66,48,0,64,147,15,0,2,4,56,0,85,88,193,0,43,8,193,14,183,70,62,180,
+    0,0,0,0,0,0,0,0,200,131,21,12,69,127,22,52,206,170,228,51,128,254,0,222,197,173,69,92,117,68,195,92,
+    0,186,244,92,155,222,83,48,251,238,87,80,164,19,146,79,237,219,196,73,89,159,232,117,89,95,30,116,0,146,149,117,
+    121,85,230,37,87,255,251,89,232,64,217,173,207,11,227,5,67,137,227,209,151,129,0,57,45,159,5,31,217,9,249,104,
+    123,97,234,126,18,154,229,26,166,39,244,112,107,255,253,184,110,34,234,52,182,222,238,174,140,134,238,196,128,194,128,0,
+    0,0,0,0,1,0,0,0,153,69,8,2,188,177,126,6,216,18,39,249,183,251,222,187,135,225,76,82,55,198,37,126,
+    4,0,184,59,171,240,175,24,51,25,137,233,137,85,85,228,221,105,249,169,157,202,238,81,29,144,47,171,48,192,26,164,
+    60,16,128,0,82,16,0,0,147,15,0,0,4,56,0,64,8,65,0,2,72,65,0,0,77,62,0,0,16,224,0,0,
+    96,4,1,8,32,5,1,0,52,249,0,0,64,128,3,0,128,18,4,32,128,20,4,0,208,228,3,0,0,1,14,0,
+    221,83,164,240,119,145,167,28,224,94,204,156,0,232,18,93,137,96,70,48,72,0,64,80,118,148,145,15,11,68,91,73,
+    209,17,151,113,131,161,13,113,1,248,163,115,169,89,142,193,41,92,7,193,205,67,73,62,105,213,96,169,141,70,85,208,
+    52,249,0,0,64,128,3,0,128,20,4,32,128,21,4,0,208,228,3,0,0,1,14,0,123,88,16,128,55,83,144,171,
+    195,150,143,164,53,236,119,173,25,153,65,244,182,87,65,169,71,70,62,122,98,155,137,95,0,160,5,131,0,160,5,1,
+    48,250,16,173,94,129,47,147,100,123,76,94,43,200,31,3,34,216,28,16,201,231,116,240,10,220,126,41,3,100,5,1,
+    65,0,25,32,192,146,56,118,62,87,25,128,16,116,197,76,31,11,8,240,246,199,252,216,6,0,64,11,1,0,64,8,
+    62,8,133,198,96,81,107,116,6,235,85,159,4,135,28,41,249,0,108,10,194,220,253,21,21,140,15,246,24,60,106,163,
+    228,99,145,84,6,12,216,83,252,175,147,213,98,112,168,39,169,143,178,104,189,107,182,10,78,192,186,11,31,193,130,188,
+    0,0,63,238,0,208,64,0,0,77,62,0,8,16,224,0,111,0,255,0,113,64,3,81,188,26,249,20,95,191,128,51,
+    28,105,2,164,167,227,12,164,124,118,228,227,127,255,2,110,150,149,23,16,80,22,52,144,48,235,144,79,46,254,3,56,
+    130,149,4,221,54,4,219,228,1,208,88,230,124,30,217,131,132,63,56,130,53,127,149,124,173,217,83,124,205,194,95,126,
+    244,124,90,124,203,176,95,126,104,124,187,114,141,137,64,112,0,160,35,115,230,142,142,193,47,229,90,65,161,244,74,62,
+    0,0,0,0,0,0,0,0,91,215,92,193,83,35,90,65,163,69,75,62,213,252,239,223,9,103,16,202,37,95,169,191,
+    3,192,137,201,25,20,48,5,184,179,97,5,31,172,11,250,183,93,82,131,55,252,108,121,183,197,136,82,12,0,92,6,
+    200,0,25,32,55,193,10,2,83,232,253,89,88,19,242,137,190,127,0,47,6,200,0,89,210,89,16,64,133,238,79,235,
+    76,145,143,24,245,3,56,187,64,6,200,216,171,131,1,50,81,130,58,241,148,124,120,36,178,101,36,5,50,64,214,252,
+    29,117,41,181,48,96,40,235,239,190,181,100,79,163,176,253,111,236,117,146,79,159,147,93,143,123,26,205,207,188,217,91,
+    174,97,22,205,46,93,91,22,174,17,153,80,24,0,218,129,104,221,52,58,7,135,228,3,119,50,74,201,247,244,159,210,
+    60,104,95,254,83,104,25,17,144,111,122,228,178,21,141,235,128,12,144,1,49,106,201,96,123,66,83,96,163,85,33,31,
+    181,138,239,202,100,129,236,143,39,42,5,11,158,137,2,123,168,251,249,84,167,126,117,13,3,100,128,44,151,0,40,32,
+    4,154,31,200,39,17,2,130,36,168,46,152,1,0,3,2,32,64,128,159,2,2,44,8,129,143,1,251,52,168,30,64,
+    1,222,3,158,64,196,118,140,2,22,60,104,129,143,1,251,68,8,100,64,1,0,3,2,32,64,128,159,3,2,76,8,
+    34,126,138,191,240,115,77,162,110,122,147,71,82,121,96,241,153,65,102,107,165,64,149,64,71,62,108,60,55,188,98,30,
+    111,187,198,24,164,62,177,224,114,63,110,151,26,58,154,100,220,186,89,151,232,58,153,250,143,32,0,127,204,224,95,169,
+    36,137,226,166,211,174,228,18,128,14,230,122,36,81,131,0,185,213,125,165,107,142,124,142,217,243,123,69,8,96,126,199,
+    33,2,124,78,194,104,126,179,118,58,120,234,110,60,121,67,184,173,115,114,55,83,65,206,2,31,193,83,82,141,62,116,
+    204,120,134,3,151,77,89,249,236,164,3,143,212,153,129,19,211,99,255,10,109,133,185,228,48,133,254,252,80,77,203,73,
+    207,32,64,44,183,230,98,146,193,164,249,251,64,0,0,24,62,0,0,176,224,0,0,77,4,3,8,16,3,237,44,129,
+    22,215,33,64,210,252,176,64,192,88,72,62,181,55,16,224,133,209,79,213,137,91,34,211,1,8,220,212,77,61,133,1,
+    44,84,194,2,223,22,32,249,231,222,191,126,71,185,142,56,87,227,83,41,4,192,213,65,4,0,0,9,3,0,0,11,
+    128,159,1,0,84,8,32,64,1,251,226,17,161,63,129,143,226,53,90,72,93,136,1,37,93,136,104,125,1,239,219,61,
+    32,64,130,140,217,33,107,136,126,139,1,201,225,104,30,192,1,153,241,29,17,135,186,142,229,1,140,231,128,159,1,0,
+    243,9,100,255,142,241,83,42,1,50,142,72,39,56,16,141,220,44,16,187,111,151,207,93,204,155,248,237,211,5,65,70,
+    85,78,64,213,238,148,62,137,42,30,232,215,64,140,4,33,10,84,3,109,198,40,249,4,194,191,126,186,181,26,20,100,
+    208,42,129,235,207,72,97,249,80,139,160,6,211,12,38,249,188,178,228,231,148,234,195,18,67,50,207,17,83,149,129,228,
+    176,128,254,60,208,144,70,48,207,11,108,90,55,133,76,146,192,210,250,235,193,190,195,96,62,156,81,24,153,172,31,137,
+    58,11,204,189,78,17,4,128,138,228,147,181,255,254,125,162,9,54,48,174,218,43,80,215,89,146,15,63,255,1,132,244,
+    92,220,192,180,204,128,64,31,192,201,62,171,105,109,200,98,68,185,2,203,16,35,2,129,115,22,250,252,8,182,159,247,
+    223,7,65,201,47,76,62,249,232,207,223,77,207,39,204,17,248,0,199,65,176,164,209,5,240,158,4,7,1,30,4,205,
+    155,45,249,8,160,191,127,91,136,23,67,183,99,85,49,135,128,73,60,215,139,1,17,12,248,56,16,164,48,180,228,83,
+    134,141,1,188,148,39,128,196,1,0,251,1,32,64,128,159,249,185,152,7,48,68,2,147,125,103,110,49,1,37,241,81,
+    246,63,128,135,237,21,152,199,178,145,1,228,111,167,2,88,1,156,230,105,93,255,136,151,224,157,110,199,128,131,1,78,
+    110,52,63,62,30,54,61,129,234,52,63,194,185,185,184,66,246,124,57,136,96,239,185,72,36,126,95,0,6,180,32,70,
+    118,35,159,113,33,64,29,118,209,20,158,98,204,65,158,234,250,191,159,132,74,111,93,0,13,57,29,73,88,130,29,28,
+    1,2,245,253,158,192,126,147,245,253,75,232,128,155,1,0,84,168,224,63,1,250,245,217,64,78,99,152,247,245,72,232,
+    14,153,1,212,88,136,32,191,1,126,244,157,39,207,251,143,245,193,107,136,127,147,1,11,115,168,223,62,1,9,245,249,
+    254,225,45,110,220,92,92,136,123,190,28,196,176,247,92,36,18,191,47,0,3,90,16,35,187,145,207,56,14,4,56,59,
+    41,189,117,11,52,228,116,36,97,9,118,112,121,8,63,0,119,104,65,241,241,71,62,158,23,112,224,57,76,27,208,245,
+    0,25,32,3,250,117,58,65,176,66,144,193,247,179,70,62,35,8,144,32,200,254,24,32,10,178,10,18,214,198,12,94,
+    204,35,242,73,60,128,253,214,6,200,0,217,71,120,16,64,154,57,48,36,120,145,207,7,113,168,107,210,64,6,200,30,
+    92,21,190,249,99,137,162,24,6,153,80,228,157,17,123,251,93,181,80,221,158,254,138,254,16,241,154,16,176,51,65,96,
+    207,14,38,94,162,48,89,145,115,182,16,239,113,77,160,39,115,185,15,4,193,1,120,10,192,63,186,19,62,199,175,230,
+    104,150,104,2,54,214,48,249,172,82,37,12,172,154,49,9,19,46,30,25,143,73,180,228,144,86,172,226,48,121,10,104,
+    79,224,13,103,132,151,50,145,65,238,126,55,65,237,240,166,62,216,228,12,21,91,198,69,6,1,56,176,2,213,21,75,
+    221,253,174,130,236,168,94,129,239,161,145,124,195,97,4,119,245,184,123,120,72,98,236,119,120,242,255,126,161,207,85,115,
+    255,17,8,118,0,46,251,117,234,240,103,65,89,119,175,192,30,44,74,62,94,109,244,58,187,78,29,58,139,15,29,58,
+    137,251,220,26,38,249,168,31,25,26,242,124,236,0,135,140,242,242,150,16,184,66,151,53,152,16,4,128,0,16,68,176,
+    120,228,19,14,0,77,148,251,103,196,220,127,44,251,91,82,108,130,92,56,207,219,47,0,35,57,208,162,36,163,143,86,
+    5,200,0,25,134,11,43,252,57,202,97,1,79,3,194,243,25,239,142,41,64,6,200,0,196,41,221,15,133,176,60,112,
+    51,141,162,207,90,64,26,124,50,64,6,200,173,92,131,0,196,23,131,225,56,141,124,130,142,128,186,121,1,50,64,150,
+    1,0,249,1,32,64,128,159,248,13,236,23,128,151,1,252,244,231,224,191,1,0,249,1,32,64,128,159,249,1,252,7,
+    128,159,1,0,3,24,32,64,1,241,248,217,222,62,142,215,244,137,1,40,107,169,1,32,7,104,129,55,1,227,232,225,
+    23,215,187,2,23,17,109,8,4,128,217,60,4,138,26,25,243,231,150,16,244,18,89,228,30,129,254,148,221,147,1,7,
+    30,62,222,198,176,198,84,16,80,121,76,109,15,3,17,99,208,86,187,144,116,0,2,84,120,144,111,229,120,198,219,46,
+    126,168,5,49,117,115,57,66,64,70,75,231,4,144,1,50,140,54,124,20,115,32,253,8,13,199,91,228,50,122,0,249,
+    129,236,143,1,225,15,172,32,175,220,71,96,227,108,38,159,13,252,247,239,100,128,12,144,77,160,5,1,36,68,2,251,
+    14,0,208,228,47,128,0,1,48,23,170,184,143,102,115,87,200,9,117,145,62,248,51,108,193,147,46,253,62,22,20,88,
+    224,250,249,67,254,224,7,48,5,19,111,231,249,168,174,91,127,155,252,41,2,228,157,191,21,12,0,0,228,3,0,128,
+    37,112,142,9,145,143,148,15,57,113,241,78,97,119,13,239,128,118,178,226,159,119,232,3,46,65,0,245,131,192,164,35,
+    105,62,13,218,171,250,66,249,108,220,253,52,177,211,45,20,26,210,101,14,16,6,1,112,255,3,179,128,34,249,172,234,
+    217,177,143,27,65,244,46,117,199,49,14,206,189,160,142,122,65,187,110,81,230,26,8,64,32,247,167,99,237,200,231,32,
+    33,124,199,45,214,100,87,208,115,178,55,195,234,239,135,84,249,104,215,121,3,110,87,181,166,102,39,130,52,14,4,208,
+    1,10,9,10,223,62,128,143,9,14,108,168,128,147,1,3,116,168,222,63,1,0,9,2,32,64,128,159,28,178,67,8,
+    43,146,1,94,48,136,116,16,1,63,31,22,71,232,46,140,14,34,180,103,143,175,1,26,163,231,164,3,1,246,10,218,
+    38,31,112,246,22,159,206,55,152,95,222,225,14,31,160,36,152,159,108,230,118,220,116,14,85,29,196,186,123,221,34,196,
+    68,48,128,178,54,144,226,90,146,143,152,26,248,78,210,186,109,110,205,151,214,111,80,249,192,47,23,215,47,47,130,253,
+    80,97,221,61,251,30,225,121,34,45,5,249,59,97,4,171,184,64,250,92,77,147,243,28,44,42,251,56,121,36,246,62,
+    135,169,253,108,112,65,233,182,25,85,231,248,224,13,233,2,15,177,130,0,21,47,130,33,137,152,124,66,91,89,120,140,
+    197,51,216,77,129,201,135,31,0,10,129,101,32,3,100,255,203,65,0,25,49,193,23,85,141,62,172,133,213,237,36,204,
+    25,32,195,254,13,2,200,0,9,254,69,11,242,17,204,120,175,74,105,46,0,217,44,249,144,64,6,200,112,23,70,102,
+    53,219,22,4,121,47,12,28,109,238,230,51,123,43,7,120,103,238,7,93,248,72,113,93,128,68,118,93,8,235,78,16,
+    193,127,108,240,133,114,145,143,249,51,100,72,36,12,187,116,94,67,117,119,0,41,57,119,6,212,98,65,211,25,233,192,
+    135,235,134,115,231,191,149,129,100,172,35,140,100,247,35,26,51,82,97,23,43,149,110,228,131,233,73,242,3,130,113,233,
+    211,161,97,242,107,4,246,232,75,244,136,165,19,144,140,182,6,16,62,172,2,0,64,11,1,0,192,10,0,0,104,242,
+    17,70,74,65,204,226,126,62,179,69,12,161,127,66,1,6,120,155,133,0,219,240,31,249,76,71,192,126,76,183,119,3,
+    131,157,110,26,54,0,112,228,48,17,127,243,112,137,83,34,15,128,0,76,176,127,191,159,64,58,74,178,191,113,13,134,
+    25,247,58,48,72,35,85,48,214,50,146,15,5,137,16,132,16,42,14,110,93,203,99,112,0,136,72,115,97,237,125,65,
+    172,191,138,193,57,92,70,62,93,227,220,141,33,249,223,224,177,12,33,219,73,182,128,225,101,112,78,4,28,206,11,3,
+    194,115,193,0,216,234,64,172,134,73,62,244,241,23,63,95,159,194,62,187,42,24,191,44,62,198,62,59,11,56,57,245,
+    164,169,184,204,248,135,185,12,172,239,96,0,135,94,160,193,122,33,31,181,132,153,157,22,228,48,29,146,131,146,30,201,
+    1,244,55,241,31,3,100,238,32,64,2,217,103,193,199,101,66,62,90,203,239,223,95,118,12,144,97,248,1,1,100,127,
+    5,3,0,128,249,0,0,160,128,3,0,52,4,18,32,64,11,6,0,128,242,1,0,64,0,7,0,104,11,36,64,128,
+    151,241,243,137,205,24,244,81,73,189,6,17,111,253,1,37,160,29,249,168,14,10,195,97,158,175,87,151,128,135,66,199,
+    128,162,59,39,24,153,28,4,25,169,247,243,68,102,228,227,180,252,254,173,227,218,237,29,123,235,204,221,38,121,11,158,
+    223,201,95,71,32,171,7,176,6,200,0,25,6,0,64,10,1,0,128,7,7,0,104,242,25,64,128,0,64,6,200,0,
+    0,0,78,48,0,0,60,48,0,64,147,15,0,2,4,56,50,64,6,200,0,80,130,1,0,224,129,1,0,154,124,0,
+    242,145,242,161,248,45,222,41,245,197,27,202,245,185,106,216,248,153,96,240,221,109,76,222,218,201,138,135,222,161,15,0,
+    4,1,212,127,2,147,142,184,249,52,104,15,252,8,229,167,249,234,85,93,250,190,46,102,252,148,60,35,238,158,76,236,
+    164,7,32,64,1,0,7,2,32,64,128,159,7,2,172,7,128,159,1,0,180,7,32,64,1,0,7,2,32,64,128,159,
+    7,2,188,7,128,159,1,0,196,7,32,64,1,0,7,2,32,64,128,159,6,110,203,7,129,143,1,244,203,7,111,192,
+    82,46,11,130,146,88,194,130,155,230,208,124,22,111,156,128,144,1,50,64,239,8,15,12,118,126,21,228,94,85,228,147,
+    121,255,6,110,12,144,5,50,42,106,96,129,14,168,160,129,41,34,31,20,186,53,127,90,128,12,144,217,194,2,3,100,
+    73,151,22,245,9,4,64,157,19,212,55,14,232,3,163,149,226,171,215,25,184,211,131,212,208,155,130,11,247,19,222,162,
+    142,251,135,194,163,171,166,93,168,11,210,231,5,2,96,69,9,2,0,128,242,1,0,192,0,0,0,104,0,0,0,0,
+    115,128,145,203,67,168,181,194,203,52,127,243,115,25,117,202,43,140,26,200,150,234,214,183,214,227,112,11,97,72,29,1,
+    97,232,100,242,157,81,255,232,89,25,162,249,169,160,107,231,125,197,170,249,41,59,0,218,21,41,146,203,3,224,252,209,
+    197,113,236,74,207,53,104,225,6,3,32,82,5,51,150,69,249,108,61,246,128,131,134,0,16,247,31,64,63,71,152,213,
+    167,167,45,31,249,83,90,202,251,203,32,183,242,211,125,211,216,22,74,240,127,32,207,213,84,32,56,183,226,223,224,126,
+    140,32,64,0,132,238,64,205,48,71,62,143,234,47,224,51,54,158,196,85,43,79,204,193,128,65,197,21,143,135,1,1,
+    78,200,3,197,159,46,249,160,36,63,130,147,43,96,98,7,60,18,112,7,0,162,27,23,119,245,8,20,213,238,14,20,
+    196,45,145,233,0,4,110,234,166,158,194,128,22,42,97,129,111,11,144,124,137,86,0,120,149,237,181,116,68,15,130,121,
+    140,215,255,126,148,235,136,115,53,62,149,114,0,92,29,116,0,0,144,64,0,0,176,64,0,0,77,62,0,0,0,0,
+    242,249,214,214,233,125,99,242,247,173,147,198,248,89,232,214,250,253,165,178,0,193,124,0,5,7,192,48,249,84,192,184,
+    252,192,237,28,250,88,181,112,250,42,8,239,252,34,9,241,222,172,207,100,223,34,71,29,230,38,103,215,131,0,176,60,
+    44,39,238,134,145,198,82,103,223,126,43,55,32,191,115,151,54,124,20,4,32,253,8,140,199,91,228,115,122,0,249,13,
+    252,166,79,93,225,139,22,94,240,132,23,30,43,9,86,16,38,242,35,176,99,223,146,207,7,2,12,184,58,133,46,120,
+    91,155,207,141,114,216,120,103,243,199,115,67,69,162,115,249,8,172,116,201,222,89,191,0,154,90,65,255,66,124,62,5,
+    56,204,223,3,237,228,208,5,167,95,213,229,64,105,204,185,166,236,250,2,13,97,5,73,207,96,250,188,222,91,119,119,
+    212,72,20,17,243,253,94,18,33,254,112,228,144,6,69,113,80,139,239,50,207,39,176,61,139,222,131,165,65,28,186,120,
+    64,16,72,8,62,202,114,207,223,50,137,71,4,177,7,112,3,1,0,96,249,0,0,64,128,3,0,52,18,4,32,64,
+    4,209,192,0,175,134,64,118,166,92,62,115,126,103,114,174,236,134,218,69,188,241,227,33,154,60,227,117,112,99,2,115,
+    238,161,1,121,92,53,250,136,222,63,186,123,82,55,39,167,35,230,131,231,190,187,98,23,78,146,16,244,158,167,3,180,
+    26,201,199,142,246,249,251,30,32,3,100,253,103,65,0,25,175,192,106,213,70,62,197,118,239,223,18,206,25,32,11,200,
+    11,6,200,0,4,38,129,57,242,41,217,125,0,255,204,37,0,89,189,127,48,64,6,200,48,0,0,86,15,0,0,36,
+    137,30,132,238,191,223,186,36,178,156,143,234,187,93,76,191,192,29,107,228,120,16,128,175,57,48,36,71,145,207,7,154,
+    169,111,210,120,200,143,229,133,200,47,232,53,168,15,48,151,193,46,19,6,217,46,28,86,218,78,148,35,45,24,32,197,
+    73,67,75,4,37,203,51,242,241,156,28,236,145,233,161,249,121,252,255,233,177,56,165,249,21,192,0,217,193,82,92,225,
+    227,199,14,225,131,23,76,7,96,41,206,1,90,142,41,249,158,36,253,239,202,16,210,252,16,110,5,240,168,254,213,252,
+    227,191,125,147,233,129,47,8,70,144,1,128,71,104,124,35,1,120,212,241,211,217,244,142,231,137,208,40,168,141,1,155,
+    172,8,254,171,1,118,245,1,170,3,169,135,241,153,121,104,126,146,1,197,101,168,54,191,2,251,236,57,94,94,129,51,
+    0,208,228,3,128,0,1,14,0,0,36,48,0,0,86,48,0,64,147,15,0,2,4,56,0,0,96,192,0,0,88,193,
+    0,0,77,62,3,8,16,224,3,0,128,0,0,0,96,5,3,0,52,249,11,32,64,128,12,0,0,252,3,0,128,21,
+    247,31,129,96,4,224,178,95,172,14,127,22,147,117,247,10,238,193,162,228,28,128,0,1,28,32,79,93,92,176,230,90,
+    48,0,120,168,48,0,0,90,15,0,0,36,56,0,64,147,0,0,2,4,0,0,0,0,0,0,0,0,193,0,0,0,
+    130,69,9,90,124,48,139,193,117,175,117,145,117,29,135,135,126,1,187,97,126,131,220,104,113,243,53,107,112,44,86,202,
+    115,93,166,252,65,0,200,17,192,7,17,59,62,236,69,64,190,247,66,163,190,0,253,194,191,242,89,121,191,236,106,46,
+    126,195,9,76,169,113,8,116,237,32,232,83,90,167,127,236,252,234,29,48,40,21,25,16,48,10,145,79,182,118,149,96,
+    105,72,48,192,98,0,217,64,72,107,74,62,243,34,90,199,179,84,87,6,84,252,127,3,163,148,26,249,108,147,88,11,
+    26,20,44,31,175,22,28,31,173,228,99,209,0,255,61,156,250,99,48,123,169,109,176,184,250,144,143,161,254,131,129,254,
+    214,195,192,2,216,147,193,187,129,70,62,5,247,95,32,101,135,21,252,184,245,158,2,227,235,42,249,204,42,4,171,108,
+    190,193,144,68,191,200,111,244,190,59,4,7,63,205,129,241,58,246,94,5,187,212,193,19,59,157,176,147,96,192,126,140,
+    223,214,153,193,31,43,141,205,157,71,29,34,93,232,39,109,95,155,150,218,223,107,82,49,93,191,210,188,93,250,98,210,
+    50,158,229,215,121,146,204,135,22,73,229,55,23,60,101,247,199,76,86,103,64,21,102,103,243,191,26,4,83,138,10,220,
+    85,33,228,163,97,172,230,99,172,176,242,155,138,179,230,179,98,182,242,35,167,33,190,59,245,216,186,203,53,34,193,115,
+    183,184,67,149,65,26,226,183,192,15,152,83,62,5,196,219,69,118,99,76,5,249,215,207,3,203,99,131,249,140,86,12,
+    126,98,79,29,14,68,225,63,16,12,112,225,228,179,199,245,28,158,29,114,90,176,135,4,52,48,0,0,147,15,0,0,
+    13,90,82,157,0,154,13,157,133,247,67,16,61,136,107,48,212,120,145,79,182,85,201,175,235,184,164,47,221,116,201,47,
+    74,108,164,207,61,161,34,206,215,64,79,142,0,227,98,174,1,17,58,8,39,101,40,248,199,172,200,167,102,0,205,87,
+    194,52,212,109,105,16,120,242,142,241,119,82,3,39,117,173,189,1,62,36,190,215,64,117,135,29,63,76,242,14,150,133,
+    166,49,208,37,142,253,218,21,136,116,217,141,69,40,252,0,172,253,2,65,30,55,250,100,34,98,149,173,84,42,32,55,
+    250,147,42,251,128,235,77,252,178,193,71,251,160,124,52,232,10,141,63,230,0,0,120,217,133,101,130,130,228,138,199,129,
+    226,88,242,124,169,14,21,121,67,251,34,124,155,161,89,122,111,69,250,126,136,157,5,121,173,192,14,118,168,233,35,120,
+    140,135,230,140,177,153,21,119,126,73,249,115,128,125,48,119,215,153,190,65,186,210,179,192,106,54,71,62,25,0,113,98,
+    253,9,57,211,145,162,110,211,1,0,81,209,149,46,241,1,188,135,21,3,120,70,36,249,246,159,64,211,23,176,58,222,
+    154,73,119,30,246,3,121,56,230,255,126,42,61,171,116,145,165,165,118,118,98,61,119,243,56,118,65,0,25,128,192,146,
+    197,76,62,87,100,113,63,116,116,170,190,125,248,253,57,218,233,170,59,74,42,178,187,89,151,151,188,231,231,90,188,171,
+    0,0,0,0,51,8,37,24,166,96,15,88,43,169,200,71,239,202,230,71,200,199,142,87,42,184,142,183,92,115,230,71,
+    13,220,64,87,200,217,105,7,96,145,106,167,72,63,17,12,38,217,7,204,206,127,228,115,102,181,192,251,147,162,185,51,
+    110,237,139,124,22,64,96,193,144,1,50,64,15,20,22,12,25,128,19,4,12,94,228,163,127,1,2,254,44,144,1,178,
+    191,198,96,128,197,150,32,250,130,34,31,186,168,104,49,174,128,12,144,13,85,7,3,100,115,6,77,165,19,249,240,215,
+    50,94,3,255,128,12,144,1,25,199,231,32,9,185,151,96,236,212,34,31,245,11,200,130,100,128,12,144,215,91,5,1,
+    209,126,2,155,242,29,249,76,13,244,199,72,3,100,128,108,28,38,8,32,252,26,88,125,117,208,167,0,14,34,140,90,
+    119,252,118,102,193,128,197,186,65,58,149,87,62,58,4,56,223,180,143,71,202,249,183,239,192,33,57,199,206,229,169,52,
+    5,3,96,212,4,153,133,57,249,12,251,224,130,221,218,23,20,39,128,192,4,23,128,156,50,23,216,94,22,12,0,63,
+    180,232,151,109,179,125,55,148,79,113,135,135,219,40,199,153,148,17,4,0,57,23,68,168,161,228,19,200,46,239,219,140,
+    105,240,83,46,102,240,195,11,28,239,107,96,201,120,43,203,218,123,203,70,127,154,43,110,144,5,2,128,161,12,98,33,
+    243,239,159,91,0,25,32,83,125,1,2,200,0,12,174,78,63,242,137,197,128,18,201,110,200,0,89,192,106,16,64,6,
+    94,112,39,37,146,207,189,13,222,97,173,18,6,200,72,131,130,0,50,64,128,121,29,177,124,30,74,253,63,65,52,149,
+    49,232,108,71,138,228,194,74,233,230,2,142,147,130,0,160,115,130,145,149,142,124,4,14,69,120,121,71,101,126,217,145,
+    105,120,200,149,110,126,255,243,19,119,244,91,48,115,215,34,33,119,64,121,17,65,129,104,120,64,50,57,76,62,83,191,
+    188,91,142,248,198,30,8,0,134,59,152,195,90,201,39,120,139,190,55,64,39,230,7,11,45,193,87,103,93,230,215,203,
+    88,46,215,97,182,47,247,53,107,69,119,120,168,31,4,0,135,21,108,184,121,228,99,199,228,242,203,128,91,228,51,58,
+    76,117,200,65,176,192,0,216,81,65,254,188,66,62,134,65,239,255,4,49,41,200,153,55,92,214,61,251,33,223,41,60,
+    30,3,3,124,6,5,189,119,174,250,136,152,114,91,76,155,93,98,71,52,198,64,7,189,201,123,23,138,134,10,12,160,
+    14,0,208,228,16,128,0,1,16,0,0,70,15,0,0,60,56,0,64,147,65,0,2,4,64,0,0,40,62,0,0,240,
+    224,0,0,77,4,1,8,16,3,1,0,224,249,0,0,192,128,3,0,52,20,4,32,64,15,4,0,128,228,3,0,0,
+    0,0,8,16,0,0,0,0,0,0,0,0,4,3,0,0,3,237,44,129,249,28,170,83,105,89,160,24,5,71,63,203,
+    0,87,1,104,37,247,206,85,16,12,0,102,11,228,89,114,228,115,51,112,157,122,17,152,168,156,167,241,200,91,70,41,
+    0,0,0,0,14,90,16,0,230,73,176,234,156,145,207,35,76,10,79,43,205,194,142,116,224,141,206,136,255,223,143,215,
+    53,242,46,22,237,232,142,181,161,9,79,15,239,44,88,232,247,34,184,65,166,200,167,0,196,98,151,92,113,124,23,169,
+    0,128,17,12,0,208,228,3,128,0,1,14,0,0,82,48,0,0,70,48,0,64,147,15,0,2,4,56,0,0,56,193,
+    0,0,24,193,0,0,77,62,3,8,16,224,251,72,161,4,176,59,95,4,51,174,5,249,76,32,64,128,156,149,125,17,
+    9,151,140,114,17,254,131,115,0,104,7,115,85,203,149,65,204,23,149,63,10,130,69,62,233,247,143,91,149,194,39,191,
+    5,84,208,198,1,32,150,205,233,94,135,3,128,18,29,2,38,17,28,249,167,227,254,141,135,69,249,96,231,91,42,68,
+    118,33,31,203,17,101,223,111,82,139,223,101,246,138,159,100,191,100,31,92,211,199,29,185,249,202,29,239,19,221,157,214,
+    15,123,16,160,202,6,176,135,146,145,207,132,163,160,174,202,18,13,47,46,50,111,143,77,185,223,175,24,112,249,174,61,
+    52,232,63,189,3,240,231,225,162,235,35,23,202,173,81,200,128,143,1,82,219,136,216,191,1,161,216,113,96,192,233,144,
+    255,149,168,72,150,147,1,21,105,72,26,126,2,33,236,153,226,163,107,53,235,1,108,40,128,159,1,0,116,8,32,64,
+    215,228,39,142,74,209,39,81,246,228,151,222,196,252,70,115,95,4,135,66,188,55,119,120,118,25,4,0,171,13,188,98,
+    57,228,3,37,144,211,91,91,62,243,243,218,142,211,171,185,86,243,155,63,50,187,155,5,131,170,83,72,31,189,179,237,
+    247,64,207,157,135,198,183,43,215,152,8,4,12,0,58,50,100,18,5,25,179,88,146,27,79,173,130,228,28,108,217,244,
+    27,226,238,106,92,64,111,21,48,0,16,177,16,87,177,78,207,122,102,48,44,195,208,146,114,37,67,151,115,56,12,103,
+    197,95,142,189,133,53,187,180,3,96,88,205,25,227,160,5,208,51,31,5,39,200,24,249,87,33,192,125,183,92,127,92,
+    231,122,225,130,108,134,131,133,212,43,126,21,35,180,129,20,190,11,146,228,157,133,1,3,92,219,86,59,92,224,248,252,
+    34,159,87,141,232,239,205,0,44,144,1,4,5,9,100,128,1,1,0,160,249,0,0,128,128,3,0,52,128,12,32,64,
+    8,32,3,100,200,44,66,16,231,141,245,51,197,150,56,201,100,221,247,222,0,89,32,3,10,255,138,65,147,145,152,190,
+    80,224,195,254,46,212,241,8,105,212,177,102,9,205,145,38,70,2,3,64,60,7,129,94,27,249,16,111,13,204,184,217,
+    59,116,199,114,251,130,167,180,176,135,231,163,221,11,172,173,157,20,180,197,63,233,195,205,179,236,168,182,68,150,29,32,
+    0,0,224,4,3,0,52,249,12,32,64,128,12,0,128,21,3,0,128,19,14,0,208,228,48,128,0,1,48,0,0,82,
+    15,0,0,78,56,0,64,147,193,0,2,4,193,0,0,56,62,0,0,56,224,0,0,77,4,3,8,16,4,3,0,160,
+    206,5,200,252,6,1,0,11,248,240,41,239,249,68,130,207,240,52,75,26,238,154,13,85,251,146,126,229,253,0,191,27,
+    239,156,122,175,238,156,182,116,240,212,31,66,131,140,16,62,127,40,225,39,124,218,219,249,126,66,56,144,123,250,65,101,
+    62,111,21,230,178,102,235,83,128,12,144,1,234,166,199,96,52,180,68,96,178,60,35,159,65,244,143,110,100,127,12,144,
+    23,76,7,11,41,206,1,131,142,41,249,96,95,128,126,91,3,100,128,172,145,61,24,32,131,35,200,231,87,201,71,248,
+    49,247,95,192,46,23,143,61,50,23,44,24,20,4,128,81,16,252,2,134,228,19,188,129,3,78,0,167,83,28,121,0,
+    141,28,51,213,223,92,115,57,92,16,0,114,26,112,3,37,161,79,144,188,218,210,141,202,222,117,72,198,87,121,127,78,
+    131,195,130,219,168,148,17,84,200,57,23,68,140,161,228,19,42,189,169,212,11,129,44,208,159,13,101,16,87,139,146,15,
+    21,91,191,51,208,82,56,193,146,34,208,64,202,242,80,62,83,7,80,223,13,188,155,4,144,53,60,3,131,192,31,249,
+    19,55,161,204,55,151,179,60,22,4,128,249,246,179,11,112,228,51,212,136,32,210,185,92,73,221,1,239,171,93,3,254,
+    164,29,226,162,111,48,192,118,2,208,29,182,145,15,175,50,3,215,208,150,8,111,8,128,143,110,193,1,37,115,101,242,
+    44,25,2,250,183,121,63,123,55,121,4,63,7,22,239,166,100,182,38,149,84,9,148,25,195,198,83,10,45,230,113,228,
+    29,186,254,246,221,172,75,13,157,76,125,110,16,128,63,116,240,175,212,71,79,205,43,102,113,65,163,146,116,216,108,166,
+    65,251,241,243,63,198,163,221,62,54,123,216,95,33,117,69,7,27,8,144,4,117,226,87,249,240,72,162,203,72,10,40,
+    21,172,249,101,21,244,33,143,228,115,19,250,173,6,101,89,71,176,8,84,39,144,223,48,146,15,10,244,120,5,31,172,
+    100,176,64,6,253,239,190,181,146,79,163,176,84,87,236,117,6,200,252,87,131,1,50,64,128,214,77,163,124,112,72,62,
+    165,39,163,148,64,246,40,131,12,144,5,50,132,214,75,21,83,192,247,18,239,61,105,232,178,145,43,34,128,12,144,1,
+    126,124,128,23,108,135,250,255,120,49,114,43,118,205,182,41,113,198,156,238,118,90,37,10,193,0,68,172,65,120,254,226,
+    62,221,124,5,59,110,148,70,60,194,228,72,62,252,189,52,191,76,196,134,59,138,244,118,187,228,62,157,59,12,46,60,
+    199,45,210,124,199,133,255,239,7,85,236,72,71,88,85,115,4,176,250,115,164,28,105,2,227,167,227,12,99,124,118,228,
+    171,198,41,185,155,220,35,170,115,144,114,181,35,239,255,247,171,113,216,124,11,175,212,110,10,64,206,154,122,48,241,2,
+    2,200,0,25,6,0,192,10,1,0,64,9,7,0,104,242,25,64,128,0,64,6,200,0,234,14,90,16,35,230,73,176,
+    43,156,145,207,0,2,28,120,50,64,246,199,244,206,130,5,112,47,130,27,101,138,124,10,175,223,191,201,1,178,64,118,
+    59,6,199,172,31,249,240,53,191,88,101,106,176,96,119,223,31,72,199,67,74,59,87,251,154,7,12,0,24,21,204,28,
+    108,228,211,184,2,135,227,39,151,238,157,129,128,174,29,57,24,20,158,60,254,35,48,154,247,77,240,58,168,146,15,170,
+    237,190,68,193,36,76,88,65,63,250,80,62,17,29,132,245,213,98,205,221,89,11,161,220,1,54,0,220,149,153,182,4,
+    252,252,238,5,161,124,47,249,215,191,63,127,183,213,57,50,215,231,135,62,12,64,125,77,228,176,88,17,227,60,47,25,
+    58,222,31,128,239,179,224,224,161,33,159,73,3,232,111,226,127,12,144,221,129,0,9,100,159,5,31,151,9,249,104,45,
+    191,127,127,217,99,128,140,225,12,8,32,251,44,56,8,40,200,135,21,253,1,252,135,212,11,100,2,249,64,2,25,32,
+    32,64,128,159,243,205,107,24,127,163,1,5,113,24,224,190,2,26,244,101,32,64,128,111,245,1,140,7,128,159,1,0,
+    148,7,32,64,1,0,245,1,32,64,128,159,245,1,156,7,128,159,1,0,164,7,32,64,1,0,245,1,32,64,128,159,
+    39,225,7,18,123,68,171,200,176,0,1,250,48,0,0,36,15,0,0,36,56,0,64,147,96,1,2,4,96,0,0,48,
+    31,0,0,72,112,0,128,38,192,2,4,8,192,0,0,32,62,0,0,144,224,0,0,77,127,5,8,16,129,1,0,128,
+    12,63,104,13,51,169,119,25,71,163,56,228,144,39,70,92,47,167,32,113,143,21,99,242,23,236,213,145,64,252,91,124,
+    64,97,21,172,62,61,252,203,133,169,89,79,0,217,211,7,1,165,131,199,250,120,238,204,240,186,223,100,4,100,236,73,
+    181,133,253,86,75,116,216,135,136,111,141,172,152,116,33,185,12,64,0,240,110,193,1,48,71,62,21,48,135,48,112,59,
+    58,188,57,177,174,191,69,142,121,204,77,206,180,6,1,96,131,5,139,18,34,249,96,22,64,128,95,235,165,28,215,63,
+    176,202,252,234,102,32,248,152,3,195,252,96,174,80,222,192,101,10,230,160,176,120,230,2,69,131,130,1,196,48,130,58,
+    224,215,124,74,138,156,123,213,248,20,121,35,61,230,122,5,106,252,126,71,228,89,117,96,115,210,117,12,112,18,114,67,
+    97,86,64,166,133,149,98,208,5,28,21,201,1,64,211,205,35,43,39,5,8,28,230,4,243,142,28,249,135,31,255,129,
+    119,45,50,113,7,148,7,51,20,136,22,114,36,147,19,17,51,245,139,7,72,149,206,228,93,193,136,77,28,241,225,99,
+    18,169,78,179,67,250,78,190,69,44,72,71,172,37,56,39,163,209,167,80,116,162,55,20,84,238,167,24,69,212,87,117,
+    225,113,167,213,91,131,119,168,227,122,135,6,65,123,231,239,128,22,4,244,128,19,12,0,208,228,3,0,0,0,0,0,
+    97,58,27,28,50,64,118,74,25,4,144,5,21,76,162,235,228,35,95,81,1,172,147,101,1,178,124,11,32,128,12,144,
+    224,72,129,222,159,131,178,149,41,133,46,36,144,153,197,160,1,100,128,12,111,175,129,6,112,45,65,1,20,174,40,249,
+    0,13,4,32,128,18,4,0,208,228,3,0,0,1,14,0,5,60,16,128,5,74,144,120,43,146,79,223,241,11,184,28,
+    0,8,65,254,0,40,65,0,0,77,62,0,8,16,224,0,252,99,4,1,138,162,4,1,16,37,249,68,224,191,128,71,
+    114,35,182,11,114,233,234,5,111,116,222,250,113,33,189,72,65,0,224,84,193,187,129,135,62,27,215,11,187,92,228,71,
+    59,26,91,75,191,175,80,184,191,117,12,10,56,39,149,87,56,180,193,6,185,103,223,2,32,0,224,231,224,25,236,204,
+    1,4,0,0,18,116,138,245,228,99,4,128,254,29,246,86,18,30,122,252,11,93,143,167,20,30,34,131,24,16,169,210,
+    73,144,183,103,146,207,62,218,236,183,93,23,47,108,238,1,44,109,224,159,77,115,225,74,144,64,0,216,40,65,0,0,
+    0,32,64,0,0,77,62,0,8,16,224,0,0,96,4,1,0,128,0,1,0,52,249,0,32,64,128,3,0,128,18,4,
+    0,0,2,4,0,208,228,3,128,0,1,14,0,0,78,16,0,0,8,16,0,64,147,15,0,2,4,56,0,0,72,65,
+    0,208,130,4,0,0,126,0,0,154,124,0,16,32,192,1,0,160,5,11,0,0,255,0,0,52,249,0,32,64,128,3,
+    0,192,10,22,0,0,254,1,0,104,242,1,64,128,0,7,0,128,20,44,0,0,252,3,0,208,228,3,128,0,1,14,
+    92,198,21,177,29,219,130,151,16,128,65,159,240,166,223,84,79,64,224,48,39,112,164,146,113,214,5,252,113,68,202,178,
+    115,177,178,119,65,0,136,40,192,121,52,95,62,183,30,174,223,84,217,98,227,5,234,113,232,173,248,251,225,241,63,57,
+    188,144,145,207,2,72,108,152,0,0,88,193,0,0,32,192,0,0,77,62,3,8,16,224,179,61,58,5,16,158,54,1,
+    112,194,69,250,108,110,49,48,60,239,42,24,179,38,219,14,254,115,31,228,48,219,255,0,176,176,245,83,15,120,56,68,
+    217,1,56,176,218,189,232,231,220,225,79,151,6,1,108,169,2,213,21,75,249,184,226,99,47,249,213,24,34,199,223,63,
+    224,150,102,169,63,23,176,149,24,4,128,191,25,28,178,164,228,51,120,217,164,120,33,106,56,156,214,69,133,92,113,19,
+    140,79,129,145,200,36,187,96,9,178,63,22,224,200,39,131,80,166,50,131,155,124,140,124,214,252,159,64,144,1,50,64,
+    81,160,17,12,95,97,25,244,106,44,228,211,173,91,221,223,12,144,1,178,2,127,96,128,50,176,160,130,247,52,31,23,
+    0,77,62,0,8,16,224,0,84,246,4,1,10,224,4,133,65,36,249,140,223,63,128,243,184,58,21,228,73,19,20,52,
+    21,179,229,51,21,241,228,57,238,223,86,16,169,171,82,144,198,188,192,207,134,38,18,183,152,48,101,65,229,162,67,65,
+    243,155,137,140,182,203,93,79,161,227,218,224,180,99,200,214,13,10,224,225,9,142,20,232,242,57,40,91,244,85,232,66,
+    249,49,208,125,249,149,223,61,244,193,67,34,204,113,22,135,204,97,70,141,205,69,34,238,4,5,0,212,1,27,29,63,
+    3,0,52,249,22,32,64,128,6,0,128,6,1,0,128,5,7,0,104,242,44,64,128,0,12,0,0,11,3,0,0,11,
+    14,0,208,228,88,128,0,1,24,0,0,18,7,0,0,22,28,0,160,201,176,0,1,2,48,0,0,24,15,0,0,44,
+    24,236,158,192,11,124,169,250,228,163,38,202,218,181,24,113,77,48,2,237,96,176,116,195,145,207,0,158,158,220,13,156,
+    228,191,96,60,134,193,206,252,72,62,170,18,48,27,187,112,242,1,251,23,19,5,155,116,22,250,224,72,51,96,183,95,
+    183,187,115,250,151,47,196,223,199,76,25,37,151,180,89,17,12,128,191,59,108,108,68,23,243,198,239,4,199,218,53,228,
+    29,128,0,31,93,200,109,126,29,47,143,7,48,0,126,30,112,74,98,57,207,90,7,117,67,125,247,144,118,184,7,250,
+    189,82,227,69,7,201,116,54,5,63,32,66,249,244,164,12,168,233,152,21,26,4,254,171,10,220,243,191,228,163,83,138,
+    164,110,85,33,92,144,169,14,56,240,146,207,145,143,142,220,228,231,169,149,75,65,108,11,24,193,170,72,144,62,215,78,
+    190,11,146,228,176,133,1,3,80,116,223,87,15,138,123,82,238,80,70,160,193,214,41,84,65,67,182,81,62,110,88,82,
+    49,10,55,70,6,139,236,130,6,193,145,79,249,160,76,101,129,54,249,24,17,172,249,63,25,244,81,160,228,211,95,97,
+    31,147,226,143,94,39,163,35,29,100,240,18,158,4,138,156,223,146,131,74,157,196,248,191,157,238,254,154,157,138,227,177,
+    16,192,165,129,48,55,7,106,15,0,26,72,239,224,185,145,111,254,44,203,207,117,60,207,79,42,0,0,174,107,204,5,
+    142,62,183,186,71,251,150,34,133,233,81,233,77,228,237,25,151,220,69,133,16,6,57,138,255,3,179,128,34,249,172,234,
+    64,251,208,172,173,47,23,96,139,244,70,231,78,21,23,210,120,24,4,0,189,16,188,27,126,228,179,113,253,2,206,69,
+    116,103,4,227,115,36,202,6,65,0,168,193,193,49,152,169,62,183,189,74,113,132,197,70,217,33,232,47,222,133,8,147,
+    225,169,12,143,6,161,202,139,255,18,63,118,250,0,64,33,80,25,11,44,147,231,188,164,171,199,83,1,148,199,84,90,
+    17,249,188,67,75,104,16,7,99,128,204,128,44,88,32,251,32,72,94,228,200,103,241,242,254,59,35,209,251,99,35,9,
+    193,2,25,32,65,0,0,88,62,0,0,8,224,0,0,77,32,3,8,16,6,200,0,25,2,0,64,10,1,0,64,8,
+    71,62,35,255,112,224,233,57,211,5,99,47,115,4,55,187,27,249,192,52,64,120,241,79,58,22,172,95,142,24,172,215,
+    107,228,227,173,100,49,85,38,174,58,48,244,230,101,240,132,189,146,143,178,70,211,175,102,131,174,192,96,218,138,193,120,
+    230,153,28,124,210,214,92,248,2,90,48,0,3,60,16,191,212,146,207,166,1,244,55,85,101,41,115,236,83,250,113,2,
+    64,48,114,45,18,3,193,0,249,235,64,123,101,71,62,162,251,111,224,226,6,79,212,161,16,16,218,193,112,224,215,9,
+    62,4,255,190,42,36,243,68,31,3,200,207,18,200,254,216,86,202,147,15,177,172,121,11,251,102,23,242,89,28,22,142,
+    64,6,200,0,135,15,123,144,132,202,6,176,202,146,145,207,188,13,4,184,50,64,246,199,82,196,130,4,197,90,130,115,
+    68,50,228,67,142,0,3,206,44,144,1,178,165,163,96,129,210,147,32,66,132,35,31,235,251,71,240,98,129,12,144,217,
+    254,4,11,100,153,4,65,240,37,249,72,143,51,103,201,37,100,128,204,192,40,24,32,3,35,232,135,36,205,167,138,40,
+    239,17,92,202,207,232,19,91,143,174,149,242,0,86,144,136,0,74,48,0,64,147,15,0,2,4,56,0,59,104,65,0,
+    152,39,193,170,112,70,62,143,8,112,224,173,232,157,5,3,224,94,4,55,203,20,249,20,94,191,127,147,0,128,21,236,
+    118,82,248,101,5,156,28,58,210,84,92,230,252,195,92,6,214,119,48,0,67,47,208,96,189,144,143,218,2,4,120,11,
+    157,127,119,29,156,19,119,158,79,55,120,246,9,150,192,190,167,214,65,1,119,71,62,4,134,146,192,155,188,118,192,181,
+    241,1,140,231,128,159,1,0,147,7,32,64,1,3,241,205,30,192,126,147,241,1,156,167,128,159,1,0,164,7,32,64,
+    1,0,241,1,32,64,128,159,241,1,172,7,128,159,1,0,180,7,32,64,1,0,241,1,32,64,128,159,241,1,188,7,
+    3,245,146,170,2,160,110,167,150,113,124,14,145,144,123,9,205,78,45,242,105,114,125,250,85,95,173,248,233,1,57,218,
+    185,59,79,222,97,8,226,204,1,194,23,209,1,128,107,211,155,215,91,5,76,209,126,2,74,242,29,249,230,2,88,252,
+    221,109,17,180,92,206,74,193,155,248,223,182,92,122,103,210,16,0,128,164,112,39,37,106,207,189,13,94,79,173,18,146,
+    111,126,225,194,175,56,229,184,239,106,255,194,78,42,37,186,142,236,207,86,110,56,90,80,8,0,201,113,152,215,17,43,
+    19,4,15,20,228,163,25,128,2,254,12,94,99,176,127,1,75,16,253,95,145,15,221,98,180,24,87,65,213,193,6,84,
+    156,65,83,105,68,62,252,245,80,224,195,254,70,2,243,8,60,7,129,94,27,249,16,111,13,204,184,217,221,11,204,114,
+    164,7,32,64,1,0,247,1,32,64,128,159,247,1,172,7,128,159,1,0,180,7,32,64,1,0,247,1,32,64,128,159,
+    247,1,188,7,128,159,1,0,196,7,32,64,1,0,247,1,32,64,128,159,247,1,204,7,128,159,1,0,211,7,32,64,
+    249,0,0,224,128,3,0,52,19,12,32,64,19,252,217,151,232,67,74,8,142,177,134,39,94,48,110,62,61,176,199,210,
+    145,143,2,223,76,176,152,168,107,193,138,229,161,193,121,195,68,62,212,184,80,160,244,239,159,1,243,20,59,6,199,172,
+    66,39,222,56,51,135,17,155,76,23,219,178,15,12,64,53,21,228,239,8,228,147,118,126,6,110,94,85,25,30,121,255,
+    74,29,220,223,36,30,73,70,53,48,88,186,84,208,64,21,145,15,10,7,154,63,173,20,67,118,109,221,74,115,224,135,
+    207,173,180,250,208,165,61,65,3,3,240,209,5,101,62,97,249,212,173,120,224,249,183,43,56,39,224,191,51,167,243,64,
+    68,23,112,51,243,11,64,187,24,236,156,159,228,67,171,71,55,86,63,104,3,94,139,254,160,220,169,12,11,30,48,33,
+    58,242,49,41,127,3,119,50,200,0,89,62,106,16,64,6,72,48,55,7,145,15,0,26,155,223,224,185,246,199,248,245,
+    130,5,50,64,127,1,0,208,124,0,0,128,192,1,0,154,64,6,16,32,12,144,1,50,108,88,55,23,163,92,145,0,
+    180,37,8,32,119,47,168,204,123,201,231,231,253,249,11,229,32,3,100,254,21,193,0,25,146,65,14,139,74,62,206,243,
+    38,52,100,178,25,32,195,81,8,6,200,0,11,34,27,62,242,121,128,60,253,30,202,63,0,25,197,127,48,64,6,200,
+    38,249,220,230,155,22,206,30,179,18,23,206,20,50,119,65,213,54,247,140,148,16,4,128,239,27,124,172,79,228,67,240,
+    252,172,66,50,171,7,94,128,1,220,93,232,159,22,30,27,158,124,16,66,205,91,176,82,187,144,143,101,176,112,220,55,
+    77,62,0,0,16,224,0,0,192,3,1,8,224,4,1,0,52,249,0,0,64,128,3,0,128,16,4,32,128,19,4,0,
+    208,228,3,0,0,1,14,0,0,70,16,128,0,78,16,0,64,147,15,0,2,4,56,0,0,40,65,0,0,56,65,0,
+    190,94,112,218,96,212,114,145,148,168,65,0,54,120,193,157,74,72,62,247,13,122,135,181,253,217,202,33,71,11,202,145,
+    32,57,206,13,58,98,5,1,148,250,1,243,104,42,249,60,38,192,127,130,60,211,99,215,15,157,101,119,64,172,69,7,
+    176,140,253,51,48,0,0,90,15,0,0,82,56,0,64,147,193,0,2,4,193,0,0,88,62,0,0,72,224,0,0,77,
+    5,3,8,16,5,147,1,32,249,32,239,31,126,7,176,35,19,236,95,192,20,108,16,133,228,35,100,135,1,62,172,89,
+    208,55,23,12,132,148,0,140,128,254,229,131,104,234,87,62,117,211,99,48,26,90,34,48,89,158,145,79,32,250,71,55,
+    224,5,211,193,88,138,115,192,150,99,74,62,235,23,160,223,249,60,178,7,8,127,112,4,105,254,42,249,236,64,207,157,
+    36,64,128,0,4,0,0,6,3,0,128,21,14,0,208,228,72,128,0,1,8,0,0,18,7,0,0,43,28,0,160,201,
+    144,0,1,2,16,0,0,44,15,0,0,86,56,0,64,147,32,1,2,4,32,0,0,104,31,0,0,172,112,0,128,38,
+    2,4,8,112,0,0,8,65,0,0,144,64,0,0,77,62,4,8,16,224,0,0,48,130,0,0,32,129,1,0,154,124,
+    9,16,32,192,1,0,160,4,0,0,64,2,3,0,52,249,18,32,64,128,2,0,192,9,1,0,128,4,7,0,104,242,
+    64,0,0,0,65,0,0,208,62,0,0,40,0,0,0,77,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,128,
+    0,0,0,0,0,0,0,0,32,0,0,0,32,0,0,120,31,0,0,148,0,0,128,38,0,0,0,0,0,0,0,0,
+    128,159,1,0,212,7,32,64,1,0,243,1,32,64,128,159,243,1,220,7,128,159,1,0,228,7,32,64,1,0,243,1,
+    32,64,128,159,243,1,236,7,128,159,1,0,244,7,32,64,1,0,243,1,32,64,128,159,243,9,252,7,128,151,1,3,
+    200,181,14,174,174,44,242,129,180,139,220,65,27,121,216,237,87,70,241,229,245,227,251,209,193,22,196,185,74,246,194,93,
+    96,83,206,165,188,109,7,1,239,117,6,31,144,33,249,108,225,62,253,238,114,86,252,94,237,26,238,22,74,215,239,226,
+    24,249,232,150,97,236,112,235,63,240,96,12,187,247,20,175,248,253,154,140,167,232,164,247,79,237,234,202,68,237,124,177,
+    168,131,0,4,16,131,203,29,140,124,0,218,76,120,181,60,80,119,120,186,25,126,201,52,171,126,174,156,87,115,133,142,
+    246,92,191,146,32,165,66,16,45,60,97,176,225,81,154,143,54,41,236,232,103,81,49,65,186,229,219,193,220,58,70,62,
+    169,198,239,223,151,59,80,7,0,180,33,6,107,121,24,249,36,71,64,126,124,121,207,24,67,67,208,20,54,43,177,228,
+    0,1,2,28,0,0,24,176,0,0,86,48,0,64,147,15,1,2,4,56,0,0,16,96,0,0,172,96,0,128,38,31,
+    2,4,8,112,0,0,192,191,0,0,88,193,0,0,77,62,5,8,16,224,1,0,0,126,0,0,176,130,1,0,154,124,
+    47,38,196,145,27,1,202,49,32,179,205,149,121,101,5,1,129,143,1,67,79,11,249,204,23,192,127,255,95,188,100,87,
+    184,137,94,23,72,136,113,199,243,110,22,4,173,67,8,44,220,68,229,83,129,8,247,159,203,168,83,222,97,212,64,158,
+    247,5,1,112,42,6,135,181,25,249,176,254,55,251,228,112,72,252,70,122,87,252,106,210,76,251,24,5,111,240,210,73,
+    144,237,144,252,192,240,88,134,123,130,36,91,50,129,144,94,1,125,214,84,165,126,150,12,160,121,83,75,10,120,207,225,
+    128,159,1,0,148,7,32,64,1,0,235,1,32,64,128,159,235,1,156,7,128,159,1,0,164,7,32,64,1,0,235,1,
+    32,64,128,159,235,1,172,7,128,159,1,0,180,7,32,64,1,0,235,1,32,64,128,159,235,1,188,7,128,159,1,0,
+    11,10,193,183,179,70,62,224,160,168,81,58,47,130,213,241,70,34,214,193,244,26,216,65,154,98,6,1,60,30,5,179,
+    149,37,249,20,19,133,78,19,66,196,252,198,120,95,4,135,0,188,55,119,98,118,25,4,37,171,13,188,91,57,228,3,
+    0,1,14,0,144,1,50,128,148,96,128,12,132,96,0,0,38,31,0,0,8,112,0,128,12,144,1,4,4,3,100,128,
+    4,3,0,96,249,0,0,32,128,3,0,52,128,12,32,64,24,32,3,100,24,0,0,33,7,0,0,33,28,0,160,201,
+    2,4,56,0,0,24,193,0,0,208,192,0,0,77,62,0,8,16,224,0,0,32,4,3,0,64,3,3,0,52,249,0,
+    32,64,128,3,72,10,15,12,71,19,13,188,0,89,229,35,132,1,27,158,58,0,52,48,2,40,52,240,49,92,146,207,
+    81,48,157,133,73,16,161,210,145,143,117,233,35,120,49,194,32,115,236,253,41,120,56,33,40,120,170,221,63,193,138,54,
+    38,65,16,188,73,62,210,99,204,89,114,73,161,188,49,240,20,204,65,93,241,204,5,202,6,5,3,96,97,4,117,138,
+    52,249,0,0,64,128,3,0,0,9,4,32,128,17,4,0,208,228,3,0,0,1,14,0,0,44,16,128,0,70,16,0,
+    64,147,15,0,2,4,56,0,0,208,64,0,0,24,65,0,0,77,62,0,8,16,224,0,0,192,3,1,0,96,4,1,
+    187,73,184,1,240,163,120,6,176,44,48,249,228,31,64,33,124,81,181,28,195,90,24,19,78,194,220,232,16,236,95,221,
+    240,47,90,104,143,96,198,75,85,74,115,145,65,102,201,127,192,93,24,153,62,38,20,166,65,103,33,71,4,25,248,47,
+    77,62,0,0,16,224,0,0,25,32,3,8,11,6,200,0,9,2,0,64,242,1,0,192,0,7,0,104,0,25,64,128,
+    48,64,6,200,16,0,0,86,15,0,0,78,56,0,64,147,200,0,2,4,1,50,64,6,0,0,144,130,0,0,112,130,
+    2,142,1,42,119,72,156,184,1,34,232,177,86,131,167,153,233,1,140,71,128,159,1,0,148,7,32,64,1,0,233,1,
+    32,64,128,159,233,1,156,7,128,159,1,0,164,7,32,64,1,0,233,1,32,64,128,159,233,1,172,7,128,159,1,0,
+    63,198,157,78,204,96,48,96,198,230,111,235,14,145,143,149,6,252,247,163,139,73,119,159,165,212,118,233,161,172,119,212,
+    214,146,193,128,194,246,191,251,215,73,62,141,95,81,93,177,107,203,194,245,34,19,202,165,64,59,208,53,155,70,7,3,
+    145,15,68,174,11,56,114,101,5,113,136,253,189,112,87,176,148,115,169,146,219,65,0,216,157,193,7,111,72,62,219,123,
+    112,58,59,100,18,197,21,24,93,201,37,72,29,204,245,166,162,6,1,0,171,251,74,73,28,249,28,115,126,150,139,214,
+    207,112,7,115,72,43,249,4,102,129,149,7,184,168,31,4,199,135,21,108,128,121,228,99,162,186,234,203,245,213,129,16,
+    57,89,59,240,48,161,145,143,196,137,43,224,32,92,111,65,7,237,62,193,111,80,76,62,147,213,224,105,134,7,157,5,
+    240,160,37,159,151,213,0,158,201,10,241,157,200,24,102,222,3,244,191,159,45,44,244,92,218,0,194,28,0,179,17,93,
+    0,0,36,16,0,0,78,48,0,64,147,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,15,0,0,0,0,
+    1,71,240,211,249,168,60,96,68,228,151,26,106,7,196,93,128,23,237,135,132,167,144,110,25,36,66,112,245,35,116,166,
+    228,99,248,31,0,62,11,97,189,27,209,255,137,92,128,192,210,92,191,166,107,16,0,134,4,176,102,11,145,15,209,155,
+    176,112,220,55,62,236,65,226,42,27,192,30,75,70,62,19,54,16,224,42,164,136,5,241,138,181,4,231,98,52,250,20,
+    96,35,121,133,0,128,22,36,0,128,19,12,0,208,228,3,128,0,1,14,0,0,90,48,0,0,74,48,0,64,147,15,
+    1,0,231,1,32,64,128,159,231,1,220,7,128,159,1,0,228,7,32,64,1,0,231,1,32,64,128,159,231,1,236,7,
+    128,159,1,0,244,7,32,64,1,0,231,1,32,64,128,159,231,1,252,7,128,159,1,0,3,8,32,64,1,243,230,185,
+    115,194,4,25,130,87,185,228,16,128,255,8,240,82,144,85,79,178,54,102,183,102,30,145,65,230,1,236,192,144,28,225,
+    62,31,104,230,174,73,227,69,5,123,196,161,5,3,0,160,249,0,0,96,128,3,0,52,21,12,32,64,21,12,0,128,
+    255,237,79,19,8,222,233,250,248,97,23,131,248,97,74,184,246,229,9,162,248,61,91,195,246,245,30,127,211,133,243,152,
+    215,5,60,227,212,5,190,146,255,2,136,212,4,3,0,0,249,0,0,32,0,0,0,52,0,0,0,0,0,0,0,0,
+    0,8,16,224,1,0,0,255,0,0,32,5,3,0,52,249,4,32,64,128,4,0,0,2,3,0,128,20,14,0,208,228,
+    16,128,0,1,16,0,0,24,15,0,0,82,56,0,64,147,64,0,2,4,65,0,0,144,62,0,0,72,224,0,0,77,
+    0,148,32,1,0,164,32,0,128,38,31,0,4,8,112,0,0,56,65,2,0,72,65,0,0,77,62,0,8,16,224,0,
+    0,144,130,4,0,144,130,0,0,154,124,0,16,32,192,1,0,96,5,9,0,32,5,1,0,52,249,0,32,64,128,3,
+    0,117,59,29,140,227,115,16,132,220,75,176,118,106,145,143,250,5,100,65,24,130,56,115,128,240,69,116,0,224,218,116,
+    230,245,86,65,83,180,159,192,146,124,71,62,93,3,253,49,65,249,104,208,21,26,127,204,1,0,240,178,171,143,195,4,
+    128,0,1,14,0,0,74,48,0,0,66,48,0,64,147,15,0,2,4,56,0,0,24,193,0,0,8,193,0,0,77,62,
+    3,8,16,224,3,0,32,4,0,0,32,4,3,0,52,249,12,32,64,128,12,0,0,15,3,0,128,16,14,0,208,228,
+    228,7,32,64,1,0,15,2,32,64,128,159,15,2,236,7,128,159,1,0,244,7,32,64,1,0,15,2,32,64,128,159,
+    15,2,252,7,128,159,1,0,4,8,32,64,1,0,15,2,32,64,128,159,15,2,12,8,128,159,1,0,20,8,32,64,
+    96,3,28,225,111,1,28,218,240,243,220,179,118,102,16,0,241,71,240,12,209,145,143,73,249,27,184,147,251,107,118,242,
+    142,199,118,186,151,6,118,42,28,168,65,0,104,32,193,220,231,70,62,0,215,111,126,131,96,241,223,229,179,130,217,89,
+    21,2,44,8,128,159,1,0,52,8,32,64,1,0,21,2,32,64,128,159,21,2,60,8,128,159,1,0,68,8,32,64,
+    1,0,21,2,32,64,128,159,21,2,76,8,128,159,1,0,84,8,32,64,1,0,21,2,32,64,128,159,21,2,92,8,
+    0,0,0,0,72,96,0,0,120,96,0,0,38,31,0,0,0,0,0,128,0,0,0,0,0,0,0,0,192,31,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,24,48,0,0,60,48,0,0,147,15,0,0,0,0,0,64,0,0,0,0,
+    128,159,1,0,84,8,32,64,1,0,19,2,32,64,128,159,19,2,92,8,128,159,1,0,100,8,32,64,1,0,19,2,
+    32,64,128,159,19,2,108,8,128,159,1,0,116,8,32,64,1,0,19,2,32,64,128,159,21,2,140,7,128,159,1,0,
+    128,159,1,0,4,8,32,64,1,0,25,2,32,64,128,159,25,2,12,8,128,159,1,0,20,8,32,64,1,0,25,2,
+    32,64,128,159,25,2,28,8,128,159,1,0,36,8,32,64,1,0,25,2,32,64,128,159,25,2,44,8,128,159,1,0,
+    0,208,228,3,128,0,1,14,0,0,39,72,0,0,37,8,0,160,201,7,0,1,2,28,0,0,82,144,0,0,74,16,
+    0,64,147,15,1,2,4,56,0,0,172,32,0,0,148,32,0,128,38,31,2,4,8,112,0,0,104,65,0,0,40,65,
+    0,0,0,0,0,0,0,0,0,32,5,1,0,96,4,3,0,52,249,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,130,0,0,48,130,1,0,154,124,0,0,0,0,0,
+    208,130,0,0,154,124,0,0,32,192,1,0,50,64,6,16,18,4,144,1,22,4,0,128,228,3,0,128,1,14,0,208,
+    1,50,128,0,32,128,12,144,32,0,0,156,31,0,0,180,112,0,128,38,144,1,4,8,1,100,128,12,1,0,32,5,
+    4,56,0,64,88,193,0,2,208,192,0,0,77,62,0,0,16,224,0,0,32,5,3,8,64,3,3,0,52,249,0,0,
+    64,128,3,0,128,19,12,32,0,13,12,0,208,228,3,0,0,1,14,0,0,74,48,128,0,52,48,0,64,147,15,0,
+    2,4,0,0,18,4,0,0,228,3,0,128,0,0,0,208,0,0,0,0,0,0,0,0,248,3,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,3,2,0,0,9,2,0,0,242,1,0,64,0,0,0,104,0,0,0,0,0,0,0,0,
+    1,2,28,0,32,3,100,0,208,64,0,25,208,64,0,0,77,62,0,0,16,224,0,0,25,32,3,8,7,2,200,0,
+    6,2,0,128,242,1,0,128,0,7,0,104,0,25,64,128,16,64,6,200,16,0,0,66,15,0,0,52,56,0,64,147,
+    0,0,72,65,0,0,40,65,0,0,77,62,1,8,16,224,1,0,96,5,0,0,160,4,3,0,52,249,4,32,64,128,
+    4,0,128,22,3,0,128,18,14,0,208,228,48,128,0,1,80,162,24,90,79,205,249,77,55,3,140,144,193,2,2,252,
+    5,243,168,23,2,3,0,160,249,0,0,192,128,3,0,52,0,0,32,64,0,0,0,0,0,0,0,0,21,12,0,0,
+    11,12,0,128,228,3,0,0,1,14,0,208,0,0,128,0,0,0,0,0,0,0,0,0,82,48,0,0,44,48,0,0,
+    6,200,0,2,130,0,50,64,130,0,0,112,124,0,0,112,192,1,0,154,64,6,16,32,4,144,1,50,4,0,128,20,
+    3,0,128,19,14,0,208,228,50,128,0,1,128,12,144,1,0,0,172,32,0,0,156,32,0,128,38,31,1,4,8,112,
+    0,0,0,0,0,0,22,8,0,0,18,8,0,160,201,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,7,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,4,0,0,9,4,0,208,228,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,192,191,0,0,72,193,0,0,77,62,0,8,16,224,0,0,0,0,0,0,0,0,
+    2,0,0,0,3,0,0,252,0,0,32,5,3,0,52,249,0,32,64,128,0,0,0,0,0,0,0,0,19,0,0,0,
+    193,0,0,144,62,0,0,104,224,0,0,77,32,3,8,16,2,200,0,25,6,0,128,5,1,0,64,11,7,0,104,242,
+    25,64,128,0,64,6,200,0,0,0,52,16,0,0,90,48,0,64,147,15,0,2,4,56,50,64,6,200,0,224,129,0,
+    15,0,0,66,56,0,64,147,200,0,2,4,0,50,64,6,0,0,176,130,0,0,16,130,1,0,154,124,6,16,32,192,
+    144,1,50,64,0,128,22,4,0,128,16,4,0,208,228,3,128,0,1,14,12,144,1,50,0,180,96,128,0,140,32,0,
+    27,2,92,8,128,159,1,0,100,8,32,64,1,0,27,2,32,64,128,159,27,2,108,8,128,159,1,0,116,8,32,64,
+    1,0,27,2,32,64,128,159,29,2,140,7,128,159,1,0,148,7,32,64,1,0,29,2,32,64,128,159,29,2,156,7,
+    25,32,3,100,0,96,192,0,0,40,193,0,0,77,62,0,8,16,224,0,0,25,32,3,0,1,6,200,64,9,6,0,
+    104,242,1,0,128,0,7,0,200,0,25,64,240,47,64,6,74,48,0,0,147,15,0,0,4,56,0,64,6,200,0,2,
+    1,0,229,1,32,64,128,159,229,1,204,7,128,159,1,0,212,7,32,64,1,0,229,1,32,64,128,159,229,1,220,7,
+    128,159,1,0,228,7,32,64,1,0,229,1,32,64,128,159,229,1,236,7,128,159,1,0,244,7,32,64,1,0,229,1,
+    0,208,130,1,0,154,124,0,16,32,192,1,1,50,64,6,128,16,4,144,128,22,12,0,208,228,3,0,0,1,14,0,
+    144,1,50,128,140,32,128,12,180,96,0,0,38,31,0,0,8,112,0,128,12,144,1,4,4,1,100,128,5,31,116,160,
+    17,2,12,8,128,159,1,0,20,8,32,64,1,0,17,2,32,64,128,159,17,2,28,8,128,159,1,0,36,8,32,64,
+    1,0,17,2,32,64,128,159,17,2,44,8,128,159,1,0,52,8,32,64,1,0,17,2,32,64,128,159,17,2,60,8,
+    28,0,160,201,100,0,1,2,0,25,32,3,0,0,144,64,0,0,88,65,0,0,77,62,3,8,16,224,200,0,25,32,
+    0,128,5,2,0,192,10,2,0,104,242,1,64,128,0,7,6,200,0,25,0,52,16,64,0,86,16,0,64,147,15,0,
+    112,0,128,38,144,1,4,8,3,100,128,12,3,0,96,5,0,0,160,5,3,0,52,249,12,32,64,128,32,3,100,128,
+    0,0,41,24,0,0,45,24,0,160,201,7,0,1,2,28,25,32,3,100,0,56,193,0,0,104,193,0,0,77,62,0,
+    0,164,96,128,0,88,96,0,128,38,31,0,4,8,112,0,128,12,144,1,224,4,3,100,192,2,3,0,52,249,0,0,
+    64,128,3,0,100,128,12,32,37,24,32,3,22,24,0,0,201,7,0,0,2,28,0,160,3,100,0,1,193,0,25,32,
+    227,1,156,7,128,159,1,0,164,7,32,64,1,0,227,1,32,64,128,159,227,1,172,7,128,159,1,0,180,7,32,64,
+    1,0,227,1,32,64,128,159,227,1,188,7,128,159,1,0,196,7,32,64,1,0,227,1,32,64,128,159,227,1,204,7,
+    23,2,60,8,128,159,1,0,68,8,32,64,1,0,23,2,32,64,128,159,23,2,76,8,128,159,1,0,84,8,32,64,
+    1,0,23,2,32,64,128,159,23,2,92,8,128,159,1,0,100,8,32,64,1,0,23,2,32,64,128,159,23,2,108,8,
+    0,0,0,154,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,
+    65,0,0,144,62,0,0,24,0,0,0,77,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,128,0,0,0,0,
+    0,70,48,0,64,147,15,0,2,4,56,0,64,6,200,0,160,129,1,50,48,130,1,0,154,124,0,0,32,192,1,0,
+    50,64,6,16,11,12,144,1,17,12,0,0,228,3,0,128,1,14,0,208,1,50,128,0,96,128,12,144,96,0,0,72,
+    0,0,148,32,0,128,38,31,1,4,8,112,100,128,12,144,0,32,5,1,0,160,4,1,0,52,249,0,32,64,128,3,
+    3,100,128,12,0,43,8,32,0,37,8,0,160,201,7,0,1,2,28,0,32,3,100,0,104,65,0,25,40,65,0,0,
+    0,32,64,128,0,0,0,0,0,0,0,0,12,0,0,0,12,0,0,6,3,0,128,22,14,0,208,228,0,128,0,1,
+    0,0,0,0,0,0,0,0,48,0,0,0,48,0,0,8,15,0,0,90,56,0,64,147,0,0,2,4,0,0,0,0,
+    8,0,0,39,7,0,0,39,0,0,160,201,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,240,0,0,0,0,
+    0,0,0,0,4,0,0,0,4,0,128,20,3,0,128,19,0,0,208,228,0,0,0,0,0,0,0,0,3,0,0,0,
+    0,0,2,4,0,0,0,0,0,0,0,0,65,0,0,0,65,0,0,104,62,0,0,24,224,0,0,77,0,0,8,16,
+    0,0,0,0,0,0,0,0,5,3,0,0,4,1,0,160,249,0,0,160,128,3,0,52,0,0,32,64,0,0,0,0,
+    0,64,3,3,0,192,2,3,0,52,249,0,32,64,128,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,12,
+    0,0,11,12,0,208,228,3,128,0,1,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,48,0,0,44,48,
+    0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,16,0,0,0,16,0,0,82,
+    15,0,0,82,0,0,64,147,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,
+    0,77,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,63,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,164,96,0,0,132,32,0,128,38,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,31,0,0,0,0,0,
+    228,3,0,128,1,14,0,208,0,0,128,0,0,0,0,0,0,0,0,0,44,16,0,0,78,16,0,0,147,15,0,0,
+    4,56,0,64,0,0,0,2,0,0,0,0,0,0,0,0,208,64,0,0,56,65,0,0,77,62,0,0,16,224,0,0,
+    0,0,0,0,3,0,0,0,0,0,0,248,0,0,0,0,0,0,0,0,1,0,0,0,2,0,0,254,1,0,128,5,
+    0,0,104,242,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,252,0,0,0,0,0,0,0,0,1,0,0,0,
+    0,0,0,64,0,0,0,0,0,0,0,0,224,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,8,0,0,
+    39,8,0,0,201,7,0,0,0,0,0,160,0,0,0,0,0,0,0,0,240,7,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,248,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,2,0,64,11,2,0,
+    104,242,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    77,62,0,0,16,224,0,0,0,0,0,8,0,0,0,0,0,0,0,0,96,5,1,0,160,5,1,0,52,249,0,0,
+    64,128,3,0,0,0,0,32,0,0,0,0,0,0,0,0,128,22,4,0,128,22,4,0,208,228,3,0,0,1,14,0,
+    0,1,14,0,0,0,0,128,0,0,0,0,0,0,0,0,0,192,47,0,0,90,16,0,64,147,15,0,2,4,56,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,104,65,0,0,77,62,0,8,16,224,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,1,0,
+    112,130,0,0,154,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,
+};
+
+static const uint8_t delta_dictionary[16384] =
+{
+    182,248,59,96,160,10,193,6,66,190,35,254,16,128,180,15,197,83,43,150,191,34,249,158,150,48,192,151,123,86,58,175,
+    199,253,208,235,139,150,6,129,217,239,168,56,4,144,243,123,250,108,27,57,15,67,191,227,222,31,8,233,142,182,239,152,
+    23,64,2,208,5,31,193,60,188,203,46,217,225,149,185,127,126,134,6,184,255,20,20,21,35,230,173,142,207,128,87,220,
+    63,19,105,79,27,219,42,7,241,156,79,123,91,14,141,225,193,187,69,181,252,224,242,151,159,244,244,13,11,120,98,238,
+    28,212,40,118,103,40,73,242,40,167,100,225,234,81,9,104,141,199,21,232,16,237,29,37,164,5,93,49,29,194,207,176,
+    33,64,80,110,231,160,91,89,60,106,29,143,241,86,225,83,60,226,99,153,215,246,182,68,96,64,199,128,16,62,102,182,
+    213,64,100,13,225,1,168,232,112,7,152,26,34,79,26,75,124,8,32,11,188,252,46,16,20,109,57,1,0,96,133,209,
+    232,84,89,60,29,132,1,177,240,41,102,37,162,230,187,63,156,101,9,5,112,156,128,11,52,120,21,106,2,191,1,194,
+    169,160,19,255,208,209,129,43,154,15,12,84,103,187,63,16,156,255,150,188,111,94,191,29,199,24,255,216,85,228,198,127,
+    176,150,241,253,193,99,97,170,97,249,156,110,115,124,17,233,194,2,85,240,102,29,0,134,154,253,120,27,179,100,200,61,
+    12,97,29,94,99,114,20,191,215,123,2,241,79,229,34,156,30,190,169,100,132,56,123,75,151,172,199,39,111,111,195,159,
+    91,68,184,123,0,178,186,145,73,240,1,0,3,220,224,131,205,157,245,55,122,118,7,190,27,94,129,91,193,255,35,10,
+    44,107,173,134,194,251,237,83,75,56,9,239,45,81,224,124,181,208,231,40,123,2,189,204,119,245,164,130,249,87,8,227,
+    195,10,223,197,203,10,191,189,252,163,11,141,222,139,15,99,191,222,253,163,224,159,33,143,10,159,252,247,143,239,253,25,
+    233,189,233,126,64,246,134,133,139,12,105,170,87,223,169,78,6,208,28,216,183,7,233,125,249,228,25,237,101,192,63,135,
+    139,205,123,218,216,0,0,14,77,191,87,50,240,249,188,171,97,13,32,220,218,255,238,177,14,123,212,251,134,31,1,162,
+    142,202,145,254,252,62,255,250,157,120,16,35,255,59,206,107,133,163,250,106,144,12,178,205,3,5,240,232,79,36,168,239,
+    35,77,229,22,211,79,7,192,213,189,187,128,255,142,237,236,227,68,63,70,18,47,82,11,228,2,60,146,80,10,186,254,
+    15,227,245,40,224,60,124,71,248,26,208,47,244,8,178,3,2,62,204,247,127,135,1,240,135,47,224,191,167,224,136,131,
+    12,121,34,128,8,0,47,161,144,96,194,215,62,17,24,51,145,5,5,242,2,141,230,123,96,14,1,1,108,121,90,202,
+    2,92,13,8,0,0,255,16,75,53,240,1,24,4,70,228,190,123,151,159,241,123,170,7,57,37,133,193,58,193,231,49,
+    118,48,113,207,159,51,5,70,239,161,74,248,208,151,19,144,8,255,158,119,32,123,190,204,58,252,242,216,167,27,225,115,
+    116,21,187,189,184,9,141,20,48,7,99,133,194,127,105,82,10,70,248,15,108,90,47,62,153,156,73,125,33,196,199,127,
+    44,59,64,125,6,78,254,231,41,241,15,10,29,52,19,5,144,193,199,2,249,145,68,161,31,30,211,38,19,156,169,25,
+    34,128,38,2,160,3,48,13,64,2,152,66,158,5,47,87,132,2,61,21,7,66,68,63,107,251,241,64,164,62,13,48,
+    22,198,153,20,80,95,35,48,136,125,194,39,46,126,238,58,94,161,251,159,111,25,21,135,62,103,249,143,139,127,164,91,
+    177,64,34,11,224,1,144,200,8,123,23,145,112,230,13,61,56,208,170,50,3,6,198,35,17,35,120,76,159,1,47,226,
+    117,29,58,254,128,119,192,224,249,109,6,188,132,207,60,1,80,177,29,229,42,20,56,26,18,254,1,26,128,131,120,141,
+    169,248,121,220,255,52,193,214,17,225,171,135,157,233,183,71,143,129,214,80,163,191,60,231,207,14,59,203,177,224,81,179,
+    165,54,126,95,225,223,75,56,21,33,252,7,87,142,29,254,241,203,230,214,171,169,202,224,184,108,69,3,31,225,251,215,
+    104,222,149,160,10,200,232,247,136,132,192,104,224,43,124,199,29,54,65,188,157,151,111,178,186,126,240,226,131,49,102,1,
+    241,174,122,89,96,88,191,16,72,168,48,55,127,253,46,50,189,188,227,199,16,152,203,239,49,235,89,161,64,3,254,238,
+    137,132,6,129,244,182,9,60,1,57,82,116,204,79,8,142,95,197,124,139,207,102,232,16,191,146,220,53,78,92,46,187,
+    4,125,20,128,228,217,92,92,120,160,143,37,166,160,88,183,5,167,225,241,121,125,106,116,178,69,60,230,177,135,205,13,
+    0,21,26,37,116,136,79,181,73,186,12,130,247,15,178,98,117,165,252,182,233,213,119,248,248,236,180,176,217,94,195,223,
+    169,55,137,58,220,136,249,168,141,30,81,50,192,255,3,29,147,186,97,188,31,199,131,212,74,220,107,251,133,195,163,98,
+    99,83,148,192,0,0,80,9,0,0,0,0,18,31,0,0,64,213,194,254,18,15,44,58,0,0,0,252,13,231,29,124,
+    61,134,2,79,143,63,225,229,240,124,32,172,6,65,56,51,0,0,0,2,80,127,199,7,169,19,80,73,124,92,74,169,
+    117,32,90,7,190,3,240,73,144,42,111,224,119,211,211,165,5,252,41,54,0,123,246,244,110,157,192,221,162,64,163,114,
+    12,112,103,111,139,129,78,101,25,192,207,158,121,1,95,76,67,160,201,61,188,12,200,254,179,43,240,198,64,13,152,219,
+    152,193,96,5,115,66,49,32,10,60,238,249,129,222,3,83,20,102,106,189,244,49,240,152,37,11,134,13,37,96,98,154,
+    103,48,134,193,113,217,26,240,223,93,175,64,124,237,55,123,170,187,50,32,138,129,231,218,90,48,126,96,133,192,180,73,
+    0,0,0,0,123,0,0,0,97,250,202,219,194,217,196,0,218,247,160,233,1,185,240,141,236,248,79,183,192,217,5,191,
+    216,89,224,230,0,80,191,215,0,0,0,0,156,51,239,1,94,3,186,105,17,61,132,9,0,0,0,0,2,0,0,128,
+    130,128,46,8,160,3,112,139,8,154,247,236,196,125,219,93,153,149,255,85,250,231,117,242,159,163,31,209,23,136,15,30,
+    39,216,36,64,83,122,208,209,232,6,242,189,145,184,57,97,186,11,155,208,124,72,8,178,230,17,207,190,155,104,88,190,
+    0,0,0,0,30,124,0,0,128,129,10,3,143,95,192,201,0,0,0,240,0,0,0,0,48,88,198,7,203,24,32,214,
+    248,210,210,150,224,29,10,161,158,42,2,2,0,0,32,120,142,153,248,0,250,1,235,26,160,8,230,45,0,0,0,0,
+    248,252,22,188,78,172,4,215,183,1,149,171,137,47,124,193,161,101,17,128,188,28,171,196,140,240,154,16,121,100,196,128,
+    193,107,67,231,80,11,144,186,143,192,169,15,25,252,57,103,3,111,251,44,247,220,250,98,145,193,163,131,15,72,153,207,
+    106,44,23,159,191,254,249,158,208,138,97,70,223,59,112,75,92,18,104,108,142,190,111,116,131,247,251,87,141,130,147,0,
+    63,119,185,178,221,31,19,127,127,188,25,128,175,239,221,72,4,178,239,3,21,186,74,38,62,88,250,158,36,70,192,252,
+    128,247,200,124,48,80,95,62,5,20,120,24,20,120,144,248,1,49,244,97,255,59,133,168,64,129,15,201,95,96,16,95,
+    188,252,179,178,245,27,120,145,155,20,16,238,137,91,199,26,158,102,133,31,124,67,33,224,146,228,206,246,246,5,68,120,
+    233,39,37,222,94,3,108,68,126,242,135,103,117,119,124,92,245,242,115,12,101,130,199,9,95,57,28,74,40,153,18,233,
+    81,223,155,22,0,180,155,207,54,137,5,200,242,249,50,188,96,4,245,77,231,53,184,146,111,8,150,228,139,63,28,10,
+    250,131,114,37,217,119,20,89,2,119,2,102,210,39,218,207,191,121,239,177,24,112,144,160,247,249,251,183,10,172,247,31,
+    143,1,6,9,18,151,191,126,96,15,125,39,117,33,128,92,34,229,1,220,5,170,209,247,150,182,5,3,239,146,147,24,
+    242,7,238,223,148,76,6,48,0,128,37,78,0,0,0,0,20,160,239,1,10,12,118,18,195,161,157,101,29,120,210,222,
+    124,191,19,136,0,128,77,156,0,16,0,0,23,215,123,0,82,1,12,1,48,188,160,147,96,13,124,15,130,34,112,143,
+    243,128,15,28,159,145,66,160,162,187,253,57,129,251,252,61,43,107,128,238,0,160,165,62,97,58,111,15,92,34,224,232,
+    247,106,230,132,84,38,54,41,231,227,150,1,223,3,96,12,144,13,200,167,166,171,201,8,247,0,128,90,87,52,158,153,
+    130,142,53,107,241,229,159,111,122,67,120,35,176,100,30,83,164,184,109,70,208,197,191,102,10,14,208,223,123,132,240,157,
+    191,199,82,159,57,191,126,164,65,71,167,178,136,246,239,146,221,42,61,59,136,165,143,38,46,179,8,27,44,76,208,209,
+    75,108,247,11,132,231,200,125,33,101,128,84,247,84,128,47,240,23,59,223,34,89,6,244,130,80,182,27,12,187,238,153,
+    28,3,110,69,105,163,240,136,196,31,243,174,59,49,128,116,157,214,94,50,174,227,123,240,69,223,3,46,209,45,213,22,
+    74,4,7,87,222,122,124,177,205,255,66,248,179,34,14,207,115,235,95,218,185,13,32,41,209,113,93,190,122,118,178,118,
+    182,120,187,63,47,10,44,5,107,231,233,226,194,139,24,127,178,92,239,172,253,28,165,153,64,22,201,155,125,142,206,245,
+    223,249,29,63,66,233,254,28,138,143,198,188,57,114,67,25,1,134,46,251,177,9,75,12,122,127,28,37,143,96,190,159,
+    239,61,126,182,76,253,94,97,17,197,163,97,142,93,130,216,127,120,84,79,72,159,87,50,233,143,16,255,5,252,55,139,
+    248,196,58,124,232,26,129,152,211,210,74,78,159,47,208,195,156,158,48,144,188,51,22,79,207,250,140,76,96,130,198,0,
+    195,71,67,16,144,159,79,174,26,107,15,78,28,188,52,192,10,137,254,194,237,240,157,26,136,176,174,131,240,238,208,56,
+    179,98,57,129,223,3,96,214,252,254,247,14,44,160,89,13,230,6,192,69,7,228,8,115,148,16,52,188,253,221,102,120,
+    190,7,64,181,64,162,48,73,22,102,227,16,95,239,129,173,4,226,40,20,187,78,63,176,123,15,0,192,144,158,96,36,
+    237,52,44,60,179,171,17,79,117,91,1,247,31,107,69,211,138,80,154,220,71,125,10,74,113,93,244,238,177,31,227,79,
+    238,130,230,165,95,230,81,142,148,87,203,85,180,212,99,92,235,173,250,203,194,248,78,81,136,252,240,31,73,104,193,9,
+    208,118,47,51,69,128,37,161,140,91,73,51,1,154,18,248,253,139,1,109,0,0,92,184,132,242,230,61,224,102,0,194,
+    189,199,23,48,88,158,176,30,242,25,196,12,134,166,247,5,175,3,5,19,30,107,48,214,194,194,201,246,2,131,90,96,
+    1,37,14,114,159,204,102,253,59,114,101,32,62,1,32,238,88,132,247,15,158,207,121,64,120,14,112,26,13,25,14,50,
+    21,127,47,2,211,224,177,158,19,104,98,216,44,97,165,214,225,223,131,71,220,31,48,163,211,156,146,123,216,80,222,193,
+    78,73,169,15,136,103,165,77,176,38,65,71,108,99,32,62,71,157,197,127,153,57,21,137,49,78,46,26,139,156,209,226,
+    35,215,27,74,50,12,91,205,150,114,91,74,63,35,132,111,245,124,21,57,21,30,55,147,153,104,102,107,207,81,173,8,
+    174,123,199,39,50,224,255,158,233,122,29,102,129,44,224,29,211,226,128,93,119,44,8,168,44,255,29,131,162,177,55,9,
+    164,224,85,170,8,52,36,216,187,92,166,152,83,47,239,39,24,4,224,242,191,73,126,85,159,239,106,189,229,82,19,56,
+    183,96,120,11,161,3,16,43,76,1,24,27,22,119,154,82,184,251,168,6,164,26,150,42,235,218,31,29,62,10,63,23,
+    210,99,202,60,108,88,88,6,156,161,123,127,94,53,17,69,2,46,240,224,144,54,57,114,185,246,111,216,158,129,209,244,
+    69,249,192,80,95,108,4,1,241,194,55,44,13,184,182,175,248,234,61,100,247,253,103,248,11,86,2,101,13,127,211,77,
+    32,28,63,150,2,248,239,48,135,205,225,235,223,6,244,222,0,133,1,243,174,11,31,0,182,160,244,64,159,25,245,102,
+    27,12,224,23,70,249,250,225,93,52,248,19,168,1,70,228,203,255,194,138,243,218,1,252,192,207,128,120,240,200,16,96,
+    180,205,75,24,132,0,63,3,224,192,167,62,15,16,51,143,31,41,62,255,188,251,3,143,165,73,192,206,60,238,48,5,
+    168,139,218,185,31,24,223,69,225,192,132,4,119,111,53,192,104,240,221,243,3,30,14,188,190,127,255,14,129,7,15,62,
+    223,98,64,192,240,193,231,111,28,14,252,167,143,251,142,2,247,0,64,69,8,4,114,205,142,199,172,1,122,135,239,243,
+    248,28,219,115,196,252,7,77,231,168,86,85,247,230,209,198,47,7,5,15,227,207,145,227,21,80,209,59,236,150,153,102,
+    212,49,204,163,59,50,206,176,205,193,222,207,116,205,97,192,17,8,227,223,7,5,96,39,231,49,172,133,232,239,2,173,
+    140,122,142,204,149,240,165,160,164,199,0,65,160,237,122,142,155,173,192,135,142,220,6,160,151,96,202,122,118,225,150,240,
+    67,61,130,116,183,134,23,211,199,242,9,71,16,44,45,83,154,231,88,55,9,198,13,238,36,75,36,4,79,170,246,136,
+    154,22,144,174,27,30,171,15,212,240,230,9,255,172,182,99,182,248,242,189,11,71,208,17,73,39,48,195,109,17,49,29,
+    242,235,194,63,240,125,25,194,199,121,9,128,162,206,204,176,140,127,21,134,20,132,241,33,207,253,25,137,142,241,185,143,
+    202,74,51,2,137,31,45,15,208,64,160,63,221,159,201,28,137,120,210,244,1,251,250,105,136,106,214,137,55,125,175,109,
+    34,224,127,31,184,164,38,84,169,151,248,219,61,2,78,231,14,206,78,190,96,172,134,7,44,37,240,96,224,72,215,105,
+    33,225,223,138,24,11,10,149,65,191,191,214,21,96,225,206,136,86,27,17,192,10,246,142,23,124,0,2,187,131,153,196,
+    61,232,90,228,11,157,210,0,225,61,5,164,129,35,126,39,118,164,198,96,233,175,119,52,65,2,147,243,251,33,109,166,
+    194,58,211,234,232,40,143,223,158,208,237,25,53,111,152,1,28,230,85,187,41,251,222,205,67,252,152,236,144,109,250,153,
+    166,240,136,6,28,60,183,25,11,61,129,118,128,164,185,91,126,38,157,91,44,136,159,61,246,20,228,17,20,254,120,100,
+    216,217,14,14,226,197,242,199,143,81,218,176,218,27,117,240,58,30,183,35,56,231,196,236,160,99,82,16,44,201,215,171,
+    44,18,222,18,194,64,71,60,129,240,126,175,46,135,174,60,95,117,131,142,120,50,209,94,30,3,26,5,59,75,13,40,
+    35,156,64,120,194,135,38,56,224,243,14,45,68,113,116,17,6,0,0,151,187,180,4,31,243,159,160,217,224,195,196,15,
+    184,177,247,59,219,102,174,47,154,19,252,82,32,1,44,242,143,116,78,96,54,29,159,132,174,49,220,49,129,240,191,105,
+    103,64,122,6,224,1,120,73,64,173,247,184,227,108,189,35,120,240,174,57,3,248,197,43,190,144,0,151,13,254,4,82,
+    192,18,121,56,119,51,255,128,192,135,96,74,208,54,15,97,10,2,220,12,128,3,159,250,62,96,202,60,150,108,24,126,
+    159,35,213,23,224,141,87,29,64,211,0,19,82,120,25,222,36,174,231,192,61,71,155,77,232,59,175,92,210,166,229,54,
+    122,61,71,4,70,248,25,175,179,175,118,17,60,85,249,28,133,80,161,105,30,115,55,81,136,200,0,53,115,212,155,102,
+    18,232,130,78,161,151,135,139,62,248,3,159,225,71,0,99,10,180,146,69,49,248,6,64,2,40,2,102,139,97,87,50,
+    35,120,196,104,2,186,255,21,200,93,133,150,186,11,60,72,43,129,27,254,192,85,202,151,45,60,138,131,1,90,0,183,
+    158,218,233,18,108,255,177,85,166,240,156,248,249,34,32,3,51,239,171,151,234,25,12,14,88,162,215,56,255,82,105,33,
+    160,206,145,13,225,255,196,221,3,248,239,8,175,239,2,215,64,122,19,126,194,191,172,32,7,112,223,83,227,132,127,181,
+    37,142,193,75,186,185,66,95,175,79,196,35,234,16,240,56,79,147,97,122,20,254,227,119,46,6,194,135,23,13,248,245,
+    143,133,230,122,231,185,102,9,123,102,84,33,100,60,210,4,18,211,241,74,76,150,238,10,27,14,241,120,235,4,10,218,
+    128,203,249,124,203,100,192,253,243,99,239,31,164,24,76,235,175,166,73,100,72,175,93,189,253,251,12,80,236,222,247,240,
+    101,68,189,147,26,14,106,63,196,245,59,214,240,17,166,230,140,227,88,25,236,123,110,239,139,170,28,0,119,85,151,97,
+    223,147,127,132,160,35,140,242,0,64,216,153,33,135,18,30,35,116,26,147,11,39,8,171,86,65,229,156,84,200,120,196,
+    212,9,249,207,243,104,249,120,118,225,216,246,231,241,40,126,122,89,191,116,246,54,94,60,76,103,98,28,210,200,115,120,
+    64,64,10,4,223,1,192,73,56,49,40,160,236,160,201,84,121,231,12,48,16,131,97,231,113,52,120,28,7,97,17,100,
+    0,33,242,126,126,190,29,128,253,61,189,122,192,64,131,14,216,16,224,109,31,253,30,75,91,128,110,194,166,117,52,73,
+    123,251,174,239,69,64,146,194,194,65,186,134,92,221,239,251,25,3,64,24,114,141,49,152,196,172,238,254,26,94,128,190,
+    49,159,226,22,4,132,191,25,57,0,114,96,73,63,145,50,254,163,119,166,155,1,1,27,186,223,191,127,225,97,122,111,
+    4,87,24,174,242,102,57,113,216,80,223,113,189,8,252,92,199,79,37,247,107,161,163,125,207,55,33,16,253,29,21,42,
+    64,205,130,150,174,247,87,138,67,65,219,90,223,145,137,20,52,112,8,2,25,7,80,7,100,124,71,118,39,144,160,161,
+    191,59,138,240,107,192,41,144,33,126,97,212,136,123,122,135,7,47,217,18,207,172,195,31,61,145,168,110,248,83,175,23,
+    249,237,229,106,45,111,35,5,167,12,191,44,70,96,159,61,203,203,43,112,180,247,176,225,8,30,6,60,0,128,129,251,
+    239,1,0,0,192,217,19,182,70,30,191,4,0,0,128,66,124,0,0,0,142,252,6,60,6,170,2,1,35,131,47,212,
+    32,16,5,31,120,98,52,48,0,0,0,0,13,31,0,0,160,254,62,134,244,214,207,59,115,10,31,208,168,0,203,190,
+    183,47,170,194,121,247,13,152,116,95,106,73,126,165,203,210,90,127,191,12,106,37,121,192,76,120,148,16,2,153,248,209,
+    238,26,156,63,50,120,23,112,2,98,254,145,189,172,105,132,8,53,224,119,230,56,84,19,71,129,184,200,207,31,68,132,
+    89,96,152,5,158,3,144,46,52,160,199,255,169,38,206,82,212,222,188,10,147,192,63,186,3,8,16,225,163,107,233,61,
+    24,223,201,195,244,167,237,228,129,194,209,124,8,240,31,224,213,66,39,241,128,185,211,189,61,225,248,203,199,127,246,254,
+    250,215,128,178,119,244,148,136,1,8,254,200,182,36,79,3,77,223,177,168,9,80,34,248,57,156,222,142,96,128,125,71,
+    67,62,48,138,29,9,5,255,204,129,97,248,151,133,133,128,232,119,20,106,2,65,10,210,43,223,138,144,119,149,223,241,
+    252,16,222,58,88,162,190,15,35,252,211,250,203,30,132,15,64,88,154,160,197,35,11,8,127,148,29,181,124,238,225,131,
+    216,188,127,80,85,78,166,114,203,227,118,248,84,45,68,161,208,212,65,199,146,67,160,103,30,70,125,239,162,164,81,103,
+    252,120,255,0,252,249,140,1,207,218,77,1,112,128,15,212,156,224,196,94,133,242,171,189,209,195,193,240,200,178,43,202,
+    17,254,134,64,196,253,126,66,103,253,223,152,207,192,193,255,248,16,160,219,221,218,226,181,190,122,251,254,67,126,12,17,
+    172,221,180,70,16,246,251,30,201,0,206,249,137,70,249,230,219,123,245,239,207,168,7,248,190,227,208,14,72,49,79,251,
+    136,38,120,12,121,3,159,191,83,97,168,185,14,118,229,157,253,54,208,59,228,239,137,168,239,152,110,167,196,241,67,176,
+    126,219,35,226,183,80,14,4,148,123,143,23,132,208,58,96,174,198,203,189,248,58,223,123,229,175,130,95,195,231,185,88,
+    176,150,79,180,244,208,136,16,254,61,0,111,0,179,127,214,196,28,237,117,118,239,1,32,12,40,221,147,34,180,222,229,
+    86,240,183,36,101,215,190,33,12,31,0,135,0,162,192,121,4,8,240,48,120,176,225,63,93,6,48,20,124,123,252,246,
+    134,2,21,58,94,191,191,0,247,0,192,206,224,247,105,205,108,163,140,2,253,19,95,175,118,224,16,63,100,19,249,248,
+    13,62,238,149,238,19,223,248,67,220,207,49,68,53,246,250,163,241,165,62,222,250,77,193,132,105,67,45,245,100,236,115,
+    196,160,2,240,10,58,16,185,223,17,194,255,80,245,7,240,223,43,64,178,31,250,90,182,254,118,9,139,125,36,15,90,
+    141,3,42,227,52,143,239,193,18,242,8,249,4,29,197,166,99,230,63,77,48,99,16,21,140,193,255,138,234,81,154,116,
+    24,168,45,143,87,23,178,242,111,27,209,31,63,242,91,199,209,223,205,173,113,122,21,121,235,229,232,105,231,231,72,206,
+    194,63,11,28,241,65,245,147,141,112,73,254,234,187,255,191,230,246,103,34,73,226,209,129,69,197,54,202,242,223,34,53,
+    111,14,190,124,248,92,227,115,6,201,135,192,208,17,45,38,204,14,20,100,193,41,76,29,79,65,79,133,36,200,73,208,
+    3,40,226,59,176,125,252,30,173,12,248,218,111,2,156,242,51,184,86,141,200,231,111,224,2,82,8,28,239,175,242,216,
+    242,233,115,216,123,11,151,2,203,247,24,67,1,239,246,237,95,192,135,175,160,5,60,8,94,130,52,248,86,69,40,41,
+    145,228,30,150,227,135,81,223,183,153,86,28,124,199,110,251,208,59,159,241,207,250,88,46,229,243,29,239,250,0,45,125,
+    28,67,200,47,245,17,214,119,222,145,1,218,222,183,31,191,20,189,87,180,153,201,84,6,149,125,87,229,133,80,241,31,
+    252,65,169,172,4,252,38,54,223,64,197,128,194,47,84,243,56,152,79,226,254,253,91,12,8,188,72,252,130,76,241,24,
+    176,141,87,40,89,197,143,244,20,16,32,15,224,133,213,25,196,46,60,73,71,1,255,252,4,253,106,98,175,88,194,151,
+    188,163,2,163,131,95,47,118,48,113,95,88,237,133,55,44,3,0,0,250,227,55,15,224,160,110,8,48,3,252,119,248,
+    131,192,250,124,195,176,73,232,223,238,128,127,61,222,224,47,240,55,250,67,212,230,43,105,111,198,107,34,47,12,254,232,
+    176,233,251,126,50,129,226,248,68,92,176,68,124,248,234,221,223,106,64,191,119,244,151,239,167,248,33,180,53,31,242,14,
+    252,222,209,79,61,240,229,23,67,157,248,152,159,182,124,199,205,212,80,107,29,37,145,34,240,124,244,243,61,220,38,1,
+    224,131,111,125,243,106,241,163,71,88,71,149,7,31,198,247,111,21,124,202,165,139,216,118,158,126,142,146,181,176,44,33,
+    166,161,128,162,237,179,22,60,76,23,120,138,5,131,241,115,248,70,134,181,116,252,228,43,127,3,225,5,68,123,15,14,
+    176,248,111,218,134,125,170,18,37,5,175,104,51,0,27,193,197,153,49,57,31,123,121,63,194,32,32,151,253,91,230,171,
+    4,125,246,234,174,222,99,0,68,120,101,242,17,231,4,150,233,183,12,0,95,7,124,8,91,130,237,3,148,99,111,108,
+    0,8,80,67,87,182,223,3,129,17,56,183,61,37,126,134,191,123,230,254,110,234,150,0,184,191,135,136,19,48,110,47,
+    12,83,114,222,235,209,247,247,67,236,2,130,249,62,188,188,35,8,191,4,150,247,242,17,215,236,223,191,204,53,152,254,
+    85,215,194,151,239,1,17,246,95,169,218,160,239,41,66,248,235,159,215,19,218,150,155,234,240,106,95,127,109,25,96,75,
+    255,8,253,99,199,169,79,225,120,1,198,248,138,143,92,120,209,67,60,144,251,215,164,24,163,117,28,231,100,61,71,48,
+    64,32,112,56,154,99,92,22,42,107,248,237,107,5,223,4,63,32,66,14,134,64,57,14,123,237,98,32,223,225,171,186,
+    30,56,10,136,150,94,42,225,28,62,0,128,128,4,131,136,249,1,207,144,240,67,194,7,124,16,104,73,248,30,179,109,
+    121,138,201,114,18,137,222,228,198,15,175,11,97,60,186,154,115,116,161,63,252,35,195,193,42,66,134,16,101,252,99,234,
+    135,226,131,15,142,104,94,158,235,145,47,116,120,148,163,163,13,81,115,165,69,110,245,170,126,17,194,247,248,72,132,17,
+    71,169,253,117,35,190,144,248,95,5,99,124,7,112,248,224,189,252,6,252,169,138,45,226,225,115,172,55,136,136,6,129,
+    69,52,219,83,208,109,255,236,106,166,11,197,97,16,190,191,208,100,144,80,247,152,245,172,28,240,155,63,251,187,196,240,
+    208,222,17,100,70,156,224,87,101,188,96,120,31,220,123,199,215,227,48,96,149,87,222,34,241,63,188,133,162,71,81,223,
+    221,147,73,228,126,71,125,40,64,124,94,137,42,116,255,27,98,189,171,24,19,104,143,79,152,52,153,39,190,198,245,142,
+    205,225,51,124,73,127,119,3,249,119,77,100,248,225,156,113,236,45,234,231,210,27,198,30,185,196,71,183,238,213,252,33,
+    73,149,143,251,253,91,252,77,173,211,207,254,209,0,126,208,217,128,199,127,206,220,81,231,3,232,24,113,7,195,246,117,
+    123,255,5,50,240,194,223,251,67,215,128,0,190,71,215,31,160,19,207,68,22,53,138,12,253,211,247,28,147,1,241,226,
+    160,223,62,128,231,61,0,0,0,128,121,44,63,112,224,100,15,78,188,103,60,29,144,98,247,209,50,181,189,221,193,141,
+    46,240,27,96,167,37,228,49,128,21,235,29,198,192,128,115,119,36,185,14,136,1,26,180,191,36,79,2,239,222,241,154,
+    6,56,4,232,132,2,253,45,96,62,124,71,248,24,160,16,128,20,14,12,1,0,13,51,142,2,12,8,133,191,228,249,
+    85,64,98,5,224,1,184,202,128,240,167,33,19,93,158,66,125,175,4,5,80,237,30,76,181,84,121,35,232,248,61,249,
+    99,64,188,123,156,7,48,224,239,81,236,119,127,199,1,0,224,188,95,70,244,187,39,144,4,3,94,6,119,145,49,126,
+    252,130,255,6,120,246,166,57,26,200,21,1,0,0,160,241,15,95,196,7,74,35,24,146,62,144,202,29,194,123,229,26,
+    174,223,112,64,128,195,119,152,36,160,115,111,23,53,149,95,15,0,0,0,13,159,134,134,76,214,50,32,201,240,29,44,
+    49,23,252,223,199,14,15,191,172,60,189,155,142,86,202,246,138,223,201,129,11,61,144,97,224,127,3,62,241,156,58,231,
+    66,248,99,17,249,248,249,59,35,104,0,143,37,178,135,91,35,228,207,113,103,33,140,218,163,84,20,0,221,119,225,159,
+    80,111,237,190,89,24,16,0,252,71,29,37,97,255,228,12,219,207,21,129,191,135,180,138,48,58,111,81,86,234,98,39,
+    238,251,77,214,0,43,251,40,255,227,71,202,178,190,227,180,19,240,175,239,132,235,38,33,218,225,123,78,177,130,194,250,
+    92,76,214,119,112,233,211,255,240,111,139,55,131,144,191,77,254,107,242,47,229,120,140,147,91,177,8,40,236,31,113,215,
+    137,171,253,164,117,49,40,251,226,97,59,177,195,97,55,97,116,164,59,243,202,239,142,43,244,172,2,141,56,116,60,216,
+    220,55,15,223,12,30,6,32,244,189,115,192,192,190,125,251,8,240,223,102,207,223,190,7,254,17,128,181,247,39,39,90,
+    119,246,201,215,178,232,123,4,170,249,126,184,78,65,233,190,216,34,21,201,10,178,195,247,113,18,23,176,252,222,172,243,
+    33,209,241,252,34,236,19,124,232,215,59,57,96,49,252,12,169,145,243,145,141,161,163,136,30,0,63,216,197,209,216,48,
+    168,221,161,163,80,69,168,73,153,210,124,172,156,189,240,200,148,1,160,197,117,192,61,234,144,219,235,13,251,44,130,251,
+    248,252,0,250,254,232,17,20,62,126,151,1,253,2,255,224,71,96,10,189,231,112,20,124,166,39,65,224,142,145,8,76,
+    2,31,184,247,160,2,63,78,89,185,74,253,167,156,224,27,58,9,220,150,0,65,229,175,18,240,1,0,4,238,213,83,
+    42,224,24,220,161,14,30,223,169,22,197,227,215,200,94,100,236,231,120,36,235,113,234,34,128,187,143,186,99,71,116,147,
+    16,210,255,137,22,144,79,95,207,93,173,255,255,120,243,64,64,128,70,8,240,224,81,55,155,8,111,59,249,57,46,233,
+    155,23,240,241,208,86,167,152,22,254,217,132,103,64,171,123,62,199,244,222,122,193,161,99,119,245,126,179,96,159,182,125,
+    38,121,212,48,235,29,249,109,192,57,124,204,163,182,9,134,173,247,27,32,3,46,246,125,147,211,215,11,202,222,5,130,
+    7,0,0,128,168,47,94,195,249,123,12,80,115,248,252,248,1,9,245,249,32,64,128,151,0,0,0,0,133,15,0,0,
+    192,223,31,61,171,144,227,24,0,0,0,20,191,134,10,31,240,167,32,213,0,16,132,142,20,62,0,0,196,20,127,143,
+    17,120,131,142,179,123,235,106,62,247,3,159,225,72,192,98,10,172,138,117,49,248,6,64,2,26,2,194,202,218,94,46,
+    35,120,196,136,2,179,255,65,199,218,135,138,178,11,60,232,45,129,24,254,80,181,137,152,3,40,240,6,62,3,118,249,
+    254,232,247,167,59,222,45,198,8,223,248,135,16,190,175,194,45,73,229,93,195,22,149,187,24,144,241,243,22,18,66,30,
+    113,47,190,175,124,4,45,226,31,119,24,106,73,153,14,107,121,234,188,88,206,134,93,194,118,149,189,64,189,130,207,196,
+    191,62,91,63,129,58,200,193,227,57,6,116,130,217,124,161,208,182,47,226,227,234,57,190,104,66,237,119,38,70,120,108,
+    46,76,76,60,62,121,173,232,45,88,252,93,127,246,241,64,190,248,241,193,124,16,126,17,227,241,11,252,113,142,106,19,
+    216,210,159,35,15,27,80,13,71,50,63,145,149,99,162,142,24,236,240,212,31,156,6,245,107,224,71,123,242,242,185,255,
+    120,164,19,125,193,27,41,74,143,103,251,38,92,102,83,8,145,231,222,142,9,252,210,207,193,255,33,34,160,163,207,148,
+    125,189,42,239,10,28,228,147,241,207,28,7,76,65,77,124,202,237,92,135,45,226,183,193,112,62,86,177,9,162,63,1,
+    109,232,15,224,250,199,125,249,188,148,232,118,25,66,248,254,253,76,217,156,36,185,124,69,120,157,25,176,157,28,103,62,
+    162,6,63,107,237,233,128,117,245,142,130,46,192,146,189,224,147,39,112,57,152,243,251,246,168,135,206,238,104,193,95,213,
+    253,219,100,239,159,214,10,80,191,167,198,61,72,87,143,160,3,10,188,12,195,254,158,21,50,64,0,62,254,243,119,155,
+    113,23,30,225,211,64,102,129,204,119,214,212,5,254,99,120,124,199,1,21,124,233,97,69,69,4,185,34,82,101,218,132,
+    39,80,107,88,3,128,20,220,98,21,248,188,231,1,217,7,145,221,81,5,28,152,111,224,221,253,6,52,131,199,137,0,
+    103,64,124,6,224,1,96,105,136,174,167,184,217,64,93,38,119,240,46,58,3,248,197,227,62,137,0,95,175,32,194,99,
+    219,11,240,23,70,249,246,213,161,52,248,19,223,1,73,228,9,31,202,253,118,0,15,130,51,0,222,188,50,4,40,240,
+    197,162,172,166,250,247,15,224,194,111,246,254,241,66,0,94,59,242,163,38,27,9,97,220,210,191,133,129,122,207,248,111,
+    18,18,33,140,126,209,119,228,207,6,6,18,17,223,7,63,76,184,77,223,242,10,16,72,125,71,36,191,192,43,225,180,
+    59,54,226,182,19,249,228,217,223,191,197,0,189,103,147,200,32,145,47,213,229,41,91,17,226,187,54,30,1,221,248,138,
+    174,230,153,157,74,190,111,163,24,16,144,111,46,32,17,174,212,219,251,55,8,129,211,236,35,168,36,109,47,231,191,131,
+    67,58,201,28,242,196,35,42,152,86,64,103,46,116,132,77,13,101,249,234,207,181,22,248,133,83,241,152,91,35,204,202,
+    82,212,171,182,18,1,162,111,64,67,103,255,211,152,207,111,32,219,10,81,159,88,133,158,222,236,112,23,29,107,26,68,
+    50,95,107,70,52,20,142,239,83,48,7,176,62,115,17,103,32,195,133,249,200,111,52,64,240,55,251,75,188,12,68,129,
+    123,220,66,3,242,174,244,0,224,97,195,117,67,119,239,57,52,239,75,219,3,32,54,132,63,129,251,22,22,242,206,52,
+    241,192,239,125,119,131,219,222,21,240,211,194,48,31,41,160,99,248,195,254,7,47,3,122,140,172,211,43,64,49,13,127,
+    142,178,64,95,225,143,79,70,200,7,104,190,182,128,129,24,255,58,252,134,151,2,109,0,48,80,46,138,131,129,15,0,
+    88,136,1,79,9,191,223,63,0,88,187,188,219,119,245,67,119,117,225,247,63,9,240,123,128,151,34,21,35,248,0,0,
+    1,26,229,45,105,63,127,155,188,100,5,31,13,65,0,122,224,239,87,41,44,143,167,183,60,184,180,15,94,7,252,55,
+    192,176,124,33,90,180,231,151,203,247,5,224,1,222,246,229,31,64,148,223,198,5,60,8,190,130,74,248,85,10,231,48,
+    125,32,241,125,29,100,128,255,119,238,239,46,248,248,17,236,192,131,155,1,232,115,236,160,0,11,253,234,19,245,29,243,
+    99,223,117,31,8,212,222,39,252,19,47,2,95,31,125,198,212,31,16,143,248,37,140,247,129,139,1,224,222,177,224,63,
+    248,227,167,79,252,254,141,6,178,121,199,128,38,32,142,31,9,170,18,121,126,158,230,93,141,164,128,135,119,100,121,167,
+    8,132,228,199,171,112,199,251,171,1,222,50,99,64,2,124,211,7,160,31,23,83,224,121,135,53,88,180,183,61,177,105,
+    126,207,19,222,141,135,64,99,151,67,226,40,190,199,71,224,15,65,10,80,222,57,186,115,73,123,110,5,132,201,67,129,
+    224,60,115,20,161,167,121,71,121,139,112,6,29,95,143,149,138,132,248,225,52,108,58,138,204,119,180,126,31,149,34,6,
+    161,60,179,91,24,83,223,241,77,7,44,88,71,180,226,111,80,225,64,125,67,120,26,224,188,187,204,249,16,184,48,216,
+    221,41,2,4,223,17,162,49,188,221,55,111,157,160,207,18,77,125,199,95,36,224,152,95,193,63,210,22,125,50,244,29,
+    160,101,128,91,119,252,176,143,178,247,77,216,57,253,223,1,41,223,49,227,20,144,218,151,73,126,145,231,75,148,239,48,
+    188,99,226,146,184,86,79,223,128,38,153,18,209,123,38,229,0,132,246,210,119,228,193,227,3,189,107,178,35,8,121,111,
+    93,107,53,212,226,217,187,39,127,4,235,248,98,215,35,77,15,251,188,223,158,17,136,115,46,223,126,151,247,94,211,59,
+    5,237,247,83,142,27,124,140,63,132,225,251,15,174,183,181,118,223,139,131,203,214,71,224,0,0,206,227,103,15,224,3,
+    174,7,160,227,252,119,250,84,133,250,20,3,91,144,131,131,215,128,159,103,239,48,28,159,71,250,91,125,228,251,117,240,
+    228,236,240,104,133,88,224,72,95,65,124,210,123,158,8,110,49,254,99,104,142,241,197,143,149,32,212,128,89,210,170,144,
+    128,142,127,182,128,131,160,118,207,128,23,220,252,215,143,30,56,43,127,11,244,39,19,255,69,152,207,226,75,50,74,109,
+    52,32,5,63,250,15,56,143,252,44,218,59,178,85,1,55,239,120,102,13,252,243,75,126,78,82,198,9,107,190,99,139,
+    28,40,185,207,138,146,205,237,62,131,244,190,53,125,66,182,123,83,69,248,171,237,78,237,152,38,14,1,253,125,229,186,
+    99,32,68,6,193,3,32,234,80,106,143,108,68,10,221,139,159,128,2,101,155,215,111,224,8,142,5,184,96,12,129,253,
+    211,71,240,140,79,3,238,213,200,191,126,4,189,127,5,223,244,69,64,89,142,0,252,167,213,19,104,240,27,151,3,232,
+    2,240,255,233,116,110,159,110,63,19,6,159,10,50,64,248,15,76,208,74,208,31,66,133,35,120,22,0,0,0,10,190,
+    125,0,111,0,130,9,95,195,49,160,223,63,251,3,8,112,252,7,82,161,0,16,6,68,0,0,0,0,0,0,0,0,
+    43,129,148,248,134,35,29,219,207,242,193,219,221,12,16,118,111,120,59,188,249,144,11,60,127,200,0,163,45,151,175,32,
+    142,111,133,192,101,174,16,64,60,115,166,67,151,243,154,7,165,163,228,137,194,55,119,67,8,84,79,159,70,247,10,129,
+    0,70,32,151,141,252,30,247,209,230,29,193,234,3,21,130,252,87,248,46,4,170,167,119,158,212,8,154,222,49,49,168,
+    60,8,232,176,15,67,204,7,73,123,199,127,25,96,28,96,214,97,20,48,4,239,35,144,10,208,6,164,175,17,142,238,
+    131,121,215,212,34,112,47,98,133,186,18,13,90,165,247,80,215,4,155,8,85,4,78,141,32,68,124,23,37,59,160,145,
+    92,243,0,76,25,58,173,247,146,148,1,138,7,246,31,192,24,161,193,120,156,59,75,192,247,96,53,180,245,17,22,97,
+    226,227,254,142,32,34,50,223,248,127,245,224,18,51,23,58,142,245,83,101,139,215,253,160,236,212,63,182,69,10,208,223,
+    22,144,6,95,55,194,248,79,83,78,151,173,163,184,80,234,163,95,36,89,17,251,218,251,247,231,221,160,223,169,3,170,
+    193,106,191,123,60,34,240,64,181,240,59,6,250,2,143,6,117,51,87,79,127,1,7,94,22,231,195,149,120,108,96,111,
+    240,247,141,39,154,196,5,1,105,224,113,75,14,76,220,199,45,42,39,154,224,225,129,71,190,55,0,57,30,37,75,133,
+    56,83,208,152,224,212,240,72,103,5,30,195,240,128,228,179,167,247,57,58,14,129,157,128,71,23,83,206,154,190,109,248,
+    159,195,60,226,8,9,137,101,195,7,255,58,244,39,8,227,145,20,172,254,254,190,164,115,201,224,195,249,112,75,61,71,
+    23,94,223,209,181,46,228,225,215,144,78,197,78,95,208,123,35,104,33,176,246,125,55,44,64,161,126,169,11,111,224,110,
+    233,225,247,252,3,20,181,251,12,124,221,82,248,44,219,59,209,228,0,200,240,171,73,130,186,21,252,66,50,110,22,15,
+    130,62,185,85,209,167,248,175,175,13,132,234,63,49,111,41,174,62,191,12,87,215,164,32,103,225,243,57,17,12,203,55,
+    168,179,216,157,124,0,0,128,53,246,138,12,55,79,72,130,131,129,127,11,177,96,56,158,253,194,10,249,199,83,22,241,
+    126,255,54,3,30,190,99,65,15,200,184,239,2,173,9,92,56,239,125,129,113,192,74,125,133,39,47,127,19,118,172,119,
+    174,160,1,4,223,49,131,170,216,116,232,62,254,250,93,6,247,238,177,180,4,110,13,228,214,93,237,171,111,206,187,163,
+    4,180,177,123,222,59,41,76,207,170,195,71,38,45,0,154,0,110,124,152,169,105,107,0,191,127,207,69,42,208,222,30,
+    10,50,255,229,221,0,0,0,30,162,3,255,249,61,211,253,172,185,55,194,0,0,188,48,203,208,239,1,31,5,18,245,
+    243,124,20,73,96,235,196,75,63,136,66,66,137,133,143,210,54,202,67,193,203,239,191,35,111,211,210,61,222,60,139,224,
+    140,239,31,138,18,128,208,61,246,161,140,127,214,253,227,115,211,20,178,175,77,207,222,250,248,224,31,161,0,240,32,124,
+    245,30,204,59,148,118,136,145,231,241,245,10,97,15,174,188,188,180,82,192,187,30,132,68,77,245,232,207,174,39,1,6,
+    188,239,113,34,48,104,143,239,198,201,243,92,204,59,38,105,3,181,245,118,238,221,166,157,255,188,103,2,44,176,103,143,
+    160,197,135,54,0,251,93,6,233,239,175,26,7,86,187,219,4,168,226,58,47,175,195,163,129,22,144,32,143,89,7,101,
+    169,189,180,2,146,154,150,96,129,119,41,105,240,19,222,199,73,145,120,35,13,254,17,244,129,128,118,187,150,35,241,96,
+    76,147,129,226,4,90,87,119,68,137,1,149,207,212,132,36,29,162,251,117,83,230,44,16,119,77,75,57,21,35,250,151,
+    172,205,124,2,122,15,245,108,192,137,160,85,224,212,120,77,196,119,81,69,3,25,9,66,144,187,80,178,192,120,7,22,
+    108,117,94,59,254,191,228,198,56,250,171,180,253,196,151,116,208,230,244,236,255,137,206,30,14,173,192,28,17,254,213,242,
+    195,127,0,135,45,227,251,227,39,141,253,252,34,246,148,255,189,221,206,149,139,127,140,240,110,224,192,229,71,24,255,252,
+    0,0,0,0,0,0,0,64,31,191,7,16,12,208,151,112,255,254,1,188,18,214,235,247,175,159,2,133,254,62,224,63,
+    128,88,66,119,251,23,245,69,3,0,0,216,156,191,131,39,225,33,126,207,187,50,48,72,239,11,170,250,142,38,100,215,
+    90,209,254,167,215,128,56,216,52,176,134,62,153,8,120,40,13,205,128,32,175,242,215,230,224,85,17,194,53,62,169,47,
+    254,101,231,19,56,148,180,223,248,198,62,59,182,253,233,65,212,83,105,23,185,222,115,68,107,132,130,5,143,85,205,45,
+    205,242,4,15,5,255,69,176,128,177,188,37,22,237,219,63,0,0,0,20,240,28,55,124,192,201,0,156,129,191,219,95,
+    49,8,222,232,114,179,19,17,0,0,0,22,188,34,13,31,111,49,224,137,0,16,244,135,31,0,0,0,240,59,192,12,
+    167,86,165,3,133,199,172,188,240,180,31,62,205,86,205,194,68,120,207,152,1,250,252,17,32,64,127,155,111,132,231,141,
+    66,240,206,223,52,119,117,113,229,87,248,222,31,10,86,250,45,107,227,207,159,133,133,247,55,28,224,245,223,118,184,131,
+    180,96,78,11,160,3,208,139,148,191,135,76,52,131,205,99,24,255,39,17,34,64,128,71,5,213,224,113,113,168,46,53,
+    107,246,57,10,33,132,164,121,4,12,72,222,248,232,20,116,47,61,139,94,241,168,58,223,36,6,182,229,194,70,139,246,
+    107,212,143,155,112,210,126,220,23,171,229,145,61,190,3,87,1,253,93,151,67,136,247,127,173,8,235,193,237,63,85,215,
+    3,64,239,20,46,218,63,214,250,247,47,104,83,75,242,79,179,110,124,25,217,246,93,194,246,200,64,37,0,19,17,244,
+    58,248,17,186,229,243,164,9,3,123,3,5,156,215,149,42,237,241,243,237,74,134,136,5,52,149,33,239,143,30,132,223,
+    123,31,225,251,225,251,155,224,30,33,140,15,36,137,203,29,199,87,167,54,50,167,169,247,248,71,21,182,61,231,254,197,
+    189,61,254,94,139,112,35,89,166,244,137,57,215,67,239,239,156,98,26,192,126,74,178,133,101,188,60,254,123,221,69,131,
+    239,168,240,129,54,213,251,144,120,240,190,3,249,158,138,68,32,75,61,142,167,76,172,115,218,239,193,56,3,164,220,91,
+    192,179,66,147,26,147,7,61,24,6,223,47,171,7,212,87,129,70,57,56,46,164,133,239,92,44,4,32,249,222,235,52,
+    64,251,192,209,234,147,109,124,23,27,224,83,95,6,188,235,0,101,215,244,219,231,61,0,118,192,201,132,191,217,80,228,
+    53,151,159,2,145,159,177,95,30,32,55,24,116,210,207,232,115,8,14,25,193,156,249,30,239,48,192,233,51,2,4,248,
+    67,8,211,235,246,25,51,131,2,248,131,138,6,252,142,189,191,160,214,65,1,164,230,114,97,191,123,135,56,29,112,14,
+    15,0,157,252,56,162,25,253,39,2,189,172,152,27,132,241,251,195,66,235,139,175,11,221,249,242,179,150,30,79,20,129,
+    244,39,32,69,19,19,15,210,132,167,217,208,48,215,126,234,95,20,228,30,172,52,248,224,189,95,46,255,210,173,162,240,
+    247,0,0,0,16,238,21,254,113,72,245,2,242,12,127,24,239,98,142,188,159,28,101,134,251,151,72,225,10,14,17,0,
+    27,116,125,134,129,133,254,248,3,0,0,20,242,103,196,223,82,78,7,76,1,62,136,17,0,53,124,233,1,105,240,138,
+    59,124,20,104,209,201,235,14,48,205,67,199,212,140,192,24,142,144,129,76,50,224,252,134,56,167,83,1,14,29,1,127,
+    161,114,192,220,81,136,177,249,93,27,122,18,140,193,211,128,36,85,186,221,195,174,217,122,184,109,56,196,128,75,56,255,
+    52,67,131,28,72,143,46,143,244,201,57,101,252,83,83,252,246,185,238,177,167,86,254,17,243,143,144,154,4,100,156,187,
+    34,79,143,227,101,53,34,193,138,5,122,246,49,66,234,128,199,91,1,172,12,176,23,65,145,52,82,216,35,232,184,161,
+    210,191,127,65,229,165,150,127,158,69,154,199,28,178,14,8,183,184,105,3,254,183,141,160,151,38,17,120,244,71,196,135,
+    250,197,179,182,140,186,143,184,139,169,195,163,253,26,230,209,216,48,219,52,60,118,249,214,236,224,79,215,66,42,232,106,
+    148,74,244,59,63,99,7,143,125,7,33,190,60,102,253,27,99,0,127,17,16,195,125,135,4,222,197,81,134,138,128,215,
+    60,108,72,151,77,43,248,181,131,1,29,255,209,166,64,129,252,247,167,224,157,37,26,40,130,71,68,18,112,9,96,193,
+    21,237,171,254,71,8,223,27,33,223,131,168,85,175,119,135,62,188,10,208,247,150,5,8,195,107,195,4,221,35,11,42,
+    120,76,104,201,11,183,74,24,142,147,12,250,174,225,232,127,189,167,175,208,0,29,129,249,129,205,66,42,126,41,171,173,
+    18,112,57,15,193,4,107,92,176,13,188,12,42,1,21,241,160,124,12,177,15,93,65,207,161,12,192,30,30,239,130,167,
+    61,26,48,61,33,92,39,177,0,62,18,120,150,14,2,130,135,2,170,185,229,221,178,134,110,216,56,114,120,42,122,99,
+    194,32,40,12,111,251,189,39,58,105,56,129,0,59,242,237,241,60,240,123,112,94,130,53,126,255,184,74,160,44,30,4,
+    139,49,158,29,45,236,247,62,135,1,14,227,33,224,63,130,210,123,67,239,12,54,19,190,0,64,56,120,247,63,223,3,
+    147,255,100,65,15,240,71,81,4,2,203,227,26,66,185,73,143,1,0,128,239,222,60,127,251,55,25,80,245,239,5,238,
+    5,190,221,195,204,96,120,103,123,12,254,125,204,152,65,149,191,7,23,82,24,96,79,217,148,190,158,72,17,223,247,107,
+    127,118,125,187,128,176,158,189,75,192,243,24,40,120,71,111,9,227,29,140,58,191,3,143,236,86,3,225,60,42,28,52,
+    189,240,90,54,89,160,37,129,140,240,152,185,3,24,212,227,16,41,85,34,174,200,194,227,194,23,192,249,81,95,89,61,
+    237,220,45,138,248,207,204,52,67,246,219,213,140,253,95,34,65,106,253,174,37,199,192,163,139,34,87,69,4,216,115,236,
+    205,137,154,246,56,25,252,72,227,65,187,231,58,67,14,178,207,49,134,103,154,203,219,195,135,106,150,35,96,230,35,119,
+    51,96,68,3,159,3,192,234,188,110,152,86,29,109,105,49,83,168,9,113,39,119,49,254,250,216,89,164,191,245,65,138,
+    255,216,47,64,76,162,173,165,233,253,83,198,228,230,147,149,138,219,253,24,143,52,92,186,25,140,240,141,54,90,67,249,
+    239,181,164,116,14,18,228,95,189,134,226,8,101,249,94,147,67,0,61,193,191,53,234,68,32,136,35,223,116,188,12,96,
+    233,123,158,218,0,26,4,13,40,209,247,209,120,145,223,83,240,6,140,31,0,226,90,230,167,222,3,0,9,68,40,24,
+    99,55,97,130,118,18,7,30,250,122,70,61,120,68,186,13,7,228,169,118,33,202,197,2,4,252,140,146,2,109,244,170,
+    16,34,195,114,35,59,240,248,142,50,236,172,99,194,67,218,11,79,104,195,69,218,18,168,8,143,162,191,128,65,61,206,
+    123,96,196,7,160,3,80,233,92,231,71,165,41,241,235,48,69,63,119,123,217,232,179,79,57,221,22,179,91,109,15,143,
+    65,214,141,136,195,251,207,145,110,34,66,241,227,111,221,251,125,14,97,252,247,71,61,152,50,55,61,198,159,192,139,116,
+    33,240,32,143,126,224,134,92,186,239,251,2,27,1,205,241,113,71,109,204,252,7,240,38,165,239,83,12,3,68,231,75,
+    171,125,0,47,11,0,31,7,94,32,215,63,16,91,82,247,187,145,239,168,206,3,68,213,10,197,138,233,61,247,249,158,
+    124,0,0,0,245,250,118,57,136,192,69,1,187,195,135,241,18,80,23,207,81,178,194,110,124,0,0,0,142,237,38,58,
+    50,141,219,128,0,0,224,230,215,147,224,3,16,7,220,125,0,57,71,194,158,159,130,15,180,50,176,176,0,64,14,65,
+    6,32,102,0,111,142,195,7,156,25,193,21,0,72,179,246,42,124,0,0,128,125,241,8,208,159,192,199,158,170,133,175,
+    135,32,160,36,240,225,122,31,86,190,219,189,119,248,232,7,90,27,190,140,103,193,229,119,159,152,22,48,27,111,198,195,
+    184,122,123,164,97,93,215,30,107,131,170,143,139,158,192,106,199,1,228,236,44,95,241,162,12,94,62,18,27,145,227,209,
+    153,244,115,164,183,132,50,8,216,142,88,224,16,10,24,232,74,100,25,161,241,177,51,206,165,208,135,80,183,178,247,73,
+    203,119,28,152,1,245,246,241,223,192,129,155,168,177,222,61,178,6,24,76,178,14,171,188,13,92,248,238,233,107,4,112,
+    187,163,211,87,0,246,207,207,3,2,106,12,183,225,107,0,21,156,25,40,42,193,7,30,212,29,240,33,102,8,52,15,
+    252,45,247,40,35,133,77,11,0,0,0,40,0,8,0,0,149,114,247,0,169,1,208,242,95,66,168,84,194,186,59,0,
+    221,251,61,64,82,93,235,101,0,2,50,31,249,41,140,247,88,47,2,24,0,160,224,192,233,113,114,247,15,143,1,175,
+    135,48,254,23,255,113,47,194,83,184,111,150,100,40,206,85,148,25,136,52,124,30,180,167,181,178,113,17,175,169,201,49,
+    176,143,146,250,27,37,191,161,232,230,229,120,31,35,252,35,158,163,34,132,136,166,216,87,98,206,247,163,27,253,227,64,
+    249,157,64,93,126,66,247,87,198,63,58,247,255,193,247,17,37,79,129,255,179,225,81,15,31,27,107,36,252,179,6,166,
+    31,124,31,33,136,167,226,31,190,251,255,219,238,120,36,163,36,30,31,108,238,78,135,149,198,127,11,243,253,61,248,17,
+    209,240,128,131,222,171,246,185,152,28,184,205,0,25,190,6,255,220,251,100,45,129,169,3,96,42,13,186,160,62,129,15,
+    16,30,240,163,0,48,190,131,202,163,247,0,15,2,203,8,187,44,62,140,191,43,224,191,143,96,66,123,3,120,25,224,
+    1,22,28,52,47,199,254,222,147,128,225,242,213,151,80,133,16,175,15,255,195,227,195,4,220,1,9,138,115,204,101,168,
+    227,10,69,229,96,53,253,0,22,251,248,208,109,248,185,187,165,10,30,55,193,215,66,120,232,217,35,61,213,162,117,241,
+    74,248,15,194,11,218,191,11,252,17,102,248,230,193,230,80,159,166,224,49,143,182,135,135,244,251,28,157,220,192,199,194,
+    227,126,137,134,57,234,37,30,39,63,57,235,8,71,226,49,131,84,23,144,10,235,31,163,62,6,49,124,58,220,169,12,
+    239,225,160,159,188,223,91,244,155,49,18,5,254,46,78,16,225,188,189,110,1,110,138,115,239,8,232,176,167,158,110,125,
+    22,142,98,224,4,143,4,61,111,65,191,135,245,35,24,56,79,143,185,40,246,178,241,187,36,119,129,212,255,196,240,159,
+    195,95,229,77,192,195,239,69,237,218,51,21,217,83,248,153,68,2,248,243,103,157,186,188,152,79,226,194,253,59,12,48,
+    0,0,252,254,151,63,224,3,97,44,44,151,124,5,38,193,64,242,188,76,38,211,47,3,189,133,63,126,44,224,160,31,
+    123,208,4,186,107,3,49,252,161,190,213,128,52,127,223,91,39,64,230,159,207,176,248,168,230,115,155,239,154,232,18,216,
+    253,30,108,174,0,236,191,204,120,180,151,55,149,127,15,184,70,16,55,96,184,114,134,194,206,162,231,0,144,1,234,45,
+    228,252,98,216,216,19,60,186,248,128,250,251,104,229,11,226,236,227,55,240,228,238,4,184,192,163,8,202,56,27,16,251,
+    213,226,38,16,4,2,143,131,52,128,212,192,146,159,119,112,7,203,249,59,154,118,140,218,240,8,22,152,200,23,188,53,
+    247,24,128,176,124,242,241,251,42,245,96,6,217,201,9,129,179,128,255,60,65,160,96,94,138,194,253,129,123,0,0,1,
+    126,246,250,245,224,191,197,128,64,127,239,47,25,208,207,30,3,254,35,120,218,123,247,239,0,71,3,74,252,94,199,130,
+    83,64,56,5,223,1,104,42,84,7,8,202,231,234,89,79,125,159,133,13,0,14,223,66,181,44,248,25,241,189,9,214,
+    0,255,125,43,31,238,30,109,164,232,106,219,165,239,27,49,5,120,247,147,204,98,167,140,23,165,213,216,69,125,71,235,
+    53,152,132,94,220,245,4,238,197,191,162,43,134,150,198,140,250,200,178,131,178,46,205,23,88,134,142,41,24,64,62,94,
+    3,10,134,83,158,20,136,158,201,243,192,164,175,23,117,10,182,189,140,243,47,137,222,130,29,208,174,95,163,232,129,16,
+    63,40,168,253,85,82,94,167,65,238,4,191,157,82,0,29,114,217,106,195,241,243,132,239,170,24,3,246,62,87,132,169,
+    150,190,41,246,53,85,42,65,239,116,161,208,70,241,147,159,18,159,109,9,1,111,151,45,192,91,192,145,81,214,125,185,
+    34,87,104,112,71,104,90,99,245,40,237,123,107,254,129,15,135,212,196,106,59,175,56,191,173,116,25,168,187,79,112,1,
+    181,246,198,241,152,40,109,1,191,255,84,50,80,50,15,68,82,242,75,15,238,59,87,250,130,238,242,204,147,90,129,121,
+    239,47,192,7,35,17,144,128,124,0,19,228,240,250,174,57,14,194,33,129,182,195,23,145,17,128,20,111,77,110,91,13,
+    124,0,0,0,72,237,132,58,253,167,11,129,1,31,208,142,64,58,61,208,70,4,153,199,128,15,0,140,144,9,31,216,
+    221,246,59,126,36,129,181,11,168,184,248,85,41,52,201,239,148,176,3,214,191,163,202,127,200,138,240,126,10,10,171,47,
+    184,254,142,105,70,64,26,66,213,177,211,138,161,170,125,135,130,81,112,105,29,165,112,54,192,133,53,250,197,143,227,64,
+    248,192,159,30,200,175,115,64,0,0,16,29,247,19,62,0,101,64,171,131,239,71,0,31,53,113,24,195,242,195,11,56,
+    236,248,0,6,3,89,8,170,112,206,46,113,64,155,17,191,112,50,224,210,0,8,244,15,42,124,0,0,130,61,11,135,
+    18,218,113,45,108,68,239,125,70,11,72,37,61,84,50,35,24,133,116,235,176,131,156,193,99,189,143,172,59,128,187,176,
+    1,59,65,157,20,50,175,247,150,160,13,166,122,47,190,86,240,131,96,248,12,98,151,37,138,242,30,112,195,96,19,66,
+    43,121,217,162,183,254,122,150,47,11,223,215,243,41,107,232,109,37,6,162,232,40,53,229,45,233,101,81,156,199,73,24,
+    98,232,120,99,11,65,242,41,26,78,91,21,104,252,246,136,159,112,110,246,55,76,54,18,95,133,97,118,207,126,105,247,
+    133,160,195,123,68,126,35,192,238,29,243,61,64,101,130,47,139,187,27,154,221,172,247,101,52,2,12,246,138,249,25,167,
+    162,158,119,6,82,2,63,10,209,37,114,121,25,248,125,222,191,100,20,180,123,199,24,134,144,167,32,119,240,251,119,26,
+    133,0,96,8,159,124,127,175,102,141,81,95,0,226,249,20,103,16,224,3,45,6,32,140,1,132,255,252,192,43,96,240,
+    2,23,3,90,133,79,30,127,128,233,157,219,167,76,137,24,0,0,0,244,242,64,2,124,92,27,1,3,128,239,75,34,
+    28,30,43,229,195,228,148,177,226,151,201,186,126,228,239,253,158,84,227,0,63,209,120,82,98,99,237,176,208,200,153,114,
+    25,73,166,241,117,50,191,232,76,230,208,81,57,10,254,50,17,237,40,66,28,60,99,234,180,51,221,22,205,94,44,209,
+    2,220,247,239,252,96,217,59,19,53,136,171,239,248,3,220,112,244,203,125,95,122,108,33,102,190,227,145,120,40,184,47,
+    155,204,140,229,190,1,250,142,46,142,64,120,59,186,23,164,101,250,252,231,14,104,90,2,172,239,40,6,3,180,235,27,
+    41,120,35,144,247,247,24,78,2,161,239,169,27,111,167,20,190,187,254,62,77,54,160,24,223,35,44,16,152,185,215,198,
+    198,179,236,24,188,234,123,82,232,9,140,251,23,108,137,106,205,239,14,193,112,57,54,80,209,247,247,172,4,221,238,185,
+    29,14,23,138,228,255,17,90,227,217,115,141,239,25,112,46,195,211,92,130,154,18,213,249,192,71,168,7,210,209,231,35,
+    60,31,211,208,220,76,137,243,20,120,153,60,58,142,39,165,63,199,178,247,96,168,112,114,84,103,209,35,249,226,31,101,
+    129,247,17,254,2,38,254,165,177,193,97,41,87,254,221,17,189,54,64,246,71,138,116,185,22,96,33,119,164,185,153,130,
+    230,29,235,229,3,97,131,239,216,168,207,233,130,176,119,228,154,3,172,5,145,74,104,46,11,248,219,222,239,185,16,40,
+    188,43,247,239,134,15,0,0,80,82,159,0,89,245,248,33,247,0,0,58,252,246,229,211,62,127,159,1,196,7,224,223,
+    120,131,111,230,138,14,140,215,169,71,248,184,56,2,51,249,129,240,245,172,99,57,113,183,247,225,99,248,126,143,1,3,
+    41,242,158,201,69,128,180,64,167,105,36,27,212,243,190,2,50,224,27,192,238,146,15,148,249,238,219,59,68,219,128,173,
+    239,40,230,32,184,59,36,128,209,143,194,3,194,191,163,11,12,120,54,176,190,1,6,220,119,221,222,105,136,9,220,192,
+    221,192,119,76,223,3,192,244,17,26,59,231,209,247,19,223,65,73,8,196,124,207,72,125,176,70,159,193,21,220,31,28,
+    47,244,29,221,242,1,138,125,45,233,232,33,239,77,173,247,55,169,1,64,223,21,56,235,180,213,151,12,156,50,72,6,
+    19,169,191,124,248,51,209,207,90,49,27,68,219,123,207,150,226,13,65,230,233,95,210,243,17,80,105,99,145,85,190,197,
+    197,34,250,166,48,198,63,186,250,187,196,182,104,124,240,47,147,30,91,51,175,111,95,236,120,220,30,9,98,97,191,115,
+    190,79,245,153,16,200,47,96,254,17,124,12,77,188,87,255,1,111,7,107,44,215,70,62,119,196,127,165,19,128,66,176,
+    145,135,138,28,204,39,188,88,199,128,29,249,53,116,254,81,112,248,194,239,67,18,184,75,95,160,207,161,5,31,77,60,
+    18,64,55,144,211,222,187,34,253,10,81,124,155,63,1,97,137,175,197,159,224,27,224,173,227,124,119,25,3,56,241,67,
+    184,17,142,249,190,215,80,195,201,127,253,39,80,108,13,131,33,196,111,201,57,40,239,15,64,118,167,28,251,245,137,248,
+    63,54,211,128,190,239,89,142,96,226,79,119,93,76,114,14,159,187,165,113,128,92,7,247,175,224,129,198,237,186,103,218,
+    15,136,22,49,121,156,123,74,53,204,187,166,12,129,203,17,43,188,205,102,144,99,188,3,59,18,48,144,180,86,64,125,
+    166,237,111,149,165,226,124,50,195,62,103,137,84,0,47,47,7,37,149,178,204,10,14,223,136,141,80,191,9,39,226,243,
+    174,19,132,122,96,195,60,218,89,38,147,54,32,140,255,159,20,0,94,188,61,127,250,188,87,211,128,235,190,74,41,249,
+    127,167,1,251,7,0,160,193,163,79,50,196,92,246,214,144,71,248,156,236,2,255,248,217,107,244,141,84,239,97,194,135,
+    156,12,152,188,218,9,255,5,252,92,1,9,121,251,168,42,212,119,223,0,61,134,143,86,30,16,110,223,233,249,131,57,
+    95,170,244,124,175,126,108,235,222,139,143,90,199,69,131,59,241,241,95,151,175,174,197,216,39,48,245,19,167,58,105,242,
+    214,244,78,245,4,58,106,70,1,154,129,35,39,199,87,46,196,64,7,69,59,16,83,16,11,155,132,225,80,14,65,199,
+    146,128,38,9,161,3,112,10,48,10,120,48,100,75,239,61,64,5,0,18,35,132,127,43,5,216,131,240,124,64,161,62,
+    144,190,167,133,40,109,162,215,216,58,164,67,158,75,90,116,58,161,216,136,114,128,99,144,144,143,140,27,185,169,64,145,
+    158,213,216,148,176,96,207,129,193,35,33,208,32,96,176,62,158,237,64,19,41,8,159,169,64,64,197,193,33,44,249,44,
+    32,47,131,183,139,37,192,246,204,28,186,120,2,96,200,143,7,29,28,60,253,205,0,110,240,232,171,151,20,32,36,108,
+    47,64,248,2,222,1,8,42,172,21,72,64,166,84,137,90,1,56,134,217,62,128,246,158,111,49,192,222,59,206,35,200,
+    112,251,250,221,32,200,233,128,231,61,70,46,0,63,126,3,232,143,223,99,141,181,119,29,3,2,250,247,145,13,186,153,
+    183,128,124,11,161,3,176,107,156,7,152,50,228,110,63,90,255,220,251,163,220,31,101,116,232,168,251,231,190,141,45,241,
+    234,226,9,226,251,47,177,63,70,189,42,49,78,199,242,96,70,248,198,206,149,173,225,31,252,138,10,77,178,26,30,67,
+    88,144,1,75,9,223,30,64,0,88,59,189,243,151,245,69,119,115,225,235,142,9,40,124,128,161,5,243,35,248,0,0,
+    1,25,229,57,105,64,128,147,60,94,5,31,12,68,32,122,224,227,191,89,48,143,119,181,47,216,68,17,206,9,124,64,
+    21,138,243,195,68,122,113,95,239,182,190,163,62,81,40,182,156,232,3,82,56,191,160,250,125,71,70,128,176,85,159,27,
+    80,19,233,31,73,246,29,53,113,128,235,125,148,87,176,255,248,61,210,119,54,248,2,245,123,75,8,81,20,252,242,213,
+    3,116,68,39,140,208,246,198,98,96,224,79,138,5,241,24,241,24,119,57,133,195,203,96,84,108,15,251,235,115,20,153,
+    12,24,253,254,157,236,48,174,21,248,231,40,100,23,135,235,76,86,144,166,5,11,50,190,76,202,239,218,254,250,241,243,
+    2,133,166,191,148,135,71,29,9,14,11,30,201,207,145,143,39,190,29,60,0,14,60,36,144,34,64,71,213,20,241,59,
+    232,40,7,251,108,12,46,41,150,171,219,9,220,183,250,152,87,84,16,54,124,231,111,245,207,147,136,79,98,19,52,246,
+    227,51,240,137,243,6,54,254,126,116,133,38,193,127,47,7,211,223,127,128,0,0,168,183,24,162,223,3,205,54,136,23,
+    252,132,185,24,173,3,125,12,49,173,229,7,15,241,150,110,0,0,188,243,220,226,239,1,62,4,204,7,15,86,32,92,
+    203,135,4,175,42,245,138,54,208,71,91,33,158,249,87,178,86,242,220,134,55,177,80,168,51,60,44,196,171,201,11,163,
+    196,109,199,125,1,235,235,103,86,215,32,158,218,28,173,213,126,194,197,163,174,166,107,92,35,241,159,130,73,1,137,245,
+    71,36,16,232,240,209,75,243,198,221,139,35,32,149,210,12,182,5,126,14,16,65,237,123,73,32,147,95,49,100,248,128,
+    151,1,253,238,79,30,192,128,248,221,94,134,251,183,25,112,1,0,198,252,223,243,19,240,76,231,7,210,5,254,122,160,
+    54,53,216,121,48,65,60,15,60,129,244,242,1,33,214,177,239,29,192,51,123,12,152,55,19,10,1,238,243,18,6,124,
+    191,197,128,110,67,145,239,159,55,239,31,193,13,124,12,240,110,21,254,254,133,196,127,253,59,120,8,111,19,216,0,250,
+    178,234,16,46,207,83,243,148,132,223,147,83,87,43,244,45,94,61,199,158,49,64,173,111,34,102,144,0,191,162,250,71,
+    188,60,155,74,200,51,38,98,215,135,101,8,192,255,137,63,11,185,253,43,251,231,159,126,5,62,37,99,205,115,90,48,
+    132,210,247,57,26,155,5,215,120,84,140,33,116,23,205,223,103,55,108,173,34,236,159,207,147,188,49,118,159,35,120,88,
+    60,76,104,107,181,191,218,130,185,62,71,58,230,184,155,112,163,37,110,127,236,97,207,105,39,25,214,28,35,211,53,58,
+    35,38,129,253,248,176,200,152,241,245,197,84,77,9,183,1,247,0,96,88,252,246,233,211,63,127,151,1,195,7,0,96,
+    48,196,15,123,48,191,108,133,217,72,248,154,84,4,198,248,7,159,117,39,187,111,98,194,238,60,16,104,82,248,7,7,
+    195,207,210,119,104,104,15,98,1,22,252,12,58,60,45,5,129,182,246,110,82,174,174,151,193,196,59,243,17,184,173,79,
+    33,107,101,104,6,54,124,52,229,0,135,247,83,145,34,189,47,143,195,75,156,21,24,121,59,116,50,75,248,48,52,252,
+    242,126,69,22,86,139,199,207,11,81,136,30,217,109,115,182,123,23,35,30,223,112,128,172,47,123,219,17,28,187,177,3,
+    122,5,84,192,95,60,138,221,1,34,245,120,123,53,105,32,67,63,241,152,18,4,70,213,35,187,161,121,134,143,33,196,
+    201,96,156,12,158,3,144,108,52,63,136,59,147,210,137,47,102,48,0,15,35,132,127,25,124,43,214,252,53,198,135,254,
+    134,42,51,13,172,96,109,255,0,168,251,51,153,4,238,29,6,140,8,46,209,40,201,60,0,181,20,235,115,148,214,8,
+    248,46,151,218,96,31,191,78,152,170,138,49,96,239,115,69,14,12,233,123,8,102,66,101,249,249,78,215,150,96,20,63,
+    217,34,241,217,140,34,240,118,7,15,16,6,24,150,131,182,63,226,246,254,239,66,160,192,144,1,131,224,241,123,61,239,
+    137,240,200,60,231,40,201,117,212,253,29,219,169,146,161,38,68,232,216,235,33,38,0,122,50,169,238,208,106,28,232,248,
+    6,7,2,12,30,189,4,158,65,20,150,43,113,183,176,56,156,252,248,229,63,186,59,199,56,245,84,167,105,187,127,203,
+    127,109,11,30,34,230,128,248,120,117,145,155,125,254,245,51,18,127,35,8,236,224,209,20,41,24,247,87,162,119,71,255,
+    32,129,130,199,58,3,161,4,187,132,78,75,12,176,209,192,75,106,202,64,5,191,175,35,64,227,63,109,84,152,112,59,
+    43,73,129,16,240,41,255,165,52,236,3,150,158,255,192,3,11,120,88,254,4,194,240,241,95,64,112,188,55,28,224,209,
+    93,9,248,157,199,186,20,222,86,30,190,137,190,12,24,144,19,158,123,160,0,192,125,14,7,48,224,101,252,0,239,162,
+    99,195,9,245,171,239,28,252,97,255,28,101,124,33,153,64,31,139,34,112,233,250,6,217,247,220,31,5,255,59,33,252,
+    6,223,191,40,39,92,166,199,184,69,166,152,10,202,20,232,245,216,7,34,240,8,137,83,72,121,197,230,143,190,145,190,
+    214,130,99,3,234,200,82,214,16,50,190,115,129,80,216,39,174,19,179,132,4,159,215,251,227,59,1,59,46,93,248,78,
+    183,75,90,240,44,247,238,76,202,3,246,38,244,69,111,64,64,253,240,222,205,71,224,79,106,215,253,19,54,68,59,239,
+    193,191,184,6,252,115,168,225,32,188,222,162,1,138,254,136,45,112,145,193,68,75,240,136,159,50,18,1,99,77,118,226,
+    226,175,38,194,239,78,22,224,10,143,225,32,64,70,191,57,180,229,126,64,82,132,111,1,52,208,133,223,11,242,92,21,
+    139,66,154,132,104,50,105,133,225,71,41,255,246,246,174,54,114,202,233,126,244,165,207,49,145,5,168,1,121,211,200,40,
+    29,166,174,241,124,109,23,204,199,60,40,16,163,4,85,84,123,172,27,227,115,151,46,160,199,4,77,244,72,53,14,129,
+    223,49,64,249,59,150,11,201,99,16,227,239,44,169,37,129,31,239,250,92,4,128,11,92,50,110,209,9,80,0,194,239,
+    201,14,88,65,175,91,130,247,7,193,30,9,140,161,87,160,124,55,117,172,144,104,95,125,11,255,28,26,160,238,157,73,
+    34,108,238,33,14,29,10,191,15,99,252,145,252,159,30,140,91,148,15,107,122,105,223,31,12,255,56,163,161,41,225,79,
+    225,67,24,127,186,247,207,8,79,193,22,95,202,19,62,234,117,127,220,19,144,85,237,221,238,159,132,127,249,39,0,132,
+    0,128,91,181,29,194,7,0,12,240,226,144,164,131,88,145,3,0,0,0,121,152,50,225,169,84,6,208,123,128,42,189,
+    50,6,41,252,112,91,195,129,0,0,176,27,117,253,30,0,50,96,222,193,248,251,215,111,30,0,0,0,34,194,116,253,
+    243,35,61,240,145,244,38,113,203,13,146,244,191,215,73,110,132,242,225,116,255,218,251,43,245,31,91,132,40,251,250,53,
+    188,120,15,241,48,42,186,166,153,8,116,19,186,133,143,3,10,26,239,3,62,100,239,111,240,95,163,15,130,111,190,115,
+    71,95,231,100,81,240,222,62,241,32,149,168,251,223,136,217,66,201,127,201,152,22,224,63,131,71,104,88,11,98,126,100,
+    79,194,188,228,83,126,92,242,221,138,127,116,252,226,124,245,37,255,8,99,199,52,233,171,114,160,219,167,254,232,16,241,
+    24,84,195,46,112,249,120,220,150,2,37,199,245,153,71,49,19,215,132,26,29,168,199,234,84,189,77,23,190,196,199,125,
+    162,82,49,87,18,113,31,239,69,194,66,244,66,248,190,40,246,22,178,255,86,208,177,54,79,0,209,163,97,204,43,171,
+    0,0,132,0,1,0,0,0,77,129,15,0,25,64,206,96,252,253,11,56,0,64,0,0,0,0,0,0,239,1,0,0,
+    240,37,204,231,136,0,47,3,0,0,192,189,126,255,247,0,133,1,255,20,224,191,192,126,191,7,0,0,144,178,16,104,
+    124,179,27,241,144,95,228,35,19,140,146,59,246,12,31,4,33,200,220,135,186,204,24,126,238,46,217,68,120,237,18,58,
+    17,123,129,202,60,70,143,8,168,213,80,85,99,63,102,104,110,129,194,248,194,31,243,158,159,93,108,255,60,154,7,29,
+    11,124,114,12,143,196,136,192,224,205,57,153,140,193,199,145,80,97,66,7,20,33,162,247,66,75,224,8,6,223,23,100,
+    129,21,190,45,78,83,37,182,117,240,180,201,6,94,229,11,244,200,122,114,88,3,207,219,85,32,125,190,177,108,129,198,
+    12,36,195,7,33,14,129,69,247,62,49,124,154,208,132,178,0,80,40,222,55,124,0,0,1,116,250,140,142,158,190,37,
+    0,0,0,112,245,197,107,248,127,143,1,11,14,159,31,63,32,161,62,127,4,8,240,50,0,0,0,0,240,1,0,0,
+    106,38,119,225,163,113,125,85,170,100,156,220,223,44,184,20,194,63,62,8,241,189,247,49,202,119,241,253,115,20,143,50,
+    205,36,10,6,181,193,115,94,60,135,81,65,250,244,232,129,209,24,134,243,177,127,87,101,86,235,203,195,252,221,251,255,
+    97,0,62,0,117,129,122,127,88,94,168,145,0,0,0,0,0,0,0,0,15,0,0,0,55,159,166,126,246,189,37,32,
+    0,0,196,229,0,0,0,1,12,4,124,0,111,12,204,254,143,164,230,42,55,31,243,125,238,148,118,48,187,239,73,151,
+    127,201,254,61,235,128,64,183,1,224,131,219,221,107,128,239,5,169,18,200,123,128,141,230,146,1,253,229,53,51,89,136,
+    0,0,96,99,0,0,0,0,0,0,0,3,0,0,0,0,126,146,242,61,70,233,128,240,192,239,101,47,8,253,239,127,
+    0,0,0,0,0,0,0,64,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,4,0,0,16,17,0,0,8,0,
+    238,1,0,0,82,77,180,220,62,163,163,24,0,4,128,178,0,0,0,0,208,230,187,7,169,19,144,195,0,33,152,162,
+    0,0,0,0,0,1,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
+    0,64,0,0,0,128,0,0,0,0,0,0,0,0,0,128,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,
+    243,129,5,248,56,75,2,253,0,64,198,34,0,0,0,0,0,16,0,0,0,0,32,0,0,0,16,0,0,0,0,0,
+    0,2,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,
+    0,44,111,57,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,
+    4,0,0,0,0,0,0,0,32,0,0,0,0,4,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+#endif // #ifndef GAME_PACKET_DICTIONARY_H
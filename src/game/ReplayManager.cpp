@@ -394,6 +394,8 @@ void ReplayManager::UpdatePlayback()
                 message.SerializeRead( stream );
 
                 srand( message.seed );
+
+                core::random_seed( message.seed );
             }
             break;
 
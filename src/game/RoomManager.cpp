@@ -0,0 +1,206 @@
+#include "RoomManager.h"
+
+extern "C" 
+{
+    extern void dRandSetSeed( unsigned int seed );
+}
+
+static void InitializeRoomThread( void * /*context*/ )
+{
+    cubes::Simulation::InitializeThread();
+}
+
+RoomManager::RoomManager( core::Allocator & allocator, const RoomConfig & config )
+{
+    CORE_ASSERT( config.num_rooms > 0 );
+    CORE_ASSERT( config.num_rooms <= MaxRooms );
+
+    m_allocator = &allocator;
+    m_config = config;
+    m_deltaTime = 0.0f;
+
+    m_rooms = CORE_NEW_ARRAY( allocator, Room, config.num_rooms );
+
+    for ( int i = 0; i < config.num_rooms; ++i )
+    {
+        m_rooms[i].game_instance = CreateCubesGameInstance( allocator );
+
+        // note: each room has a single player slot, so it is always the local player for view packet purposes
+
+        m_rooms[i].game_instance->SetLocalPlayer( 0 );
+
+        if ( config.bots )
+            m_rooms[i].game_instance->OnPlayerJoined( 0 );
+    }
+
+    // IMPORTANT: create the job system after the rooms so ode is initialized before the workers allocate their per-thread data
+
+    core::JobSystemConfig job_config;
+    job_config.num_threads = config.num_threads;
+    job_config.thread_start = InitializeRoomThread;
+
+    m_job_system = CORE_NEW( allocator, core::JobSystem, job_config );
+}
+
+RoomManager::~RoomManager()
+{
+    CORE_DELETE( *m_allocator, JobSystem, m_job_system );
+
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+        CORE_DELETE( *m_allocator, GameInstance, m_rooms[i].game_instance );
+
+    CORE_DELETE_ARRAY( *m_allocator, m_rooms, m_config.num_rooms );
+
+    m_job_system = nullptr;
+    m_rooms = nullptr;
+}
+
+int RoomManager::JoinRoom( int client_index )
+{
+    CORE_ASSERT( client_index >= 0 );
+    CORE_ASSERT( FindRoom( client_index ) == -1 );
+
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+    {
+        Room & room = m_rooms[i];
+
+        if ( room.client_index != -1 )
+            continue;
+
+        room.client_index = client_index;
+        room.input_frame = 0;
+        room.input = game::Input();
+
+        if ( !room.game_instance->IsPlayerJoined( 0 ) )
+            room.game_instance->OnPlayerJoined( 0 );
+
+        return i;
+    }
+
+    return -1;
+}
+
+void RoomManager::LeaveRoom( int client_index )
+{
+    const int room_index = FindRoom( client_index );
+    if ( room_index == -1 )
+        return;
+
+    Room & room = m_rooms[room_index];
+
+    room.client_index = -1;
+    room.input = game::Input();
+
+    // with bots on the room keeps its player so it stays busy
+
+    if ( !m_config.bots )
+    {
+        room.game_instance->OnPlayerLeft( 0 );
+        room.game_instance->SetLocalPlayer( 0 );
+    }
+}
+
+int RoomManager::FindRoom( int client_index ) const
+{
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+    {
+        if ( m_rooms[i].client_index == client_index )
+            return i;
+    }
+    return -1;
+}
+
+void RoomManager::SetInput( int client_index, uint32_t frame, const game::Input & input )
+{
+    const int room_index = FindRoom( client_index );
+    if ( room_index == -1 )
+        return;
+
+    Room & room = m_rooms[room_index];
+
+    if ( frame < room.input_frame )
+        return;
+
+    room.input_frame = frame;
+    room.input = input;
+}
+
+void RoomManager::Update( float deltaTime )
+{
+    m_deltaTime = deltaTime;
+
+    m_job_system->Run( UpdateRoomJob, this, m_config.num_rooms );
+}
+
+int RoomManager::GetNumPlayers() const
+{
+    int num_players = 0;
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+    {
+        if ( m_rooms[i].client_index != -1 )
+            num_players++;
+    }
+    return num_players;
+}
+
+int RoomManager::GetNumThreads() const
+{
+    return m_job_system->GetNumThreads();
+}
+
+const Room & RoomManager::GetRoom( int room_index ) const
+{
+    CORE_ASSERT( room_index >= 0 );
+    CORE_ASSERT( room_index < m_config.num_rooms );
+    return m_rooms[room_index];
+}
+
+void RoomManager::GetStats( RoomStats & stats ) const
+{
+    stats.Clear();
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+        stats.Merge( m_rooms[i].stats );
+}
+
+void RoomManager::ClearStats()
+{
+    for ( int i = 0; i < m_config.num_rooms; ++i )
+        m_rooms[i].stats.Clear();
+}
+
+void RoomManager::UpdateRoomJob( void * data, int index )
+{
+    RoomManager * room_manager = (RoomManager*) data;
+    room_manager->UpdateRoom( index );
+}
+
+void RoomManager::UpdateRoom( int room_index )
+{
+    Room & room = m_rooms[room_index];
+
+    const uint64_t start = core::nanoseconds();
+
+    if ( room.client_index == -1 && m_config.bots )
+    {
+        // roll around alternating push and pull so the room never settles
+
+        room.input = game::Input();
+        room.input.left = ( room.frame / 40 ) % 2 == 0;
+        room.input.up = true;
+        room.input.push = ( room.frame / 30 ) % 2 == 0;
+        room.input.pull = !room.input.push;
+    }
+
+    room.game_instance->SetPlayerInput( 0, room.input );
+
+    // note: the ode random seed is thread local, so this is safe with rooms stepping in parallel
+
+    if ( m_config.deterministic )
+        dRandSetSeed( room.frame );
+
+    room.game_instance->Update( m_deltaTime );
+
+    room.frame++;
+
+    room.stats.AddTick( core::nanoseconds() - start );
+}
@@ -0,0 +1,124 @@
+#ifndef GAME_ROOM_MANAGER_H
+#define GAME_ROOM_MANAGER_H
+
+#include "Cubes.h"
+
+const int MaxRooms = 256;
+
+struct RoomConfig
+{
+    int num_rooms = 1;
+    int num_threads = -1;                   // worker threads used to step rooms. -1 means one per core.
+    bool bots = false;                      // rooms without a player are driven by canned input so they keep simulating. useful for load testing.
+    bool deterministic = true;              // seed the ode random number generator with the room frame each tick
+};
+
+struct RoomStats
+{
+    int ticks;
+    uint64_t total_time;                    // nanoseconds
+    uint64_t min_time;
+    uint64_t max_time;
+
+    RoomStats()
+    {
+        Clear();
+    }
+
+    void Clear()
+    {
+        ticks = 0;
+        total_time = 0;
+        min_time = 0;
+        max_time = 0;
+    }
+
+    void AddTick( uint64_t time )
+    {
+        if ( ticks == 0 || time < min_time )
+            min_time = time;
+        if ( time > max_time )
+            max_time = time;
+        total_time += time;
+        ticks++;
+    }
+
+    void Merge( const RoomStats & other )
+    {
+        if ( other.ticks == 0 )
+            return;
+        if ( ticks == 0 || other.min_time < min_time )
+            min_time = other.min_time;
+        if ( other.max_time > max_time )
+            max_time = other.max_time;
+        total_time += other.total_time;
+        ticks += other.ticks;
+    }
+
+    double GetAverageMilliseconds() const
+    {
+        return ticks ? total_time / 1000000.0 / ticks : 0.0;
+    }
+};
+
+struct Room
+{
+    GameInstance * game_instance = nullptr;
+    uint32_t frame = 0;
+    int client_index = -1;                  // client driving this room, -1 if nobody is in it
+    uint32_t input_frame = 0;
+    game::Input input;
+    RoomStats stats;
+};
+
+class RoomManager
+{
+public:
+
+    RoomManager( core::Allocator & allocator, const RoomConfig & config );
+
+    ~RoomManager();
+
+    int JoinRoom( int client_index );
+
+    void LeaveRoom( int client_index );
+
+    int FindRoom( int client_index ) const;
+
+    void SetInput( int client_index, uint32_t frame, const game::Input & input );
+
+    void Update( float deltaTime );
+
+    int GetNumRooms() const { return m_config.num_rooms; }
+
+    int GetNumPlayers() const;
+
+    int GetNumThreads() const;
+
+    const Room & GetRoom( int room_index ) const;
+
+    void GetStats( RoomStats & stats ) const;
+
+    void ClearStats();
+
+private:
+
+    static void UpdateRoomJob( void * data, int index );
+
+    void UpdateRoom( int room_index );
+
+    RoomManager( const RoomManager & other );
+    RoomManager & operator = ( const RoomManager & other );
+
+    core::Allocator * m_allocator;
+
+    RoomConfig m_config;
+
+    Room * m_rooms;
+
+    core::JobSystem * m_job_system;
+
+    float m_deltaTime;
+};
+
+#endif // #ifndef GAME_ROOM_MANAGER_H
@@ -9,10 +9,18 @@
 #include "protocol/Stream.h"
 #include "protocol/Object.h"
 #include "protocol/SequenceBuffer.h"
+#include "network/Compressor.h"
+#if defined( VECTORIAL_SSE )
+#include <emmintrin.h>
+#endif // #if defined( VECTORIAL_SSE )
 
 #define DELTA_STATS 1
 #define DELTA_DATA 1
 //#define SERIALIZE_ANGULAR_VELOCITY
+//#define PACKET_COMPRESSION 1
+//#define PACKET_SAMPLES 1
+//#define STATIC_DELTA_TABLES 1
+//#define ENTROPY_CODED_SNAPSHOTS 1
 
 static const int NumCubes = 900 + MaxPlayers;
 
@@ -1098,6 +1106,262 @@ struct QuantizedSnapshot_HighPrecision
     QuantizedCubeState_HighPrecision cubes[NumCubes];
 };
 
+/*
+    Batch quantization of cube state.
+
+    These produce exactly the same results as calling QuantizedCubeState::Load/Save on each cube, 
+    but work on four cubes at a time: the cubes are transposed into structure of arrays form in
+    simd4f registers, and the largest component selection for smallest three is done with masks 
+    instead of branches. Every floating point operation is done in the same order as the scalar 
+    code, so the output is bit-exact.
+
+    The SIMD path needs SSE compares and masks, which simd4f doesn't expose, so other 
+    platforms fall back to the scalar code.
+*/
+
+#if defined( VECTORIAL_SSE )
+
+inline __m128i snapshot_floor_to_int( simd4f value )
+{
+    // SSE2 has no floor instruction. truncate then step down one for negative non-integers
+
+    const __m128i truncated = _mm_cvttps_epi32( value );
+    const simd4f too_large = _mm_cmpgt_ps( _mm_cvtepi32_ps( truncated ), value );
+    return _mm_add_epi32( truncated, _mm_castps_si128( too_large ) );
+}
+
+inline __m128i snapshot_lanes( int32_t a, int32_t b, int32_t c, int32_t d )
+{
+    return _mm_unpacklo_epi64( _mm_unpacklo_epi32( _mm_cvtsi32_si128( a ), _mm_cvtsi32_si128( b ) ),
+                               _mm_unpacklo_epi32( _mm_cvtsi32_si128( c ), _mm_cvtsi32_si128( d ) ) );
+}
+
+inline simd4f snapshot_select( simd4f mask, simd4f a, simd4f b )
+{
+    return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) );
+}
+
+inline void QuantizeCubeStates_SSE( const CubeState * cube_states, QuantizedCubeState * quantized_cubes )
+{
+    const float minimum = - 1.0f / 1.414214f;
+    const float maximum = + 1.0f / 1.414214f;
+
+    const simd4f units = simd4f_splat( float( UnitsPerMeter ) );
+    const simd4f half = simd4f_splat( 0.5f );
+    const simd4f zero = simd4f_zero();
+    const simd4f sign_bit = simd4f_splat( -0.0f );
+    const simd4f orientation_minimum = simd4f_splat( minimum );
+    const simd4f orientation_range = simd4f_splat( maximum - minimum );
+    const simd4f orientation_scale = simd4f_splat( float( ( 1 << OrientationBits ) - 1 ) );
+    const __m128i orientation_mask = _mm_set1_epi32( ( 1 << OrientationBits ) - 1 );
+
+    // position
+
+    simd4f px = cube_states[0].position.value;
+    simd4f py = cube_states[1].position.value;
+    simd4f pz = cube_states[2].position.value;
+    simd4f pw = cube_states[3].position.value;
+
+    _MM_TRANSPOSE4_PS( px, py, pz, pw );
+
+    int32_t position_x[4], position_y[4], position_z[4];
+    _mm_storeu_si128( (__m128i*) position_x, snapshot_floor_to_int( simd4f_add( simd4f_mul( px, units ), half ) ) );
+    _mm_storeu_si128( (__m128i*) position_y, snapshot_floor_to_int( simd4f_add( simd4f_mul( py, units ), half ) ) );
+    _mm_storeu_si128( (__m128i*) position_z, snapshot_floor_to_int( simd4f_add( simd4f_mul( pz, units ), half ) ) );
+
+    // orientation: select the largest absolute component. ties go to the first component, same as the scalar code
+
+    simd4f x = cube_states[0].orientation.value;
+    simd4f y = cube_states[1].orientation.value;
+    simd4f z = cube_states[2].orientation.value;
+    simd4f w = cube_states[3].orientation.value;
+
+    _MM_TRANSPOSE4_PS( x, y, z, w );
+
+    const simd4f abs_x = _mm_andnot_ps( sign_bit, x );
+    const simd4f abs_y = _mm_andnot_ps( sign_bit, y );
+    const simd4f abs_z = _mm_andnot_ps( sign_bit, z );
+    const simd4f abs_w = _mm_andnot_ps( sign_bit, w );
+
+    const simd4f largest_value = _mm_max_ps( _mm_max_ps( abs_x, abs_y ), _mm_max_ps( abs_z, abs_w ) );
+
+    const simd4f largest_x = _mm_cmpeq_ps( abs_x, largest_value );
+    const simd4f largest_y = _mm_andnot_ps( largest_x, _mm_cmpeq_ps( abs_y, largest_value ) );
+    const simd4f largest_xy = _mm_or_ps( largest_x, largest_y );
+    const simd4f largest_z = _mm_andnot_ps( largest_xy, _mm_cmpeq_ps( abs_z, largest_value ) );
+    const simd4f largest_w = _mm_andnot_ps( _mm_or_ps( largest_xy, largest_z ), _mm_cmpeq_ps( zero, zero ) );
+
+    const __m128i largest = _mm_or_si128( _mm_or_si128( _mm_and_si128( _mm_castps_si128( largest_y ), _mm_set1_epi32( 1 ) ),
+                                                        _mm_and_si128( _mm_castps_si128( largest_z ), _mm_set1_epi32( 2 ) ) ),
+                                                        _mm_and_si128( _mm_castps_si128( largest_w ), _mm_set1_epi32( 3 ) ) );
+
+    // the remaining three components, negated if the largest component is negative
+
+    const simd4f largest_component = _mm_or_ps( _mm_or_ps( _mm_and_ps( largest_x, x ), _mm_and_ps( largest_y, y ) ),
+                                                _mm_or_ps( _mm_and_ps( largest_z, z ), _mm_and_ps( largest_w, w ) ) );
+
+    const simd4f negate = _mm_and_ps( _mm_cmplt_ps( largest_component, zero ), sign_bit );
+
+    const simd4f a = _mm_xor_ps( snapshot_select( largest_x, y, x ), negate );
+    const simd4f b = _mm_xor_ps( snapshot_select( largest_xy, z, y ), negate );
+    const simd4f c = _mm_xor_ps( snapshot_select( largest_w, z, w ), negate );
+
+    const simd4f normal_a = simd4f_div( simd4f_sub( a, orientation_minimum ), orientation_range );
+    const simd4f normal_b = simd4f_div( simd4f_sub( b, orientation_minimum ), orientation_range );
+    const simd4f normal_c = simd4f_div( simd4f_sub( c, orientation_minimum ), orientation_range );
+
+    int32_t largest_index[4], integer_a[4], integer_b[4], integer_c[4];
+    _mm_storeu_si128( (__m128i*) largest_index, largest );
+    _mm_storeu_si128( (__m128i*) integer_a, _mm_and_si128( snapshot_floor_to_int( simd4f_add( simd4f_mul( normal_a, orientation_scale ), half ) ), orientation_mask ) );
+    _mm_storeu_si128( (__m128i*) integer_b, _mm_and_si128( snapshot_floor_to_int( simd4f_add( simd4f_mul( normal_b, orientation_scale ), half ) ), orientation_mask ) );
+    _mm_storeu_si128( (__m128i*) integer_c, _mm_and_si128( snapshot_floor_to_int( simd4f_add( simd4f_mul( normal_c, orientation_scale ), half ) ), orientation_mask ) );
+
+    for ( int j = 0; j < 4; ++j )
+    {
+        QuantizedCubeState & quantized = quantized_cubes[j];
+        quantized.interacting = cube_states[j].interacting;
+        quantized.position_x = position_x[j];
+        quantized.position_y = position_y[j];
+        quantized.position_z = position_z[j];
+        quantized.orientation.largest = largest_index[j];
+        quantized.orientation.integer_a = integer_a[j];
+        quantized.orientation.integer_b = integer_b[j];
+        quantized.orientation.integer_c = integer_c[j];
+#if defined( DELTA_STATS ) || defined( DELTA_DATA )
+        quantized.original_position = cube_states[j].position;
+        quantized.original_orientation = cube_states[j].orientation;
+#endif // #if defined( DELTA_STATS ) || defined( DELTA_DATA )
+    }
+}
+
+inline void DequantizeCubeStates_SSE( const QuantizedCubeState * quantized_cubes, CubeState * cube_states )
+{
+    const float minimum = - 1.0f / 1.414214f;
+    const float maximum = + 1.0f / 1.414214f;
+    const float scale = float( ( 1 << OrientationBits ) - 1 );
+
+    const simd4f units = simd4f_splat( float( UnitsPerMeter ) );
+    const simd4f one = simd4f_splat( 1.0f );
+    const simd4f orientation_minimum = simd4f_splat( minimum );
+    const simd4f orientation_range = simd4f_splat( maximum - minimum );
+    const simd4f inverse_scale = simd4f_splat( 1.0f / scale );
+
+    // unpack the bitfields to integer lanes
+
+    const QuantizedCubeState & q0 = quantized_cubes[0];
+    const QuantizedCubeState & q1 = quantized_cubes[1];
+    const QuantizedCubeState & q2 = quantized_cubes[2];
+    const QuantizedCubeState & q3 = quantized_cubes[3];
+
+    const compressed_quaternion<OrientationBits> o0 = q0.orientation;
+    const compressed_quaternion<OrientationBits> o1 = q1.orientation;
+    const compressed_quaternion<OrientationBits> o2 = q2.orientation;
+    const compressed_quaternion<OrientationBits> o3 = q3.orientation;
+
+    const __m128i position_x = snapshot_lanes( q0.position_x, q1.position_x, q2.position_x, q3.position_x );
+    const __m128i position_y = snapshot_lanes( q0.position_y, q1.position_y, q2.position_y, q3.position_y );
+    const __m128i position_z = snapshot_lanes( q0.position_z, q1.position_z, q2.position_z, q3.position_z );
+    const __m128i largest = snapshot_lanes( o0.largest, o1.largest, o2.largest, o3.largest );
+    const __m128i integer_a_values = snapshot_lanes( o0.integer_a, o1.integer_a, o2.integer_a, o3.integer_a );
+    const __m128i integer_b_values = snapshot_lanes( o0.integer_b, o1.integer_b, o2.integer_b, o3.integer_b );
+    const __m128i integer_c_values = snapshot_lanes( o0.integer_c, o1.integer_c, o2.integer_c, o3.integer_c );
+
+    // position
+
+    simd4f px = simd4f_div( _mm_cvtepi32_ps( position_x ), units );
+    simd4f py = simd4f_div( _mm_cvtepi32_ps( position_y ), units );
+    simd4f pz = simd4f_div( _mm_cvtepi32_ps( position_z ), units );
+    simd4f pw = simd4f_zero();
+
+    _MM_TRANSPOSE4_PS( px, py, pz, pw );
+
+    // orientation: reconstruct the largest component and put it back in its slot without branches
+
+    const simd4f largest_x = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 0 ) ) );
+    const simd4f largest_y = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 1 ) ) );
+    const simd4f largest_z = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 2 ) ) );
+    const simd4f largest_w = _mm_castsi128_ps( _mm_cmpeq_epi32( largest, _mm_set1_epi32( 3 ) ) );
+
+    const simd4f integer_a = _mm_cvtepi32_ps( integer_a_values );
+    const simd4f integer_b = _mm_cvtepi32_ps( integer_b_values );
+    const simd4f integer_c = _mm_cvtepi32_ps( integer_c_values );
+
+    const simd4f a = simd4f_add( simd4f_mul( simd4f_mul( integer_a, inverse_scale ), orientation_range ), orientation_minimum );
+    const simd4f b = simd4f_add( simd4f_mul( simd4f_mul( integer_b, inverse_scale ), orientation_range ), orientation_minimum );
+    const simd4f c = simd4f_add( simd4f_mul( simd4f_mul( integer_c, inverse_scale ), orientation_range ), orientation_minimum );
+
+    const simd4f r = simd4f_sqrt( simd4f_sub( simd4f_sub( simd4f_sub( one, simd4f_mul( a, a ) ), simd4f_mul( b, b ) ), simd4f_mul( c, c ) ) );
+
+    simd4f x = snapshot_select( largest_x, r, a );
+    simd4f y = snapshot_select( largest_x, a, snapshot_select( largest_y, r, b ) );
+    simd4f z = snapshot_select( _mm_or_ps( largest_x, largest_y ), b, snapshot_select( largest_z, r, c ) );
+    simd4f w = snapshot_select( largest_w, r, c );
+
+    // normalize with the same operation order as simd4f_normalize4
+
+    const simd4f length_squared = simd4f_add( simd4f_add( simd4f_add( simd4f_mul( x, x ), simd4f_mul( y, y ) ), simd4f_mul( z, z ) ), simd4f_mul( w, w ) );
+    const simd4f inverse_length = simd4f_rsqrt( length_squared );
+
+    x = simd4f_mul( x, inverse_length );
+    y = simd4f_mul( y, inverse_length );
+    z = simd4f_mul( z, inverse_length );
+    w = simd4f_mul( w, inverse_length );
+
+    _MM_TRANSPOSE4_PS( x, y, z, w );
+
+    cube_states[0].position.value = px;
+    cube_states[1].position.value = py;
+    cube_states[2].position.value = pz;
+    cube_states[3].position.value = pw;
+
+    cube_states[0].orientation.value = x;
+    cube_states[1].orientation.value = y;
+    cube_states[2].orientation.value = z;
+    cube_states[3].orientation.value = w;
+
+    for ( int j = 0; j < 4; ++j )
+    {
+        cube_states[j].interacting = quantized_cubes[j].interacting;
+        cube_states[j].linear_velocity = vectorial::vec3f( 0, 0, 0 );
+    }
+}
+
+#endif // #if defined( VECTORIAL_SSE )
+
+inline void QuantizeCubeStates( const CubeState * cube_states, QuantizedCubeState * quantized_cubes, int count )
+{
+    CORE_ASSERT( cube_states );
+    CORE_ASSERT( quantized_cubes );
+    CORE_ASSERT( count >= 0 );
+
+    int i = 0;
+
+#if defined( VECTORIAL_SSE )
+    for ( ; i + 4 <= count; i += 4 )
+        QuantizeCubeStates_SSE( cube_states + i, quantized_cubes + i );
+#endif // #if defined( VECTORIAL_SSE )
+
+    for ( ; i < count; ++i )
+        quantized_cubes[i].Load( cube_states[i] );
+}
+
+inline void DequantizeCubeStates( const QuantizedCubeState * quantized_cubes, CubeState * cube_states, int count )
+{
+    CORE_ASSERT( quantized_cubes );
+    CORE_ASSERT( cube_states );
+    CORE_ASSERT( count >= 0 );
+
+    int i = 0;
+
+#if defined( VECTORIAL_SSE )
+    for ( ; i + 4 <= count; i += 4 )
+        DequantizeCubeStates_SSE( quantized_cubes + i, cube_states + i );
+#endif // #if defined( VECTORIAL_SSE )
+
+    for ( ; i < count; ++i )
+        quantized_cubes[i].Save( cube_states[i] );
+}
+
 static void InterpolateSnapshot_Linear( float t, 
                                         const __restrict CubeState * a, 
                                         const __restrict CubeState * b, 
@@ -1209,20 +1473,13 @@ inline bool GetSnapshot( GameInstance * game_instance, Snapshot & snapshot )
         CORE_ASSERT( index >= 0 );
         CORE_ASSERT( index < NumCubes );
 
-        snapshot.cubes[index].position = vectorial::vec3f( object.position.x, object.position.y, object.position.z );
+        snapshot.cubes[index].position = math::to_vec3f( object.position );
 
-        snapshot.cubes[index].orientation = vectorial::quat4f( object.orientation.x, 
-                                                               object.orientation.y, 
-                                                               object.orientation.z,
-                                                               object.orientation.w );
+        snapshot.cubes[index].orientation = math::to_quat4f( object.orientation );
 
-        snapshot.cubes[index].linear_velocity = vectorial::vec3f( object.linearVelocity.x, 
-                                                                  object.linearVelocity.y,
-                                                                  object.linearVelocity.z );
+        snapshot.cubes[index].linear_velocity = math::to_vec3f( object.linearVelocity );
 
-        snapshot.cubes[index].angular_velocity = vectorial::vec3f( object.angularVelocity.x, 
-                                                                   object.angularVelocity.y,
-                                                                   object.angularVelocity.z );
+        snapshot.cubes[index].angular_velocity = math::to_vec3f( object.angularVelocity );
 
         snapshot.cubes[index].interacting = object.authority == 0;
     }
@@ -1241,35 +1498,42 @@ inline bool GetQuantizedSnapshot( GameInstance * game_instance, QuantizedSnapsho
 
     CORE_ASSERT( active_objects );
 
-    for ( int i = 0; i < num_active_objects; ++i )
+    // gather active objects in batches so they can be quantized four at a time
+
+    const int BatchSize = 64;
+
+    CubeState cube_states[BatchSize];
+    QuantizedCubeState quantized_cubes[BatchSize];
+    int indices[BatchSize];
+
+    for ( int batch_start = 0; batch_start < num_active_objects; batch_start += BatchSize )
     {
-        auto & object = active_objects[i];
+        const int batch_count = core::min( BatchSize, num_active_objects - batch_start );
 
-        const int index = object.id - 1;
+        for ( int j = 0; j < batch_count; ++j )
+        {
+            auto & object = active_objects[batch_start + j];
 
-        CORE_ASSERT( index >= 0 );
-        CORE_ASSERT( index < NumCubes );
+            const int index = object.id - 1;
 
-        CubeState cube_state;
+            CORE_ASSERT( index >= 0 );
+            CORE_ASSERT( index < NumCubes );
 
-        cube_state.position = vectorial::vec3f( object.position.x, object.position.y, object.position.z );
+            indices[j] = index;
 
-        cube_state.orientation = vectorial::quat4f( object.orientation.x, 
-                                                    object.orientation.y, 
-                                                    object.orientation.z,
-                                                    object.orientation.w );
+            CubeState & cube_state = cube_states[j];
 
-        cube_state.linear_velocity = vectorial::vec3f( object.linearVelocity.x, 
-                                                       object.linearVelocity.y,
-                                                       object.linearVelocity.z );
+            cube_state.position = math::to_vec3f( object.position );
 
-        cube_state.angular_velocity = vectorial::vec3f( object.angularVelocity.x, 
-                                                        object.angularVelocity.y,
-                                                        object.angularVelocity.z );
+            cube_state.orientation = math::to_quat4f( object.orientation );
 
-        cube_state.interacting = object.authority == 0;
+            cube_state.interacting = object.authority == 0;
+        }
 
-        snapshot.cubes[index].Load( cube_state );
+        QuantizeCubeStates( cube_states, quantized_cubes, batch_count );
+
+        for ( int j = 0; j < batch_count; ++j )
+            snapshot.cubes[indices[j]] = quantized_cubes[j];
     }
 
     return true;
@@ -1297,20 +1561,13 @@ inline bool GetQuantizedSnapshotWithVelocity( GameInstance * game_instance, Quan
 
         CubeState cube_state;
 
-        cube_state.position = vectorial::vec3f( object.position.x, object.position.y, object.position.z );
+        cube_state.position = math::to_vec3f( object.position );
 
-        cube_state.orientation = vectorial::quat4f( object.orientation.x, 
-                                                    object.orientation.y, 
-                                                    object.orientation.z,
-                                                    object.orientation.w );
+        cube_state.orientation = math::to_quat4f( object.orientation );
 
-        cube_state.linear_velocity = vectorial::vec3f( object.linearVelocity.x, 
-                                                       object.linearVelocity.y,
-                                                       object.linearVelocity.z );
+        cube_state.linear_velocity = math::to_vec3f( object.linearVelocity );
 
-        cube_state.angular_velocity = vectorial::vec3f( object.angularVelocity.x, 
-                                                        object.angularVelocity.y,
-                                                        object.angularVelocity.z );
+        cube_state.angular_velocity = math::to_vec3f( object.angularVelocity );
 
         cube_state.interacting = object.authority == 0;
 
@@ -1342,20 +1599,13 @@ inline bool GetQuantizedSnapshot_HighPrecision( GameInstance * game_instance, Qu
 
         CubeState cube_state;
 
-        cube_state.position = vectorial::vec3f( object.position.x, object.position.y, object.position.z );
+        cube_state.position = math::to_vec3f( object.position );
 
-        cube_state.orientation = vectorial::quat4f( object.orientation.x, 
-                                                    object.orientation.y, 
-                                                    object.orientation.z,
-                                                    object.orientation.w );
+        cube_state.orientation = math::to_quat4f( object.orientation );
 
-        cube_state.linear_velocity = vectorial::vec3f( object.linearVelocity.x, 
-                                                       object.linearVelocity.y,
-                                                       object.linearVelocity.z );
+        cube_state.linear_velocity = math::to_vec3f( object.linearVelocity );
 
-        cube_state.angular_velocity = vectorial::vec3f( object.angularVelocity.x, 
-                                                        object.angularVelocity.y,
-                                                        object.angularVelocity.z );
+        cube_state.angular_velocity = math::to_vec3f( object.angularVelocity );
 
         cube_state.interacting = object.authority == 0;
 
@@ -1378,7 +1628,7 @@ struct SnapshotInterpolationBuffer
 
     void AddSnapshot( double time, uint16_t sequence, const CubeState * cube_state )
     {
-        CORE_ASSERT( cube_state > 0 );
+        CORE_ASSERT( cube_state );
 
         if ( stopped )
         {
@@ -1540,4 +1790,50 @@ struct SnapshotInterpolationBuffer
     protocol::SequenceBuffer<Snapshot> snapshots;
 };
 
+inline void GetCompressionString( const network::PacketCompressor & compressor, char * string, int size )
+{
+    // bytes saved vs. CPU spent, averaged over every packet since the last reset
+
+    const uint64_t packets = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_PACKETS_ENCODED );
+    const uint64_t bytes_before = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_BEFORE_ENCODE );
+    const uint64_t bytes_after = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_AFTER_ENCODE );
+    const uint64_t encode_nanoseconds = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_ENCODE_NANOSECONDS );
+    const uint64_t decode_nanoseconds = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_DECODE_NANOSECONDS );
+
+    if ( packets == 0 || bytes_after == 0 )
+    {
+        snprintf( string, size, "LZ: no packets" );
+        return;
+    }
+
+    snprintf( string, size, "LZ: %.2f:1 (encode %.1fus, decode %.1fus per-packet)", 
+        bytes_before / double( bytes_after ),
+        encode_nanoseconds / 1000.0 / packets,
+        decode_nanoseconds / 1000.0 / packets );
+}
+
+#if PACKET_SAMPLES
+
+inline void WritePacketSample( FILE * file, protocol::Object * packet, const void ** context, int max_packet_size )
+{
+    // append the packet as the compressor will see it, for training dictionaries with tools/PacketDictionary
+
+    if ( !file )
+        return;
+
+    uint8_t * buffer = (uint8_t*) alloca( max_packet_size );
+
+    protocol::WriteStream stream( buffer, max_packet_size );
+    stream.SetContext( context );
+    packet->SerializeWrite( stream );
+    const int bytes = stream.GetBytesProcessed();
+    stream.Flush();
+
+    const uint8_t header[4] = { uint8_t( bytes ), uint8_t( bytes >> 8 ), uint8_t( bytes >> 16 ), uint8_t( bytes >> 24 ) };
+    fwrite( header, sizeof( header ), 1, file );
+    fwrite( buffer, bytes, 1, file );
+}
+
+#endif // #if PACKET_SAMPLES
+
 #endif // #ifndef GAME_SNAPSHOT_H
@@ -281,21 +281,14 @@ void SnapshotDemo::Update()
                 CORE_ASSERT( index >= 0 );
                 CORE_ASSERT( index < NumCubes );
 
-                snapshot_packet->cubes[index].position = vectorial::vec3f( object.position.x, object.position.y, object.position.z );
+                snapshot_packet->cubes[index].position = math::to_vec3f( object.position );
 
-                snapshot_packet->cubes[index].orientation = vectorial::quat4f( object.orientation.x, 
-                                                                               object.orientation.y, 
-                                                                               object.orientation.z,
-                                                                               object.orientation.w );
+                snapshot_packet->cubes[index].orientation = math::to_quat4f( object.orientation );
 
-                snapshot_packet->cubes[index].linear_velocity = vectorial::vec3f( object.linearVelocity.x, 
-                                                                                  object.linearVelocity.y,
-                                                                                  object.linearVelocity.z );
+                snapshot_packet->cubes[index].linear_velocity = math::to_vec3f( object.linearVelocity );
 
 #ifdef SERIALIZE_ANGULAR_VELOCITY
-                snapshot_packet->cubes[index].angular_velocity = vectorial::vec3f( object.angularVelocity.x, 
-                                                                                   object.angularVelocity.y,
-                                                                                   object.angularVelocity.z );
+                snapshot_packet->cubes[index].angular_velocity = math::to_vec3f( object.angularVelocity );
 #endif // #ifdef SERIALIZE_ANGULAR_VELOCITY
 
                 snapshot_packet->cubes[index].interacting = object.authority == 0;
@@ -14,6 +14,7 @@
 #include <algorithm>
 
 static const int MaxCubesPerPacket = 63;
+static const int MaxCubeBytes = 500;
 static const int NumStateUpdates = 256;
 static const int RightPort = 1001;
 
@@ -138,9 +139,34 @@ template <typename Stream> void serialize_cube_state_compressed( Stream & stream
     }
 }
 
+// the sender serializes the cubes that fit in the packet once, in priority order, while choosing them.
+// the packet keeps those bits and copies them into the packet stream instead of writing the cubes again
+
+struct CubeBits
+{
+    int num_bits = 0;
+    uint32_t data[MaxCubeBytes*2/4];
+};
+
+template <typename Stream> void serialize_cube_bits( Stream & stream, const CubeBits & cube_bits )
+{
+    protocol::BitReader reader( cube_bits.data, sizeof( cube_bits.data ) );
+
+    int bits = cube_bits.num_bits;
+
+    while ( bits > 0 )
+    {
+        const int n = bits < 32 ? bits : 32;
+        uint32_t value = reader.ReadBits( n );
+        stream.SerializeBits( value, n );
+        bits -= n;
+    }
+}
+
 struct StatePacketUncompressed : public protocol::Packet
 {
     StateUpdateUncompressed state_update;
+    CubeBits cube_bits;
 
     StatePacketUncompressed() : Packet( SYNC_STATE_PACKET_UNCOMPRESSED ) {}
 
@@ -157,9 +183,14 @@ struct StatePacketUncompressed : public protocol::Packet
 
         serialize_int( stream, state_update.num_cubes, 0, MaxCubesPerPacket );
 
-        for ( int i = 0; i < state_update.num_cubes; ++i )
+        if ( Stream::IsWriting )
         {
-            serialize_cube_state_uncompressed( stream, state_update.cube_index[i], state_update.cube_state[i] );
+            serialize_cube_bits( stream, cube_bits );
+        }
+        else
+        {
+            for ( int i = 0; i < state_update.num_cubes; ++i )
+                serialize_cube_state_uncompressed( stream, state_update.cube_index[i], state_update.cube_state[i] );
         }
     }
 };
@@ -167,6 +198,7 @@ struct StatePacketUncompressed : public protocol::Packet
 struct StatePacketCompressed : public protocol::Packet
 {
     StateUpdateCompressed state_update;
+    CubeBits cube_bits;
 
     StatePacketCompressed() : Packet( SYNC_STATE_PACKET_COMPRESSED ) {}
 
@@ -183,9 +215,14 @@ struct StatePacketCompressed : public protocol::Packet
 
         serialize_int( stream, state_update.num_cubes, 0, MaxCubesPerPacket );
 
-        for ( int i = 0; i < state_update.num_cubes; ++i )
+        if ( Stream::IsWriting )
+        {
+            serialize_cube_bits( stream, cube_bits );
+        }
+        else
         {
-            serialize_cube_state_compressed( stream, state_update.cube_index[i], state_update.cube_state[i] );
+            for ( int i = 0; i < state_update.num_cubes; ++i )
+                serialize_cube_state_compressed( stream, state_update.cube_index[i], state_update.cube_state[i] );
         }
     }
 };
@@ -454,10 +491,10 @@ void ApplySnapshot( GameInstance & game_instance, QuantizedSnapshot_HighPrecisio
             CubeState cube;
             snapshot.cubes[i].Save( cube );
 
-            active_object->position = math::Vector( cube.position.x(), cube.position.y(), cube.position.z() );
-            active_object->orientation = math::Quaternion( cube.orientation.w(), cube.orientation.x(), cube.orientation.y(), cube.orientation.z() );
-            active_object->linearVelocity = math::Vector( cube.linear_velocity.x(), cube.linear_velocity.y(), cube.linear_velocity.z() );
-            active_object->angularVelocity = math::Vector( cube.angular_velocity.x(), cube.angular_velocity.y(), cube.angular_velocity.z() );
+            active_object->position = math::to_vector( cube.position );
+            active_object->orientation = math::to_quaternion( cube.orientation );
+            active_object->linearVelocity = math::to_vector( cube.linear_velocity );
+            active_object->angularVelocity = math::to_vector( cube.angular_velocity );
 
             game_instance.MoveActiveObject( active_object );
         }
@@ -486,10 +523,10 @@ void ApplyStateUpdateUncompressed( GameInstance & game_instance, const StateUpda
 
             orientation_error[id] = vectorial::conjugate( new_orientation ) * ( old_orientation * orientation_error[id] );
 
-            active_object->position = math::Vector( cube.position.x(), cube.position.y(), cube.position.z() );
-            active_object->orientation = math::Quaternion( cube.orientation.w(), cube.orientation.x(), cube.orientation.y(), cube.orientation.z() );
-            active_object->linearVelocity = math::Vector( cube.linear_velocity.x(), cube.linear_velocity.y(), cube.linear_velocity.z() );
-            active_object->angularVelocity = math::Vector( cube.angular_velocity.x(), cube.angular_velocity.y(), cube.angular_velocity.z() );
+            active_object->position = math::to_vector( cube.position );
+            active_object->orientation = math::to_quaternion( cube.orientation );
+            active_object->linearVelocity = math::to_vector( cube.linear_velocity );
+            active_object->angularVelocity = math::to_vector( cube.angular_velocity );
             active_object->authority = cube.interacting ? 0 : MaxPlayers;
             active_object->enabled = !cube.AtRest();
 
@@ -522,10 +559,10 @@ void ApplyStateUpdateCompressed( GameInstance & game_instance, const StateUpdate
 
             orientation_error[id] = vectorial::conjugate( new_orientation ) * ( old_orientation * orientation_error[id] );
 
-            active_object->position = math::Vector( cube.position.x(), cube.position.y(), cube.position.z() );
-            active_object->orientation = math::Quaternion( cube.orientation.w(), cube.orientation.x(), cube.orientation.y(), cube.orientation.z() );
-            active_object->linearVelocity = math::Vector( cube.linear_velocity.x(), cube.linear_velocity.y(), cube.linear_velocity.z() );
-            active_object->angularVelocity = math::Vector( cube.angular_velocity.x(), cube.angular_velocity.y(), cube.angular_velocity.z() );
+            active_object->position = math::to_vector( cube.position );
+            active_object->orientation = math::to_quaternion( cube.orientation );
+            active_object->linearVelocity = math::to_vector( cube.linear_velocity );
+            active_object->angularVelocity = math::to_vector( cube.angular_velocity );
             active_object->authority = cube.interacting ? 0 : MaxPlayers;
             active_object->enabled = !state_update.cube_state[i].AtRest();
 
@@ -570,7 +607,7 @@ void CalculateCubePriorities_Compressed( float * priority, QuantizedSnapshot_Hig
     }
 }
 
-bool priority_sort_function( const CubePriorityInfo & a, const CubePriorityInfo & b ) { return a.accum > b.accum; }
+bool priority_sort_function( const CubePriorityInfo & a, const CubePriorityInfo & b ) { return a.accum > b.accum || ( a.accum == b.accum && a.index < b.index ); }
 
 struct SendCubeInfo
 {
@@ -578,52 +615,73 @@ struct SendCubeInfo
     bool send;
 };
 
-void MeasureCubesToSend_Uncompressed( Snapshot & snapshot, SendCubeInfo * send_cubes, int max_bytes )
+// cubes are serialized in priority order straight into the packet's cube bits, which have room for the
+// budget plus one cube. a cube that takes the packet over budget is rolled back and the next one is tried
+
+void WriteCubesToSend_Uncompressed( Snapshot & snapshot, SendCubeInfo * send_cubes, CubeBits & cube_bits )
 {
-    const int max_bits = max_bytes * 8;
+    const int max_bits = MaxCubeBytes * 8;
 
-    int bits = 0;
+    protocol::WriteStream stream( (uint8_t*) cube_bits.data, sizeof( cube_bits.data ) );
 
     for ( int i = 0; i < MaxCubesPerPacket; ++i )
     {
-        protocol::MeasureStream stream( max_bytes * 2 );
+        const protocol::WriteStream::Checkpoint checkpoint = stream.GetCheckpoint();
 
         int id = send_cubes[i].index;
 
         serialize_cube_state_uncompressed( stream, id, snapshot.cubes[id] );
 
-        const int bits_processed = stream.GetBitsProcessed();
-
-        if ( bits + bits_processed < max_bits )
-        {
+        if ( stream.GetBitsProcessed() < max_bits )
             send_cubes[i].send = true;
-            bits += bits_processed;
-        }
+        else
+            stream.Rollback( checkpoint );
     }
+
+    cube_bits.num_bits = stream.GetBitsProcessed();
+
+    stream.Flush();
 }
 
-void MeasureCubesToSend_Compressed( QuantizedSnapshot_HighPrecision & snapshot, SendCubeInfo * send_cubes, int max_bytes )
+void WriteCubesToSend_Compressed( QuantizedSnapshot_HighPrecision & snapshot, SendCubeInfo * send_cubes, CubeBits & cube_bits )
 {
-    const int max_bits = max_bytes * 8;
+    const int max_bits = MaxCubeBytes * 8;
 
-    int bits = 0;
+    protocol::WriteStream stream( (uint8_t*) cube_bits.data, sizeof( cube_bits.data ) );
 
     for ( int i = 0; i < MaxCubesPerPacket; ++i )
     {
-        protocol::MeasureStream stream( max_bytes * 2 );
+        const protocol::WriteStream::Checkpoint checkpoint = stream.GetCheckpoint();
 
         int id = send_cubes[i].index;
 
         serialize_cube_state_compressed( stream, id, snapshot.cubes[id] );
 
-        const int bits_processed = stream.GetBitsProcessed();
+        if ( stream.GetBitsProcessed() < max_bits )
+            send_cubes[i].send = true;
+        else
+            stream.Rollback( checkpoint );
+    }
+
+    cube_bits.num_bits = stream.GetBitsProcessed();
+
+    stream.Flush();
+}
+
+int ResetPriorityOfSentCubes( const SendCubeInfo * send_cubes, CubePriorityInfo * priority_info )
+{
+    int num_cubes_sent = 0;
 
-        if ( bits + bits_processed < max_bits )
+    for ( int i = 0; i < MaxCubesPerPacket; i++ )
+    {
+        if ( send_cubes[i].send )
         {
-            send_cubes[i].send = true;
-            bits += bits_processed;
+            priority_info[send_cubes[i].index].accum = 0.0;
+            num_cubes_sent++;
         }
     }
+
+    return num_cubes_sent;
 }
 
 void SyncDemo::Update()
@@ -677,7 +735,10 @@ void SyncDemo::Update()
 
     memcpy( priority_info, m_sync->priority_info, sizeof( CubePriorityInfo ) * NumCubes );
 
-    std::sort( priority_info, priority_info + NumCubes, priority_sort_function );
+    // only the cubes that can go in the packet need to be in order
+
+    std::nth_element( priority_info, priority_info + MaxCubesPerPacket, priority_info + NumCubes, priority_sort_function );
+    std::sort( priority_info, priority_info + MaxCubesPerPacket, priority_sort_function );
 
     SendCubeInfo send_cubes[MaxCubesPerPacket];
 
@@ -687,25 +748,7 @@ void SyncDemo::Update()
         send_cubes[i].send = false;
     }
 
-    const int MaxCubeBytes = 500;
-
-    if ( GetMode() == SYNC_MODE_UNCOMPRESSED )
-        MeasureCubesToSend_Uncompressed( left_snapshot_uncompressed, send_cubes, MaxCubeBytes );
-    else
-        MeasureCubesToSend_Compressed( left_snapshot_compressed, send_cubes, MaxCubeBytes );
-
-    int num_cubes_to_send = 0;
-
-    for ( int i = 0; i < MaxCubesPerPacket; i++ )
-    {
-        if ( send_cubes[i].send )
-        {
-            m_sync->priority_info[send_cubes[i].index].accum = 0.0;
-            num_cubes_to_send++;
-        }
-    }
-
-    // construct state packet containing cubes to be sent
+    // construct state packet and write the cubes that fit straight into it
 
     auto local_input = m_internal->GetLocalInput();
 
@@ -716,18 +759,9 @@ void SyncDemo::Update()
         state_packet->state_update.input = local_input;
         state_packet->state_update.sequence = m_sync->send_sequence;
 
-        state_packet->state_update.num_cubes = num_cubes_to_send;
-        int j = 0;    
-        for ( int i = 0; i < MaxCubesPerPacket; ++i )
-        {
-            if ( send_cubes[i].send )
-            {
-                state_packet->state_update.cube_index[j] = send_cubes[i].index;
-                state_packet->state_update.cube_state[j] = left_snapshot_uncompressed.cubes[ send_cubes[i].index ];
-                j++;
-            }
-        }
-        CORE_ASSERT( j == num_cubes_to_send );
+        WriteCubesToSend_Uncompressed( left_snapshot_uncompressed, send_cubes, state_packet->cube_bits );
+
+        state_packet->state_update.num_cubes = ResetPriorityOfSentCubes( send_cubes, m_sync->priority_info );
 
         m_sync->network_simulator->SendPacket( network::Address( "::1", RightPort ), state_packet );
 
@@ -740,18 +774,9 @@ void SyncDemo::Update()
         state_packet->state_update.input = local_input;
         state_packet->state_update.sequence = m_sync->send_sequence;
 
-        state_packet->state_update.num_cubes = num_cubes_to_send;
-        int j = 0;    
-        for ( int i = 0; i < MaxCubesPerPacket; ++i )
-        {
-            if ( send_cubes[i].send )
-            {
-                state_packet->state_update.cube_index[j] = send_cubes[i].index;
-                state_packet->state_update.cube_state[j] = left_snapshot_compressed.cubes[ send_cubes[i].index ];
-                j++;
-            }
-        }
-        CORE_ASSERT( j == num_cubes_to_send );
+        WriteCubesToSend_Compressed( left_snapshot_compressed, send_cubes, state_packet->cube_bits );
+
+        state_packet->state_update.num_cubes = ResetPriorityOfSentCubes( send_cubes, m_sync->priority_info );
 
         m_sync->network_simulator->SendPacket( network::Address( "::1", RightPort ), state_packet );
 
@@ -24,6 +24,7 @@
 
 #include "network/Network.h"
 #include "network/BSDSocket.h"
+#include "network/Compressor.h"
 #include "core/Config.h"
 #include "core/Memory.h"
 #include "core/Queue.h"
@@ -62,6 +63,8 @@
 
 namespace network
 {     
+    static const int ProtocolIdBytes = 8;
+
     BSDSocket::BSDSocket( const BSDSocketConfig & config )
         : m_config( config ), 
           m_send_queue( config.allocator ? *config.allocator : core::memory::default_allocator() ),
@@ -79,7 +82,17 @@ namespace network
         core::queue::reserve( m_send_queue, m_config.sendQueueSize );
         core::queue::reserve( m_receive_queue, m_config.receiveQueueSize );
 
-        m_receiveBuffer = (uint8_t*) m_allocator->Allocate( m_config.maxPacketSize );
+        // IMPORTANT: packets that don't compress go out raw behind a one byte header, so on the wire they can be a byte over the max packet size
+
+        m_maxWirePacketSize = m_config.compressor ? ProtocolIdBytes + PacketCompressor::GetMaxEncodedSize( m_config.maxPacketSize - ProtocolIdBytes ) : m_config.maxPacketSize;
+
+        m_receiveBuffer = (uint8_t*) m_allocator->Allocate( m_maxWirePacketSize );
+
+        m_decodeBuffer = m_config.compressor ? (uint8_t*) m_allocator->Allocate( m_config.maxPacketSize ) : nullptr;
+
+        m_encodeBuffer = m_config.compressor ? (uint8_t*) m_allocator->Allocate( m_maxWirePacketSize ) : nullptr;
+
+        memset( m_counters, 0, sizeof( m_counters ) );
 
         m_error = BSD_SOCKET_ERROR_NONE;
 
@@ -177,6 +190,18 @@ namespace network
             m_receiveBuffer = nullptr;
         }
 
+        if ( m_decodeBuffer )
+        {
+            m_allocator->Free( m_decodeBuffer );
+            m_decodeBuffer = nullptr;
+        }
+
+        if ( m_encodeBuffer )
+        {
+            m_allocator->Free( m_encodeBuffer );
+            m_encodeBuffer = nullptr;
+        }
+
         if ( m_socket != 0 )
         {
             #if CORE_PLATFORM == CORE_PLATFORM_MAC || CORE_PLATFORM == CORE_PLATFORM_UNIX
@@ -334,11 +359,30 @@ namespace network
                 continue;
             }
 
-            const int bytes = stream.GetBytesProcessed();
+            int bytes = stream.GetBytesProcessed();
             const uint8_t * data = stream.GetData();
 
-            CORE_ASSERT( bytes <= m_config.maxPacketSize );
-            if ( bytes > m_config.maxPacketSize )
+            if ( m_config.compressor )
+            {
+                // IMPORTANT: the protocol id stays uncompressed so it can be checked before decoding
+
+                uint8_t * encoded = m_encodeBuffer;
+
+                memcpy( encoded, data, ProtocolIdBytes );
+
+                const int encodedBytes = m_config.compressor->EncodePacket( data + ProtocolIdBytes, 
+                                                                            bytes - ProtocolIdBytes, 
+                                                                            encoded + ProtocolIdBytes, 
+                                                                            m_maxWirePacketSize - ProtocolIdBytes );
+
+                CORE_ASSERT( encodedBytes > 0 );
+
+                bytes = ProtocolIdBytes + encodedBytes;
+                data = encoded;
+            }
+
+            CORE_ASSERT( bytes <= m_maxWirePacketSize );
+            if ( bytes > m_maxWirePacketSize )
             {
                 m_counters[BSD_SOCKET_COUNTER_PACKET_TOO_LARGE_TO_SEND]++;
                 m_config.packetFactory->Destroy( packet );
@@ -359,13 +403,38 @@ namespace network
                 break;
 
             Address address;
-            int received_bytes = ReceivePacketInternal( address, m_receiveBuffer, m_config.maxPacketSize );
+            int received_bytes = ReceivePacketInternal( address, m_receiveBuffer, m_maxWirePacketSize );
             if ( !received_bytes )
                 break;
 
+            uint8_t * buffer = m_receiveBuffer;
+
+            if ( m_config.compressor )
+            {
+                if ( received_bytes <= ProtocolIdBytes )
+                {
+                    m_counters[BSD_SOCKET_COUNTER_DECODE_FAILURES]++;
+                    continue;
+                }
+
+                memcpy( m_decodeBuffer, m_receiveBuffer, ProtocolIdBytes );
+
+                const int decodedBytes = m_config.compressor->DecodePacket( m_receiveBuffer + ProtocolIdBytes,
+                                                                            received_bytes - ProtocolIdBytes,
+                                                                            m_decodeBuffer + ProtocolIdBytes,
+                                                                            m_config.maxPacketSize - ProtocolIdBytes );
+                if ( decodedBytes < 0 )
+                {
+                    m_counters[BSD_SOCKET_COUNTER_DECODE_FAILURES]++;
+                    continue;
+                }
+
+                buffer = m_decodeBuffer;
+            }
+
             typedef protocol::ReadStream Stream;
 
-            Stream stream( m_receiveBuffer, m_config.maxPacketSize );
+            Stream stream( buffer, m_config.maxPacketSize );
 
             stream.SetContext( m_context );
 
@@ -428,7 +497,7 @@ namespace network
         CORE_ASSERT( m_socket );
         CORE_ASSERT( address.IsValid() );
         CORE_ASSERT( bytes > 0 );
-        CORE_ASSERT( (int) bytes <= m_config.maxPacketSize );
+        CORE_ASSERT( (int) bytes <= m_maxWirePacketSize );
 
         bool result = false;
 
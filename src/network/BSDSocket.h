@@ -33,6 +33,9 @@ namespace core { class Allocator; }
 
 namespace network 
 {     
+    class PacketCompressor;
+
+
     struct BSDSocketConfig
     {
         BSDSocketConfig()
@@ -45,6 +48,7 @@ namespace network
             packetFactory = nullptr;
             sendQueueSize = 256;
             receiveQueueSize = 256;
+            compressor = nullptr;
         }
 
         core::Allocator * allocator;                // allocator for long term allocations matching object life cycle. if nullptr then the default allocator is used.
@@ -55,6 +59,7 @@ namespace network
         int sendQueueSize;                          // send queue size between "SendPacket" and sendto. additional sent packets will be dropped.
         int receiveQueueSize;                       // send queue size between "recvfrom" and "ReceivePacket" function. additional received packets will be dropped.
         protocol::PacketFactory * packetFactory;    // packet factory (required)
+        PacketCompressor * compressor;              // optional packet compressor. not owned. if set, everything after the protocol id is compressed. both sides must agree!
     };
 
     class BSDSocket : public Interface
@@ -106,7 +111,10 @@ namespace network
         BSDSocketError m_error;
         core::Queue<protocol::Packet*> m_send_queue;
         core::Queue<protocol::Packet*> m_receive_queue;
+        int m_maxWirePacketSize;
         uint8_t * m_receiveBuffer;
+        uint8_t * m_decodeBuffer;
+        uint8_t * m_encodeBuffer;
         const void ** m_context;
         uint64_t m_counters[BSD_SOCKET_COUNTER_NUM_COUNTERS];
 
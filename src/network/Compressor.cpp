@@ -0,0 +1,485 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "network/Compressor.h"
+#include "core/Memory.h"
+
+namespace network
+{
+    const int MinMatch = 4;
+    const int MaxOffset = 65535;
+    const int HashBits = 12;
+    const int HashSize = 1 << HashBits;
+    const uint32_t EmptyHashEntry = 0xFFFFFFFF;
+    const int MaxDictionarySize = MaxOffset;
+
+    static inline uint32_t read32( const uint8_t * p )
+    {
+        uint32_t value;
+        memcpy( &value, p, 4 );
+        return value;
+    }
+
+    static inline uint32_t hash32( uint32_t value )
+    {
+        return ( value * 2654435761U ) >> ( 32 - HashBits );
+    }
+
+    static inline int length_bytes( int length )
+    {
+        // number of extension bytes needed to encode a length in a 4 bit token field
+
+        return ( length >= 15 ) ? 1 + ( length - 15 ) / 255 : 0;
+    }
+
+    static inline uint8_t * write_length( uint8_t * p, int length )
+    {
+        CORE_ASSERT( length >= 15 );
+        length -= 15;
+        while ( length >= 255 )
+        {
+            *p++ = 255;
+            length -= 255;
+        }
+        *p++ = (uint8_t) length;
+        return p;
+    }
+
+    static inline bool read_length( const uint8_t * & p, const uint8_t * end, int & length )
+    {
+        while ( true )
+        {
+            if ( p >= end )
+                return false;
+            const uint8_t value = *p++;
+            length += value;
+            if ( value != 255 )
+                return true;
+        }
+    }
+
+    PacketCompressor::PacketCompressor( const PacketCompressorConfig & config )
+        : m_config( config )
+    {
+        CORE_ASSERT( m_config.maxPacketSize > 0 );
+        CORE_ASSERT( m_config.dictionarySize >= 0 );
+        CORE_ASSERT( m_config.dictionarySize == 0 || m_config.dictionary );
+
+        m_allocator = m_config.allocator ? m_config.allocator : &core::memory::default_allocator();
+
+        // IMPORTANT: only the tail of the dictionary is reachable by a 16 bit offset
+
+        m_dictionarySize = core::min( m_config.dictionarySize, MaxDictionarySize );
+
+        m_work = (uint8_t*) m_allocator->Allocate( m_dictionarySize + m_config.maxPacketSize );
+        m_hashTable = (uint32_t*) m_allocator->Allocate( HashSize * sizeof( uint32_t ) );
+        m_dictionaryHashTable = (uint32_t*) m_allocator->Allocate( HashSize * sizeof( uint32_t ) );
+
+        for ( int i = 0; i < HashSize; ++i )
+            m_dictionaryHashTable[i] = EmptyHashEntry;
+
+        if ( m_dictionarySize > 0 )
+        {
+            memcpy( m_work, m_config.dictionary + m_config.dictionarySize - m_dictionarySize, m_dictionarySize );
+
+            for ( int i = 0; i <= m_dictionarySize - MinMatch; ++i )
+                m_dictionaryHashTable[ hash32( read32( m_work + i ) ) ] = i;
+        }
+
+        ResetCounters();
+    }
+
+    PacketCompressor::~PacketCompressor()
+    {
+        CORE_ASSERT( m_allocator );
+        m_allocator->Free( m_work );
+        m_allocator->Free( m_hashTable );
+        m_allocator->Free( m_dictionaryHashTable );
+        m_work = nullptr;
+        m_hashTable = nullptr;
+        m_dictionaryHashTable = nullptr;
+    }
+
+    int PacketCompressor::EncodePacket( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes )
+    {
+        CORE_ASSERT( input );
+        CORE_ASSERT( output );
+        CORE_ASSERT( inputBytes > 0 );
+        CORE_ASSERT( inputBytes <= m_config.maxPacketSize );
+
+        if ( maxOutputBytes < 1 )
+            return 0;
+
+        const uint64_t start = core::nanoseconds();
+
+        // IMPORTANT: Limit the compressed size to one byte less than the input. 
+        // This way compression gives up as soon as it can't win and we fall back to raw.
+
+        int encodedBytes = 0;
+
+        const int compressedBytes = Compress( input, inputBytes, output + 1, core::min( inputBytes - 1, maxOutputBytes - 1 ) );
+
+        if ( compressedBytes > 0 )
+        {
+            output[0] = PACKET_ENCODING_LZ;
+            encodedBytes = compressedBytes + 1;
+            m_counters[PACKET_COMPRESSOR_COUNTER_PACKETS_COMPRESSED]++;
+        }
+        else if ( inputBytes + 1 <= maxOutputBytes )
+        {
+            output[0] = PACKET_ENCODING_RAW;
+            memcpy( output + 1, input, inputBytes );
+            encodedBytes = inputBytes + 1;
+            m_counters[PACKET_COMPRESSOR_COUNTER_PACKETS_SENT_RAW]++;
+        }
+
+        if ( encodedBytes )
+        {
+            m_counters[PACKET_COMPRESSOR_COUNTER_PACKETS_ENCODED]++;
+            m_counters[PACKET_COMPRESSOR_COUNTER_BYTES_BEFORE_ENCODE] += inputBytes;
+            m_counters[PACKET_COMPRESSOR_COUNTER_BYTES_AFTER_ENCODE] += encodedBytes;
+        }
+
+        m_counters[PACKET_COMPRESSOR_COUNTER_ENCODE_NANOSECONDS] += core::nanoseconds() - start;
+
+        return encodedBytes;
+    }
+
+    int PacketCompressor::DecodePacket( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes )
+    {
+        CORE_ASSERT( input );
+        CORE_ASSERT( output );
+
+        const uint64_t start = core::nanoseconds();
+
+        int decodedBytes = -1;
+
+        if ( inputBytes >= 1 )
+        {
+            switch ( input[0] )
+            {
+                case PACKET_ENCODING_RAW:
+                {
+                    if ( inputBytes - 1 <= maxOutputBytes )
+                    {
+                        memcpy( output, input + 1, inputBytes - 1 );
+                        decodedBytes = inputBytes - 1;
+                    }
+                }
+                break;
+
+                case PACKET_ENCODING_LZ:
+                    decodedBytes = Decompress( input + 1, inputBytes - 1, output, maxOutputBytes );
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        if ( decodedBytes >= 0 )
+            m_counters[PACKET_COMPRESSOR_COUNTER_PACKETS_DECODED]++;
+        else
+            m_counters[PACKET_COMPRESSOR_COUNTER_DECODE_FAILURES]++;
+
+        m_counters[PACKET_COMPRESSOR_COUNTER_DECODE_NANOSECONDS] += core::nanoseconds() - start;
+
+        return decodedBytes;
+    }
+
+    uint64_t PacketCompressor::GetCounter( int index ) const
+    {
+        CORE_ASSERT( index >= 0 );
+        CORE_ASSERT( index < PACKET_COMPRESSOR_COUNTER_NUM_COUNTERS );
+        return m_counters[index];
+    }
+
+    void PacketCompressor::ResetCounters()
+    {
+        memset( m_counters, 0, sizeof( m_counters ) );
+    }
+
+    int PacketCompressor::Compress( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes )
+    {
+        if ( maxOutputBytes <= 0 )
+            return 0;
+
+        // work buffer is [dictionary][input] so matches can reach back into the dictionary
+
+        uint8_t * base = m_work;
+        memcpy( base + m_dictionarySize, input, inputBytes );
+        memcpy( m_hashTable, m_dictionaryHashTable, HashSize * sizeof( uint32_t ) );
+
+        const int end = m_dictionarySize + inputBytes;
+        const int matchLimit = end - MinMatch;
+
+        uint8_t * op = output;
+        uint8_t * const outputEnd = output + maxOutputBytes;
+
+        int anchor = m_dictionarySize;
+        int ip = m_dictionarySize;
+
+        while ( ip <= matchLimit )
+        {
+            const uint32_t sequence = read32( base + ip );
+            const uint32_t hash = hash32( sequence );
+            const uint32_t ref = m_hashTable[hash];
+            m_hashTable[hash] = ip;
+
+            if ( ref == EmptyHashEntry || ip - (int) ref > MaxOffset || read32( base + ref ) != sequence )
+            {
+                ip++;
+                continue;
+            }
+
+            int matchLength = MinMatch;
+            while ( ip + matchLength < end && base[ref+matchLength] == base[ip+matchLength] )
+                matchLength++;
+
+            const int literalLength = ip - anchor;
+            const int offset = ip - ref;
+
+            const int sequenceBytes = 1 + length_bytes( literalLength ) + literalLength + 2 + length_bytes( matchLength - MinMatch );
+            if ( op + sequenceBytes > outputEnd )
+                return 0;
+
+            uint8_t * token = op++;
+            *token = uint8_t( ( core::min( literalLength, 15 ) << 4 ) | core::min( matchLength - MinMatch, 15 ) );
+            if ( literalLength >= 15 )
+                op = write_length( op, literalLength );
+            memcpy( op, base + anchor, literalLength );
+            op += literalLength;
+            *op++ = uint8_t( offset & 0xFF );
+            *op++ = uint8_t( offset >> 8 );
+            if ( matchLength - MinMatch >= 15 )
+                op = write_length( op, matchLength - MinMatch );
+
+            // insert the last position of the match so the next search has something close by
+
+            ip += matchLength;
+            anchor = ip;
+
+            if ( ip - 2 <= matchLimit )
+                m_hashTable[ hash32( read32( base + ip - 2 ) ) ] = ip - 2;
+        }
+
+        // final sequence is literals only. the decoder stops when it runs out of input after them
+
+        const int literalLength = end - anchor;
+        const int lastBytes = 1 + length_bytes( literalLength ) + literalLength;
+        if ( op + lastBytes > outputEnd )
+            return 0;
+
+        *op++ = uint8_t( core::min( literalLength, 15 ) << 4 );
+        if ( literalLength >= 15 )
+            op = write_length( op, literalLength );
+        memcpy( op, base + anchor, literalLength );
+        op += literalLength;
+
+        return int( op - output );
+    }
+
+    int PacketCompressor::Decompress( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes )
+    {
+        // IMPORTANT: input comes straight off the wire. Every length and offset must be validated.
+
+        const int maxBytes = core::min( maxOutputBytes, m_config.maxPacketSize );
+
+        const uint8_t * ip = input;
+        const uint8_t * const inputEnd = input + inputBytes;
+
+        uint8_t * const base = m_work;
+        int op = m_dictionarySize;
+        const int outputEnd = m_dictionarySize + maxBytes;
+
+        while ( ip < inputEnd )
+        {
+            const uint8_t token = *ip++;
+
+            int literalLength = token >> 4;
+            if ( literalLength == 15 && !read_length( ip, inputEnd, literalLength ) )
+                return -1;
+
+            if ( literalLength > inputEnd - ip || literalLength > outputEnd - op )
+                return -1;
+
+            memcpy( base + op, ip, literalLength );
+            ip += literalLength;
+            op += literalLength;
+
+            if ( ip == inputEnd )
+                break;
+
+            if ( inputEnd - ip < 2 )
+                return -1;
+
+            const int offset = ip[0] | ( ip[1] << 8 );
+            ip += 2;
+
+            if ( offset == 0 || offset > op )
+                return -1;
+
+            int matchLength = token & 0xF;
+            if ( matchLength == 15 && !read_length( ip, inputEnd, matchLength ) )
+                return -1;
+            matchLength += MinMatch;
+
+            if ( matchLength > outputEnd - op )
+                return -1;
+
+            // IMPORTANT: byte by byte because the match may overlap the bytes being written
+
+            const uint8_t * match = base + op - offset;
+            uint8_t * destination = base + op;
+            for ( int i = 0; i < matchLength; ++i )
+                destination[i] = match[i];
+            op += matchLength;
+        }
+
+        const int decodedBytes = op - m_dictionarySize;
+        memcpy( output, base + m_dictionarySize, decodedBytes );
+        return decodedBytes;
+    }
+
+    int TrainPacketDictionary( const uint8_t ** samples, const int * sampleBytes, int numSamples, uint8_t * dictionary, int maxDictionaryBytes )
+    {
+        /*
+            Greedy segment selection in the spirit of zstd's COVER dictionary builder.
+
+            Count how often each 8 byte sequence occurs across all samples (approximately, via a hashed 
+            count table), then repeatedly pick the sample segment whose sequences are most common and 
+            zero the counts of everything it covers, so the next pick adds new information.
+
+            The best segments go at the end of the dictionary, where offsets to them are shortest.
+        */
+
+        CORE_ASSERT( samples );
+        CORE_ASSERT( sampleBytes );
+        CORE_ASSERT( dictionary );
+        CORE_ASSERT( maxDictionaryBytes > 0 );
+
+        const int K = 8;
+        const int SegmentSize = 64;
+        const int SegmentStep = SegmentSize / 2;
+        const int CountBits = 16;
+        const int NumCounts = 1 << CountBits;
+
+        core::Allocator & allocator = core::memory::default_allocator();
+
+        uint32_t * counts = (uint32_t*) allocator.Allocate( NumCounts * sizeof( uint32_t ) );
+        memset( counts, 0, NumCounts * sizeof( uint32_t ) );
+
+        int totalBytes = 0;
+        int numSegments = 0;
+        for ( int i = 0; i < numSamples; ++i )
+        {
+            totalBytes += sampleBytes[i];
+            if ( sampleBytes[i] >= SegmentSize )
+                numSegments += 1 + ( sampleBytes[i] - SegmentSize ) / SegmentStep;
+        }
+
+        if ( numSegments == 0 )
+        {
+            allocator.Free( counts );
+            return 0;
+        }
+
+        // hash every k-mer once up front. scoring segments is then just table lookups
+
+        uint16_t * kmers = (uint16_t*) allocator.Allocate( totalBytes * sizeof( uint16_t ) + 1 );
+        const uint8_t ** segments = (const uint8_t**) allocator.Allocate( numSegments * sizeof( const uint8_t* ), alignof( const uint8_t* ) );
+        const uint16_t ** segmentKmers = (const uint16_t**) allocator.Allocate( numSegments * sizeof( const uint16_t* ), alignof( const uint16_t* ) );
+
+        int kmerOffset = 0;
+        int segmentIndex = 0;
+        for ( int i = 0; i < numSamples; ++i )
+        {
+            const uint8_t * sample = samples[i];
+            for ( int j = 0; j <= sampleBytes[i] - K; ++j )
+            {
+                uint64_t value;
+                memcpy( &value, sample + j, K );
+                const uint16_t kmer = uint16_t( ( value * 0x9E3779B97F4A7C15ULL ) >> ( 64 - CountBits ) );
+                kmers[kmerOffset+j] = kmer;
+                counts[kmer]++;
+            }
+
+            for ( int j = 0; j + SegmentSize <= sampleBytes[i]; j += SegmentStep )
+            {
+                segments[segmentIndex] = sample + j;
+                segmentKmers[segmentIndex] = kmers + kmerOffset + j;
+                segmentIndex++;
+            }
+
+            kmerOffset += sampleBytes[i];
+        }
+
+        CORE_ASSERT( segmentIndex == numSegments );
+
+        int dictionaryBytes = 0;
+
+        while ( dictionaryBytes + SegmentSize <= maxDictionaryBytes )
+        {
+            int bestSegment = -1;
+            uint64_t bestScore = 0;
+
+            for ( int i = 0; i < numSegments; ++i )
+            {
+                // only k-mers seen more than once are worth anything
+
+                uint64_t score = 0;
+                const uint16_t * segmentKmer = segmentKmers[i];
+                for ( int j = 0; j <= SegmentSize - K; ++j )
+                    score += counts[segmentKmer[j]] > 1 ? counts[segmentKmer[j]] : 0;
+
+                if ( score > bestScore )
+                {
+                    bestScore = score;
+                    bestSegment = i;
+                }
+            }
+
+            if ( bestSegment == -1 )
+                break;
+
+            const uint16_t * segmentKmer = segmentKmers[bestSegment];
+            for ( int j = 0; j <= SegmentSize - K; ++j )
+                counts[segmentKmer[j]] = 0;
+
+            dictionaryBytes += SegmentSize;
+            memcpy( dictionary + maxDictionaryBytes - dictionaryBytes, segments[bestSegment], SegmentSize );
+        }
+
+        // shift the segments we picked down to the start of the dictionary buffer
+
+        memmove( dictionary, dictionary + maxDictionaryBytes - dictionaryBytes, dictionaryBytes );
+
+        allocator.Free( segmentKmers );
+        allocator.Free( segments );
+        allocator.Free( kmers );
+        allocator.Free( counts );
+
+        return dictionaryBytes;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef NETWORK_COMPRESSOR_H
+#define NETWORK_COMPRESSOR_H
+
+#include "core/Core.h"
+#include "network/Enums.h"
+
+namespace core { class Allocator; }
+
+namespace network
+{
+    struct PacketCompressorConfig
+    {
+        PacketCompressorConfig()
+        {
+            allocator = nullptr;
+            dictionary = nullptr;
+            dictionarySize = 0;
+            maxPacketSize = 64 * 1024;
+        }
+
+        core::Allocator * allocator;                // allocator for work buffers. if nullptr then the default allocator is used.
+        const uint8_t * dictionary;                 // optional static dictionary. both sides of the connection must use the same one. see TrainPacketDictionary.
+        int dictionarySize;                         // dictionary size in bytes. matches can reach back at most 64k so larger dictionaries are pointless.
+        int maxPacketSize;                          // maximum uncompressed packet size in bytes.
+    };
+
+    /*
+        Byte oriented LZ77 packet compressor (LZ4 style sequences).
+
+        Each packet is compressed independently so loss and reordering don't matter, 
+        which is why the static dictionary is important: it stands in for the history 
+        a streaming compressor would have. Encoded packets are prefixed by a single byte
+        PacketEncoding so packets that don't get smaller are sent raw at a cost of one byte.
+
+        Not thread safe. Use one compressor per-network interface.
+    */
+
+    class PacketCompressor
+    {
+    public:
+
+        PacketCompressor( const PacketCompressorConfig & config = PacketCompressorConfig() );
+
+        ~PacketCompressor();
+
+        int EncodePacket( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes );        // returns encoded bytes, or zero if the output buffer is too small.
+
+        int DecodePacket( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes );        // returns decoded bytes, or -1 if the packet is corrupt.
+
+        uint64_t GetCounter( int index ) const;
+
+        void ResetCounters();
+
+        static int GetMaxEncodedSize( int inputBytes ) { return inputBytes + 1; }
+
+    protected:
+
+        int Compress( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes );
+
+        int Decompress( const uint8_t * input, int inputBytes, uint8_t * output, int maxOutputBytes );
+
+    private:
+
+        const PacketCompressorConfig m_config;
+
+        core::Allocator * m_allocator;
+
+        int m_dictionarySize;
+
+        uint8_t * m_work;                           // dictionary followed by the packet being compressed or decompressed.
+
+        uint32_t * m_hashTable;
+        uint32_t * m_dictionaryHashTable;           // hash table primed with the dictionary. copied into the hash table before each packet.
+
+        uint64_t m_counters[PACKET_COMPRESSOR_COUNTER_NUM_COUNTERS];
+
+        PacketCompressor( const PacketCompressor & other );
+        PacketCompressor & operator = ( const PacketCompressor & other );
+    };
+
+    int TrainPacketDictionary( const uint8_t ** samples, const int * sampleBytes, int numSamples, uint8_t * dictionary, int maxDictionaryBytes );      // returns dictionary size in bytes.
+}
+
+#endif
@@ -57,8 +57,29 @@ namespace network
         BSD_SOCKET_COUNTER_CREATE_PACKET_FAILURES,
         BSD_SOCKET_COUNTER_PROTOCOL_ID_MISMATCH,
         BSD_SOCKET_COUNTER_ABORTED_PACKET_READS,
+        BSD_SOCKET_COUNTER_DECODE_FAILURES,
         BSD_SOCKET_COUNTER_NUM_COUNTERS
     };
+
+    enum PacketEncoding
+    {
+        PACKET_ENCODING_RAW = 0,
+        PACKET_ENCODING_LZ = 1
+    };
+
+    enum PacketCompressorCounter
+    {
+        PACKET_COMPRESSOR_COUNTER_PACKETS_ENCODED,
+        PACKET_COMPRESSOR_COUNTER_PACKETS_COMPRESSED,
+        PACKET_COMPRESSOR_COUNTER_PACKETS_SENT_RAW,
+        PACKET_COMPRESSOR_COUNTER_PACKETS_DECODED,
+        PACKET_COMPRESSOR_COUNTER_DECODE_FAILURES,
+        PACKET_COMPRESSOR_COUNTER_BYTES_BEFORE_ENCODE,
+        PACKET_COMPRESSOR_COUNTER_BYTES_AFTER_ENCODE,
+        PACKET_COMPRESSOR_COUNTER_ENCODE_NANOSECONDS,
+        PACKET_COMPRESSOR_COUNTER_DECODE_NANOSECONDS,
+        PACKET_COMPRESSOR_COUNTER_NUM_COUNTERS
+    };
 }
 
 #endif
@@ -23,6 +23,7 @@
 */
 
 #include "network/Simulator.h"
+#include "network/Compressor.h"
 #include "core/Memory.h"
 #include "protocol/PacketFactory.h"
 
@@ -48,6 +49,10 @@ namespace network
         m_numStates = 0;
 
         m_context = nullptr;
+
+        m_random.Seed( m_config.seed ? m_config.seed : core::nanoseconds() );
+
+        m_randomPoolIndex = RandomPoolSize;
     }
 
     Simulator::~Simulator()
@@ -101,9 +106,9 @@ namespace network
 
         const int index = m_packetNumberSend % m_config.numPackets;
 
-        const bool loss = core::random_float( 0.0f, 100.0f ) <= m_state.packetLoss;
+        const bool loss = GetRandomFloat() * 100.0f < m_state.packetLoss;
 
-        const float jitter = core::random_float( -m_state.jitter, +m_state.jitter );
+        const float jitter = ( GetRandomFloat() * 2.0f - 1.0f ) * m_state.jitter;
 
         if ( m_config.serializePackets )
         {
@@ -211,9 +216,9 @@ namespace network
     {
         m_timeBase = timeBase;
 
-        if ( m_numStates && ( rand() % m_config.stateChance ) == 0 )
+        if ( m_numStates && m_random.GetUint32( m_config.stateChance ) == 0 )
         {
-            const int stateIndex = rand() % m_numStates;
+            const int stateIndex = m_random.GetUint32( m_numStates );
             m_state = m_states[stateIndex];
         }
 
@@ -236,6 +241,20 @@ namespace network
         }
     }
 
+    float Simulator::GetRandomFloat()
+    {
+        // IMPORTANT: Loss and jitter decisions are drawn from a pool refilled in bulk
+        // so the per-packet cost is a single array read in the common case.
+
+        if ( m_randomPoolIndex == RandomPoolSize )
+        {
+            m_random.GetFloats( m_randomPool, RandomPoolSize );
+            m_randomPoolIndex = 0;
+        }
+
+        return m_randomPool[m_randomPoolIndex++];
+    }
+
     protocol::Packet * Simulator::SerializePacket( protocol::Packet * input, int & packetSize )
     {
         CORE_ASSERT( input );
@@ -267,6 +286,27 @@ namespace network
             m_config.packetFactory->Destroy( input );
         }
 
+        // compress and decompress (optional)
+        {
+            if ( m_config.compressor )
+            {
+                const int maxEncodedBytes = PacketCompressor::GetMaxEncodedSize( m_config.maxPacketSize );
+
+                uint8_t * encoded = (uint8_t*) alloca( maxEncodedBytes );
+
+                const int encodedBytes = m_config.compressor->EncodePacket( buffer, bytes, encoded, maxEncodedBytes );
+
+                CORE_ASSERT( encodedBytes > 0 );
+
+                const int decodedBytes = m_config.compressor->DecodePacket( encoded, encodedBytes, buffer, m_config.maxPacketSize );
+
+                CORE_ASSERT( decodedBytes == bytes );
+                (void) decodedBytes;
+
+                bytes = encodedBytes;
+            }
+        }
+
         // serialize read
         {
             protocol::Packet * packet = m_config.packetFactory->Create( packetType );
@@ -27,6 +27,7 @@
 
 #include "core/Core.h"
 #include "core/Memory.h"
+#include "core/Random.h"
 #include "network/Constants.h"
 #include "network/Interface.h"
 #include "protocol/SlidingWindow.h"
@@ -41,6 +42,8 @@ namespace protocol
 
 namespace network
 {
+    class PacketCompressor;
+
     struct SimulatorConfig
     {
         core::Allocator * allocator;
@@ -52,6 +55,8 @@ namespace network
         bool serializePackets;              // if true then serialize read/writ packets
         int bandwidthSize;                  // number of entries in bandwidth sliding window
         float bandwidthTime;                // average bandwidth over this amount of time in the past
+        uint64_t seed;                      // random seed for loss, jitter and state changes. if zero then seed from the clock
+        PacketCompressor * compressor;      // optional packet compressor applied to serialized packets. bandwidth is measured after compression. not owned
 
         SimulatorConfig()
         {   
@@ -64,6 +69,8 @@ namespace network
             packetHeaderSize = 28;
             bandwidthSize = 1024;
             bandwidthTime = 0.5f;
+            seed = 0;
+            compressor = nullptr;
         }
     };
 
@@ -159,8 +166,12 @@ namespace network
 
         protocol::Packet * SerializePacket( protocol::Packet * input, int & packetSize );
 
+        float GetRandomFloat();
+
     private:
 
+        enum { RandomPoolSize = 256 };
+
         struct PacketData
         {
             protocol::Packet * packet;
@@ -197,6 +208,11 @@ namespace network
 
         BandwidthSlidingWindow m_bandwidthSlidingWindow;
 
+        core::RandomGenerator m_random;
+
+        int m_randomPoolIndex;
+        float m_randomPool[RandomPoolSize];
+
         Simulator( const Simulator & other );
         const Simulator & operator = ( const Simulator & other );
     };
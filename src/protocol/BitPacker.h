@@ -78,6 +78,40 @@ namespace protocol
             return m_overflow;
         }
 
+        // lets the caller write speculatively and undo it, eg. to fill a packet up to a budget
+        // without measuring each object first. words flushed after the checkpoint are simply
+        // written again as writing continues from it
+
+        struct Checkpoint
+        {
+            uint64_t scratch;
+            int bitsWritten;
+            int bitIndex;
+            int wordIndex;
+            bool overflow;
+        };
+
+        Checkpoint GetCheckpoint() const
+        {
+            Checkpoint checkpoint;
+            checkpoint.scratch = m_scratch;
+            checkpoint.bitsWritten = m_bitsWritten;
+            checkpoint.bitIndex = m_bitIndex;
+            checkpoint.wordIndex = m_wordIndex;
+            checkpoint.overflow = m_overflow;
+            return checkpoint;
+        }
+
+        void Rollback( const Checkpoint & checkpoint )
+        {
+            CORE_ASSERT( checkpoint.bitsWritten <= m_bitsWritten );
+            m_scratch = checkpoint.scratch;
+            m_bitsWritten = checkpoint.bitsWritten;
+            m_bitIndex = checkpoint.bitIndex;
+            m_wordIndex = checkpoint.wordIndex;
+            m_overflow = checkpoint.overflow;
+        }
+
     private:
 
         uint32_t * m_data;
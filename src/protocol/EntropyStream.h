@@ -0,0 +1,378 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef PROTOCOL_ENTROPY_STREAM_H
+#define PROTOCOL_ENTROPY_STREAM_H
+
+#include "core/Core.h"
+#include "protocol/ProtocolConstants.h"
+#include "protocol/RangeCoder.h"
+
+namespace protocol
+{
+    /*
+        Drop-in replacement for WriteStream/ReadStream that range codes every value against 
+        an adaptive model instead of writing fixed width bit fields.
+
+        Existing serialize_* functions compile against these streams unchanged. Fields don't 
+        carry names, so the probability context for each value is picked from its range plus the 
+        ranges of the two values serialized before it. In a per-object loop this tells x, y and z 
+        of the same vector apart and gives each field of each object type its own statistics.
+
+        Models start flat and adapt within a packet, so there is no state shared across packets
+        and packet loss doesn't matter.
+    */
+
+    const int EntropyNumContexts = 32;
+    const int EntropyTreeBits = 8;
+    const int EntropyTreeSize = 1 << EntropyTreeBits;
+    const int EntropyMaxLowBits = 32 - EntropyTreeBits;
+    const int EntropyProbabilitiesPerContext = EntropyTreeSize + EntropyMaxLowBits * 2;
+
+    struct EntropyContext
+    {
+        RangeCoderProbability tree[EntropyTreeSize];                // top bits of each value, coded with a binary tree so every prefix has its own probability
+        RangeCoderProbability low[EntropyMaxLowBits][2];            // remaining bits, conditioned on the previous bit coded
+    };
+
+    class EntropyModel
+    {
+    public:
+
+        EntropyModel()
+        {
+            Reset();
+        }
+
+        void Reset()
+        {
+            CORE_ASSERT( sizeof( EntropyContext ) == EntropyProbabilitiesPerContext * sizeof( RangeCoderProbability ) );
+            range_coder_reset( &m_contexts[0].tree[0], EntropyNumContexts * EntropyProbabilitiesPerContext );
+            m_history[0] = 0;
+            m_history[1] = 0;
+        }
+
+        EntropyContext & GetContext( uint32_t signature )
+        {
+            const uint32_t hash = ( signature * 0x9E3779B1U ) ^ ( m_history[0] * 0x85EBCA77U ) ^ ( m_history[1] * 0xC2B2AE3DU );
+            m_history[1] = m_history[0];
+            m_history[0] = signature;
+            return m_contexts[ ( hash >> 16 ) % EntropyNumContexts ];
+        }
+
+        static uint32_t GetSignature( int32_t min, int32_t max )
+        {
+            return ( uint32_t( min ) * 0x27D4EB2FU ) ^ uint32_t( max );
+        }
+
+        static uint32_t GetSignature( int bits )
+        {
+            return 0x165667B1U + bits;
+        }
+
+    private:
+
+        EntropyContext m_contexts[EntropyNumContexts];
+        uint32_t m_history[2];
+    };
+
+    class EntropyWriteStream
+    {
+    public:
+
+        enum { IsWriting = 1 };
+        enum { IsReading = 0 };
+
+        EntropyWriteStream( uint8_t * buffer, int bytes ) : m_encoder( buffer, bytes ), m_context( NULL ), m_aborted( false ), m_flushed( false ) {}
+
+        void SerializeInteger( int32_t value, int32_t min, int32_t max )
+        {
+            CORE_ASSERT( min < max );
+            CORE_ASSERT( value >= min );
+            CORE_ASSERT( value <= max );
+            const int bits = core::bits_required( min, max );
+            const uint32_t unsigned_value = uint32_t( value ) - uint32_t( min );
+            EncodeValue( m_model.GetContext( EntropyModel::GetSignature( min, max ) ), unsigned_value, bits );
+        }
+
+        void SerializeBits( uint32_t value, int bits )
+        {
+            CORE_ASSERT( bits > 0 );
+            CORE_ASSERT( bits <= 32 );
+            if ( bits < 32 )
+                value &= ( 1U << bits ) - 1;
+            EncodeValue( m_model.GetContext( EntropyModel::GetSignature( bits ) ), value, bits );
+        }
+
+        void SerializeBytes( const uint8_t * data, int bytes )
+        {
+            for ( int i = 0; i < bytes; ++i )
+                m_encoder.EncodeDirectBits( data[i], 8 );
+        }
+
+        void Align()
+        {
+            // there is nothing to align to in a range coded stream
+        }
+
+        int GetAlignBits() const
+        {
+            return 0;
+        }
+
+        bool Check( uint32_t magic )
+        {
+            m_encoder.EncodeDirectBits( magic, 32 );
+            return true;
+        }
+
+        void Flush()
+        {
+            CORE_ASSERT( !m_flushed );
+            m_encoder.Flush();
+            m_flushed = true;
+        }
+
+        const uint8_t * GetData() const
+        {
+            return m_encoder.GetData();
+        }
+
+        int GetBytesProcessed() const
+        {
+            return m_encoder.GetBytesWritten() + ( m_flushed ? 0 : m_encoder.GetBytesPending() );
+        }
+
+        int GetBitsProcessed() const
+        {
+            return GetBytesProcessed() * 8;
+        }
+
+        int GetBitsRemaining() const
+        {
+            return GetTotalBits() - GetBitsProcessed();
+        }
+
+        int GetTotalBits() const
+        {
+            return m_encoder.GetTotalBytes() * 8;
+        }
+
+        int GetTotalBytes() const
+        {
+            return m_encoder.GetTotalBytes();
+        }
+
+        bool IsOverflow() const
+        {
+            return m_encoder.IsOverflow();
+        }
+
+        void SetContext( const void ** context )
+        {
+            m_context = context;
+        }
+
+        const void * GetContext( int index ) const
+        {
+            CORE_ASSERT( index >= 0 );
+            CORE_ASSERT( index < protocol::MaxContexts );
+            return m_context ? m_context[index] : NULL;
+        }
+
+        void Abort()
+        {
+            m_aborted = true;
+        }
+
+        bool Aborted() const
+        {
+            return m_aborted;
+        }
+
+    private:
+
+        void EncodeValue( EntropyContext & context, uint32_t value, int bits )
+        {
+            const int treeBits = core::min( bits, EntropyTreeBits );
+            const int lowBits = bits - treeBits;
+
+            const uint32_t top = ( lowBits < 32 ) ? ( value >> lowBits ) : 0;
+
+            uint32_t node = 1;
+            for ( int i = treeBits - 1; i >= 0; --i )
+            {
+                const uint32_t bit = ( top >> i ) & 1;
+                m_encoder.EncodeBit( context.tree[node], bit );
+                node = ( node << 1 ) | bit;
+            }
+
+            uint32_t previous = top & 1;
+            for ( int i = lowBits - 1; i >= 0; --i )
+            {
+                const uint32_t bit = ( value >> i ) & 1;
+                m_encoder.EncodeBit( context.low[i][previous], bit );
+                previous = bit;
+            }
+        }
+
+        RangeEncoder m_encoder;
+        EntropyModel m_model;
+        const void ** m_context;
+        bool m_aborted;
+        bool m_flushed;
+    };
+
+    class EntropyReadStream
+    {
+    public:
+
+        enum { IsWriting = 0 };
+        enum { IsReading = 1 };
+
+        EntropyReadStream( const uint8_t * buffer, int bytes ) : m_decoder( buffer, bytes ), m_context( NULL ), m_aborted( false ) {}
+
+        void SerializeInteger( int32_t & value, int32_t min, int32_t max )
+        {
+            CORE_ASSERT( min < max );
+            const int bits = core::bits_required( min, max );
+            const uint32_t unsigned_value = DecodeValue( m_model.GetContext( EntropyModel::GetSignature( min, max ) ), bits );
+            value = int32_t( unsigned_value + uint32_t( min ) );
+        }
+
+        void SerializeBits( uint32_t & value, int bits )
+        {
+            CORE_ASSERT( bits > 0 );
+            CORE_ASSERT( bits <= 32 );
+            value = DecodeValue( m_model.GetContext( EntropyModel::GetSignature( bits ) ), bits );
+        }
+
+        void SerializeBytes( uint8_t * data, int bytes )
+        {
+            for ( int i = 0; i < bytes; ++i )
+                data[i] = uint8_t( m_decoder.DecodeDirectBits( 8 ) );
+        }
+
+        void Align()
+        {
+            // there is nothing to align to in a range coded stream
+        }
+
+        int GetAlignBits() const
+        {
+            return 0;
+        }
+
+        bool Check( uint32_t magic )
+        {
+            const uint32_t value = m_decoder.DecodeDirectBits( 32 );
+            CORE_ASSERT( value == magic );
+            return value == magic;
+        }
+
+        int GetBitsProcessed() const
+        {
+            return m_decoder.GetBytesRead() * 8;
+        }
+
+        int GetBytesProcessed() const
+        {
+            return m_decoder.GetBytesRead();
+        }
+
+        bool IsOverflow() const
+        {
+            return m_decoder.IsOverflow();
+        }
+
+        void SetContext( const void ** context )
+        {
+            m_context = context;
+        }
+
+        const void * GetContext( int index ) const
+        {
+            CORE_ASSERT( index >= 0 );
+            CORE_ASSERT( index < MaxContexts );
+            return m_context ? m_context[index] : NULL;
+        }
+
+        void Abort()
+        {
+            m_aborted = true;
+        }
+
+        bool Aborted() const
+        {
+            return m_aborted;
+        }
+
+        int GetBytesRead() const
+        {
+            return m_decoder.GetBytesRead();
+        }
+
+    private:
+
+        uint32_t DecodeValue( EntropyContext & context, int bits )
+        {
+            const int treeBits = core::min( bits, EntropyTreeBits );
+            const int lowBits = bits - treeBits;
+
+            uint32_t node = 1;
+            for ( int i = 0; i < treeBits; ++i )
+                node = ( node << 1 ) | m_decoder.DecodeBit( context.tree[node] );
+
+            const uint32_t top = node - ( 1U << treeBits );
+
+            uint32_t value = top;
+            uint32_t previous = top & 1;
+            for ( int i = lowBits - 1; i >= 0; --i )
+            {
+                const uint32_t bit = m_decoder.DecodeBit( context.low[i][previous] );
+                value = ( value << 1 ) | bit;
+                previous = bit;
+            }
+
+            return value;
+        }
+
+        RangeDecoder m_decoder;
+        EntropyModel m_model;
+        const void ** m_context;
+        bool m_aborted;
+    };
+}
+
+template <typename T> void serialize_object( protocol::EntropyReadStream & stream, T & object )
+{                        
+    object.Serialize( stream );
+}
+
+template <typename T> void serialize_object( protocol::EntropyWriteStream & stream, T & object )
+{                        
+    object.Serialize( stream );
+}
+
+#endif
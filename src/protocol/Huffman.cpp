@@ -0,0 +1,188 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "protocol/Huffman.h"
+#include <stdlib.h>
+#include <string.h>
+
+namespace protocol
+{
+    struct HuffmanLeaf
+    {
+        uint64_t count;
+        int symbol;
+    };
+
+    static int compare_huffman_leaves( const void * a, const void * b )
+    {
+        const HuffmanLeaf * leaf_a = (const HuffmanLeaf*) a;
+        const HuffmanLeaf * leaf_b = (const HuffmanLeaf*) b;
+        if ( leaf_a->count != leaf_b->count )
+            return leaf_a->count < leaf_b->count ? -1 : +1;
+        return leaf_b->symbol - leaf_a->symbol;                  // on ties, lower symbols (small deltas) get the shorter codes
+    }
+
+    static int build_huffman_tree( HuffmanLeaf * leaves, int numSymbols, uint64_t * weights, int * parents, uint8_t * lengths )
+    {
+        // two queue construction: leaves are sorted by count, internal nodes are created in increasing weight order
+
+        const int numNodes = numSymbols * 2 - 1;
+
+        for ( int i = 0; i < numSymbols; ++i )
+            weights[i] = leaves[i].count;
+
+        int leaf = 0;
+        int node = numSymbols;
+
+        for ( int next = numSymbols; next < numNodes; ++next )
+        {
+            int children[2];
+            for ( int j = 0; j < 2; ++j )
+            {
+                if ( leaf < numSymbols && ( node >= next || weights[leaf] <= weights[node] ) )
+                    children[j] = leaf++;
+                else
+                    children[j] = node++;
+            }
+            weights[next] = weights[children[0]] + weights[children[1]];
+            parents[children[0]] = next;
+            parents[children[1]] = next;
+        }
+
+        // depth of each node is one more than its parent. parents always have higher indices
+
+        int * depths = parents;
+        depths[numNodes-1] = 0;
+        for ( int i = numNodes - 2; i >= 0; --i )
+            depths[i] = depths[parents[i]] + 1;
+
+        int maxDepth = 0;
+        for ( int i = 0; i < numSymbols; ++i )
+        {
+            lengths[leaves[i].symbol] = (uint8_t) depths[i];
+            maxDepth = core::max( maxDepth, depths[i] );
+        }
+
+        return maxDepth;
+    }
+
+    bool huffman_build_lengths( const uint64_t * counts, int numSymbols, int maxLength, uint8_t * lengths )
+    {
+        CORE_ASSERT( counts );
+        CORE_ASSERT( lengths );
+        CORE_ASSERT( numSymbols > 1 );
+        CORE_ASSERT( maxLength > 0 );
+        CORE_ASSERT( maxLength <= HuffmanMaxCodeLength );
+
+        if ( ( 1 << maxLength ) < numSymbols )
+            return false;
+
+        HuffmanLeaf * leaves = (HuffmanLeaf*) malloc( sizeof( HuffmanLeaf ) * numSymbols );
+        uint64_t * weights = (uint64_t*) malloc( sizeof( uint64_t ) * numSymbols * 2 );
+        int * parents = (int*) malloc( sizeof( int ) * numSymbols * 2 );
+
+        // every symbol gets a code, even if it was never seen in the training data
+
+        for ( int i = 0; i < numSymbols; ++i )
+        {
+            leaves[i].count = counts[i] + 1;
+            leaves[i].symbol = i;
+        }
+
+        // if the tree is too deep, flatten the distribution and try again
+
+        while ( true )
+        {
+            qsort( leaves, numSymbols, sizeof( HuffmanLeaf ), compare_huffman_leaves );
+
+            if ( build_huffman_tree( leaves, numSymbols, weights, parents, lengths ) <= maxLength )
+                break;
+
+            for ( int i = 0; i < numSymbols; ++i )
+                leaves[i].count = ( leaves[i].count >> 1 ) + 1;
+        }
+
+        free( leaves );
+        free( weights );
+        free( parents );
+
+        return true;
+    }
+
+    void huffman_build_table( HuffmanTable & table, int numSymbols, const uint8_t * lengths, uint16_t * codes, uint16_t * symbols )
+    {
+        CORE_ASSERT( numSymbols > 1 );
+        CORE_ASSERT( lengths );
+        CORE_ASSERT( codes );
+        CORE_ASSERT( symbols );
+
+        table.numSymbols = numSymbols;
+        table.lengths = lengths;
+        table.codes = codes;
+        table.symbols = symbols;
+
+        memset( table.firstCode, 0, sizeof( table.firstCode ) );
+        memset( table.firstIndex, 0, sizeof( table.firstIndex ) );
+        memset( table.lengthCount, 0, sizeof( table.lengthCount ) );
+
+        for ( int i = 0; i < numSymbols; ++i )
+        {
+            CORE_ASSERT( lengths[i] > 0 );
+            CORE_ASSERT( lengths[i] <= HuffmanMaxCodeLength );
+            table.lengthCount[lengths[i]]++;
+        }
+
+        // canonical codes: shorter codes first, then by symbol within each length
+
+        uint32_t code = 0;
+        int index = 0;
+        for ( int length = 1; length <= HuffmanMaxCodeLength; ++length )
+        {
+            table.firstCode[length] = (uint16_t) code;
+            table.firstIndex[length] = (uint16_t) index;
+            code = ( code + table.lengthCount[length] ) << 1;
+            index += table.lengthCount[length];
+        }
+
+        uint16_t nextCode[HuffmanMaxCodeLength+1];
+        uint16_t nextIndex[HuffmanMaxCodeLength+1];
+        memcpy( nextCode, table.firstCode, sizeof( nextCode ) );
+        memcpy( nextIndex, table.firstIndex, sizeof( nextIndex ) );
+
+        for ( int i = 0; i < numSymbols; ++i )
+        {
+            const int length = lengths[i];
+            codes[i] = nextCode[length]++;
+            symbols[nextIndex[length]++] = (uint16_t) i;
+        }
+    }
+
+    uint64_t huffman_encoded_bits( const HuffmanTable & table, const uint64_t * counts )
+    {
+        uint64_t bits = 0;
+        for ( int i = 0; i < table.numSymbols; ++i )
+            bits += counts[i] * table.lengths[i];
+        return bits;
+    }
+}
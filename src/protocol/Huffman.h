@@ -0,0 +1,94 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef PROTOCOL_HUFFMAN_H
+#define PROTOCOL_HUFFMAN_H
+
+#include "core/Core.h"
+
+namespace protocol
+{
+    /*
+        Static canonical huffman codes.
+
+        Tables are built offline from recorded value histograms (see tools/Entropy) and compiled
+        in as constant data, so there is no model to adapt or transmit at runtime. Codes are 
+        sent MSB first, one bit at a time, so the same table works with every stream type.
+    */
+
+    const int HuffmanMaxCodeLength = 16;
+
+    struct HuffmanTable
+    {
+        int numSymbols;
+        const uint8_t * lengths;                                // code length for each symbol
+        const uint16_t * codes;                                 // canonical code for each symbol
+        const uint16_t * symbols;                               // symbols sorted by code
+        uint16_t firstCode[HuffmanMaxCodeLength+1];             // first canonical code of each length
+        uint16_t firstIndex[HuffmanMaxCodeLength+1];            // index into symbols of first code of each length
+        uint16_t lengthCount[HuffmanMaxCodeLength+1];           // number of codes of each length
+    };
+
+    bool huffman_build_lengths( const uint64_t * counts, int numSymbols, int maxLength, uint8_t * lengths );
+
+    void huffman_build_table( HuffmanTable & table, int numSymbols, const uint8_t * lengths, uint16_t * codes, uint16_t * symbols );
+
+    uint64_t huffman_encoded_bits( const HuffmanTable & table, const uint64_t * counts );
+}
+
+template <typename Stream> void serialize_huffman( Stream & stream, int & symbol, const protocol::HuffmanTable & table )
+{
+    if ( Stream::IsWriting )
+    {
+        CORE_ASSERT( symbol >= 0 );
+        CORE_ASSERT( symbol < table.numSymbols );
+        const int length = table.lengths[symbol];
+        const uint32_t code = table.codes[symbol];
+        for ( int i = length - 1; i >= 0; --i )
+        {
+            uint32_t bit = ( code >> i ) & 1;
+            stream.SerializeBits( bit, 1 );
+        }
+    }
+    else
+    {
+        uint32_t code = 0;
+        symbol = 0;
+        for ( int length = 1; length <= protocol::HuffmanMaxCodeLength; ++length )
+        {
+            uint32_t bit = 0;
+            stream.SerializeBits( bit, 1 );
+            code = ( code << 1 ) | bit;
+            const uint32_t offset = code - table.firstCode[length];
+            if ( code >= table.firstCode[length] && offset < table.lengthCount[length] )
+            {
+                symbol = table.symbols[table.firstIndex[length] + offset];
+                return;
+            }
+        }
+        stream.Abort();
+    }
+}
+
+#endif
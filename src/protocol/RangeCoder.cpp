@@ -0,0 +1,204 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "RangeCoder.h"
+
+namespace protocol
+{
+    const uint32_t RangeCoderTopValue = 1 << 24;
+
+    RangeEncoder::RangeEncoder( void * data, int bytes )
+        : m_data( (uint8_t*) data ), m_numBytes( bytes )
+    {
+        CORE_ASSERT( data );
+        CORE_ASSERT( bytes > 0 );
+        m_bytesWritten = 0;
+        m_low = 0;
+        m_range = 0xFFFFFFFF;
+        m_cacheSize = 1;
+        m_cache = 0;
+        m_first = true;
+        m_overflow = false;
+    }
+
+    void RangeEncoder::EncodeBit( RangeCoderProbability & probability, uint32_t bit )
+    {
+        const uint32_t bound = ( m_range >> RangeCoderProbabilityBits ) * probability;
+
+        if ( bit == 0 )
+        {
+            m_range = bound;
+            probability += ( RangeCoderProbabilityOne - probability ) >> RangeCoderAdaptShift;
+        }
+        else
+        {
+            m_low += bound;
+            m_range -= bound;
+            probability -= probability >> RangeCoderAdaptShift;
+        }
+
+        while ( m_range < RangeCoderTopValue )
+        {
+            m_range <<= 8;
+            ShiftLow();
+        }
+    }
+
+    void RangeEncoder::EncodeDirectBits( uint32_t value, int bits )
+    {
+        CORE_ASSERT( bits > 0 );
+        CORE_ASSERT( bits <= 32 );
+
+        do
+        {
+            m_range >>= 1;
+            bits--;
+            m_low += m_range & ( 0 - ( ( value >> bits ) & 1 ) );
+            if ( m_range < RangeCoderTopValue )
+            {
+                m_range <<= 8;
+                ShiftLow();
+            }
+        }
+        while ( bits );
+    }
+
+    void RangeEncoder::Flush()
+    {
+        for ( int i = 0; i < 5; ++i )
+            ShiftLow();
+    }
+
+    void RangeEncoder::ShiftLow()
+    {
+        // IMPORTANT: a carry out of low can still change bytes we have already produced,
+        // so runs of 0xFF bytes are held back in the cache until we know if they carry.
+        // the very first byte is always zero, because the coded value is less than one, so it is never written.
+
+        if ( uint32_t( m_low ) < 0xFF000000U || uint32_t( m_low >> 32 ) != 0 )
+        {
+            uint8_t temp = m_cache;
+            do
+            {
+                if ( !m_first )
+                    WriteByte( uint8_t( temp + uint8_t( m_low >> 32 ) ) );
+                m_first = false;
+                temp = 0xFF;
+            }
+            while ( --m_cacheSize != 0 );
+            m_cache = uint8_t( uint32_t( m_low ) >> 24 );
+        }
+        m_cacheSize++;
+        m_low = uint32_t( m_low << 8 );
+    }
+
+    void RangeEncoder::WriteByte( uint8_t value )
+    {
+        if ( m_bytesWritten >= m_numBytes )
+        {
+            m_overflow = true;
+            return;
+        }
+        m_data[m_bytesWritten++] = value;
+    }
+
+    RangeDecoder::RangeDecoder( const void * data, int bytes )
+        : m_data( (const uint8_t*) data ), m_numBytes( bytes )
+    {
+        CORE_ASSERT( data );
+        CORE_ASSERT( bytes >= 0 );
+        m_bytesRead = 0;
+        m_range = 0xFFFFFFFF;
+        m_code = 0;
+        m_overflow = false;
+        for ( int i = 0; i < 4; ++i )
+            m_code = ( m_code << 8 ) | ReadByte();
+    }
+
+    uint32_t RangeDecoder::DecodeBit( RangeCoderProbability & probability )
+    {
+        const uint32_t bound = ( m_range >> RangeCoderProbabilityBits ) * probability;
+
+        uint32_t bit;
+
+        if ( m_code < bound )
+        {
+            m_range = bound;
+            probability += ( RangeCoderProbabilityOne - probability ) >> RangeCoderAdaptShift;
+            bit = 0;
+        }
+        else
+        {
+            m_range -= bound;
+            m_code -= bound;
+            probability -= probability >> RangeCoderAdaptShift;
+            bit = 1;
+        }
+
+        while ( m_range < RangeCoderTopValue )
+        {
+            m_range <<= 8;
+            m_code = ( m_code << 8 ) | ReadByte();
+        }
+
+        return bit;
+    }
+
+    uint32_t RangeDecoder::DecodeDirectBits( int bits )
+    {
+        CORE_ASSERT( bits > 0 );
+        CORE_ASSERT( bits <= 32 );
+
+        uint32_t value = 0;
+
+        do
+        {
+            m_range >>= 1;
+            m_code -= m_range;
+            const uint32_t mask = 0 - ( m_code >> 31 );
+            m_code += m_range & mask;
+            value = ( value << 1 ) + ( mask + 1 );
+            if ( m_range < RangeCoderTopValue )
+            {
+                m_range <<= 8;
+                m_code = ( m_code << 8 ) | ReadByte();
+            }
+        }
+        while ( --bits );
+
+        return value;
+    }
+
+    uint8_t RangeDecoder::ReadByte()
+    {
+        // IMPORTANT: reading past the end is flagged but returns zero so the decoder stays in a sane state
+
+        if ( m_bytesRead >= m_numBytes )
+        {
+            m_overflow = true;
+            return 0;
+        }
+        return m_data[m_bytesRead++];
+    }
+}
@@ -0,0 +1,141 @@
+/*
+    Networked Physics Example
+
+    Copyright © 2008 - 2016, The Network Protocol Company, Inc.
+
+    Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+
+        1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+
+        2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer 
+           in the documentation and/or other materials provided with the distribution.
+
+        3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived 
+           from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+    INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+    SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+    SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+    WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+    USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef PROTOCOL_RANGE_CODER_H
+#define PROTOCOL_RANGE_CODER_H
+
+#include "core/Core.h"
+
+namespace protocol
+{
+    /*
+        Binary adaptive range coder (the LZMA flavor).
+
+        Each bit is coded against an 11 bit probability that it is zero, which is
+        then nudged towards the value actually coded. Bits with no useful model
+        can be coded directly at exactly one bit each.
+    */
+
+    const int RangeCoderProbabilityBits = 11;
+    const int RangeCoderProbabilityOne = 1 << RangeCoderProbabilityBits;
+    const int RangeCoderAdaptShift = 5;
+
+    typedef uint16_t RangeCoderProbability;
+
+    inline void range_coder_reset( RangeCoderProbability * probabilities, int count )
+    {
+        for ( int i = 0; i < count; ++i )
+            probabilities[i] = RangeCoderProbabilityOne / 2;
+    }
+
+    class RangeEncoder
+    {
+    public:
+
+        RangeEncoder( void * data, int bytes );
+
+        void EncodeBit( RangeCoderProbability & probability, uint32_t bit );
+
+        void EncodeDirectBits( uint32_t value, int bits );
+
+        void Flush();
+
+        const uint8_t * GetData() const
+        {
+            return m_data;
+        }
+
+        int GetBytesWritten() const
+        {
+            return m_bytesWritten;
+        }
+
+        int GetBytesPending() const
+        {
+            // bytes that will be written when the encoder is flushed
+
+            return m_cacheSize + 4 - ( m_first ? 1 : 0 );
+        }
+
+        int GetTotalBytes() const
+        {
+            return m_numBytes;
+        }
+
+        bool IsOverflow() const
+        {
+            return m_overflow;
+        }
+
+    private:
+
+        void ShiftLow();
+
+        void WriteByte( uint8_t value );
+
+        uint8_t * m_data;
+        int m_numBytes;
+        int m_bytesWritten;
+        uint64_t m_low;
+        uint32_t m_range;
+        uint32_t m_cacheSize;
+        uint8_t m_cache;
+        bool m_first;
+        bool m_overflow;
+    };
+
+    class RangeDecoder
+    {
+    public:
+
+        RangeDecoder( const void * data, int bytes );
+
+        uint32_t DecodeBit( RangeCoderProbability & probability );
+
+        uint32_t DecodeDirectBits( int bits );
+
+        int GetBytesRead() const
+        {
+            return m_bytesRead;
+        }
+
+        bool IsOverflow() const
+        {
+            return m_overflow;
+        }
+
+    private:
+
+        uint8_t ReadByte();
+
+        const uint8_t * m_data;
+        int m_numBytes;
+        int m_bytesRead;
+        uint32_t m_range;
+        uint32_t m_code;
+        bool m_overflow;
+    };
+}
+
+#endif
@@ -124,6 +124,18 @@ namespace protocol
             return m_writer.IsOverflow();
         }
 
+        typedef BitWriter::Checkpoint Checkpoint;
+
+        Checkpoint GetCheckpoint() const
+        {
+            return m_writer.GetCheckpoint();
+        }
+
+        void Rollback( const Checkpoint & checkpoint )
+        {
+            m_writer.Rollback( checkpoint );
+        }
+
         void SetContext( const void ** context )
         {
             m_context = context;
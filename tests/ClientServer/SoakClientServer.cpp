@@ -3,6 +3,7 @@
 #include "network/Simulator.h"
 #include "network/BSDSocket.h"
 #include "network/Network.h"
+#include "core/Random.h"
 #include "TestMessages.h"
 #include "TestPackets.h"
 #include "TestClientServer.h"
@@ -60,14 +61,16 @@ struct ServerInfo
     network::Simulator * networkSimulator;
 };
 
-void soak_test()
+void soak_test( uint64_t seed )
 {
 #if PROFILE
     printf( "[profile client server]\n" );
 #else
-    printf( "[soak client server]\n" );
+    printf( "[soak client server] seed = %llu\n", (unsigned long long) seed );
 #endif
 
+    core::RandomGenerator random( seed );
+
     TestMessageFactory messageFactory( core::memory::default_allocator() );
 
     TestChannelStructure channelStructure( messageFactory );
@@ -92,6 +95,7 @@ void soak_test()
         network::SimulatorConfig networkSimulatorConfig;
         networkSimulatorConfig.packetFactory = &packetFactory;
         networkSimulatorConfig.serializePackets = false;
+        networkSimulatorConfig.seed = seed + 1 + i;
         serverInfo[i].networkSimulator = CORE_NEW( core::memory::default_allocator(), network::Simulator, networkSimulatorConfig );
         serverInfo[i].networkSimulator->AddState( { 0.0f, 0.0f, 0.0f } );
         serverInfo[i].networkSimulator->AddState( { 0.1f, 0.1f, 5.0f } );
@@ -106,8 +110,8 @@ void soak_test()
                 data[j] = ( 10 + i + j ) % 256;
 
             auto testContext = (TestContext*) data;
-            testContext->value_min = -1 - ( rand() % 100000000 );
-            testContext->value_max = rand() % 1000000000;
+            testContext->value_min = -1 - random.GetInt( 0, 100000000 - 1 );
+            testContext->value_max = random.GetInt( 0, 1000000000 - 1 );
         }
 
         clientServer::ServerConfig serverConfig;
@@ -116,6 +120,7 @@ void soak_test()
         serverConfig.channelStructure = &channelStructure;
         serverConfig.networkInterface = serverInfo[i].networkInterface;
         serverConfig.networkSimulator = serverInfo[i].networkSimulator;
+        serverConfig.seed = seed + 1 + NumServers + i;
 
         serverInfo[i].server = CORE_NEW( core::memory::default_allocator(), TestServer, serverConfig );
     }
@@ -138,6 +143,7 @@ void soak_test()
         network::SimulatorConfig networkSimulatorConfig;
         networkSimulatorConfig.serializePackets = false;
         networkSimulatorConfig.packetFactory = &packetFactory;
+        networkSimulatorConfig.seed = seed + 1 + NumServers * 2 + i;
         clientInfo[i].networkSimulator = CORE_NEW( core::memory::default_allocator(), network::Simulator, networkSimulatorConfig );
         clientInfo[i].networkSimulator->AddState( { 0.0f, 0.0f, 0.0f } );
         clientInfo[i].networkSimulator->AddState( { 0.1f, 0.1f, 5.0f } );
@@ -272,7 +278,7 @@ void soak_test()
                     auto message = (TestContextMessage*) messageFactory.Create( MESSAGE_TEST_CONTEXT );
                     CORE_CHECK( message );
                     message->sequence = clientInfo[i].sendSequence++;
-                    message->value = core::random_int( testContext->value_min, testContext->value_max );
+                    message->value = random.GetInt( testContext->value_min, testContext->value_max );
                     messageChannel->SendMessage( message );
                 }
 
@@ -300,7 +306,7 @@ void soak_test()
             {
                 clientInfo[i].networkInterface->Update( timeBase );
 
-                if ( clientInfo[i].receiveSequence > 100 && ( rand() % 100 ) == 0 )
+                if ( clientInfo[i].receiveSequence > 100 && random.GetUint32( 100 ) == 0 )
                 {
                     printf( "%09.2f - disconnect client %d from server %d\n", timeBase.time, i, clientInfo[i].serverIndex );
                     clientInfo[i].client->Disconnect();
@@ -310,9 +316,9 @@ void soak_test()
 
             if ( clientInfo[i].client->GetState() == clientServer::CLIENT_STATE_DISCONNECTED )
             {
-                if ( ( rand() % 200 ) == 0 )
+                if ( random.GetUint32( 200 ) == 0 )
                 {
-                    const int serverIndex = rand() % NumServers;
+                    const int serverIndex = random.GetUint32( NumServers );
                     printf( "%09.2f - connect client %d to server %d\n", timeBase.time, i, serverIndex );
                     clientInfo[i].client->Connect( serverInfo[serverIndex].address ); 
                     clientInfo[i].serverIndex = serverIndex;                  
@@ -359,9 +365,13 @@ void soak_test()
     }
 }
 
-int main()
+int main( int argc, char ** argv )
 {
-    srand( (int) time( nullptr ) );
+    // pass in a seed from a previous run to reproduce it
+
+    const uint64_t seed = ( argc > 1 ) ? strtoull( argv[1], nullptr, 10 ) : (uint64_t) time( nullptr );
+
+    core::random_seed( seed );
 
     core::memory::initialize();
 
@@ -373,7 +383,7 @@ int main()
 
     CORE_ASSERT( network::IsNetworkInitialized() );
 
-    soak_test();
+    soak_test( seed );
 
     network::ShutdownNetwork();
 
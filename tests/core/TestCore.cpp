@@ -3,8 +3,11 @@
 #include "core/Array.h"
 #include "core/Hash.h"
 #include "core/Queue.h"
+#include "core/Random.h"
+#include "core/JobSystem.h"
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <time.h>
 
 void test_sequence()
@@ -315,6 +318,149 @@ void test_pointer_arithmetic()
     }
 }
 
+void test_random()
+{
+    printf( "test_random\n" );
+
+    // same seed must reproduce the same sequence
+
+    {
+        core::RandomGenerator a( 12345 );
+        core::RandomGenerator b( 12345 );
+        for ( int i = 0; i < 1000; ++i )
+            CORE_CHECK( a.GetUint32() == b.GetUint32() );
+    }
+
+    // different seeds diverge
+
+    {
+        core::RandomGenerator a( 1 );
+        core::RandomGenerator b( 2 );
+        int numMatches = 0;
+        for ( int i = 0; i < 1000; ++i )
+        {
+            if ( a.GetUint32() == b.GetUint32() )
+                numMatches++;
+        }
+        CORE_CHECK( numMatches < 10 );
+    }
+
+    // ranges are inclusive and every value is hit
+
+    {
+        core::RandomGenerator random( 1000 );
+        int counts[7];
+        memset( counts, 0, sizeof( counts ) );
+        for ( int i = 0; i < 7000; ++i )
+        {
+            const int value = random.GetInt( -3, +3 );
+            CORE_CHECK( value >= -3 );
+            CORE_CHECK( value <= +3 );
+            counts[value+3]++;
+        }
+        for ( int i = 0; i < 7; ++i )
+            CORE_CHECK( counts[i] > 700 );
+
+        for ( int i = 0; i < 10000; ++i )
+        {
+            const float value = random.GetFloat( -1.0f, +1.0f );
+            CORE_CHECK( value >= -1.0f );
+            CORE_CHECK( value <= +1.0f );
+            CORE_CHECK( random.GenerateId() != 0 );
+        }
+    }
+
+    // batched floats match the sequence of the generator and stay in range
+
+    {
+        const int NumValues = 1000;
+        float values[NumValues];
+        core::RandomGenerator a( 555 );
+        core::RandomGenerator b( 555 );
+        a.GetFloats( values, NumValues );
+        for ( int i = 0; i < NumValues; ++i )
+        {
+            CORE_CHECK( values[i] >= 0.0f );
+            CORE_CHECK( values[i] < 1.0f );
+            CORE_CHECK( values[i] == b.GetFloat() );
+        }
+    }
+
+    // seeding the default generator makes the global functions reproducible
+
+    {
+        core::random_seed( 42 );
+        const int a = core::random_int( 0, 1000000 );
+        const uint16_t id_a = core::generate_id();
+        core::random_seed( 42 );
+        const int b = core::random_int( 0, 1000000 );
+        const uint16_t id_b = core::generate_id();
+        CORE_CHECK( a == b );
+        CORE_CHECK( id_a == id_b );
+    }
+}
+
+static std::atomic<int> job_thread_starts;
+static std::atomic<int> job_thread_stops;
+
+static void count_job_thread_start( void * /*context*/ )
+{
+    job_thread_starts++;
+}
+
+static void count_job_thread_stop( void * /*context*/ )
+{
+    job_thread_stops++;
+}
+
+static void square_job( void * data, int index )
+{
+    int * values = (int*) data;
+    values[index] = values[index] * values[index];
+}
+
+void test_job_system()
+{
+    printf( "test_job_system\n" );
+
+    CORE_CHECK( core::get_num_cores() >= 1 );
+
+    // each job runs exactly once, regardless of the number of workers
+
+    for ( int num_threads = 0; num_threads <= 4; ++num_threads )
+    {
+        job_thread_starts = 0;
+        job_thread_stops = 0;
+
+        {
+            core::JobSystemConfig config;
+            config.num_threads = num_threads;
+            config.thread_start = count_job_thread_start;
+            config.thread_stop = count_job_thread_stop;
+
+            core::JobSystem job_system( config );
+
+            CORE_CHECK( job_system.GetNumThreads() == num_threads + 1 );
+
+            const int MaxJobs = 100;
+            int values[MaxJobs];
+
+            for ( int iteration = 0; iteration < 100; ++iteration )
+            {
+                const int count = iteration % MaxJobs;
+                for ( int i = 0; i < count; ++i )
+                    values[i] = i + iteration;
+                job_system.Run( square_job, values, count );
+                for ( int i = 0; i < count; ++i )
+                    CORE_CHECK( values[i] == ( i + iteration ) * ( i + iteration ) );
+            }
+        }
+
+        CORE_CHECK( job_thread_starts == num_threads );
+        CORE_CHECK( job_thread_stops == num_threads );
+    }
+}
+
 int main()
 {
     srand( (uint32_t) time( nullptr ) );
@@ -330,6 +476,8 @@ int main()
     test_pointer_arithmetic();
     test_sequence();
     test_endian();
+    test_random();
+    test_job_system();
 
     return 0;
 }
@@ -0,0 +1,1810 @@
+#include "core/Core.h"
+#include "core/JobSystem.h"
+#include "cubes/Game.h"
+#include "cubes/Hypercube.h"
+#include "cubes/Interest.h"
+#include "cubes/Prediction.h"
+#include "cubes/View.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+#if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+    #pragma comment( lib, "psapi.lib" )
+
+    #ifdef GetObject
+    #undef GetObject
+    #endif // #ifdef GetObject
+
+#else // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+    #include <unistd.h>
+    #if defined( __GLIBC__ )
+    #include <malloc.h>
+    #endif // #if defined( __GLIBC__ )
+
+#endif // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+
+// steps independent cube rooms across the job system to measure how many rooms each core can sustain,
+// then compares array of structures vs. structure of arrays active object storage on a single room,
+// then compares push radius queries over 10k active cubes: brute force vs. proximity grid,
+// then solves separate towers of cubes with an increasing number of island threads,
+// then counts heap allocations per simulation update while a pile of cubes builds its interaction graph,
+// then compares collision broadphases on the same pile,
+// then compares ode's generic dCollide against the batched box narrowphase on the same pile,
+// then saves and restores the pile in bulk and measures rolling back and resimulating n frames,
+// then predicts a room ahead of a server at increasing latency and measures the cost of reconciling,
+// then measures activation as players move, and how the cost scales with the activation radius,
+// then starts a world from a world file instead of inserting every object, and streams cells in and out as players move,
+// measuring the memory the process really gains for each,
+// then picks the objects to send to each of many clients with a full sort vs. selecting the top k,
+// then accumulates per-client priorities over every active object vs. only the grid cells each client can see,
+// then compresses positions and orientations one object at a time vs. four at a time,
+// then integrates and converts objects with plain floats vs. the simd4f backed cubes math,
+// then updates and blends the view objects a client draws, from 1k up to 10k objects
+
+typedef game::Instance<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectSet> GameInstance;
+typedef game::Instance<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectArrays> GameInstanceArrays;
+
+extern "C" 
+{
+    extern void dRandSetSeed( unsigned int seed );
+}
+
+// count every allocation so per-frame allocation churn shows up in the profile
+
+static std::atomic<uint64_t> num_allocations( 0 );
+
+void * operator new( size_t size )
+{
+    num_allocations++;
+    void * p = malloc( size ? size : 1 );
+    if ( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+// gcc sees new expressions paired with these inlined deletes and warns that free is called on memory from operator new,
+// but here operator new is malloc, so free is the right match
+
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete( void * p ) noexcept
+{
+    free( p );
+}
+
+void operator delete( void * p, size_t ) noexcept
+{
+    free( p );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+// what the process really holds in memory, as the os sees it. resident counts mapped file pages too,
+// which the os can drop again whenever it likes. anonymous is the memory only the process has a copy of
+
+struct ProcessMemory
+{
+    uint64_t resident;
+    uint64_t anonymous;
+};
+
+static ProcessMemory get_process_memory()
+{
+    ProcessMemory memory;
+    memory.resident = 0;
+    memory.anonymous = 0;
+    #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS_EX counters;
+    if ( GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*) &counters, sizeof( counters ) ) )
+    {
+        memory.resident = counters.WorkingSetSize;
+        memory.anonymous = counters.PrivateUsage;
+    }
+    #else // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+    #if defined( __GLIBC__ )
+    // hand pages freed earlier back to the os first, or memory reused from an earlier profile never shows up
+    malloc_trim( 0 );
+    #endif // #if defined( __GLIBC__ )
+    FILE * file = fopen( "/proc/self/statm", "r" );
+    if ( file )
+    {
+        unsigned long long size, resident, shared;
+        if ( fscanf( file, "%llu %llu %llu", &size, &resident, &shared ) == 3 )
+        {
+            const uint64_t page_size = sysconf( _SC_PAGESIZE );
+            memory.resident = resident * page_size;
+            memory.anonymous = ( resident - shared ) * page_size;
+        }
+        fclose( file );
+    }
+    #endif // #if CORE_PLATFORM == CORE_PLATFORM_WINDOWS
+    return memory;
+}
+
+static double megabytes( int64_t bytes )
+{
+    return bytes / ( 1000.0 * 1000.0 );
+}
+
+const int CubeSteps = 30;
+const int NumFrames = 120;
+const int MaxRoomsPerCore = 4;
+const float DeltaTime = 1.0f / 60.0f;
+const int NumDatabaseObjects = 1000000;
+const float ActivationWorldSize = 2000.0f;
+const float ActivationRadius = 32.0f;
+
+struct Room
+{
+    uint32_t frame = 0;
+    GameInstance * instance = nullptr;
+};
+
+template <typename Instance> static void AddCube( Instance * instance, int player, float x, float y, float z )
+{
+    hypercube::DatabaseObject object;
+    cubes::CompressPosition( math::Vector( x, y, z ), object.position );
+    cubes::CompressOrientation( math::Quaternion(1,0,0,0), object.orientation );
+    object.enabled = player;
+    object.session = 0;
+    object.player = player;
+    activation::ObjectId id = instance->AddObject( object, x, y );
+    if ( player )
+        instance->DisableObject( id );
+}
+
+template <typename Instance> static Instance * CreateRoom( bool rollback = false )
+{
+    game::Config config;
+
+    config.maxObjects = CubeSteps * CubeSteps + MaxPlayers + 1;
+    config.deactivationTime = 0.5f;
+    config.cellSize = 2.0f;
+    config.cellWidth = int( CubeSteps / config.cellSize + 2 * 2 );
+    config.cellHeight = config.cellWidth;
+    config.activationDistance = 100.0f;
+
+    config.simConfig.ERP = 0.25f;
+    config.simConfig.CFM = 0.001f;
+    config.simConfig.MaxIterations = 64;
+    config.simConfig.MaximumCorrectingVelocity = 250.0f;
+    config.simConfig.ContactSurfaceLayer = 0.01f;
+    config.simConfig.Elasticity = 0.0f;
+    config.simConfig.LinearDrag = 0.001f;
+    config.simConfig.AngularDrag = 0.001f;
+    config.simConfig.Friction = 200.0f;
+    config.simConfig.SortBroadphasePairs = rollback;
+
+    Instance * instance = new Instance( config );
+
+    instance->InitializeBegin();
+
+    instance->AddPlane( math::Vector(0,0,1), 0 );
+
+    AddCube( instance, 1, 0, 0, 10 );
+
+    const float origin = -CubeSteps / 2.0f;
+    const float z = hypercube::NonPlayerCubeSize / 2.0f;
+    for ( int y = 0; y < CubeSteps; ++y )
+        for ( int x = 0; x < CubeSteps; ++x )
+            AddCube( instance, 0, x + origin + 0.5f, y + origin + 0.5f, z );
+
+    instance->InitializeEnd();
+
+    instance->OnPlayerJoined( 0 );
+    instance->SetLocalPlayer( 0 );
+    instance->SetPlayerFocus( 0, 1 );
+
+    instance->SetFlag( game::FLAG_Push );
+    instance->SetFlag( game::FLAG_Pull );
+
+    return instance;
+}
+
+template <typename Instance> static void UpdateRoom( Instance * instance, uint32_t frame )
+{
+    // alternate pushing and pulling while rolling around so the room stays busy
+
+    game::Input input;
+    input.left = ( frame / 40 ) % 2 == 0;
+    input.up = true;
+    input.push = ( frame / 30 ) % 2 == 0;
+    input.pull = !input.push;
+
+    instance->SetPlayerInput( 0, input );
+
+    dRandSetSeed( frame );
+
+    instance->Update( DeltaTime );
+}
+
+static void UpdateRoomJob( void * data, int index )
+{
+    Room & room = ( (Room*) data )[index];
+
+    UpdateRoom( room.instance, room.frame );
+
+    room.frame++;
+}
+
+template <typename Instance> static uint64_t GetRoomChecksum( Instance * instance )
+{
+    uint64_t checksum = 0;
+    hypercube::ActiveObject object;
+    for ( int id = 1; id <= CubeSteps * CubeSteps + 1; ++id )
+    {
+        if ( !instance->IsObjectActive( id ) )
+            continue;
+        instance->GetObjectState( id, object );
+        uint32_t bits[3];
+        memcpy( bits, &object.position, sizeof( bits ) );
+        checksum = checksum * 31 + bits[0];
+        checksum = checksum * 31 + bits[1];
+        checksum = checksum * 31 + bits[2];
+    }
+    return checksum;
+}
+
+static void InitializeRoomThread( void * /*context*/ )
+{
+    cubes::Simulation::InitializeThread();
+}
+
+template <typename Instance> static double ProfileRoom( const char * layout, uint64_t & checksum )
+{
+    Instance * instance = CreateRoom<Instance>();
+
+    double min_frame_ms = 1000000.0;
+    double total_ms = 0.0;
+
+    for ( int frame = 0; frame < NumFrames * 4; ++frame )
+    {
+        const uint64_t start = core::nanoseconds();
+        UpdateRoom( instance, frame );
+        const double frame_ms = ( core::nanoseconds() - start ) / 1000000.0;
+        min_frame_ms = core::min( min_frame_ms, frame_ms );
+        total_ms += frame_ms;
+    }
+
+    printf( "%-24s  %14d  %10.3f  %10.3f\n", layout, instance->GetNumActiveObjects(), total_ms / ( NumFrames * 4 ), min_frame_ms );
+
+    checksum = GetRoomChecksum( instance );
+
+    delete instance;
+
+    return total_ms;
+}
+
+static void ProfileActiveObjectLayout()
+{
+    printf( "\nactive object layout      active objects  frame (ms)    min (ms)\n" );
+
+    uint64_t checksum_structures = 0;
+    uint64_t checksum_arrays = 0;
+
+    const double structures_ms = ProfileRoom<GameInstance>( "array of structures", checksum_structures );
+    const double arrays_ms = ProfileRoom<GameInstanceArrays>( "structure of arrays", checksum_arrays );
+
+    printf( "\nstructure of arrays saves %.3fms per frame (%.1f%%), results %s\n", 
+        ( structures_ms - arrays_ms ) / ( NumFrames * 4 ), 
+        ( structures_ms - arrays_ms ) / structures_ms * 100.0,
+        checksum_structures == checksum_arrays ? "identical" : "DIFFERENT" );
+}
+
+static int FindPushedObjects( const float * x, const float * y, const float * z, int count, const math::Vector & push_origin, std::vector<int> & candidates, bool brute_force )
+{
+    // same distance test as push in game::Instance::ProcessPlayerInput
+
+    int pushed = 0;
+    const int num_candidates = brute_force ? count : (int) candidates.size();
+    for ( int j = 0; j < num_candidates; ++j )
+    {
+        const int i = brute_force ? j : candidates[j];
+        const math::Vector difference = math::Vector( x[i], y[i], z[i] ) - push_origin;
+        const float distanceSquared = difference.lengthSquared();
+        if ( distanceSquared > 0.01f * 0.01f && distanceSquared < game::PushRadius * game::PushRadius )
+            pushed += i;
+    }
+    return pushed;
+}
+
+static void ProfileProximityGrid()
+{
+    const int NumObjects = 10000;
+    const int NumPlayers = 16;
+    const float WorldSize = 100.0f;
+
+    std::vector<float> x( NumObjects ), y( NumObjects ), z( NumObjects );
+    for ( int i = 0; i < NumObjects; ++i )
+    {
+        x[i] = core::random_float( -WorldSize / 2, WorldSize / 2 );
+        y[i] = core::random_float( -WorldSize / 2, WorldSize / 2 );
+        z[i] = core::random_float( 0.0f, 1.0f );
+    }
+
+    math::Vector push_origin[NumPlayers];
+    for ( int i = 0; i < NumPlayers; ++i )
+        push_origin[i] = math::Vector( core::random_float( -WorldSize / 2, WorldSize / 2 ), core::random_float( -WorldSize / 2, WorldSize / 2 ), -0.1f );
+
+    activation::ProximityGrid grid;
+    std::vector<int> candidates;
+
+    uint64_t brute_force_checksum = 0;
+    uint64_t grid_checksum = 0;
+    int num_candidates = 0;
+
+    const uint64_t brute_force_start = core::nanoseconds();
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        for ( int player = 0; player < NumPlayers; ++player )
+            brute_force_checksum += FindPushedObjects( &x[0], &y[0], &z[0], NumObjects, push_origin[player], candidates, true );
+    }
+    const uint64_t brute_force_finish = core::nanoseconds();
+
+    const uint64_t grid_start = core::nanoseconds();
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        grid.Begin( NumObjects );
+        for ( int i = 0; i < NumObjects; ++i )
+            grid.Insert( i, x[i], y[i] );
+        grid.End();
+
+        for ( int player = 0; player < NumPlayers; ++player )
+        {
+            grid.Query( push_origin[player].x, push_origin[player].y, game::PushRadius, candidates );
+            num_candidates += (int) candidates.size();
+            grid_checksum += FindPushedObjects( &x[0], &y[0], &z[0], NumObjects, push_origin[player], candidates, false );
+        }
+    }
+    const uint64_t grid_finish = core::nanoseconds();
+
+    const double brute_force_ms = ( brute_force_finish - brute_force_start ) / 1000000.0 / NumFrames;
+    const double grid_ms = ( grid_finish - grid_start ) / 1000000.0 / NumFrames;
+
+    printf( "\npush queries: %d active objects, %d players\n\n", NumObjects, NumPlayers );
+    printf( "brute force     %.3fms per frame, %d objects visited per player\n", brute_force_ms, NumObjects );
+    printf( "proximity grid  %.3fms per frame, %d objects visited per player (including grid build)\n", grid_ms, num_candidates / ( NumFrames * NumPlayers ) );
+    printf( "\nresults %s\n", brute_force_checksum == grid_checksum ? "identical" : "DIFFERENT" );
+}
+
+static uint64_t ProfileIslands( int island_threads )
+{
+    const int TowerSteps = 16;
+    const int TowerHeight = 4;
+    const float TowerSpacing = 4.0f;
+
+    cubes::SimulationConfig config;
+    config.MaxIterations = 64;
+    config.IslandThreads = island_threads;
+
+    cubes::Simulation * simulation = new cubes::Simulation();
+
+    simulation->Initialize( config );
+
+    simulation->AddPlane( math::Vector(0,0,1), 0 );
+
+    // every tower is its own island. the wobble keeps them toppling so they don't fall asleep
+
+    std::vector<int> ids;
+    for ( int y = 0; y < TowerSteps; ++y )
+    {
+        for ( int x = 0; x < TowerSteps; ++x )
+        {
+            for ( int z = 0; z < TowerHeight; ++z )
+            {
+                cubes::SimulationObjectState state;
+                state.enabled = true;
+                state.scale = 1.0f;
+                state.position = math::Vector( ( x - TowerSteps / 2 ) * TowerSpacing, ( y - TowerSteps / 2 ) * TowerSpacing, 0.5f + z * 1.01f );
+                state.orientation = math::Quaternion(1,0,0,0);
+                state.linearVelocity = math::Vector(0,0,0);
+                state.angularVelocity = math::Vector( 0.1f * ( ( x + z ) % 3 ), 0.1f * ( ( y + z ) % 5 ), 0 );
+                ids.push_back( simulation->AddObject( state ) );
+            }
+        }
+    }
+
+    dRandSetSeed( 0 );
+
+    uint64_t island_time = 0;
+    uint64_t max_island_time = 0;
+    int num_islands = 0;
+
+    const uint64_t start = core::nanoseconds();
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        simulation->Update( DeltaTime );
+
+        num_islands += simulation->GetNumIslands();
+
+        uint64_t frame_max_island_time = 0;
+        for ( int i = 0; i < simulation->GetNumIslands(); ++i )
+        {
+            const cubes::SimulationIslandStats & island = simulation->GetIslandStats( i );
+            island_time += island.time;
+            frame_max_island_time = core::max( frame_max_island_time, island.time );
+        }
+        max_island_time += frame_max_island_time;
+    }
+
+    const uint64_t finish = core::nanoseconds();
+
+    uint64_t checksum = 0;
+    for ( int i = 0; i < (int) ids.size(); ++i )
+    {
+        cubes::SimulationObjectState state;
+        simulation->GetObjectState( ids[i], state );
+        uint32_t bits[3];
+        memcpy( bits, &state.position, sizeof( bits ) );
+        checksum = checksum * 31 + bits[0];
+        checksum = checksum * 31 + bits[1];
+        checksum = checksum * 31 + bits[2];
+    }
+
+    simulation->Reset();
+
+    delete simulation;
+
+    printf( "%14d  %7d  %10.3f  %15.3f  %17.3f\n", island_threads, num_islands / NumFrames, 
+        ( finish - start ) / 1000000.0 / NumFrames, island_time / 1000000.0 / NumFrames, max_island_time / 1000000.0 / NumFrames );
+
+    return checksum;
+}
+
+static void ProfileIslandThreads()
+{
+    printf( "\nisland threads  islands  frame (ms)  islands (ms/cpu)  largest island (ms)\n" );
+
+    // one thread steps islands in order on the world's own random sequence, and gathers no island stats.
+    // with more threads each island is seeded separately, so the result must not depend on the thread count
+
+    ProfileIslands( 1 );
+
+    const uint64_t checksum = ProfileIslands( 2 );
+
+    bool deterministic = true;
+    for ( int island_threads = 4; island_threads <= 8; island_threads *= 2 )
+    {
+        if ( ProfileIslands( island_threads ) != checksum )
+            deterministic = false;
+    }
+
+    printf( "\nresults %s\n", deterministic ? "identical" : "DIFFERENT" );
+}
+
+const int PileSteps = 16;
+const int PileHeight = 4;
+
+static cubes::Simulation * CreatePile( const cubes::SimulationConfig & config )
+{
+    cubes::Simulation * simulation = new cubes::Simulation();
+
+    simulation->Initialize( config );
+
+    simulation->AddPlane( math::Vector(0,0,1), 0 );
+
+    // a tightly packed pile of 1024 cubes so every cube touches its neighbours
+
+    for ( int z = 0; z < PileHeight; ++z )
+    {
+        for ( int y = 0; y < PileSteps; ++y )
+        {
+            for ( int x = 0; x < PileSteps; ++x )
+            {
+                cubes::SimulationObjectState state;
+                state.enabled = true;
+                state.scale = 1.0f;
+                state.position = math::Vector( x - PileSteps / 2, y - PileSteps / 2, 0.5f + z );
+                state.orientation = math::Quaternion(1,0,0,0);
+                state.linearVelocity = math::Vector(0,0,0);
+                state.angularVelocity = math::Vector(0,0,0);
+                simulation->AddObject( state );
+            }
+        }
+    }
+
+    return simulation;
+}
+
+static void ProfileInteractionGraph()
+{
+    const int WarmupFrames = 10;
+
+    cubes::Simulation * simulation = CreatePile( cubes::SimulationConfig() );
+
+    dRandSetSeed( 0 );
+
+    for ( int frame = 0; frame < WarmupFrames; ++frame )
+        simulation->Update( DeltaTime );
+
+    uint64_t num_pairs = 0;
+
+    const uint64_t start_allocations = num_allocations;
+    const uint64_t start = core::nanoseconds();
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        simulation->Update( DeltaTime );
+        num_pairs += simulation->GetNumInteractionPairs();
+    }
+
+    const uint64_t finish = core::nanoseconds();
+    const uint64_t finish_allocations = num_allocations;
+
+    printf( "\ninteraction graph: %d cubes, %d interaction pairs per frame\n\n", PileSteps * PileSteps * PileHeight, int( num_pairs / NumFrames ) );
+    printf( "update %.3fms per frame, %.1f allocations per frame\n", ( finish - start ) / 1000000.0 / NumFrames, double( finish_allocations - start_allocations ) / NumFrames );
+
+    simulation->Reset();
+
+    delete simulation;
+}
+
+static void ProfileBroadphase( cubes::SimulationBroadphase broadphase, const char * name )
+{
+    cubes::SimulationConfig config;
+    config.Broadphase = broadphase;
+
+    cubes::Simulation * simulation = CreatePile( config );
+
+    dRandSetSeed( 0 );
+
+    uint64_t num_pairs = 0;
+    uint64_t num_interactions = 0;
+    uint64_t collision_time = 0;
+
+    const uint64_t start = core::nanoseconds();
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        simulation->Update( DeltaTime );
+        num_pairs += simulation->GetNumBroadphasePairs();
+        num_interactions += simulation->GetNumInteractionPairs();
+        collision_time += simulation->GetCollisionTime();
+    }
+
+    const uint64_t finish = core::nanoseconds();
+
+    printf( "%-16s  %14d  %12d  %14.3f  %10.3f\n", name, int( num_pairs / NumFrames ), int( num_interactions / NumFrames ), 
+        collision_time / 1000000.0 / NumFrames, ( finish - start ) / 1000000.0 / NumFrames );
+
+    simulation->Reset();
+
+    delete simulation;
+}
+
+static void ProfileBroadphases()
+{
+    printf( "\nbroadphase        candidate pairs  contact pairs  collision (ms)  frame (ms)\n" );
+
+    ProfileBroadphase( cubes::BROADPHASE_QuadTree, "quadtree" );
+    ProfileBroadphase( cubes::BROADPHASE_SweepAndPrune, "sweep and prune" );
+    ProfileBroadphase( cubes::BROADPHASE_Hash, "hash" );
+    ProfileBroadphase( cubes::BROADPHASE_Grid, "grid" );
+}
+
+static uint64_t ProfileNarrowphase( bool box_narrowphase, const char * name )
+{
+    cubes::SimulationConfig config;
+    config.BoxNarrowphase = box_narrowphase;
+
+    cubes::Simulation * simulation = CreatePile( config );
+
+    dRandSetSeed( 0 );
+
+    uint64_t num_pairs = 0;
+    uint64_t collision_time = 0;
+
+    const uint64_t start = core::nanoseconds();
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        simulation->Update( DeltaTime );
+        num_pairs += simulation->GetNumBroadphasePairs();
+        collision_time += simulation->GetCollisionTime();
+    }
+
+    const uint64_t finish = core::nanoseconds();
+
+    uint64_t checksum = 0;
+    for ( int i = 0; i < PileSteps * PileSteps * PileHeight; ++i )
+    {
+        if ( !simulation->ObjectExists( i ) )
+            continue;
+        cubes::SimulationObjectState state;
+        simulation->GetObjectState( i, state );
+        uint32_t bits[3];
+        memcpy( bits, &state.position, sizeof( bits ) );
+        checksum = checksum * 31 + bits[0];
+        checksum = checksum * 31 + bits[1];
+        checksum = checksum * 31 + bits[2];
+    }
+
+    simulation->Reset();
+
+    delete simulation;
+
+    printf( "%-16s  %14d  %14.3f  %16.3f  %10.3f\n", name, int( num_pairs / NumFrames ), collision_time / 1000000.0 / NumFrames,
+        collision_time / 1000.0 / double( num_pairs ), ( finish - start ) / 1000000.0 / NumFrames );
+
+    return checksum;
+}
+
+static void ProfileNarrowphases()
+{
+    printf( "\nnarrowphase       candidate pairs  collision (ms)   per pair (us)  frame (ms)\n" );
+
+    const uint64_t ode_checksum = ProfileNarrowphase( false, "ode dCollide" );
+    const uint64_t box_checksum = ProfileNarrowphase( true, "box batched simd" );
+
+    printf( "\nresults %s\n", ode_checksum == box_checksum ? "identical" : "DIFFERENT" );
+}
+
+const int RollbackRepeats = 8;
+
+static uint64_t GetSimulationChecksum( cubes::Simulation * simulation )
+{
+    cubes::SimulationState state;
+    simulation->SaveState( state );
+    uint64_t checksum = 0;
+    for ( int i = 0; i < (int) state.bodies.size(); ++i )
+    {
+        const cubes::SimulationBodyState & body = state.bodies[i];
+        uint32_t bits[13];
+        memcpy( bits, body.position, sizeof( body.position ) );
+        memcpy( bits + 3, body.orientation, sizeof( body.orientation ) );
+        memcpy( bits + 7, body.linearVelocity, sizeof( body.linearVelocity ) );
+        memcpy( bits + 10, body.angularVelocity, sizeof( body.angularVelocity ) );
+        for ( int j = 0; j < 13; ++j )
+            checksum = checksum * 31 + bits[j];
+    }
+    return checksum;
+}
+
+static void ProfileRollback()
+{
+    cubes::SimulationConfig config;
+    config.SortBroadphasePairs = true;
+
+    cubes::Simulation * simulation = CreatePile( config );
+
+    dRandSetSeed( 0 );
+
+    // let the pile start to collapse so most cubes are awake and touching
+
+    for ( int frame = 0; frame < 10; ++frame )
+        simulation->Update( DeltaTime );
+
+    const int num_objects = PileSteps * PileSteps * PileHeight;
+
+    // bulk save and restore vs. round tripping each object through get/set object state
+
+    cubes::SimulationState saved;
+    std::vector<cubes::SimulationObjectState> object_states( num_objects );
+
+    uint64_t save_time = 0;
+    uint64_t restore_time = 0;
+    uint64_t object_save_time = 0;
+    uint64_t object_restore_time = 0;
+
+    for ( int i = 0; i < RollbackRepeats; ++i )
+    {
+        uint64_t start = core::nanoseconds();
+        simulation->SaveState( saved );
+        save_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        simulation->RestoreState( saved );
+        restore_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        for ( int j = 0; j < num_objects; ++j )
+            simulation->GetObjectState( j, object_states[j] );
+        object_save_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        for ( int j = 0; j < num_objects; ++j )
+            simulation->SetObjectState( j, object_states[j], true );
+        object_restore_time += core::nanoseconds() - start;
+
+        simulation->RestoreState( saved );
+    }
+
+    printf( "\nrollback: %d cubes, %d byte state\n\n", num_objects, int( saved.bodies.size() * sizeof( cubes::SimulationBodyState ) ) );
+    printf( "state             save (ms)  restore (ms)\n" );
+    printf( "bulk              %9.3f  %12.3f\n", save_time / 1000000.0 / RollbackRepeats, restore_time / 1000000.0 / RollbackRepeats );
+    printf( "per object        %9.3f  %12.3f\n", object_save_time / 1000000.0 / RollbackRepeats, object_restore_time / 1000000.0 / RollbackRepeats );
+
+    // roll back n frames and resimulate them, as a client does when a correction arrives or a server rewinds.
+    // resimulating from a restored state must land exactly where the original frames did
+
+    printf( "\nframes  simulate (ms)  restore (ms)  resimulate (ms)  deterministic\n" );
+
+    for ( int num_frames = 1; num_frames <= 16; num_frames *= 2 )
+    {
+        uint64_t simulate_time = 0;
+        uint64_t resimulate_time = 0;
+        restore_time = 0;
+        bool deterministic = true;
+
+        for ( int i = 0; i < RollbackRepeats; ++i )
+        {
+            simulation->SaveState( saved );
+
+            uint64_t start = core::nanoseconds();
+            for ( int frame = 0; frame < num_frames; ++frame )
+                simulation->Update( DeltaTime );
+            simulate_time += core::nanoseconds() - start;
+
+            const uint64_t checksum = GetSimulationChecksum( simulation );
+
+            start = core::nanoseconds();
+            simulation->RestoreState( saved );
+            restore_time += core::nanoseconds() - start;
+
+            start = core::nanoseconds();
+            for ( int frame = 0; frame < num_frames; ++frame )
+                simulation->Update( DeltaTime );
+            resimulate_time += core::nanoseconds() - start;
+
+            if ( GetSimulationChecksum( simulation ) != checksum )
+                deterministic = false;
+        }
+
+        printf( "%6d  %13.3f  %12.3f  %15.3f  %s\n", num_frames, simulate_time / 1000000.0 / RollbackRepeats, 
+            restore_time / 1000000.0 / RollbackRepeats, resimulate_time / 1000000.0 / RollbackRepeats, deterministic ? "yes" : "no" );
+    }
+
+    simulation->Reset();
+
+    delete simulation;
+}
+
+typedef game::Prediction<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectSet> GamePrediction;
+
+static void ProfilePrediction( int latency )
+{
+    // the server nudges the player every so often, which the client can't predict. the client hears about the
+    // server's state for every frame, latency frames later, so it rewinds and resimulates latency frames per update
+
+    GameInstance * server = CreateRoom<GameInstance>( true );
+    GameInstance * client = CreateRoom<GameInstance>( true );
+
+    game::PredictionConfig config;
+    config.maxResimulatedFrames = 32;
+
+    GamePrediction prediction( client, config );
+
+    std::vector< std::vector<hypercube::ActiveObject> > sent( latency + 1 );
+
+    uint64_t client_time = 0;
+
+    for ( uint32_t frame = 0; frame < NumFrames; ++frame )
+    {
+        if ( frame % 30 == 15 )
+        {
+            hypercube::ActiveObject player;
+            server->GetObjectState( 1, player );
+            player.linearVelocity.x += 5.0f;
+            server->SetObjectState( 1, player );
+        }
+
+        std::vector<hypercube::ActiveObject> & state = sent[frame % sent.size()];
+        state.resize( server->GetNumActiveObjects() );
+        int count = 0;
+        server->CopyActiveObjects( &state[0], count );
+
+        UpdateRoom( server, frame );
+
+        if ( frame >= (uint32_t) latency )
+        {
+            const std::vector<hypercube::ActiveObject> & received = sent[( frame - latency ) % sent.size()];
+            prediction.SetAuthoritativeState( frame - latency, &received[0], (int) received.size() );
+        }
+
+        game::Input input;
+        input.left = ( frame / 40 ) % 2 == 0;
+        input.up = true;
+        input.push = ( frame / 30 ) % 2 == 0;
+        input.pull = !input.push;
+
+        dRandSetSeed( frame );
+
+        const uint64_t start = core::nanoseconds();
+        prediction.Update( input, DeltaTime );
+        client_time += core::nanoseconds() - start;
+    }
+
+    const game::PredictionStats & stats = prediction.GetStats();
+
+    const double corrections = stats.numCorrections ? double( stats.numCorrections ) : 1.0;
+
+    printf( "%7d  %11d  %7d  %17.1f  %14.4f  %10.4f  %14.3f  %10.3f  %10.3f\n", latency, int( stats.numCorrections ), int( stats.numSkippedCorrections ),
+        stats.numResimulatedFrames / corrections, stats.totalPositionError / corrections, stats.maxPositionError,
+        stats.totalResimulateTime / 1000000.0 / corrections, stats.maxResimulateTime / 1000000.0, client_time / 1000000.0 / NumFrames );
+
+    delete client;
+    delete server;
+}
+
+static void ProfilePredictions()
+{
+    printf( "\nlatency  corrections  skipped  resimulated frames  position error  max error  resimulate (ms)  max (ms)  frame (ms)\n" );
+
+    for ( int latency = 2; latency <= 32; latency *= 2 )
+        ProfilePrediction( latency );
+}
+
+static void MoveActivationPoints( activation::ActivationSystem & activation_system, int num_players, math::Vector * velocity, bool rescan )
+{
+    for ( int i = 0; i < num_players; ++i )
+    {
+        float x = activation_system.GetX( i ) + velocity[i].x * DeltaTime;
+        float y = activation_system.GetY( i ) + velocity[i].y * DeltaTime;
+        if ( x < -ActivationWorldSize / 2 || x > ActivationWorldSize / 2 )
+            velocity[i].x = -velocity[i].x;
+        if ( y < -ActivationWorldSize / 2 || y > ActivationWorldSize / 2 )
+            velocity[i].y = -velocity[i].y;
+
+        if ( rescan )
+        {
+            // what a full rescan of the circle would cost
+            activation_system.RemoveActivationPoint( i );
+            activation_system.AddActivationPoint( i, x, y );
+        }
+        else
+            activation_system.MoveActivationPoint( i, x, y );
+    }
+
+    activation_system.Update( DeltaTime );
+    activation_system.ClearEvents();
+}
+
+static void ProfileActivation()
+{
+    activation::ActivationSystem activation_system( NumDatabaseObjects + 1, ActivationRadius, 512, 512, 4.0f, 8, 1024 );
+
+    const uint64_t insert_start = core::nanoseconds();
+    for ( int i = 1; i <= NumDatabaseObjects; ++i )
+        activation_system.InsertObject( i, core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 ), core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 ) );
+    const uint64_t insert_finish = core::nanoseconds();
+
+    printf( "\nactivation: %d objects (inserted in %.1fms), %.0fm activation radius\n\n", NumDatabaseObjects, ( insert_finish - insert_start ) / 1000000.0, ActivationRadius );
+    printf( "players  active objects  incremental (ms)  rescan (ms)  standing still (ms)\n" );
+
+    activation_system.RemoveActivationPoint( 0 );
+    activation_system.Update( DeltaTime );
+
+    math::Vector velocity[activation::ActivationSystem::MaxActivationPoints];
+
+    for ( int num_players = 1; num_players <= activation::ActivationSystem::MaxActivationPoints; num_players *= 2 )
+    {
+        for ( int i = 0; i < num_players; ++i )
+        {
+            const float angle = core::random_float( 0.0f, 2.0f * math::pi );
+            velocity[i] = math::Vector( cos( angle ), sin( angle ), 0 ) * MaxLinearSpeed / 4;
+            activation_system.AddActivationPoint( i, core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 ), core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 ) );
+        }
+
+        MoveActivationPoints( activation_system, num_players, velocity, false );
+
+        uint64_t start = core::nanoseconds();
+        for ( int frame = 0; frame < NumFrames; ++frame )
+            MoveActivationPoints( activation_system, num_players, velocity, false );
+        const double incremental_ms = ( core::nanoseconds() - start ) / 1000000.0 / NumFrames;
+
+        const int active_objects = activation_system.GetActiveCount();
+
+        start = core::nanoseconds();
+        for ( int frame = 0; frame < NumFrames; ++frame )
+            MoveActivationPoints( activation_system, num_players, velocity, true );
+        const double rescan_ms = ( core::nanoseconds() - start ) / 1000000.0 / NumFrames;
+
+        math::Vector still[activation::ActivationSystem::MaxActivationPoints];
+        for ( int i = 0; i < num_players; ++i )
+            still[i] = math::Vector(0,0,0);
+
+        start = core::nanoseconds();
+        for ( int frame = 0; frame < NumFrames; ++frame )
+            MoveActivationPoints( activation_system, num_players, still, false );
+        const double still_ms = ( core::nanoseconds() - start ) / 1000000.0 / NumFrames;
+
+        printf( "%7d  %14d  %16.3f  %11.3f  %19.3f\n", num_players, active_objects, incremental_ms, rescan_ms, still_ms );
+
+        for ( int i = 0; i < num_players; ++i )
+            activation_system.RemoveActivationPoint( i );
+        activation_system.Update( DeltaTime );
+        activation_system.ClearEvents();
+    }
+}
+
+static void ProfileActivationRadius( float radius, int num_players )
+{
+    // incremental and full updates side by side, fed the same player moves
+
+    activation::ActivationSystem incremental( NumDatabaseObjects + 1, radius, 512, 512, 4.0f, 8, 1024 );
+    activation::ActivationSystem full( NumDatabaseObjects + 1, radius, 512, 512, 4.0f, 8, 1024 );
+
+    full.SetIncremental( false );
+
+    for ( int i = 1; i <= NumDatabaseObjects; ++i )
+    {
+        const float x = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        const float y = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        incremental.InsertObject( i, x, y );
+        full.InsertObject( i, x, y );
+    }
+
+    math::Vector velocity[activation::ActivationSystem::MaxActivationPoints];
+    for ( int i = 0; i < num_players; ++i )
+    {
+        const float angle = core::random_float( 0.0f, 2.0f * math::pi );
+        velocity[i] = math::Vector( cos( angle ), sin( angle ), 0 ) * MaxLinearSpeed / 4;
+        const float x = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        const float y = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        if ( i == 0 )
+        {
+            incremental.MoveActivationPoint( x, y );
+            full.MoveActivationPoint( x, y );
+        }
+        else
+        {
+            incremental.AddActivationPoint( i, x, y );
+            full.AddActivationPoint( i, x, y );
+        }
+    }
+
+    incremental.Update( DeltaTime );
+    full.Update( DeltaTime );
+    incremental.ClearEvents();
+    full.ClearEvents();
+
+    uint64_t incremental_time = 0;
+    uint64_t full_time = 0;
+    bool identical = true;
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        float x[activation::ActivationSystem::MaxActivationPoints];
+        float y[activation::ActivationSystem::MaxActivationPoints];
+        for ( int i = 0; i < num_players; ++i )
+        {
+            x[i] = incremental.GetX( i ) + velocity[i].x * DeltaTime;
+            y[i] = incremental.GetY( i ) + velocity[i].y * DeltaTime;
+            if ( x[i] < -ActivationWorldSize / 2 || x[i] > ActivationWorldSize / 2 )
+                velocity[i].x = -velocity[i].x;
+            if ( y[i] < -ActivationWorldSize / 2 || y[i] > ActivationWorldSize / 2 )
+                velocity[i].y = -velocity[i].y;
+        }
+
+        // only the moves are timed, update walks the same active objects either way
+
+        uint64_t start = core::nanoseconds();
+        for ( int i = 0; i < num_players; ++i )
+            incremental.MoveActivationPoint( i, x[i], y[i] );
+        incremental_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        for ( int i = 0; i < num_players; ++i )
+            full.MoveActivationPoint( i, x[i], y[i] );
+        full_time += core::nanoseconds() - start;
+
+        incremental.Update( DeltaTime );
+        full.Update( DeltaTime );
+
+        if ( incremental.GetEventCount() != full.GetEventCount() )
+            identical = false;
+        for ( int i = 0; identical && i < incremental.GetEventCount(); ++i )
+        {
+            if ( incremental.GetEvent( i ).type != full.GetEvent( i ).type || incremental.GetEvent( i ).id != full.GetEvent( i ).id )
+                identical = false;
+        }
+
+        incremental.ClearEvents();
+        full.ClearEvents();
+    }
+
+    printf( "%6.0f  %14d  %21.3f  %14.3f  %s\n", radius, incremental.GetActiveCount(), incremental_time / 1000000.0 / NumFrames, full_time / 1000000.0 / NumFrames, identical ? "yes" : "no" );
+}
+
+static void ProfileActivationRadii()
+{
+    const int num_players = 8;
+
+    printf( "\nactivation radius: %d objects, %d moving players\n\n", NumDatabaseObjects, num_players );
+    printf( "radius  active objects  incremental move (ms)  full move (ms)  identical events\n" );
+
+    for ( float radius = 8.0f; radius <= 128.0f; radius *= 2.0f )
+        ProfileActivationRadius( radius, num_players );
+}
+
+static void ProfileStreaming()
+{
+    const int num_players = 8;
+    const char * filename = "profile_cubes_world.bin";
+
+    // the same world built in memory and written to a world file
+
+    game::Config config;
+    config.maxObjects = NumDatabaseObjects + 1;
+    config.cellWidth = 512;
+    config.cellHeight = 512;
+    config.cellSize = 4.0f;
+    config.initialObjectsPerCell = 8;
+    config.activationDistance = ActivationRadius;
+
+    activation::WorldFileWriter writer( config.cellWidth, config.cellHeight, config.cellSize, sizeof( hypercube::DatabaseObject ) );
+
+    uint64_t build_time = 0;
+
+    uint64_t start = core::nanoseconds();
+    GameInstance * in_memory = new GameInstance( config );
+    build_time += core::nanoseconds() - start;
+
+    in_memory->InitializeBegin();
+    for ( int i = 0; i < NumDatabaseObjects; ++i )
+    {
+        const float x = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        const float y = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        hypercube::DatabaseObject object;
+        memset( &object, 0, sizeof( object ) );
+        cubes::CompressPosition( math::Vector( x, y, hypercube::NonPlayerCubeSize / 2 ), object.position );
+        cubes::CompressOrientation( math::Quaternion(1,0,0,0), object.orientation );
+        start = core::nanoseconds();
+        in_memory->AddObject( object, x, y );
+        build_time += core::nanoseconds() - start;
+        writer.AddObject( x, y, &object );
+    }
+    in_memory->InitializeEnd();
+
+    start = core::nanoseconds();
+    if ( !writer.Write( filename ) )
+    {
+        printf( "\nerror: failed to write %s\n", filename );
+        delete in_memory;
+        return;
+    }
+    const uint64_t write_time = core::nanoseconds() - start;
+
+    start = core::nanoseconds();
+    activation::WorldFile world;
+    if ( !world.Open( filename ) )
+    {
+        printf( "\nerror: failed to open %s\n", filename );
+        delete in_memory;
+        remove( filename );
+        return;
+    }
+    GameInstance * streamed = new GameInstance( config, world );
+    streamed->InitializeBegin();
+    streamed->InitializeEnd();
+    const uint64_t open_time = core::nanoseconds() - start;
+
+    printf( "\nstreaming: %d objects, %d moving players\n\n", NumDatabaseObjects, num_players );
+    printf( "create instance, adding objects: %.1fms\n", build_time / 1000000.0 );
+    printf( "write world file: %.1fms\n", write_time / 1000000.0 );
+    printf( "create instance from world file: %.1fms\n", open_time / 1000000.0 );
+
+    delete streamed;
+    delete in_memory;
+
+    // players walk across the world. the streaming system only keeps cells near them loaded.
+    // each system runs on its own, so the memory the process gains while it runs is down to that system alone
+
+    const int num_frames = NumFrames * 10;
+
+    std::vector<float> path_x( num_frames * num_players );
+    std::vector<float> path_y( num_frames * num_players );
+    {
+        math::Vector velocity[activation::ActivationSystem::MaxActivationPoints];
+        float x[activation::ActivationSystem::MaxActivationPoints];
+        float y[activation::ActivationSystem::MaxActivationPoints];
+        for ( int i = 0; i < num_players; ++i )
+        {
+            const float angle = core::random_float( 0.0f, 2.0f * math::pi );
+            velocity[i] = math::Vector( cos( angle ), sin( angle ), 0 ) * MaxLinearSpeed;
+            x[i] = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+            y[i] = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        }
+        for ( int frame = 0; frame < num_frames; ++frame )
+        {
+            for ( int i = 0; i < num_players; ++i )
+            {
+                path_x[frame*num_players+i] = x[i];
+                path_y[frame*num_players+i] = y[i];
+                x[i] += velocity[i].x * DeltaTime;
+                y[i] += velocity[i].y * DeltaTime;
+                if ( x[i] < -ActivationWorldSize / 2 || x[i] > ActivationWorldSize / 2 )
+                    velocity[i].x = -velocity[i].x;
+                if ( y[i] < -ActivationWorldSize / 2 || y[i] > ActivationWorldSize / 2 )
+                    velocity[i].y = -velocity[i].y;
+            }
+        }
+    }
+
+    std::vector<int> streaming_events( num_frames );
+    std::vector<int> streaming_active( num_frames );
+
+    const ProcessMemory streaming_before = get_process_memory();
+
+    activation::ActivationSystem streaming( world, ActivationRadius, 8, 1024 );
+    for ( int i = 0; i < num_players; ++i )
+    {
+        if ( i > 0 )
+            streaming.AddActivationPoint( i, path_x[i], path_y[i] );
+        else
+            streaming.MoveActivationPoint( path_x[i], path_y[i] );
+    }
+
+    uint64_t streaming_time = 0;
+    for ( int frame = 0; frame < num_frames; ++frame )
+    {
+        start = core::nanoseconds();
+        for ( int i = 0; i < num_players; ++i )
+            streaming.MoveActivationPoint( i, path_x[frame*num_players+i], path_y[frame*num_players+i] );
+        streaming.Update( DeltaTime );
+        streaming_time += core::nanoseconds() - start;
+        streaming_events[frame] = streaming.GetEventCount();
+        streaming_active[frame] = streaming.GetActiveCount();
+        streaming.ClearEvents();
+    }
+
+    const ProcessMemory streaming_after = get_process_memory();
+
+    activation::ActivationSystem reference( NumDatabaseObjects + 1, ActivationRadius, config.cellWidth, config.cellHeight, config.cellSize, 8, 1024 );
+    for ( activation::ObjectId id = 1; id <= (activation::ObjectId) NumDatabaseObjects; ++id )
+        reference.InsertObject( id, world.GetObject( id ).x, world.GetObject( id ).y );
+    for ( int i = 0; i < num_players; ++i )
+    {
+        if ( i > 0 )
+            reference.AddActivationPoint( i, path_x[i], path_y[i] );
+        else
+            reference.MoveActivationPoint( path_x[i], path_y[i] );
+    }
+
+    uint64_t reference_time = 0;
+    bool identical = true;
+    for ( int frame = 0; frame < num_frames; ++frame )
+    {
+        start = core::nanoseconds();
+        for ( int i = 0; i < num_players; ++i )
+            reference.MoveActivationPoint( i, path_x[frame*num_players+i], path_y[frame*num_players+i] );
+        reference.Update( DeltaTime );
+        reference_time += core::nanoseconds() - start;
+        if ( reference.GetEventCount() != streaming_events[frame] || reference.GetActiveCount() != streaming_active[frame] )
+            identical = false;
+        reference.ClearEvents();
+    }
+
+    const ProcessMemory reference_after = get_process_memory();
+
+    const activation::StreamStats & stats = streaming.GetStreamStats();
+
+    printf( "\n                  update (ms)  system (MB)  resident (MB)  anonymous (MB)  active objects\n" );
+    printf( "in memory         %11.3f  %11.1f  %13.1f  %14.1f  %14d\n", reference_time / 1000000.0 / num_frames, megabytes( reference.GetBytes() ),
+        megabytes( int64_t( reference_after.resident - streaming_after.resident ) ), megabytes( int64_t( reference_after.anonymous - streaming_after.anonymous ) ), reference.GetActiveCount() );
+    printf( "streaming         %11.3f  %11.1f  %13.1f  %14.1f  %14d\n", streaming_time / 1000000.0 / num_frames, megabytes( streaming.GetBytes() + world.GetBytes() ),
+        megabytes( int64_t( streaming_after.resident - streaming_before.resident ) ), megabytes( int64_t( streaming_after.anonymous - streaming_before.anonymous ) ), streaming.GetActiveCount() );
+
+    printf( "\nresident cells %d (peak %d of %d), resident objects %d (peak %d), pinned cells %d, changed objects %d\n",
+        stats.residentCells, stats.peakResidentCells, config.cellWidth * config.cellHeight, stats.residentObjects, stats.peakResidentObjects, stats.pinnedCells, world.GetChangedCount() );
+    printf( "loaded %llu cells / %llu objects, evicted %llu cells / %llu objects, same activation: %s\n",
+        (unsigned long long) stats.cellsLoaded, (unsigned long long) stats.objectsLoaded, (unsigned long long) stats.cellsEvicted, (unsigned long long) stats.objectsEvicted, identical ? "yes" : "no" );
+
+    world.Close();
+    remove( filename );
+}
+
+const int PriorityObjects = 10000;
+const int PriorityClients = 64;
+const int PriorityObjectsPerPacket = 64;
+
+struct PriorityEntry
+{
+    int index;
+    float accumulator;
+    bool operator < ( const PriorityEntry & other ) const
+    {
+        return accumulator > other.accumulator || ( accumulator == other.accumulator && index < other.index );
+    }
+};
+
+static void ProfilePrioritySet()
+{
+    // every client accumulates its own priorities, then the objects to send are picked and their accumulators reset
+
+    cubes::PrioritySet priority_set( PriorityClients );
+    for ( int i = 0; i < PriorityObjects; ++i )
+        priority_set.AddObject( i );
+
+    std::vector<float> priority( PriorityObjects );
+    for ( int i = 0; i < PriorityObjects; ++i )
+        priority[i] = core::random_float( 0.1f, 10.0f );
+
+    std::vector<PriorityEntry> sorted( PriorityObjects );
+    uint64_t sort_time = 0;
+    uint64_t select_time = 0;
+    bool identical = true;
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        for ( int client = 0; client < PriorityClients; ++client )
+        {
+            priority_set.Accumulate( client, &priority[0], DeltaTime );
+
+            // copy and sort everything, as each packet used to
+
+            uint64_t start = core::nanoseconds();
+            for ( int i = 0; i < PriorityObjects; ++i )
+            {
+                sorted[i].index = i;
+                sorted[i].accumulator = priority_set.GetAccumulator( client, i );
+            }
+            std::sort( sorted.begin(), sorted.end() );
+            sort_time += core::nanoseconds() - start;
+
+            start = core::nanoseconds();
+            const int count = priority_set.SelectObjects( client, PriorityObjectsPerPacket );
+            select_time += core::nanoseconds() - start;
+
+            for ( int i = 0; i < count; ++i )
+            {
+                float accumulator;
+                const int index = priority_set.GetSortedObject( i, accumulator );
+                if ( index != sorted[i].index )
+                    identical = false;
+                priority_set.SetAccumulator( client, index, 0.0f );
+            }
+        }
+    }
+
+    printf( "\npriority set: %d objects, %d clients, %d objects per packet\n\n", PriorityObjects, PriorityClients, PriorityObjectsPerPacket );
+    printf( "full sort (ms)  select top k (ms)  same objects\n" );
+    printf( "%14.3f  %17.3f  %s\n", sort_time / 1000000.0 / NumFrames, select_time / 1000000.0 / NumFrames, identical ? "yes" : "no" );
+}
+
+static void ProfileInterest()
+{
+    // one client per activation point, each interested in the objects inside its own circle.
+    // brute force tests every active object against every client, interest management walks
+    // only the cells around each client
+
+    const int num_clients = activation::ActivationSystem::MaxActivationPoints;
+
+    activation::ActivationSystem activation_system( NumDatabaseObjects + 1, ActivationRadius, 512, 512, 4.0f, 8, 1024 );
+
+    std::vector<float> x( NumDatabaseObjects + 1 );
+    std::vector<float> y( NumDatabaseObjects + 1 );
+    for ( int i = 1; i <= NumDatabaseObjects; ++i )
+    {
+        x[i] = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        y[i] = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        activation_system.InsertObject( i, x[i], y[i] );
+    }
+
+    cubes::InterestConfig config;
+    config.relevanceRadius = ActivationRadius;
+
+    cubes::InterestManager interest( num_clients, config );
+
+    math::Vector velocity[num_clients];
+    for ( int i = 0; i < num_clients; ++i )
+    {
+        const float angle = core::random_float( 0.0f, 2.0f * math::pi );
+        velocity[i] = math::Vector( cos( angle ), sin( angle ), 0 ) * MaxLinearSpeed / 4;
+        const float px = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        const float py = core::random_float( -ActivationWorldSize / 2, ActivationWorldSize / 2 );
+        if ( i == 0 )
+            activation_system.MoveActivationPoint( px, py );
+        else
+            activation_system.AddActivationPoint( i, px, py );
+        interest.AddClient( i );
+    }
+
+    // the active object list brute force walks, kept up to date from activation events
+
+    std::vector<activation::ObjectId> active_ids;
+    std::vector<int> active_index( NumDatabaseObjects + 1, -1 );
+    std::vector< std::vector<float> > accumulators( num_clients );
+
+    const float radius_squared = ActivationRadius * ActivationRadius;
+
+    uint64_t brute_force_time = 0;
+    uint64_t interest_time = 0;
+    uint64_t brute_force_relevant = 0;
+    uint64_t interest_relevant = 0;
+    uint64_t objects_tested = 0;
+    uint64_t cells_visited = 0;
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        for ( int i = 0; i < num_clients; ++i )
+        {
+            float px = activation_system.GetX( i ) + velocity[i].x * DeltaTime;
+            float py = activation_system.GetY( i ) + velocity[i].y * DeltaTime;
+            if ( px < -ActivationWorldSize / 2 || px > ActivationWorldSize / 2 )
+                velocity[i].x = -velocity[i].x;
+            if ( py < -ActivationWorldSize / 2 || py > ActivationWorldSize / 2 )
+                velocity[i].y = -velocity[i].y;
+            activation_system.MoveActivationPoint( i, px, py );
+            interest.SetClientView( i, activation_system.GetX( i ), activation_system.GetY( i ), velocity[i].x, velocity[i].y );
+        }
+
+        activation_system.Update( DeltaTime );
+
+        for ( int i = 0; i < activation_system.GetEventCount(); ++i )
+        {
+            const activation::Event & event = activation_system.GetEvent( i );
+            if ( event.type == activation::Event::Activate )
+            {
+                active_index[event.id] = (int) active_ids.size();
+                active_ids.push_back( event.id );
+            }
+            else
+            {
+                const int index = active_index[event.id];
+                active_index[active_ids.back()] = index;
+                active_ids[index] = active_ids.back();
+                active_ids.pop_back();
+                active_index[event.id] = -1;
+            }
+        }
+
+        activation_system.ClearEvents();
+
+        uint64_t start = core::nanoseconds();
+        const int num_active = (int) active_ids.size();
+        for ( int client = 0; client < num_clients; ++client )
+        {
+            std::vector<float> & accumulator = accumulators[client];
+            accumulator.resize( num_active );
+            const float cx = activation_system.GetX( client );
+            const float cy = activation_system.GetY( client );
+            for ( int i = 0; i < num_active; ++i )
+            {
+                const activation::ObjectId id = active_ids[i];
+                const float dx = x[id] - cx;
+                const float dy = y[id] - cy;
+                const float distance_squared = dx * dx + dy * dy;
+                if ( distance_squared <= radius_squared )
+                {
+                    accumulator[i] += ( config.basePriority + config.distancePriority * ( 1.0f - sqrtf( distance_squared ) / ActivationRadius ) ) * DeltaTime;
+                    brute_force_relevant++;
+                }
+            }
+        }
+        brute_force_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        interest.Update( activation_system, DeltaTime );
+        interest_time += core::nanoseconds() - start;
+
+        const cubes::InterestStats & stats = interest.GetStats();
+        interest_relevant += stats.relevantObjects;
+        objects_tested += stats.objectsTested;
+        cells_visited += stats.cellsVisited;
+    }
+
+    printf( "\ninterest management: %d objects, %d clients, %.0fm relevance radius, %d active objects\n\n", NumDatabaseObjects, num_clients, ActivationRadius, (int) active_ids.size() );
+    printf( "all objects x clients (ms)  interest grid (ms)  relevant per client  objects tested per client  cells per client  same objects\n" );
+    printf( "%26.3f  %18.3f  %19.1f  %25.1f  %16.1f  %s\n",
+        brute_force_time / 1000000.0 / NumFrames,
+        interest_time / 1000000.0 / NumFrames,
+        interest_relevant / double( NumFrames * num_clients ),
+        objects_tested / double( NumFrames * num_clients ),
+        cells_visited / double( NumFrames * num_clients ),
+        interest_relevant == brute_force_relevant ? "yes" : "no" );
+}
+
+const int CompressionObjects = 1000000;
+
+static void ProfileCompression()
+{
+    std::vector<math::Vector> positions( CompressionObjects );
+    std::vector<math::Quaternion> orientations( CompressionObjects );
+    for ( int i = 0; i < CompressionObjects; ++i )
+    {
+        positions[i] = math::Vector( core::random_float( -500.0f, 500.0f ), core::random_float( -500.0f, 500.0f ), core::random_float( 0.0f, 10.0f ) );
+        orientations[i] = math::Quaternion( core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ) );
+        orientations[i].normalize();
+    }
+
+    std::vector<uint64_t> compressed_positions[2];
+    std::vector<uint32_t> compressed_orientations[2];
+    std::vector<math::Vector> decompressed_positions[2];
+    std::vector<math::Quaternion> decompressed_orientations[2];
+    std::vector<int32_t> quantized[2];
+    for ( int j = 0; j < 2; ++j )
+    {
+        compressed_positions[j].resize( CompressionObjects );
+        compressed_orientations[j].resize( CompressionObjects );
+        decompressed_positions[j].resize( CompressionObjects );
+        decompressed_orientations[j].resize( CompressionObjects );
+        quantized[j].resize( CompressionObjects * 3 );
+    }
+
+    // best of a few runs, so the first touch of each output array is not counted
+
+    double single_ms[5];
+    double batch_ms[5];
+    for ( int i = 0; i < 5; ++i )
+    {
+        single_ms[i] = 1000000.0;
+        batch_ms[i] = 1000000.0;
+    }
+
+    for ( int run = 0; run < 4; ++run )
+    {
+        uint64_t start = core::nanoseconds();
+        for ( int i = 0; i < CompressionObjects; ++i )
+            cubes::CompressPosition( positions[i], compressed_positions[0][i] );
+        single_ms[0] = core::min( single_ms[0], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int i = 0; i < CompressionObjects; ++i )
+            cubes::DecompressPosition( compressed_positions[0][i], decompressed_positions[0][i] );
+        single_ms[1] = core::min( single_ms[1], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int i = 0; i < CompressionObjects; ++i )
+            cubes::CompressOrientation( orientations[i], compressed_orientations[0][i] );
+        single_ms[2] = core::min( single_ms[2], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int i = 0; i < CompressionObjects; ++i )
+            cubes::DecompressOrientation( compressed_orientations[0][i], decompressed_orientations[0][i] );
+        single_ms[3] = core::min( single_ms[3], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int i = 0; i < CompressionObjects; ++i )
+            cubes::QuantizeVector( positions[i], quantized[0][i*3], quantized[0][i*3+1], quantized[0][i*3+2], 1000.0f );
+        single_ms[4] = core::min( single_ms[4], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        cubes::CompressPositions( &positions[0], &compressed_positions[1][0], CompressionObjects );
+        batch_ms[0] = core::min( batch_ms[0], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        cubes::DecompressPositions( &compressed_positions[1][0], &decompressed_positions[1][0], CompressionObjects );
+        batch_ms[1] = core::min( batch_ms[1], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        cubes::CompressOrientations( &orientations[0], &compressed_orientations[1][0], CompressionObjects );
+        batch_ms[2] = core::min( batch_ms[2], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        cubes::DecompressOrientations( &compressed_orientations[1][0], &decompressed_orientations[1][0], CompressionObjects );
+        batch_ms[3] = core::min( batch_ms[3], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        cubes::QuantizeVectors( &positions[0], &quantized[1][0], CompressionObjects, 1000.0f );
+        batch_ms[4] = core::min( batch_ms[4], ( core::nanoseconds() - start ) / 1000000.0 );
+    }
+
+    const bool identical[5] =
+    {
+        compressed_positions[0] == compressed_positions[1],
+        memcmp( &decompressed_positions[0][0], &decompressed_positions[1][0], sizeof( math::Vector ) * CompressionObjects ) == 0,
+        compressed_orientations[0] == compressed_orientations[1],
+        memcmp( &decompressed_orientations[0][0], &decompressed_orientations[1][0], sizeof( math::Quaternion ) * CompressionObjects ) == 0,
+        quantized[0] == quantized[1]
+    };
+
+    const char * names[5] = { "compress position", "decompress position", "compress orientation", "decompress orientation", "quantize vector" };
+
+    printf( "\ncompression: %d objects\n\n", CompressionObjects );
+    printf( "                        one at a time (ms)  four at a time (ms)  identical\n" );
+    for ( int i = 0; i < 5; ++i )
+        printf( "%-22s  %18.2f  %19.2f  %s\n", names[i], single_ms[i], batch_ms[i], identical[i] ? "yes" : "no" );
+}
+
+const int MathObjects = 4096;
+const int MathPasses = 400;
+
+struct ScalarObjectState
+{
+    float orientation[4];       // w,x,y,z
+    float position[3];
+    float linear_velocity[3];
+    float angular_velocity[3];
+    uint32_t id;
+    uint32_t flags;
+    float scale;
+};
+
+static void ProfileMath()
+{
+    // the same per object work done on plain floats one component at a time, as the cubes math used to,
+    // and on the simd4f backed math::Vector and math::Quaternion. few enough objects to stay in cache,
+    // so this measures the math rather than memory bandwidth
+
+    std::vector<ScalarObjectState> scalar( MathObjects );
+    std::vector<view::ObjectState> objects( MathObjects );
+    for ( int i = 0; i < MathObjects; ++i )
+    {
+        math::Quaternion orientation( core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ) );
+        orientation.normalize();
+        objects[i].position = math::Vector( core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ), core::random_float( 0.0f, 10.0f ) );
+        objects[i].orientation = orientation;
+        objects[i].linearVelocity = math::Vector( core::random_float( -10.0f, 10.0f ), core::random_float( -10.0f, 10.0f ), core::random_float( -10.0f, 10.0f ) );
+        objects[i].angularVelocity = math::Vector( core::random_float( -5.0f, 5.0f ), core::random_float( -5.0f, 5.0f ), core::random_float( -5.0f, 5.0f ) );
+        memcpy( scalar[i].position, &objects[i].position.x, sizeof( float ) * 3 );
+        memcpy( scalar[i].orientation, &objects[i].orientation.w, sizeof( float ) * 4 );
+        memcpy( scalar[i].linear_velocity, &objects[i].linearVelocity.x, sizeof( float ) * 3 );
+        memcpy( scalar[i].angular_velocity, &objects[i].angularVelocity.x, sizeof( float ) * 3 );
+    }
+
+    double scalar_ms[2] = { 1000000.0, 1000000.0 };
+    double simd_ms[2] = { 1000000.0, 1000000.0 };
+
+    std::vector<vectorial::vec3f> positions[2];
+    std::vector<vectorial::quat4f> orientations[2];
+    for ( int j = 0; j < 2; ++j )
+    {
+        positions[j].resize( MathObjects );
+        orientations[j].resize( MathObjects );
+    }
+
+    const float dt = 1.0f / 60.0f;
+
+    for ( int run = 0; run < 4; ++run )
+    {
+        // integrate position and orientation
+
+        uint64_t start = core::nanoseconds();
+        for ( int pass = 0; pass < MathPasses; ++pass )
+        {
+            for ( int i = 0; i < MathObjects; ++i )
+            {
+                ScalarObjectState & s = scalar[i];
+                s.position[0] += s.linear_velocity[0] * dt;
+                s.position[1] += s.linear_velocity[1] * dt;
+                s.position[2] += s.linear_velocity[2] * dt;
+                const float * q = s.orientation;
+                const float * w = s.angular_velocity;
+                const float spin[4] = { ( 0*q[0] - w[0]*q[1] - w[1]*q[2] - w[2]*q[3] ) * ( 0.5f * dt ),
+                                        ( 0*q[1] + w[0]*q[0] + w[1]*q[3] - w[2]*q[2] ) * ( 0.5f * dt ),
+                                        ( 0*q[2] - w[0]*q[3] + w[1]*q[0] + w[2]*q[1] ) * ( 0.5f * dt ),
+                                        ( 0*q[3] + w[0]*q[2] - w[1]*q[1] + w[2]*q[0] ) * ( 0.5f * dt ) };
+                float r[4] = { q[0] + spin[0], q[1] + spin[1], q[2] + spin[2], q[3] + spin[3] };
+                const float inv = 1.0f / sqrtf( r[0]*r[0] + r[1]*r[1] + r[2]*r[2] + r[3]*r[3] );
+                s.orientation[0] = r[0] * inv;
+                s.orientation[1] = r[1] * inv;
+                s.orientation[2] = r[2] * inv;
+                s.orientation[3] = r[3] * inv;
+            }
+        }
+        scalar_ms[0] = core::min( scalar_ms[0], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int pass = 0; pass < MathPasses; ++pass )
+        {
+            for ( int i = 0; i < MathObjects; ++i )
+            {
+                view::ObjectState & o = objects[i];
+                o.position += o.linearVelocity * dt;
+                const math::Quaternion spin = math::Quaternion( 0, o.angularVelocity.x, o.angularVelocity.y, o.angularVelocity.z ) * o.orientation * ( 0.5f * dt );
+                o.orientation += spin;
+                o.orientation.normalize();
+            }
+        }
+        simd_ms[0] = core::min( simd_ms[0], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        // convert to vectorial types for snapshots and the view
+
+        start = core::nanoseconds();
+        for ( int pass = 0; pass < MathPasses; ++pass )
+        {
+            for ( int i = 0; i < MathObjects; ++i )
+            {
+                const ScalarObjectState & s = scalar[i];
+                positions[0][i] = vectorial::vec3f( s.position[0], s.position[1], s.position[2] );
+                orientations[0][i] = vectorial::quat4f( s.orientation[1], s.orientation[2], s.orientation[3], s.orientation[0] );
+            }
+        }
+        scalar_ms[1] = core::min( scalar_ms[1], ( core::nanoseconds() - start ) / 1000000.0 );
+
+        start = core::nanoseconds();
+        for ( int pass = 0; pass < MathPasses; ++pass )
+        {
+            for ( int i = 0; i < MathObjects; ++i )
+            {
+                positions[1][i] = math::to_vec3f( objects[i].position );
+                orientations[1][i] = math::to_quat4f( objects[i].orientation );
+            }
+        }
+        simd_ms[1] = core::min( simd_ms[1], ( core::nanoseconds() - start ) / 1000000.0 );
+    }
+
+    bool identical = true;
+    for ( int i = 0; i < MathObjects; ++i )
+    {
+        if ( memcmp( scalar[i].position, &objects[i].position.x, sizeof( float ) * 3 ) != 0 ||
+             memcmp( scalar[i].orientation, &objects[i].orientation.w, sizeof( float ) * 4 ) != 0 ||
+             memcmp( &positions[0][i], &positions[1][i], sizeof( vectorial::vec3f ) ) != 0 ||
+             memcmp( &orientations[0][i], &orientations[1][i], sizeof( vectorial::quat4f ) ) != 0 )
+            identical = false;
+    }
+
+    const char * names[2] = { "integrate", "to vectorial" };
+
+    printf( "\nmath: %d objects, %d passes\n\n", MathObjects, MathPasses );
+    printf( "                scalar (ms)  simd4f (ms)\n" );
+    for ( int i = 0; i < 2; ++i )
+        printf( "%-14s  %11.2f  %11.2f\n", names[i], scalar_ms[i], simd_ms[i] );
+    printf( "identical: %s\n", identical ? "yes" : "no" );
+}
+
+static const int ViewFrames = 600;
+
+static void ProfileViewObjects( int num_objects, const char * name, int authority_percent, int replace_percent )
+{
+    // every object moves every frame. some percent change authority, which restarts their color blend,
+    // and some percent leave the view and are replaced by new objects. timing covers only the view
+
+    std::vector<view::ObjectUpdate> updates( num_objects );
+    for ( int i = 0; i < num_objects; ++i )
+    {
+        updates[i].id = i + 1;
+        updates[i].authority = MaxPlayers;
+        updates[i].visible = 1;
+        updates[i].scale = 1.0f;
+        updates[i].position = vectorial::vec3f( core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ), core::random_float( 0.0f, 10.0f ) );
+        updates[i].orientation = vectorial::quat4f::identity();
+    }
+
+    view::ObjectManager objects;
+    objects.UpdateObjects( &updates[0], num_objects );
+
+    const vectorial::vec3f velocity( 0.01f, 0.0f, 0.0f );
+
+    unsigned int next_id = num_objects + 1;
+
+    uint64_t update_time = 0;
+    uint64_t blend_time = 0;
+
+    for ( int frame = 0; frame < ViewFrames; ++frame )
+    {
+        for ( int i = 0; i < num_objects; ++i )
+        {
+            updates[i].position += velocity;
+            if ( authority_percent && core::random_int( 0, 99 ) < authority_percent )
+                updates[i].authority = MaxPlayers - updates[i].authority;
+            if ( replace_percent && core::random_int( 0, 99 ) < replace_percent )
+                updates[i].id = next_id++;
+        }
+
+        uint64_t start = core::nanoseconds();
+        objects.UpdateObjects( &updates[0], num_objects );
+        update_time += core::nanoseconds() - start;
+
+        start = core::nanoseconds();
+        objects.Update( 1.0f / 60.0f );
+        blend_time += core::nanoseconds() - start;
+    }
+
+    printf( "%7d  %-20s  %11.1f  %10.1f\n", num_objects, name, update_time / 1000.0 / ViewFrames, blend_time / 1000.0 / ViewFrames );
+}
+
+static void ProfileView()
+{
+    printf( "\nview objects: %d frames\n\n", ViewFrames );
+    printf( "objects  scenario              update (us)  blend (us)\n" );
+
+    for ( int num_objects = 1000; num_objects <= 10000; num_objects *= 10 )
+    {
+        ProfileViewObjects( num_objects, "at rest", 0, 0 );
+        ProfileViewObjects( num_objects, "changing authority", 10, 0 );
+        ProfileViewObjects( num_objects, "joining and leaving", 0, 10 );
+    }
+}
+
+int main()
+{
+    const int num_cores = core::get_num_cores();
+
+    printf( "profile cubes: %d frames per run, %d cores\n\n", NumFrames, num_cores );
+
+    printf( "threads  rooms  frame (ms)  rooms per core @ 60HZ  deterministic\n" );
+
+    Room rooms[64 * MaxRoomsPerCore];
+
+    for ( int num_threads = 1; num_threads <= core::min( num_cores, 64 ); ++num_threads )
+    {
+        core::JobSystemConfig job_config;
+        job_config.num_threads = num_threads - 1;
+        job_config.thread_start = InitializeRoomThread;
+
+        for ( int rooms_per_core = 1; rooms_per_core <= MaxRoomsPerCore; rooms_per_core *= 2 )
+        {
+            const int num_rooms = num_threads * rooms_per_core;
+
+            for ( int i = 0; i < num_rooms; ++i )
+            {
+                rooms[i].frame = 0;
+                rooms[i].instance = CreateRoom<GameInstance>();
+            }
+
+            // IMPORTANT: the job system must be created after the rooms so ode is initialized before workers allocate their thread data
+
+            core::JobSystem * job_system = new core::JobSystem( job_config );
+
+            const uint64_t start = core::nanoseconds();
+
+            for ( int frame = 0; frame < NumFrames; ++frame )
+                job_system->Run( UpdateRoomJob, rooms, num_rooms );
+
+            const uint64_t finish = core::nanoseconds();
+
+            delete job_system;
+
+            // every room gets the same inputs and seeds so every room must end up in the same state
+
+            const uint64_t checksum = GetRoomChecksum( rooms[0].instance );
+            bool deterministic = true;
+            for ( int i = 1; i < num_rooms; ++i )
+            {
+                if ( GetRoomChecksum( rooms[i].instance ) != checksum )
+                    deterministic = false;
+            }
+
+            for ( int i = 0; i < num_rooms; ++i )
+            {
+                delete rooms[i].instance;
+                rooms[i].instance = nullptr;
+            }
+
+            const double frame_ms = ( finish - start ) / 1000000.0 / NumFrames;
+
+            const double rooms_per_core_realtime = num_rooms * ( 1000.0 / 60.0 ) / frame_ms / num_threads;
+
+            printf( "%7d  %5d  %10.2f  %21.1f  %s\n", num_threads, num_rooms, frame_ms, rooms_per_core_realtime, deterministic ? "yes" : "no" );
+        }
+    }
+
+    ProfileActiveObjectLayout();
+
+    ProfileProximityGrid();
+
+    ProfileIslandThreads();
+
+    ProfileInteractionGraph();
+
+    ProfileBroadphases();
+
+    ProfileNarrowphases();
+
+    ProfileRollback();
+
+    ProfilePredictions();
+
+    ProfileActivation();
+
+    ProfileActivationRadii();
+
+    ProfileStreaming();
+
+    ProfilePrioritySet();
+
+    ProfileInterest();
+
+    ProfileCompression();
+
+    ProfileMath();
+
+    ProfileView();
+
+    return 0;
+}
@@ -0,0 +1,584 @@
+#include "core/Core.h"
+#include "cubes/Activation.h"
+#include "cubes/Hypercube.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+static const float ActivationRadius = 10.0f;
+
+static int count_circles( activation::ActivationSystem & activationSystem, float x, float y )
+{
+    int count = 0;
+    for ( int i = 0; i < activation::ActivationSystem::MaxActivationPoints; ++i )
+    {
+        if ( !activationSystem.HasActivationPoint( i ) )
+            continue;
+        const float dx = x - activationSystem.GetX( i );
+        const float dy = y - activationSystem.GetY( i );
+        if ( dx*dx + dy*dy < ActivationRadius * ActivationRadius )
+            count++;
+    }
+    return count;
+}
+
+static void process_events( activation::ActivationSystem & activationSystem, bool * active, int & activated, int & deactivated )
+{
+    activated = 0;
+    deactivated = 0;
+    for ( int i = 0; i < activationSystem.GetEventCount(); ++i )
+    {
+        const activation::Event & event = activationSystem.GetEvent( i );
+        if ( event.type == activation::Event::Activate )
+        {
+            CORE_CHECK( !active[event.id] );
+            active[event.id] = true;
+            activated++;
+        }
+        else
+        {
+            CORE_CHECK( active[event.id] );
+            active[event.id] = false;
+            deactivated++;
+        }
+    }
+    activationSystem.ClearEvents();
+}
+
+void test_activation_multiple_points()
+{
+    printf( "test_activation_multiple_points\n" );
+
+    const int NumObjects = 30;
+
+    activation::ActivationSystem activationSystem( 1024, ActivationRadius, 100, 100, 1.0f, 8, 32 );
+
+    // a line of objects from x = -14.5 to +14.5, covered by two overlapping circles at x = -5 and x = +5
+
+    for ( int i = 0; i < NumObjects; ++i )
+        activationSystem.InsertObject( i + 1, i - NumObjects / 2 + 0.5f, 0.0f );
+
+    activationSystem.MoveActivationPoint( -5.0f, 0.0f );
+    activationSystem.AddActivationPoint( 1, +5.0f, 0.0f );
+    activationSystem.Update( 0.1f );
+
+    bool active[NumObjects+1];
+    memset( active, 0, sizeof( active ) );
+    int activated, deactivated;
+    process_events( activationSystem, active, activated, deactivated );
+
+    CORE_CHECK( activated == NumObjects );
+    CORE_CHECK( activationSystem.GetActiveCount() == NumObjects );
+    for ( int i = 1; i <= NumObjects; ++i )
+    {
+        const float x = i - 1 - NumObjects / 2 + 0.5f;
+        CORE_CHECK( activationSystem.GetReferenceCount( i ) == ( math::abs( x ) < 5.0f ? 2 : 1 ) );
+    }
+
+    // moving one circle away only deactivates the objects no other circle holds on to
+
+    activationSystem.MoveActivationPoint( 1, 50.0f, 0.0f );
+    activationSystem.Update( 0.1f );
+    process_events( activationSystem, active, activated, deactivated );
+
+    CORE_CHECK( activated == 0 );
+    CORE_CHECK( deactivated == 10 );
+    for ( int i = 1; i <= NumObjects; ++i )
+    {
+        const float x = i - 1 - NumObjects / 2 + 0.5f;
+        CORE_CHECK( activationSystem.IsActive( i ) == ( x < 5.0f ) );
+        CORE_CHECK( activationSystem.GetReferenceCount( i ) == ( x < 5.0f ? 1 : 0 ) );
+    }
+
+    // removing the other circle deactivates everything, moving back reactivates its half
+
+    activationSystem.RemoveActivationPoint( 0 );
+    activationSystem.Update( 0.1f );
+    process_events( activationSystem, active, activated, deactivated );
+
+    CORE_CHECK( deactivated == 20 );
+    CORE_CHECK( activationSystem.GetActiveCount() == 0 );
+
+    activationSystem.MoveActivationPoint( 1, 5.0f, 0.0f );
+    activationSystem.Update( 0.1f );
+    process_events( activationSystem, active, activated, deactivated );
+
+    CORE_CHECK( activated == 20 );
+    CORE_CHECK( activationSystem.GetActiveCount() == 20 );
+
+    // an object moved into a circle activates without the circle moving
+
+    activationSystem.MoveObject( 1, 0.0f, 1.0f );
+    activationSystem.Update( 0.1f );
+    process_events( activationSystem, active, activated, deactivated );
+
+    CORE_CHECK( activated == 1 );
+    CORE_CHECK( activationSystem.IsActive( 1 ) );
+}
+
+void test_activation_moving_points()
+{
+    printf( "test_activation_moving_points\n" );
+
+    const int NumObjects = 1000;
+    const int NumPoints = 8;
+    const float WorldSize = 80.0f;
+
+    activation::ActivationSystem activationSystem( NumObjects + 1, ActivationRadius, 50, 50, 2.0f, 8, 32 );
+
+    float x[NumObjects+1];
+    float y[NumObjects+1];
+    for ( int i = 1; i <= NumObjects; ++i )
+    {
+        x[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        y[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        activationSystem.InsertObject( i, x[i], y[i] );
+    }
+
+    for ( int i = 1; i < NumPoints; ++i )
+        activationSystem.AddActivationPoint( i, core::random_float( -WorldSize / 2, +WorldSize / 2 ), core::random_float( -WorldSize / 2, +WorldSize / 2 ) );
+
+    bool active[NumObjects+1];
+    memset( active, 0, sizeof( active ) );
+
+    // random walk the points, with the occasional teleport and object move. after each update
+    // exactly the objects inside at least one circle are active, counted once per circle
+
+    for ( int frame = 0; frame < 200; ++frame )
+    {
+        for ( int i = 0; i < NumPoints; ++i )
+        {
+            float px = activationSystem.GetX( i ) + core::random_float( -1.0f, +1.0f );
+            float py = activationSystem.GetY( i ) + core::random_float( -1.0f, +1.0f );
+            if ( core::random_int( 0, 50 ) == 0 )
+            {
+                px = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+                py = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            }
+            activationSystem.MoveActivationPoint( i, px, py );
+        }
+
+        for ( int i = 0; i < 10; ++i )
+        {
+            const int id = core::random_int( 1, NumObjects );
+            x[id] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            y[id] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            activationSystem.MoveObject( id, x[id], y[id] );
+        }
+
+        activationSystem.Update( 0.1f );
+
+        int activated, deactivated;
+        process_events( activationSystem, active, activated, deactivated );
+
+        int activeCount = 0;
+        for ( int i = 1; i <= NumObjects; ++i )
+        {
+            const int circles = count_circles( activationSystem, x[i], y[i] );
+            CORE_CHECK( activationSystem.GetReferenceCount( i ) == circles );
+            CORE_CHECK( activationSystem.IsActive( i ) == ( circles > 0 ) );
+            CORE_CHECK( active[i] == ( circles > 0 ) );
+            if ( circles > 0 )
+                activeCount++;
+        }
+        CORE_CHECK( activationSystem.GetActiveCount() == activeCount );
+    }
+}
+
+void test_activation_incremental_matches_full()
+{
+    printf( "test_activation_incremental_matches_full\n" );
+
+    const int NumObjects = 2000;
+    const int NumPoints = 4;
+    const float WorldSize = 80.0f;
+
+    // one system only visits cells whose coverage changed, the other visits every cell in the bounds.
+    // fed the same moves they must produce exactly the same events in the same order
+
+    activation::ActivationSystem incremental( NumObjects + 1, ActivationRadius, 50, 50, 2.0f, 8, 32 );
+    activation::ActivationSystem full( NumObjects + 1, ActivationRadius, 50, 50, 2.0f, 8, 32 );
+
+    full.SetIncremental( false );
+
+    for ( int i = 1; i <= NumObjects; ++i )
+    {
+        const float x = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        const float y = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        incremental.InsertObject( i, x, y );
+        full.InsertObject( i, x, y );
+    }
+
+    for ( int i = 1; i < NumPoints; ++i )
+    {
+        const float x = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        const float y = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        incremental.AddActivationPoint( i, x, y );
+        full.AddActivationPoint( i, x, y );
+    }
+
+    int numEvents = 0;
+
+    for ( int frame = 0; frame < 200; ++frame )
+    {
+        for ( int i = 0; i < NumPoints; ++i )
+        {
+            float x = incremental.GetX( i ) + core::random_float( -0.5f, +0.5f );
+            float y = incremental.GetY( i ) + core::random_float( -0.5f, +0.5f );
+            if ( core::random_int( 0, 50 ) == 0 )
+            {
+                x = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+                y = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            }
+            incremental.MoveActivationPoint( i, x, y );
+            full.MoveActivationPoint( i, x, y );
+        }
+
+        for ( int i = 0; i < 10; ++i )
+        {
+            const int id = core::random_int( 1, NumObjects );
+            const float x = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            const float y = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            incremental.MoveObject( id, x, y );
+            full.MoveObject( id, x, y );
+        }
+
+        incremental.Update( 0.1f );
+        full.Update( 0.1f );
+
+        CORE_CHECK( incremental.GetEventCount() == full.GetEventCount() );
+        for ( int i = 0; i < incremental.GetEventCount(); ++i )
+        {
+            CORE_CHECK( incremental.GetEvent( i ).type == full.GetEvent( i ).type );
+            CORE_CHECK( incremental.GetEvent( i ).id == full.GetEvent( i ).id );
+        }
+        numEvents += incremental.GetEventCount();
+
+        incremental.ClearEvents();
+        full.ClearEvents();
+
+        CORE_CHECK( incremental.GetActiveCount() == full.GetActiveCount() );
+    }
+
+    CORE_CHECK( numEvents > 0 );
+}
+
+void test_activation_set_index()
+{
+    printf( "test_activation_set_index\n" );
+
+    const int MaxId = 1000;
+
+    // random inserts and deletes, growing well past the point where the set hashes its ids
+    // and shrinking back down. every id lookup must agree with a plain array of what is in the set
+
+    activation::Set<int> set;
+    set.Allocate( 4 );
+
+    bool inside[MaxId+1];
+    memset( inside, 0, sizeof( inside ) );
+    int count = 0;
+
+    for ( int iteration = 0; iteration < 20000; ++iteration )
+    {
+        const int target = ( iteration / 5000 ) % 2 == 0 ? MaxId * 3 / 4 : 10;
+        const activation::ObjectId id = core::random_int( 1, MaxId );
+        if ( !inside[id] && count < target )
+        {
+            set.InsertObject( id ) = id;
+            inside[id] = true;
+            count++;
+        }
+        else if ( inside[id] )
+        {
+            if ( core::random_int( 0, 1 ) )
+                set.DeleteObject( id );
+            else
+                set.DeleteObject( set.FindObject( id ) );
+            inside[id] = false;
+            count--;
+        }
+
+        CORE_CHECK( set.GetCount() == count );
+
+        if ( iteration % 100 == 0 )
+        {
+            for ( int i = 1; i <= MaxId; ++i )
+            {
+                const int * object = set.FindObject( i );
+                CORE_CHECK( ( object != NULL ) == inside[i] );
+                if ( object )
+                {
+                    CORE_CHECK( *object == i );
+                    CORE_CHECK( set.FindIndex( i ) == object - &set.GetObject( 0 ) );
+                }
+            }
+        }
+    }
+
+    // emptying a full set down to a quarter and filling it back up must not reallocate
+
+    activation::Set<int> small;
+    small.Allocate( 4 );
+    for ( int i = 1; i <= 64; ++i )
+        small.InsertObject( i ) = i;
+    const int size = small.GetSize();
+    CORE_CHECK( size == 64 );
+    for ( int i = 0; i < 10; ++i )
+    {
+        for ( int j = 64; j > size / 4; --j )
+            small.DeleteObject( activation::ObjectId( j ) );
+        CORE_CHECK( small.GetSize() == size );
+        for ( int j = size / 4 + 1; j <= 64; ++j )
+            small.InsertObject( j ) = j;
+        CORE_CHECK( small.GetSize() == size );
+    }
+
+    // emptying it completely shrinks back down to the initial size, and no further
+
+    for ( int i = 1; i <= 64; ++i )
+        small.DeleteObject( activation::ObjectId( i ) );
+    CORE_CHECK( small.GetCount() == 0 );
+    CORE_CHECK( small.GetSize() == 4 );
+    CORE_CHECK( small.FindObject( 1 ) == NULL );
+}
+
+void test_active_object_arrays_index()
+{
+    printf( "test_active_object_arrays_index\n" );
+
+    const int MaxId = 1000;
+
+    // the structure of arrays storage shares the set's id index and shrink policy,
+    // so run it through the same inserts and deletes and check every lookup
+
+    hypercube::ActiveObjectArrays arrays;
+    arrays.Allocate( 4 );
+
+    bool inside[MaxId+1];
+    memset( inside, 0, sizeof( inside ) );
+    int count = 0;
+
+    for ( int iteration = 0; iteration < 20000; ++iteration )
+    {
+        const int target = ( iteration / 5000 ) % 2 == 0 ? MaxId * 3 / 4 : 10;
+        const activation::ObjectId id = core::random_int( 1, MaxId );
+        if ( !inside[id] && count < target )
+        {
+            const int index = arrays.Insert( id );
+            hypercube::ActiveObject object = hypercube::ActiveObject();
+            object.id = id;
+            object.position = math::Vector( float( id ), 0.0f, 0.0f );
+            object.orientation = math::Quaternion( 1, 0, 0, 0 );
+            object.linearVelocity = math::Vector( 0, 0, 0 );
+            object.angularVelocity = math::Vector( 0, 0, 0 );
+            arrays.StoreObject( index, object );
+            inside[id] = true;
+            count++;
+        }
+        else if ( inside[id] )
+        {
+            arrays.DeleteObject( arrays.FindIndex( id ) );
+            inside[id] = false;
+            count--;
+        }
+
+        CORE_CHECK( arrays.GetCount() == count );
+
+        if ( iteration % 100 == 0 )
+        {
+            for ( int i = 1; i <= MaxId; ++i )
+            {
+                const int index = arrays.FindIndex( i );
+                CORE_CHECK( ( index >= 0 ) == inside[i] );
+                if ( index >= 0 )
+                {
+                    CORE_CHECK( arrays.GetId( index ) == activation::ObjectId( i ) );
+                    CORE_CHECK( arrays.GetPosition( index ).x == float( i ) );
+                }
+            }
+        }
+    }
+
+    // emptying down to a quarter and filling back up must not reallocate,
+    // and emptying completely shrinks back to the initial size
+
+    hypercube::ActiveObjectArrays small;
+    small.Allocate( 4 );
+    for ( int i = 1; i <= 64; ++i )
+        small.Insert( i );
+    const int size = small.GetSize();
+    CORE_CHECK( size == 64 );
+    for ( int j = 64; j > size / 4; --j )
+        small.DeleteObject( small.FindIndex( j ) );
+    CORE_CHECK( small.GetSize() == size );
+    for ( int i = 1; i <= size / 4; ++i )
+        small.DeleteObject( small.FindIndex( i ) );
+    CORE_CHECK( small.GetCount() == 0 );
+    CORE_CHECK( small.GetSize() == 4 );
+    CORE_CHECK( small.FindIndex( 1 ) == -1 );
+}
+
+static void get_events( activation::ActivationSystem & activationSystem, std::vector<uint32_t> & events )
+{
+    events.clear();
+    for ( int i = 0; i < activationSystem.GetEventCount(); ++i )
+    {
+        const activation::Event & event = activationSystem.GetEvent( i );
+        events.push_back( event.id * 2 + event.type );
+    }
+    std::sort( events.begin(), events.end() );
+    activationSystem.ClearEvents();
+}
+
+void test_activation_streaming()
+{
+    printf( "test_activation_streaming\n" );
+
+    const int NumObjects = 4000;
+    const int NumPoints = 4;
+    const float WorldSize = 80.0f;
+    const int GridSize = 50;
+    const float CellSize = 2.0f;
+    const char * filename = "test_activation_streaming.bin";
+
+    // write a world file, each object carrying the order it was added in as its database object
+
+    activation::WorldFileWriter writer( GridSize, GridSize, CellSize, sizeof( uint32_t ) );
+
+    float x[NumObjects];
+    float y[NumObjects];
+    for ( uint32_t i = 0; i < NumObjects; ++i )
+    {
+        x[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        y[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        writer.AddObject( x[i], y[i], &i );
+    }
+
+    CORE_CHECK( writer.Write( filename ) );
+
+    activation::WorldFile world;
+    CORE_CHECK( world.Open( filename ) );
+    CORE_CHECK( world.GetWidth() == GridSize );
+    CORE_CHECK( world.GetHeight() == GridSize );
+    CORE_CHECK( world.GetCellSize() == CellSize );
+    CORE_CHECK( world.GetObjectCount() == NumObjects );
+    CORE_CHECK( world.GetObjectBytes() == sizeof( uint32_t ) );
+
+    for ( int i = 0; i < NumObjects; ++i )
+    {
+        const activation::ObjectId id = writer.GetObjectId( i );
+        CORE_CHECK( *(const uint32_t*) world.GetObjectData( id ) == uint32_t( i ) );
+        CORE_CHECK( world.GetObject( id ).x == x[i] );
+        CORE_CHECK( world.GetObject( id ).y == y[i] );
+    }
+
+    // changes go to the overlay, and reverting an object that matches the file again drops it
+
+    {
+        const activation::ObjectId id = writer.GetObjectId( 0 );
+        *(uint32_t*) world.ModifyObjectData( id ) = 1000;
+        CORE_CHECK( world.GetChangedCount() == 1 );
+        CORE_CHECK( *(const uint32_t*) world.GetObjectData( id ) == 1000 );
+        world.Revert( id );
+        CORE_CHECK( world.GetChangedCount() == 1 );
+        *(uint32_t*) world.ModifyObjectData( id ) = 0;
+        world.Revert( id );
+        CORE_CHECK( world.GetChangedCount() == 0 );
+        CORE_CHECK( *(const uint32_t*) world.GetObjectData( id ) == 0 );
+    }
+
+    // a streaming system and one with every object inserted up front, fed the same moves,
+    // must agree on which objects are active after every update
+
+    activation::ActivationSystem streaming( world, ActivationRadius, 8, 32 );
+    activation::ActivationSystem reference( NumObjects + 1, ActivationRadius, GridSize, GridSize, CellSize, 8, 32 );
+
+    CORE_CHECK( streaming.IsStreaming() );
+    CORE_CHECK( !reference.IsStreaming() );
+    CORE_CHECK( streaming.GetStreamStats().residentCells == 0 );
+
+    for ( activation::ObjectId id = 1; id <= NumObjects; ++id )
+        reference.InsertObject( id, world.GetObject( id ).x, world.GetObject( id ).y );
+
+    for ( int i = 1; i < NumPoints; ++i )
+    {
+        const float px = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        const float py = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        streaming.AddActivationPoint( i, px, py );
+        reference.AddActivationPoint( i, px, py );
+    }
+
+    std::vector<uint32_t> streaming_events, reference_events;
+
+    for ( int frame = 0; frame < 300; ++frame )
+    {
+        for ( int i = 0; i < NumPoints; ++i )
+        {
+            float px = streaming.GetX( i ) + core::random_float( -1.0f, +1.0f );
+            float py = streaming.GetY( i ) + core::random_float( -1.0f, +1.0f );
+            if ( core::random_int( 0, 30 ) == 0 )
+            {
+                px = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+                py = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            }
+            streaming.MoveActivationPoint( i, px, py );
+            reference.MoveActivationPoint( i, px, py );
+        }
+
+        for ( int i = 0; i < 10; ++i )
+        {
+            const activation::ObjectId id = core::random_int( 1, NumObjects );
+            const float ox = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            const float oy = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+            streaming.MoveObject( id, ox, oy );
+            reference.MoveObject( id, ox, oy );
+        }
+
+        if ( frame % 50 == 25 )
+        {
+            const activation::ObjectId id = core::random_int( 1, NumObjects );
+            streaming.DisableObject( id );
+            reference.DisableObject( id );
+        }
+
+        streaming.Update( 0.1f );
+        reference.Update( 0.1f );
+
+        get_events( streaming, streaming_events );
+        get_events( reference, reference_events );
+        CORE_CHECK( streaming_events == reference_events );
+
+        CORE_CHECK( streaming.GetActiveCount() == reference.GetActiveCount() );
+        for ( activation::ObjectId id = 1; id <= NumObjects; ++id )
+            CORE_CHECK( streaming.GetReferenceCount( id ) == reference.GetReferenceCount( id ) );
+    }
+
+    const activation::StreamStats & stats = streaming.GetStreamStats();
+    CORE_CHECK( stats.cellsLoaded > 0 );
+    CORE_CHECK( stats.cellsEvicted > 0 );
+    CORE_CHECK( stats.cellsLoaded - stats.cellsEvicted == uint64_t( stats.residentCells ) );
+    CORE_CHECK( stats.objectsLoaded > 0 );
+    CORE_CHECK( stats.peakResidentCells < GridSize * GridSize );
+
+    // with the points gone, everything but the cells holding objects that moved in from elsewhere is evicted
+
+    for ( int i = 0; i < NumPoints; ++i )
+    {
+        streaming.RemoveActivationPoint( i );
+        reference.RemoveActivationPoint( i );
+    }
+    streaming.Update( 0.1f );
+    reference.Update( 0.1f );
+
+    CORE_CHECK( streaming.GetActiveCount() == 0 );
+    CORE_CHECK( stats.residentCells == stats.pinnedCells );
+
+    // only objects that moved or were disabled are left in the overlay once their cells are evicted
+
+    CORE_CHECK( world.GetChangedCount() <= 300 * 10 + 6 );
+
+    world.Close();
+    remove( filename );
+}
@@ -0,0 +1,218 @@
+#include "core/Core.h"
+#include "core/Random.h"
+#include "cubes/Collision.h"
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#define dSINGLE
+#include <ode/ode.h>
+
+using namespace cubes;
+
+static const int NumFuzzPairs = 10000;
+static const float ContactTolerance = 0.0001f;
+
+static void random_rotation( core::RandomGenerator & random, dMatrix3 R )
+{
+    // every few boxes is axis aligned so parallel edges and coplanar faces get covered too
+
+    if ( random.GetInt( 0, 3 ) == 0 )
+    {
+        dRSetIdentity( R );
+        return;
+    }
+
+    dQuaternion q;
+    float length = 0.0f;
+    do
+    {
+        for ( int i = 0; i < 4; ++i )
+            q[i] = random.GetFloat() * 2.0f - 1.0f;
+        length = sqrtf( q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3] );
+    }
+    while ( length < 0.1f );
+
+    for ( int i = 0; i < 4; ++i )
+        q[i] /= length;
+
+    dRfromQ( R, q );
+}
+
+static dGeomID create_random_box( core::RandomGenerator & random, float spread )
+{
+    // mostly unit cubes like the demo, some stretched boxes to exercise the general case
+
+    float side[3] = { 1.0f, 1.0f, 1.0f };
+    if ( random.GetInt( 0, 1 ) )
+    {
+        for ( int i = 0; i < 3; ++i )
+            side[i] = 0.25f + random.GetFloat() * 2.0f;
+    }
+
+    dGeomID geom = dCreateBox( 0, side[0], side[1], side[2] );
+
+    dGeomSetPosition( geom, ( random.GetFloat() * 2.0f - 1.0f ) * spread,
+                            ( random.GetFloat() * 2.0f - 1.0f ) * spread,
+                            ( random.GetFloat() * 2.0f - 1.0f ) * spread );
+
+    dMatrix3 R;
+    random_rotation( random, R );
+    dGeomSetRotation( geom, R );
+
+    return geom;
+}
+
+static void get_collision_box( dGeomID geom, CollisionBox & box )
+{
+    const dReal * position = dGeomGetPosition( geom );
+    const dReal * rotation = dGeomGetRotation( geom );
+    dVector3 side;
+    dGeomBoxGetLengths( geom, side );
+    for ( int i = 0; i < 3; ++i )
+    {
+        box.position[i] = position[i];
+        box.side[i] = side[i];
+    }
+    box.position[3] = 0.0f;
+    box.side[3] = 0.0f;
+    for ( int i = 0; i < 12; ++i )
+        box.rotation[i] = rotation[i];
+}
+
+static void check_manifold_matches_ode( const CollisionManifold & manifold, const dContactGeom * contacts, int numContacts )
+{
+    CORE_CHECK( manifold.numContacts == numContacts );
+
+    for ( int i = 0; i < numContacts; ++i )
+    {
+        for ( int j = 0; j < 3; ++j )
+        {
+            CORE_CHECK_CLOSE( manifold.normal[j], contacts[i].normal[j], ContactTolerance );
+            CORE_CHECK_CLOSE( manifold.contacts[i].position[j], contacts[i].pos[j], ContactTolerance );
+        }
+        CORE_CHECK_CLOSE( manifold.contacts[i].depth, contacts[i].depth, ContactTolerance );
+    }
+}
+
+void test_box_box_contacts_match_ode()
+{
+    printf( "test_box_box_contacts_match_ode\n" );
+
+    dInitODE2( 0 );
+    {
+        core::RandomGenerator random( 1 );
+
+        const int maxContacts[] = { 16, 4, 1 };
+
+        for ( int m = 0; m < (int) ( sizeof( maxContacts ) / sizeof( int ) ); ++m )
+        {
+            // boxes are placed close enough that most pairs touch. pairs are collided in one batch
+            // so every simd lane sees every kind of contact
+
+            std::vector<dGeomID> geoms( NumFuzzPairs * 2 );
+            std::vector<CollisionBox> boxes( NumFuzzPairs * 2 );
+            std::vector<CollisionPair> pairs( NumFuzzPairs );
+            std::vector<CollisionManifold> manifolds( NumFuzzPairs );
+
+            for ( int i = 0; i < NumFuzzPairs * 2; ++i )
+            {
+                geoms[i] = create_random_box( random, 0.75f );
+                get_collision_box( geoms[i], boxes[i] );
+            }
+
+            for ( int i = 0; i < NumFuzzPairs; ++i )
+            {
+                pairs[i].a = i * 2;
+                pairs[i].b = i * 2 + 1;
+            }
+
+            CollideBoxes( &boxes[0], &pairs[0], NumFuzzPairs, maxContacts[m], &manifolds[0] );
+
+            int numTouching = 0;
+
+            for ( int i = 0; i < NumFuzzPairs; ++i )
+            {
+                dContactGeom contacts[16];
+                const int numContacts = dCollide( geoms[i*2], geoms[i*2+1], maxContacts[m], contacts, sizeof( dContactGeom ) );
+                check_manifold_matches_ode( manifolds[i], contacts, numContacts );
+                if ( numContacts > 0 )
+                    numTouching++;
+            }
+
+            CORE_CHECK( numTouching > NumFuzzPairs / 2 );
+            CORE_CHECK( numTouching < NumFuzzPairs );
+
+            for ( int i = 0; i < NumFuzzPairs * 2; ++i )
+                dGeomDestroy( geoms[i] );
+        }
+    }
+    dCloseODE();
+}
+
+void test_box_plane_contacts_match_ode()
+{
+    printf( "test_box_plane_contacts_match_ode\n" );
+
+    dInitODE2( 0 );
+    {
+        core::RandomGenerator random( 2 );
+
+        const int maxContacts[] = { 16, 3, 2, 1 };
+
+        for ( int m = 0; m < (int) ( sizeof( maxContacts ) / sizeof( int ) ); ++m )
+        {
+            std::vector<dGeomID> geoms( NumFuzzPairs );
+            std::vector<dGeomID> planeGeoms( NumFuzzPairs );
+            std::vector<CollisionBox> boxes( NumFuzzPairs );
+            std::vector<CollisionPlane> planes( NumFuzzPairs );
+            std::vector<CollisionPair> pairs( NumFuzzPairs );
+            std::vector<CollisionManifold> manifolds( NumFuzzPairs );
+
+            for ( int i = 0; i < NumFuzzPairs; ++i )
+            {
+                geoms[i] = create_random_box( random, 1.0f );
+                get_collision_box( geoms[i], boxes[i] );
+
+                // half the planes are the ground plane the demo uses, the rest are tilted. ode normalizes the normal
+
+                if ( random.GetInt( 0, 1 ) )
+                    planeGeoms[i] = dCreatePlane( 0, 0, 0, 1, 0 );
+                else
+                    planeGeoms[i] = dCreatePlane( 0, random.GetFloat() - 0.5f, random.GetFloat() - 0.5f, 1.0f, random.GetFloat() - 0.5f );
+
+                dVector4 params;
+                dGeomPlaneGetParams( planeGeoms[i], params );
+                planes[i].normal[0] = params[0];
+                planes[i].normal[1] = params[1];
+                planes[i].normal[2] = params[2];
+                planes[i].d = params[3];
+
+                pairs[i].a = i;
+                pairs[i].b = i;
+            }
+
+            CollideBoxesWithPlanes( &boxes[0], &planes[0], &pairs[0], NumFuzzPairs, maxContacts[m], &manifolds[0] );
+
+            int numTouching = 0;
+
+            for ( int i = 0; i < NumFuzzPairs; ++i )
+            {
+                dContactGeom contacts[16];
+                const int numContacts = dCollide( geoms[i], planeGeoms[i], maxContacts[m], contacts, sizeof( dContactGeom ) );
+                check_manifold_matches_ode( manifolds[i], contacts, numContacts );
+                if ( numContacts > 0 )
+                    numTouching++;
+            }
+
+            CORE_CHECK( numTouching > NumFuzzPairs / 4 );
+            CORE_CHECK( numTouching < NumFuzzPairs );
+
+            for ( int i = 0; i < NumFuzzPairs; ++i )
+            {
+                dGeomDestroy( geoms[i] );
+                dGeomDestroy( planeGeoms[i] );
+            }
+        }
+    }
+    dCloseODE();
+}
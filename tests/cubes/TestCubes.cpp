@@ -801,7 +801,59 @@ int main()
 }
 */
 
+extern void test_activation_multiple_points();
+extern void test_activation_moving_points();
+extern void test_activation_incremental_matches_full();
+extern void test_activation_set_index();
+extern void test_active_object_arrays_index();
+extern void test_activation_streaming();
+extern void test_box_box_contacts_match_ode();
+extern void test_box_plane_contacts_match_ode();
+extern void test_simulation_save_and_restore_state();
+extern void test_simulation_restore_added_and_removed_objects();
+extern void test_prediction_rollback_without_error();
+extern void test_prediction_correction();
+extern void test_prediction_resimulation_budget();
+extern void test_prediction_rollback_across_activation();
+extern void test_priority_set_select();
+extern void test_compress_positions_batch();
+extern void test_compress_orientations_batch();
+extern void test_quantize_vectors_batch();
+extern void test_interest_relevance();
+extern void test_interest_priority();
+extern void test_vector_matches_scalar();
+extern void test_quaternion_matches_scalar();
+extern void test_math_vectorial_conversion();
+extern void test_view_object_manager();
+extern void test_view_matches_reference();
+
 int main()
 {
+	test_activation_multiple_points();
+	test_activation_moving_points();
+	test_activation_incremental_matches_full();
+	test_activation_set_index();
+	test_active_object_arrays_index();
+	test_activation_streaming();
+	test_box_box_contacts_match_ode();
+	test_box_plane_contacts_match_ode();
+	test_simulation_save_and_restore_state();
+	test_simulation_restore_added_and_removed_objects();
+	test_prediction_rollback_without_error();
+	test_prediction_correction();
+	test_prediction_resimulation_budget();
+	test_prediction_rollback_across_activation();
+	test_priority_set_select();
+	test_compress_positions_batch();
+	test_compress_orientations_batch();
+	test_quantize_vectors_batch();
+	test_interest_relevance();
+	test_interest_priority();
+	test_vector_matches_scalar();
+	test_quaternion_matches_scalar();
+	test_math_vectorial_conversion();
+	test_view_object_manager();
+	test_view_matches_reference();
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,311 @@
+#include "core/Core.h"
+#include "cubes/Engine.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+void test_priority_set_select()
+{
+    printf( "test_priority_set_select\n" );
+
+    const int NumClients = 4;
+    const int NumObjects = 1000;
+
+    cubes::PrioritySet prioritySet( NumClients );
+
+    CORE_CHECK( prioritySet.GetNumClients() == NumClients );
+
+    for ( int i = 0; i < NumObjects; ++i )
+        prioritySet.AddObject( i );
+
+    // accumulators drawn from a few values so there are plenty of ties
+
+    std::vector<float> priority( NumObjects );
+    for ( int client = 0; client < NumClients; ++client )
+    {
+        for ( int i = 0; i < NumObjects; ++i )
+            priority[i] = (float) core::random_int( 0, 20 );
+        prioritySet.Accumulate( client, &priority[0], 0.5f );
+        for ( int i = 0; i < NumObjects; ++i )
+            CORE_CHECK( prioritySet.GetAccumulator( client, i ) == priority[i] * 0.5f );
+    }
+
+    // removing an object moves the last one into its place, for every client
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        const int index = core::random_int( 0, prioritySet.GetNumObjects() - 1 );
+        const int last = prioritySet.GetNumObjects() - 1;
+        float moved[NumClients];
+        for ( int client = 0; client < NumClients; ++client )
+            moved[client] = prioritySet.GetAccumulator( client, last );
+        prioritySet.RemoveObject( index );
+        if ( index != last )
+        {
+            for ( int client = 0; client < NumClients; ++client )
+                CORE_CHECK( prioritySet.GetAccumulator( client, index ) == moved[client] );
+        }
+    }
+
+    const int numObjects = prioritySet.GetNumObjects();
+    CORE_CHECK( numObjects == NumObjects - 100 );
+
+    // selecting the top k gives exactly the start of a full sort, for each client independently
+
+    for ( int client = 0; client < NumClients; ++client )
+    {
+        std::vector<int> sorted( numObjects );
+        std::vector<float> sortedPriority( numObjects );
+        CORE_CHECK( prioritySet.SelectObjects( client, numObjects ) == numObjects );
+        for ( int i = 0; i < numObjects; ++i )
+        {
+            sorted[i] = prioritySet.GetSortedObject( i, sortedPriority[i] );
+            CORE_CHECK( sortedPriority[i] == prioritySet.GetAccumulator( client, sorted[i] ) );
+            if ( i > 0 )
+            {
+                CORE_CHECK( sortedPriority[i-1] >= sortedPriority[i] );
+                if ( sortedPriority[i-1] == sortedPriority[i] )
+                    CORE_CHECK( sorted[i-1] < sorted[i] );
+            }
+        }
+
+        const int counts[] = { 0, 1, 63, 500, numObjects, numObjects + 10 };
+        for ( int j = 0; j < (int) ( sizeof( counts ) / sizeof( int ) ); ++j )
+        {
+            const int selected = prioritySet.SelectObjects( client, counts[j] );
+            CORE_CHECK( selected == core::min( counts[j], numObjects ) );
+            for ( int i = 0; i < selected; ++i )
+            {
+                float accumulator;
+                CORE_CHECK( prioritySet.GetSortedObject( i, accumulator ) == sorted[i] );
+                CORE_CHECK( accumulator == sortedPriority[i] );
+            }
+        }
+    }
+
+    // the single client interface works on client zero
+
+    prioritySet.SetAccumulator( 7, 1000.0f );
+    CORE_CHECK( prioritySet.GetAccumulator( 0, 7 ) == 1000.0f );
+    prioritySet.SortObjects();
+    float accumulator;
+    CORE_CHECK( prioritySet.GetSortedObject( 0, accumulator ) == 7 );
+    CORE_CHECK( accumulator == 1000.0f );
+    CORE_CHECK( prioritySet.GetAccumulator( 1, 7 ) != 1000.0f );
+
+    prioritySet.Clear();
+    CORE_CHECK( prioritySet.GetNumObjects() == 0 );
+    CORE_CHECK( prioritySet.SelectObjects( 0, 10 ) == 0 );
+}
+
+void test_compress_positions_batch()
+{
+    printf( "test_compress_positions_batch\n" );
+
+    // every 20 bit value on every axis: odd multipliers visit all of them in a different order per axis.
+    // an odd count leaves a few objects for the single object tail
+
+    const int NumPositions = ( 1 << 20 ) - 1;
+    const uint64_t Mask = ( 1 << 20 ) - 1;
+
+    std::vector<uint64_t> compressed( NumPositions );
+    for ( int i = 0; i < NumPositions; ++i )
+        compressed[i] = ( uint64_t( i ) << 40 ) | ( ( ( uint64_t( i ) * 7919 ) & Mask ) << 20 ) | ( ( uint64_t( i ) * 104729 ) & Mask );
+
+    std::vector<math::Vector> positions( NumPositions );
+    cubes::DecompressPositions( &compressed[0], &positions[0], NumPositions );
+
+    bool identical = true;
+    for ( int i = 0; i < NumPositions; ++i )
+    {
+        math::Vector position;
+        cubes::DecompressPosition( compressed[i], position );
+        if ( memcmp( &position, &positions[i], sizeof( position ) ) != 0 )
+            identical = false;
+    }
+    CORE_CHECK( identical );
+
+    // decompressed positions are exact, so they compress back to the same bits
+
+    std::vector<uint64_t> recompressed( NumPositions );
+    cubes::CompressPositions( &positions[0], &recompressed[0], NumPositions );
+    CORE_CHECK( recompressed == compressed );
+
+    // positions between quantization steps round the same way as the single object version, negative ones included
+
+    for ( int i = 0; i < NumPositions; ++i )
+        positions[i] = math::Vector( core::random_float( -512.0f, 511.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -0.01f, 100.0f ) );
+
+    cubes::CompressPositions( &positions[0], &recompressed[0], NumPositions );
+
+    for ( int i = 0; i < NumPositions; ++i )
+    {
+        uint64_t single;
+        cubes::CompressPosition( positions[i], single );
+        if ( single != recompressed[i] )
+            identical = false;
+    }
+    CORE_CHECK( identical );
+}
+
+static bool orientation_code_canonical( uint32_t compressed )
+{
+    // the code decodes to a unit quaternion whose reconstructed component really is the largest,
+    // ie. one the compressor could have produced
+
+    const float minimum = - 1.0f / 1.414214f;
+    const float maximum = + 1.0f / 1.414214f;
+    const float a = ( ( compressed >> 20 ) & 1023 ) / 1024.0f * ( maximum - minimum ) + minimum;
+    const float b = ( ( compressed >> 10 ) & 1023 ) / 1024.0f * ( maximum - minimum ) + minimum;
+    const float c = ( compressed & 1023 ) / 1024.0f * ( maximum - minimum ) + minimum;
+    const float d = 1 - a*a - b*b - c*c;
+    return d >= a*a && d >= b*b && d >= c*c;
+}
+
+static bool check_orientations_batch( const std::vector<math::Quaternion> & orientations, bool round_trip )
+{
+    const int count = (int) orientations.size();
+
+    std::vector<uint32_t> compressed( count );
+    cubes::CompressOrientations( &orientations[0], &compressed[0], count );
+
+    std::vector<math::Quaternion> decompressed( count );
+    cubes::DecompressOrientations( &compressed[0], &decompressed[0], count );
+
+    bool identical = true;
+    for ( int i = 0; i < count; ++i )
+    {
+        uint32_t single;
+        cubes::CompressOrientation( orientations[i], single );
+        math::Quaternion orientation;
+        cubes::DecompressOrientation( single, orientation );
+        if ( single != compressed[i] || memcmp( &orientation, &decompressed[i], sizeof( orientation ) ) != 0 )
+            identical = false;
+
+        // the round trip lands close to the original, or its negation which is the same rotation
+
+        const float dot = orientations[i].w * orientation.w + orientations[i].x * orientation.x + orientations[i].y * orientation.y + orientations[i].z * orientation.z;
+        if ( round_trip && math::abs( dot ) < 0.999f )
+            identical = false;
+    }
+    return identical;
+}
+
+void test_compress_orientations_batch()
+{
+    printf( "test_compress_orientations_batch\n" );
+
+    // every canonical code with the three small components on a grid, for each largest component,
+    // a slice at a time. odd slice sizes leave a few codes for the single object tail
+
+    const int Step = 8;
+
+    bool identical = true;
+    bool round_trip = true;
+
+    std::vector<uint32_t> compressed;
+    std::vector<math::Quaternion> decompressed;
+
+    for ( uint32_t largest = 0; largest < 4; ++largest )
+    {
+        for ( uint32_t a = 0; a < 1024; a += Step )
+        {
+            compressed.clear();
+            for ( uint32_t b = 0; b < 1024; b += Step )
+            {
+                for ( uint32_t c = 0; c < 1024; c += Step )
+                {
+                    const uint32_t code = ( largest << 30 ) | ( a << 20 ) | ( b << 10 ) | c;
+                    if ( orientation_code_canonical( code ) )
+                        compressed.push_back( code );
+                }
+            }
+
+            const int count = (int) compressed.size();
+            if ( count == 0 )
+                continue;
+
+            decompressed.resize( count );
+            cubes::DecompressOrientations( &compressed[0], &decompressed[0], count );
+
+            for ( int i = 0; i < count; ++i )
+            {
+                math::Quaternion orientation;
+                cubes::DecompressOrientation( compressed[i], orientation );
+                if ( memcmp( &orientation, &decompressed[i], sizeof( orientation ) ) != 0 )
+                    identical = false;
+            }
+
+            // and back again
+
+            if ( !check_orientations_batch( decompressed, true ) )
+                round_trip = false;
+        }
+    }
+
+    CORE_CHECK( identical );
+    CORE_CHECK( round_trip );
+
+    // ties between the largest components, in every sign combination
+
+    std::vector<math::Quaternion> ties;
+    const float s = 1.0f / math::sqrt( 2.0f );
+    for ( int signs = 0; signs < 16; ++signs )
+    {
+        const float w = signs & 1 ? -1.0f : 1.0f;
+        const float x = signs & 2 ? -1.0f : 1.0f;
+        const float y = signs & 4 ? -1.0f : 1.0f;
+        const float z = signs & 8 ? -1.0f : 1.0f;
+        ties.push_back( math::Quaternion( 0.5f * w, 0.5f * x, 0.5f * y, 0.5f * z ) );
+        ties.push_back( math::Quaternion( s * w, s * x, 0, 0 ) );
+        ties.push_back( math::Quaternion( s * w, 0, s * y, 0 ) );
+        ties.push_back( math::Quaternion( s * w, 0, 0, s * z ) );
+        ties.push_back( math::Quaternion( 0, s * x, s * y, 0 ) );
+        ties.push_back( math::Quaternion( 0, s * x, 0, s * z ) );
+        ties.push_back( math::Quaternion( 0, 0, s * y, s * z ) );
+        ties.push_back( math::Quaternion( w, 0, 0, 0 ) );
+        ties.push_back( math::Quaternion( 0, x, 0, 0 ) );
+    }
+
+    // components of 1/sqrt(2) sit just past the edge of the quantized range, so only compare these with the single object version
+
+    CORE_CHECK( check_orientations_batch( ties, false ) );
+
+    // random rotations. a few have a second component just over the quantized range too, so again only compare
+
+    std::vector<math::Quaternion> orientations( 100001 );
+    for ( int i = 0; i < (int) orientations.size(); ++i )
+    {
+        math::Quaternion & q = orientations[i];
+        q = math::Quaternion( core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ) );
+        q.normalize();
+    }
+    CORE_CHECK( check_orientations_batch( orientations, false ) );
+}
+
+void test_quantize_vectors_batch()
+{
+    printf( "test_quantize_vectors_batch\n" );
+
+    const int NumVectors = 1001;
+
+    std::vector<math::Vector> vectors( NumVectors );
+    for ( int i = 0; i < NumVectors; ++i )
+        vectors[i] = math::Vector( core::random_float( -32.0f, 32.0f ), core::random_float( -1.0f, 1.0f ), i * 0.25f - 100.0f );
+
+    std::vector<int32_t> quantized( NumVectors * 3 );
+
+    const float resolutions[] = { 1.0f, 32.0f, 1000.0f };
+    for ( int j = 0; j < 3; ++j )
+    {
+        cubes::QuantizeVectors( &vectors[0], &quantized[0], NumVectors, resolutions[j] );
+        for ( int i = 0; i < NumVectors; ++i )
+        {
+            int32_t x, y, z;
+            cubes::QuantizeVector( vectors[i], x, y, z, resolutions[j] );
+            CORE_CHECK( quantized[i*3] == x );
+            CORE_CHECK( quantized[i*3+1] == y );
+            CORE_CHECK( quantized[i*3+2] == z );
+        }
+    }
+}
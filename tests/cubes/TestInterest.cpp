@@ -0,0 +1,230 @@
+#include "core/Core.h"
+#include "cubes/Interest.h"
+#include <stdio.h>
+#include <math.h>
+
+static const float DeltaTime = 0.1f;
+
+void test_interest_relevance()
+{
+    printf( "test_interest_relevance\n" );
+
+    const int NumObjects = 2000;
+    const int NumClients = 4;
+    const float WorldSize = 80.0f;
+
+    activation::ActivationSystem activationSystem( NumObjects + 1, 15.0f, 50, 50, 2.0f, 8, 32 );
+
+    float x[NumObjects+1];
+    float y[NumObjects+1];
+    for ( int i = 1; i <= NumObjects; ++i )
+    {
+        x[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        y[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        activationSystem.InsertObject( i, x[i], y[i] );
+    }
+
+    cubes::InterestConfig config;
+    config.relevanceRadius = 10.0f;
+
+    cubes::InterestManager interest( NumClients, config );
+
+    for ( int i = 0; i < NumClients; ++i )
+        interest.AddClient( i );
+
+    // clients 0..2 have an activation circle each. client 3 wanders around with no circle,
+    // so only objects other clients keep active can be relevant to it
+
+    float cx[NumClients];
+    float cy[NumClients];
+    for ( int i = 0; i < NumClients; ++i )
+    {
+        cx[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        cy[i] = core::random_float( -WorldSize / 2, +WorldSize / 2 );
+        if ( i < NumClients - 1 )
+        {
+            if ( i == 0 )
+                activationSystem.MoveActivationPoint( cx[i], cy[i] );
+            else
+                activationSystem.AddActivationPoint( i, cx[i], cy[i] );
+        }
+    }
+
+    int totalRelevant = 0;
+
+    for ( int frame = 0; frame < 100; ++frame )
+    {
+        for ( int i = 0; i < NumClients; ++i )
+        {
+            cx[i] = math::clamp( cx[i] + core::random_float( -2.0f, +2.0f ), -WorldSize / 2, +WorldSize / 2 );
+            cy[i] = math::clamp( cy[i] + core::random_float( -2.0f, +2.0f ), -WorldSize / 2, +WorldSize / 2 );
+            if ( i < NumClients - 1 )
+                activationSystem.MoveActivationPoint( i, cx[i], cy[i] );
+            interest.SetClientView( i, cx[i], cy[i] );
+        }
+
+        // a client leaves for a while and comes back with nothing relevant carried over
+
+        if ( frame == 40 )
+            interest.RemoveClient( 2 );
+        if ( frame == 60 )
+            interest.AddClient( 2 );
+        if ( frame == 60 )
+            interest.SetClientView( 2, cx[2], cy[2] );
+
+        activationSystem.Update( DeltaTime );
+        activationSystem.ClearEvents();
+
+        interest.Update( activationSystem, DeltaTime );
+
+        // exactly the active objects inside the relevance circle are relevant to each client
+
+        int relevant = 0;
+        for ( int client = 0; client < NumClients; ++client )
+        {
+            if ( !interest.IsClientConnected( client ) )
+            {
+                CORE_CHECK( client == 2 && frame >= 40 && frame < 60 );
+                continue;
+            }
+
+            int expected = 0;
+            for ( int i = 1; i <= NumObjects; ++i )
+            {
+                const float dx = x[i] - cx[client];
+                const float dy = y[i] - cy[client];
+                const bool inside = activationSystem.IsActive( i ) && dx*dx + dy*dy <= config.relevanceRadius * config.relevanceRadius;
+                CORE_CHECK( interest.IsRelevant( client, i ) == inside );
+                CORE_CHECK( ( interest.GetAccumulator( client, i ) > 0.0f ) == inside );
+                if ( inside )
+                    expected++;
+            }
+
+            CORE_CHECK( interest.GetNumRelevantObjects( client ) == expected );
+
+            relevant += expected;
+        }
+
+        const cubes::InterestStats & stats = interest.GetStats();
+        CORE_CHECK( stats.relevantObjects == relevant );
+        CORE_CHECK( stats.objectsTested < NumObjects );
+
+        totalRelevant += relevant;
+    }
+
+    CORE_CHECK( totalRelevant > 0 );
+}
+
+void test_interest_priority()
+{
+    printf( "test_interest_priority\n" );
+
+    activation::ActivationSystem activationSystem( 1024, 20.0f, 50, 50, 2.0f, 8, 32 );
+
+    // a near and a far object either side of the client, and a focus object off to the side
+
+    const activation::ObjectId Front = 1;
+    const activation::ObjectId Behind = 2;
+    const activation::ObjectId FarFront = 3;
+    const activation::ObjectId Focus = 4;
+
+    activationSystem.InsertObject( Front, +3.0f, 0.0f );
+    activationSystem.InsertObject( Behind, -3.0f, 0.0f );
+    activationSystem.InsertObject( FarFront, +8.0f, 0.0f );
+    activationSystem.InsertObject( Focus, 0.0f, 9.0f );
+
+    activationSystem.MoveActivationPoint( 0.0f, 0.0f );
+    activationSystem.Update( DeltaTime );
+    activationSystem.ClearEvents();
+
+    cubes::InterestConfig config;
+    config.relevanceRadius = 10.0f;
+
+    cubes::InterestManager interest( 1, config );
+    interest.AddClient( 0 );
+    interest.SetClientView( 0, 0.0f, 0.0f, 2.0f, 0.0f );
+
+    interest.Update( activationSystem, DeltaTime );
+
+    // the object in view gets the visibility bonus over the one at the same distance behind,
+    // and nearer objects beat farther ones
+
+    const float front = interest.GetAccumulator( 0, Front );
+    const float behind = interest.GetAccumulator( 0, Behind );
+    const float farFront = interest.GetAccumulator( 0, FarFront );
+
+    CORE_CHECK( fabs( front - behind - config.visiblePriority * DeltaTime ) < 0.001f );
+    CORE_CHECK( fabs( behind - ( config.basePriority + config.distancePriority * 0.7f ) * DeltaTime ) < 0.001f );
+    CORE_CHECK( front > farFront );
+
+    // interacting boosts an object for a while, then it drops back
+
+    interest.OnInteraction( 0, Behind );
+
+    for ( int i = 0; i < 3; ++i )
+        interest.Update( activationSystem, DeltaTime );
+
+    CORE_CHECK( interest.GetAccumulator( 0, Behind ) > interest.GetAccumulator( 0, Front ) );
+
+    for ( int i = 0; i < 20; ++i )
+        interest.Update( activationSystem, DeltaTime );
+
+    float before = interest.GetAccumulator( 0, Behind );
+    interest.Update( activationSystem, DeltaTime );
+    CORE_CHECK( fabs( interest.GetAccumulator( 0, Behind ) - before - behind ) < 0.001f );
+
+    // the focus object goes to the front, and resetting an accumulator sends it to the back
+
+    interest.SetClientFocus( 0, Focus );
+    interest.Update( activationSystem, DeltaTime );
+
+    CORE_CHECK( interest.SelectObjects( 0, 2 ) == 2 );
+    float priority;
+    CORE_CHECK( interest.GetSelectedObject( 0, priority ) == Focus );
+    CORE_CHECK( priority == interest.GetAccumulator( 0, Focus ) );
+    CORE_CHECK( interest.GetSelectedActiveIndex( 0 ) >= 0 );
+
+    CORE_CHECK( interest.SelectObjects( 0, 100 ) == 4 );
+    float previous = 0.0f;
+    for ( int i = 0; i < 4; ++i )
+    {
+        interest.GetSelectedObject( i, priority );
+        CORE_CHECK( i == 0 || priority <= previous );
+        previous = priority;
+    }
+
+    interest.ResetAccumulator( 0, Focus );
+    CORE_CHECK( interest.GetAccumulator( 0, Focus ) == 0.0f );
+    CORE_CHECK( interest.SelectObjects( 0, 4 ) == 4 );
+    CORE_CHECK( interest.GetSelectedObject( 3, priority ) == Focus );
+
+    // walking away drops everything, accumulators included
+
+    interest.SetClientView( 0, 40.0f, 40.0f );
+    interest.Update( activationSystem, DeltaTime );
+
+    CORE_CHECK( interest.GetNumRelevantObjects( 0 ) == 0 );
+    CORE_CHECK( interest.GetAccumulator( 0, Front ) == 0.0f );
+
+    // interacting with an object that is not relevant does not make it selectable before
+    // the next update, but the boost applies once it becomes relevant again
+
+    interest.OnInteraction( 0, Front );
+
+    CORE_CHECK( interest.GetNumRelevantObjects( 0 ) == 0 );
+    CORE_CHECK( interest.SelectObjects( 0, 4 ) == 0 );
+
+    interest.SetClientView( 0, 0.0f, 0.0f, 1.0f, 0.0f );
+    interest.Update( activationSystem, DeltaTime );
+
+    CORE_CHECK( interest.GetNumRelevantObjects( 0 ) == 4 );
+    CORE_CHECK( fabs( interest.GetAccumulator( 0, Front ) - front - config.interactionPriority * DeltaTime ) < 0.001f );
+
+    // interacting with a relevant object between updates keeps every selected active index valid
+
+    interest.OnInteraction( 0, Behind );
+
+    CORE_CHECK( interest.SelectObjects( 0, 4 ) == 4 );
+    for ( int i = 0; i < 4; ++i )
+        CORE_CHECK( interest.GetSelectedActiveIndex( i ) >= 0 );
+}
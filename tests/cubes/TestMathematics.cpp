@@ -0,0 +1,225 @@
+#include "core/Core.h"
+#include "cubes/Mathematics.h"
+#include <stdio.h>
+#include <string.h>
+
+// scalar reference versions of the vector and quaternion math, written out component by component
+// the way the cubes math layer did it before it moved onto simd4f. results must match bit for bit
+
+struct ReferenceVector { float x, y, z; };
+
+struct ReferenceQuaternion { float w, x, y, z; };
+
+static ReferenceVector reference_cross( const ReferenceVector & a, const ReferenceVector & b )
+{
+    ReferenceVector r = { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    return r;
+}
+
+static ReferenceVector reference_normalize( ReferenceVector v )
+{
+    const float magnitude = sqrtf( v.x*v.x + v.y*v.y + v.z*v.z );
+    if ( magnitude > math::epsilon )
+    {
+        const float scale = 1.0f / magnitude;
+        v.x *= scale;
+        v.y *= scale;
+        v.z *= scale;
+    }
+    return v;
+}
+
+static ReferenceQuaternion reference_multiply( const ReferenceQuaternion & a, const ReferenceQuaternion & b )
+{
+    ReferenceQuaternion r = { a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z,
+                              a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
+                              a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
+                              a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w };
+    return r;
+}
+
+static ReferenceQuaternion reference_normalize( ReferenceQuaternion q )
+{
+    const float length = sqrtf( q.w*q.w + q.x*q.x + q.y*q.y + q.z*q.z );
+    if ( length == 0 )
+    {
+        ReferenceQuaternion identity = { 1, 0, 0, 0 };
+        return identity;
+    }
+    const float inv = 1.0f / length;
+    ReferenceQuaternion r = { q.w * inv, q.x * inv, q.y * inv, q.z * inv };
+    return r;
+}
+
+static ReferenceQuaternion reference_nlerp( const ReferenceQuaternion & a, const ReferenceQuaternion & b, float t )
+{
+    const float cosine = a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z;
+    const float sign = cosine >= 0 ? 1.0f : -1.0f;
+    ReferenceQuaternion r = { a.w + ( sign * b.w - a.w ) * t,
+                              a.x + ( sign * b.x - a.x ) * t,
+                              a.y + ( sign * b.y - a.y ) * t,
+                              a.z + ( sign * b.z - a.z ) * t };
+    return reference_normalize( r );
+}
+
+static bool same( const math::Vector & v, const ReferenceVector & r )
+{
+    return memcmp( &v.x, &r.x, sizeof( float ) ) == 0 && memcmp( &v.y, &r.y, sizeof( float ) ) == 0 && memcmp( &v.z, &r.z, sizeof( float ) ) == 0;
+}
+
+static bool same( const math::Quaternion & q, const ReferenceQuaternion & r )
+{
+    return memcmp( &q.w, &r, sizeof( ReferenceQuaternion ) ) == 0;
+}
+
+static bool same( float a, float b )
+{
+    return memcmp( &a, &b, sizeof( float ) ) == 0;
+}
+
+void test_vector_matches_scalar()
+{
+    printf( "test_vector_matches_scalar\n" );
+
+    CORE_CHECK( sizeof( math::Vector ) == 4 * sizeof( float ) );
+
+    const int NumIterations = 100000;
+
+    bool identical = true;
+
+    for ( int i = 0; i < NumIterations; ++i )
+    {
+        const ReferenceVector ra = { core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ) };
+        const ReferenceVector rb = { core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ), core::random_float( -100.0f, 100.0f ) };
+        const float s = core::random_float( -10.0f, 10.0f ) + 0.001f;
+
+        const math::Vector a( ra.x, ra.y, ra.z );
+        const math::Vector b( rb.x, rb.y, rb.z );
+
+        const ReferenceVector sum = { ra.x + rb.x, ra.y + rb.y, ra.z + rb.z };
+        const ReferenceVector difference = { ra.x - rb.x, ra.y - rb.y, ra.z - rb.z };
+        const ReferenceVector scaled = { ra.x * s, ra.y * s, ra.z * s };
+        const ReferenceVector divided = { ra.x / s, ra.y / s, ra.z / s };
+        const ReferenceVector negated = { -ra.x, -ra.y, -ra.z };
+
+        identical = identical && same( a + b, sum );
+        identical = identical && same( a - b, difference );
+        identical = identical && same( a * s, scaled );
+        identical = identical && same( s * a, scaled );
+        identical = identical && same( a / s, divided );
+        identical = identical && same( -a, negated );
+        identical = identical && same( a * b, reference_cross( ra, rb ) );
+        identical = identical && same( a.cross( b ), reference_cross( ra, rb ) );
+        identical = identical && same( a.unit(), reference_normalize( ra ) );
+        identical = identical && same( a.dot( b ), ra.x * rb.x + ra.y * rb.y + ra.z * rb.z );
+        identical = identical && same( a.lengthSquared(), ra.x * ra.x + ra.y * ra.y + ra.z * ra.z );
+        identical = identical && same( a.length(), sqrtf( ra.x * ra.x + ra.y * ra.y + ra.z * ra.z ) );
+
+        math::Vector c = a;
+        c += b;
+        identical = identical && same( c, sum );
+        c = a;
+        c -= b;
+        identical = identical && same( c, difference );
+        c = a;
+        c *= s;
+        identical = identical && same( c, scaled );
+        c = a;
+        c /= s;
+        identical = identical && same( c, divided );
+        c = a;
+        c *= b;
+        identical = identical && same( c, reference_cross( ra, rb ) );
+    }
+
+    CORE_CHECK( identical );
+
+    // small vectors are left alone by normalize
+
+    math::Vector tiny( 0.000001f, 0.0f, 0.0f );
+    tiny.normalize();
+    CORE_CHECK( tiny.x == 0.000001f && tiny.y == 0.0f && tiny.z == 0.0f );
+
+    // element access goes through the same storage as the lanes
+
+    math::Vector v( 1, 2, 3 );
+    v[1] = 5;
+    CORE_CHECK( v.y == 5 && simd4f_get_y( v.value ) == 5 );
+    CORE_CHECK( simd4f_get_w( v.value ) == 0 );
+}
+
+void test_quaternion_matches_scalar()
+{
+    printf( "test_quaternion_matches_scalar\n" );
+
+    CORE_CHECK( sizeof( math::Quaternion ) == 4 * sizeof( float ) );
+
+    const int NumIterations = 100000;
+
+    bool identical = true;
+
+    for ( int i = 0; i < NumIterations; ++i )
+    {
+        const ReferenceQuaternion ra = { core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ) };
+        const ReferenceQuaternion rb = { core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ), core::random_float( -1.0f, 1.0f ) };
+        const float t = core::random_float( 0.0f, 1.0f );
+
+        const math::Quaternion a( ra.w, ra.x, ra.y, ra.z );
+        const math::Quaternion b( rb.w, rb.x, rb.y, rb.z );
+
+        const ReferenceQuaternion sum = { ra.w + rb.w, ra.x + rb.x, ra.y + rb.y, ra.z + rb.z };
+        const ReferenceQuaternion difference = { ra.w - rb.w, ra.x - rb.x, ra.y - rb.y, ra.z - rb.z };
+        const ReferenceQuaternion scaled = { ra.w * t, ra.x * t, ra.y * t, ra.z * t };
+        const ReferenceQuaternion conjugate = { ra.w, -ra.x, -ra.y, -ra.z };
+        const float norm = ra.w*ra.w + ra.x*ra.x + ra.y*ra.y + ra.z*ra.z;
+        const ReferenceQuaternion inverse = { ra.w / norm, -ra.x / norm, -ra.y / norm, -ra.z / norm };
+
+        identical = identical && same( a + b, sum );
+        identical = identical && same( a - b, difference );
+        identical = identical && same( a * t, scaled );
+        identical = identical && same( a * b, reference_multiply( ra, rb ) );
+        identical = identical && same( a.norm(), norm );
+        identical = identical && same( a.dot( b ), ra.w*rb.w + ra.x*rb.x + ra.y*rb.y + ra.z*rb.z );
+        identical = identical && same( a.inverse(), inverse );
+        identical = identical && same( math::nlerp( a, b, t ), reference_nlerp( ra, rb, t ) );
+
+        math::Quaternion c = a;
+        identical = identical && same( c.conjugate(), conjugate );
+        c.multiply( b );
+        identical = identical && same( c, reference_multiply( ra, rb ) );
+        c = a;
+        c.normalize();
+        identical = identical && same( c, reference_normalize( ra ) );
+    }
+
+    CORE_CHECK( identical );
+
+    math::Quaternion zero( 0, 0, 0, 0 );
+    zero.normalize();
+    CORE_CHECK( zero.w == 1 && zero.x == 0 && zero.y == 0 && zero.z == 0 );
+
+    // rotating a vector by a quaternion and its inverse gets back to where we started
+
+    math::Quaternion rotation( 1.0f, math::Vector( 0, 0, 1 ) );
+    math::Vector v = rotation.transform( math::Vector( 1, 0, 0 ) );
+    CORE_CHECK( math::equal( v.x, cosf( 1.0f ) ) && math::equal( v.y, sinf( 1.0f ) ) && math::equal( v.z, 0.0f ) );
+    v = rotation.inverse().transform( v );
+    CORE_CHECK( v == math::Vector( 1, 0, 0 ) );
+}
+
+void test_math_vectorial_conversion()
+{
+    printf( "test_math_vectorial_conversion\n" );
+
+    const math::Vector v( 1, 2, 3 );
+    const vectorial::vec3f a = math::to_vec3f( v );
+    CORE_CHECK( a.x() == 1 && a.y() == 2 && a.z() == 3 );
+    const math::Vector b = math::to_vector( a );
+    CORE_CHECK( b.x == 1 && b.y == 2 && b.z == 3 );
+
+    const math::Quaternion q( 1, 2, 3, 4 );
+    const vectorial::quat4f c = math::to_quat4f( q );
+    CORE_CHECK( c.w() == 1 && c.x() == 2 && c.y() == 3 && c.z() == 4 );
+    const math::Quaternion d = math::to_quaternion( c );
+    CORE_CHECK( d.w == 1 && d.x == 2 && d.y == 3 && d.z == 4 );
+}
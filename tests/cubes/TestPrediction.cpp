@@ -0,0 +1,296 @@
+#include "core/Core.h"
+#include "cubes/Prediction.h"
+#include "cubes/Hypercube.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef game::Instance<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectSet> GameInstance;
+typedef game::Prediction<hypercube::DatabaseObject, hypercube::ActiveObject, hypercube::ActiveObjectSet> GamePrediction;
+
+static const int CubeSteps = 6;
+static const int NumObjects = CubeSteps * CubeSteps + 1;
+static const float DeltaTime = 1.0f / 60.0f;
+
+static GameInstance * create_game_instance( float activation_distance = 100.0f )
+{
+    game::Config config;
+    config.maxObjects = NumObjects + MaxPlayers;
+    config.cellSize = 2.0f;
+    config.cellWidth = int( CubeSteps / config.cellSize + 2 * 2 );
+    config.cellHeight = config.cellWidth;
+    config.activationDistance = activation_distance;
+    config.deactivationTime = 0.25f;
+    config.simConfig.SortBroadphasePairs = true;
+
+    GameInstance * instance = new GameInstance( config );
+
+    instance->InitializeBegin();
+
+    instance->AddPlane( math::Vector(0,0,1), 0 );
+
+    for ( int i = 0; i < NumObjects; ++i )
+    {
+        const bool player = i == 0;
+        const float x = player ? 0.0f : ( i - 1 ) % CubeSteps - CubeSteps / 2 + 0.5f;
+        const float y = player ? 0.0f : ( i - 1 ) / CubeSteps - CubeSteps / 2 + 0.5f;
+        const float z = player ? 4.0f : hypercube::NonPlayerCubeSize / 2.0f;
+        hypercube::DatabaseObject object;
+        cubes::CompressPosition( math::Vector( x, y, z ), object.position );
+        cubes::CompressOrientation( math::Quaternion(1,0,0,0), object.orientation );
+        object.enabled = player;
+        object.session = 0;
+        object.player = player;
+        const activation::ObjectId id = instance->AddObject( object, x, y );
+        if ( player )
+            instance->DisableObject( id );
+    }
+
+    instance->InitializeEnd();
+
+    instance->OnPlayerJoined( 0 );
+    instance->SetLocalPlayer( 0 );
+    instance->SetPlayerFocus( 0, 1 );
+
+    instance->SetFlag( game::FLAG_Push );
+    instance->SetFlag( game::FLAG_Pull );
+
+    return instance;
+}
+
+static game::Input get_input( uint32_t frame )
+{
+    game::Input input;
+    input.left = ( frame / 20 ) % 2 == 0;
+    input.up = true;
+    input.push = ( frame / 15 ) % 2 == 0;
+    return input;
+}
+
+static uint64_t get_checksum( GameInstance * instance )
+{
+    uint64_t checksum = 0;
+    for ( int id = 1; id <= NumObjects; ++id )
+    {
+        hypercube::ActiveObject object;
+        instance->GetObjectState( id, object );
+        uint32_t bits[13];
+        memcpy( bits, &object.position, sizeof( float ) * 3 );
+        memcpy( bits + 3, &object.orientation, sizeof( float ) * 4 );
+        memcpy( bits + 7, &object.linearVelocity, sizeof( float ) * 3 );
+        memcpy( bits + 10, &object.angularVelocity, sizeof( float ) * 3 );
+        for ( int j = 0; j < 13; ++j )
+            checksum = checksum * 31 + bits[j];
+    }
+    return checksum;
+}
+
+static void update_reference( GameInstance * instance, uint32_t frame )
+{
+    instance->SetPlayerInput( 0, get_input( frame ) );
+    cubes::Simulation::SetRandomSeed( frame );
+    instance->Update( DeltaTime );
+}
+
+static void update_prediction( GamePrediction & prediction )
+{
+    cubes::Simulation::SetRandomSeed( prediction.GetFrame() );
+    prediction.Update( get_input( prediction.GetFrame() ), DeltaTime );
+}
+
+void test_prediction_rollback_without_error()
+{
+    printf( "test_prediction_rollback_without_error\n" );
+
+    GameInstance * reference = create_game_instance();
+    GameInstance * client = create_game_instance();
+
+    GamePrediction prediction( client );
+
+    // authoritative state that agrees with the prediction rewinds and resimulates to exactly the same place
+
+    hypercube::ActiveObject player;
+
+    for ( uint32_t frame = 0; frame < 40; ++frame )
+    {
+        if ( frame == 10 )
+            reference->GetObjectState( 1, player );
+
+        if ( frame == 20 )
+            prediction.SetAuthoritativeState( 10, &player, 1 );
+
+        update_reference( reference, frame );
+        update_prediction( prediction );
+
+        CORE_CHECK( get_checksum( reference ) == get_checksum( client ) );
+    }
+
+    const game::PredictionStats & stats = prediction.GetStats();
+    CORE_CHECK( stats.numCorrections == 1 );
+    CORE_CHECK( stats.numSkippedCorrections == 0 );
+    CORE_CHECK( stats.numResimulatedFrames == 10 );
+    CORE_CHECK( stats.maxPositionError == 0.0f );
+    CORE_CHECK( stats.maxOrientationError == 0.0f );
+
+    delete client;
+    delete reference;
+}
+
+void test_prediction_correction()
+{
+    printf( "test_prediction_correction\n" );
+
+    GameInstance * reference = create_game_instance();
+    GameInstance * client = create_game_instance();
+
+    GamePrediction prediction( client );
+
+    // the server knows the player was somewhere else at frame 10. once the client hears about it,
+    // it must end up exactly where it would have been had it known all along
+
+    hypercube::ActiveObject player;
+
+    for ( uint32_t frame = 0; frame < 40; ++frame )
+    {
+        if ( frame == 10 )
+        {
+            reference->GetObjectState( 1, player );
+            player.position.x += 1.0f;
+            player.linearVelocity.y += 2.0f;
+            reference->SetObjectState( 1, player );
+        }
+
+        if ( frame == 14 )
+            prediction.SetAuthoritativeState( 10, &player, 1 );
+
+        update_reference( reference, frame );
+        update_prediction( prediction );
+
+        if ( frame >= 10 && frame < 14 )
+            CORE_CHECK( get_checksum( reference ) != get_checksum( client ) );
+        else
+            CORE_CHECK( get_checksum( reference ) == get_checksum( client ) );
+    }
+
+    const game::PredictionStats & stats = prediction.GetStats();
+    CORE_CHECK( stats.numCorrections == 1 );
+    CORE_CHECK( stats.numResimulatedFrames == 4 );
+    CORE_CHECK( stats.maxPositionError > 0.0f );
+    CORE_CHECK( stats.totalResimulateTime > 0 );
+
+    delete client;
+    delete reference;
+}
+
+void test_prediction_resimulation_budget()
+{
+    printf( "test_prediction_resimulation_budget\n" );
+
+    GameInstance * reference = create_game_instance();
+    GameInstance * client = create_game_instance();
+
+    game::PredictionConfig config;
+    config.historySize = 32;
+    config.maxResimulatedFrames = 8;
+
+    GamePrediction prediction( client, config );
+
+    hypercube::ActiveObject player;
+
+    for ( uint32_t frame = 0; frame < 30; ++frame )
+    {
+        if ( frame == 20 )
+        {
+            // too many frames to resimulate: skipped, and the client carries on predicting
+
+            client->GetObjectState( 1, player );
+            player.position.x += 1.0f;
+            prediction.SetAuthoritativeState( 20 - 9, &player, 1 );
+        }
+
+        if ( frame == 21 )
+        {
+            // state from the future is skipped too
+
+            prediction.SetAuthoritativeState( 30, &player, 1 );
+        }
+
+        if ( frame == 22 )
+        {
+            // only the most recent state is applied, and it agrees with the prediction
+
+            reference->GetObjectState( 1, player );
+            prediction.SetAuthoritativeState( 22 - 8, &player, 1 );
+            reference->GetObjectState( 1, player );
+            prediction.SetAuthoritativeState( 22, &player, 1 );
+        }
+
+        update_reference( reference, frame );
+        update_prediction( prediction );
+
+        CORE_CHECK( get_checksum( reference ) == get_checksum( client ) );
+    }
+
+    const game::PredictionStats & stats = prediction.GetStats();
+    CORE_CHECK( stats.numSkippedCorrections == 2 );
+    CORE_CHECK( stats.numCorrections == 1 );
+    CORE_CHECK( stats.numResimulatedFrames == 0 );
+    CORE_CHECK( stats.maxPositionError == 0.0f );
+
+    delete client;
+    delete reference;
+}
+
+void test_prediction_rollback_across_activation()
+{
+    printf( "test_prediction_rollback_across_activation\n" );
+
+    // the player only activates cubes close to it, so they activate and deactivate as it moves
+
+    GameInstance * reference = create_game_instance( 2.0f );
+    GameInstance * client = create_game_instance( 2.0f );
+
+    GamePrediction prediction( client );
+
+    hypercube::ActiveObject player;
+
+    int min_active = NumObjects;
+    int max_active = 0;
+
+    for ( uint32_t frame = 0; frame < 60; ++frame )
+    {
+        if ( frame == 20 )
+            reference->GetObjectState( 1, player );
+
+        if ( frame == 36 )
+        {
+            // rewinding puts back the objects that were active, and their pending deactivation timers
+
+            prediction.SetAuthoritativeState( 20, &player, 1 );
+        }
+
+        update_reference( reference, frame );
+        update_prediction( prediction );
+
+        if ( frame >= 20 && frame < 36 )
+        {
+            min_active = core::min( min_active, reference->GetNumActiveObjects() );
+            max_active = core::max( max_active, reference->GetNumActiveObjects() );
+        }
+
+        CORE_CHECK( reference->GetNumActiveObjects() == client->GetNumActiveObjects() );
+        for ( int id = 1; id <= NumObjects; ++id )
+            CORE_CHECK( reference->IsObjectActive( id ) == client->IsObjectActive( id ) );
+        CORE_CHECK( get_checksum( reference ) == get_checksum( client ) );
+    }
+
+    CORE_CHECK( min_active < max_active );
+
+    const game::PredictionStats & stats = prediction.GetStats();
+    CORE_CHECK( stats.numCorrections == 1 );
+    CORE_CHECK( stats.numSkippedCorrections == 0 );
+    CORE_CHECK( stats.numResimulatedFrames == 16 );
+    CORE_CHECK( stats.maxPositionError == 0.0f );
+
+    delete client;
+    delete reference;
+}
@@ -0,0 +1,141 @@
+#include "core/Core.h"
+#include "cubes/Simulation.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace cubes;
+
+static const float DeltaTime = 1.0f / 60.0f;
+
+static Simulation * create_stack()
+{
+    Simulation * simulation = new Simulation();
+
+    // the stack is rolled back, so contacts must not depend on the broadphase's history
+
+    SimulationConfig config;
+    config.SortBroadphasePairs = true;
+
+    simulation->Initialize( config );
+
+    simulation->AddPlane( math::Vector(0,0,1), 0 );
+
+    // a small loose pile, dropped from just above the ground so cubes land on each other
+
+    for ( int z = 0; z < 2; ++z )
+    {
+        for ( int y = 0; y < 4; ++y )
+        {
+            for ( int x = 0; x < 4; ++x )
+            {
+                SimulationObjectState state;
+                state.enabled = true;
+                state.scale = 1.0f;
+                state.position = math::Vector( x * 1.1f + z * 0.3f, y * 1.1f, 1.0f + z * 1.2f );
+                state.orientation = math::Quaternion(1,0,0,0);
+                state.linearVelocity = math::Vector(0,0,0);
+                state.angularVelocity = math::Vector( 0.1f * x, 0, 0.1f * y );
+                simulation->AddObject( state );
+            }
+        }
+    }
+
+    return simulation;
+}
+
+static bool states_equal( const SimulationState & a, const SimulationState & b )
+{
+    if ( a.randomSeed != b.randomSeed || a.bodies.size() != b.bodies.size() )
+        return false;
+    return a.bodies.empty() || memcmp( &a.bodies[0], &b.bodies[0], a.bodies.size() * sizeof( SimulationBodyState ) ) == 0;
+}
+
+void test_simulation_save_and_restore_state()
+{
+    printf( "test_simulation_save_and_restore_state\n" );
+
+    Simulation * simulation = create_stack();
+
+    for ( int i = 0; i < 10; ++i )
+        simulation->Update( DeltaTime );
+
+    SimulationState saved;
+    simulation->SaveState( saved );
+
+    // restoring straight away leaves the simulation exactly as it was
+
+    SimulationState current;
+    simulation->RestoreState( saved );
+    simulation->SaveState( current );
+    CORE_CHECK( states_equal( saved, current ) );
+
+    // roll back and resimulate: the same frames from the same state give the same result
+
+    for ( int i = 0; i < 30; ++i )
+        simulation->Update( DeltaTime );
+
+    SimulationState expected;
+    simulation->SaveState( expected );
+    CORE_CHECK( !states_equal( saved, expected ) );
+
+    simulation->RestoreState( saved );
+
+    for ( int i = 0; i < 30; ++i )
+        simulation->Update( DeltaTime );
+
+    simulation->SaveState( current );
+    CORE_CHECK( states_equal( expected, current ) );
+
+    simulation->Reset();
+
+    delete simulation;
+}
+
+void test_simulation_restore_added_and_removed_objects()
+{
+    printf( "test_simulation_restore_added_and_removed_objects\n" );
+
+    Simulation * simulation = create_stack();
+
+    for ( int i = 0; i < 10; ++i )
+        simulation->Update( DeltaTime );
+
+    SimulationState saved;
+    simulation->SaveState( saved );
+
+    // remove two objects, then add bigger ones in their slots and another in a slot that was empty
+
+    SimulationObjectState state;
+    simulation->GetObjectState( 3, state );
+    simulation->RemoveObject( 3 );
+    simulation->RemoveObject( 5 );
+
+    state.scale = 2.0f;
+    state.position = math::Vector( 10, 10, 5 );
+    CORE_CHECK( simulation->AddObject( state ) == 3 );
+    state.position = math::Vector( 20, 10, 5 );
+    CORE_CHECK( simulation->AddObject( state ) == 5 );
+    state.position = math::Vector( 30, 10, 5 );
+    const int added = simulation->AddObject( state );
+    CORE_CHECK( !saved.bodies[added].exists );
+
+    for ( int i = 0; i < 5; ++i )
+        simulation->Update( DeltaTime );
+
+    // restore puts back the original objects in their slots and removes the rest
+
+    simulation->RestoreState( saved );
+
+    CORE_CHECK( simulation->ObjectExists( 3 ) );
+    CORE_CHECK( simulation->ObjectExists( 5 ) );
+    CORE_CHECK( !simulation->ObjectExists( added ) );
+    CORE_CHECK( simulation->GetObjectMass( 3 ) == simulation->GetObjectMass( 0 ) );
+
+    SimulationState current;
+    simulation->SaveState( current );
+    CORE_CHECK( states_equal( saved, current ) );
+
+    simulation->Reset();
+
+    delete simulation;
+}
@@ -0,0 +1,313 @@
+#include "core/Core.h"
+#include "cubes/View.h"
+#include <stdio.h>
+#include <string.h>
+#include <map>
+
+// reference version of the view object manager, one heap object per id in a map,
+// the way it was before it moved to sorted arrays. results must match bit for bit
+
+struct ReferenceObject
+{
+    int authority;
+    float scale;
+    float r, g, b, a;
+    bool remove;
+    bool visible;
+    bool blending;
+    float blend_time;
+    float blend_start;
+    float blend_finish;
+    vectorial::vec3f position;
+    vectorial::quat4f orientation;
+};
+
+typedef std::map<unsigned int, ReferenceObject> ReferenceObjects;
+
+static void reference_update_objects( ReferenceObjects & objects, const view::ObjectUpdate * updates, int updateCount )
+{
+    for ( ReferenceObjects::iterator itor = objects.begin(); itor != objects.end(); ++itor )
+        itor->second.remove = true;
+
+    for ( int i = 0; i < updateCount; ++i )
+    {
+        ReferenceObjects::iterator itor = objects.find( updates[i].id );
+
+        if ( itor == objects.end() )
+        {
+            ReferenceObject object;
+            object.authority = updates[i].authority;
+            object.position = updates[i].position;
+            object.orientation = updates[i].orientation;
+            object.scale = updates[i].scale;
+            view::getAuthorityColor( object.authority, object.r, object.g, object.b, MaxPlayers );
+            object.a = 0.0f;
+            object.remove = false;
+            object.visible = false;
+            object.blending = false;
+            object.blend_time = object.blend_start = object.blend_finish = 0.0f;
+            objects.insert( std::make_pair( (unsigned int) updates[i].id, object ) );
+        }
+        else
+        {
+            ReferenceObject & object = itor->second;
+
+            object.authority = updates[i].authority;
+            object.position = updates[i].position;
+            object.orientation = updates[i].orientation;
+            object.scale = updates[i].scale;
+            object.remove = false;
+
+            if ( !object.blending )
+            {
+                if ( object.visible && !updates[i].visible )
+                {
+                    object.blending = true;
+                    object.blend_start = 1.0f;
+                    object.blend_finish = 0.0f;
+                    object.blend_time = 0.0f;
+                }
+                else if ( !object.visible && updates[i].visible )
+                {
+                    object.blending = true;
+                    object.blend_start = 0.0f;
+                    object.blend_finish = 1.0f;
+                    object.blend_time = 0.0f;
+                }
+            }
+        }
+    }
+
+    ReferenceObjects::iterator itor = objects.begin();
+    while ( itor != objects.end() )
+    {
+        if ( itor->second.remove )
+            objects.erase( itor++ );
+        else
+            ++itor;
+    }
+}
+
+static void reference_update( ReferenceObjects & objects, float deltaTime )
+{
+    for ( ReferenceObjects::iterator itor = objects.begin(); itor != objects.end(); ++itor )
+    {
+        ReferenceObject & object = itor->second;
+
+        if ( object.blending )
+        {
+            object.blend_time += deltaTime * 4.0f;
+
+            if ( object.blend_time > 1.0f )
+            {
+                object.a = object.blend_finish;
+                object.visible = object.blend_finish != 0.0f;
+                object.blending = false;
+            }
+            else
+            {
+                const float t = object.blend_time;
+                const float t2 = t*t;
+                const float t3 = t2*t;
+                object.a = 3*t2 - 2*t3;
+                if ( object.visible )
+                    object.a = 1.0f - object.a;
+            }
+        }
+
+        const float tightness = ( object.authority == 0 ) ? ColorChangeTightnessAuthority : ColorChangeTightnessDefault;
+
+        float target_r, target_g, target_b;
+        view::getAuthorityColor( object.authority, target_r, target_g, target_b, MaxPlayers );
+
+        object.r += ( target_r - object.r ) * tightness;
+        object.g += ( target_g - object.g ) * tightness;
+        object.b += ( target_b - object.b ) * tightness;
+    }
+}
+
+static bool same( float a, float b )
+{
+    return memcmp( &a, &b, sizeof( float ) ) == 0;
+}
+
+static bool same( const view::Object & object, const ReferenceObject & reference )
+{
+    return same( object.r, reference.r ) && same( object.g, reference.g ) && same( object.b, reference.b ) && same( object.a, reference.a ) &&
+           same( object.scale, reference.scale ) && object.authority == reference.authority &&
+           object.visible == reference.visible && object.blending == reference.blending &&
+           memcmp( &object.position, &reference.position, sizeof( float ) * 3 ) == 0 &&
+           memcmp( &object.orientation, &reference.orientation, sizeof( vectorial::quat4f ) ) == 0;
+}
+
+static view::ObjectUpdate make_update( unsigned int id, int authority, bool visible )
+{
+    view::ObjectUpdate update;
+    update.id = id;
+    update.authority = authority;
+    update.visible = visible;
+    update.scale = 1.0f;
+    update.position = vectorial::vec3f( float( id ), 0, 0 );
+    update.orientation = vectorial::quat4f::identity();
+    return update;
+}
+
+void test_view_object_manager()
+{
+    printf( "test_view_object_manager\n" );
+
+    view::ObjectManager objects;
+
+    CORE_CHECK( objects.GetNumObjects() == 0 );
+
+    // updates out of id order are kept sorted by id, which is the order they render in
+
+    view::ObjectUpdate updates[5];
+    updates[0] = make_update( 7, 0, true );
+    updates[1] = make_update( 3, MaxPlayers, true );
+    updates[2] = make_update( 5, MaxPlayers, false );
+
+    objects.UpdateObjects( updates, 3 );
+
+    CORE_CHECK( objects.GetNumObjects() == 3 );
+
+    view::Cubes cubes;
+    objects.GetRenderState( cubes, NULL, NULL );
+    CORE_CHECK( cubes.numCubes == 3 );
+    CORE_CHECK( simd4f_get_x( cubes.cube[0].transform.value.w ) == 3.0f );
+    CORE_CHECK( simd4f_get_x( cubes.cube[1].transform.value.w ) == 5.0f );
+    CORE_CHECK( simd4f_get_x( cubes.cube[2].transform.value.w ) == 7.0f );
+
+    // new objects start invisible with their authority color
+
+    view::Object object;
+    CORE_CHECK( objects.GetObject( 3, object ) );
+    CORE_CHECK( object.id == 3 && object.authority == MaxPlayers && object.a == 0.0f && !object.visible && !object.blending );
+    float r, g, b;
+    view::getAuthorityColor( MaxPlayers, r, g, b );
+    CORE_CHECK( object.r == r && object.g == g && object.b == b );
+    CORE_CHECK( !objects.GetObject( 4, object ) );
+
+    // the next update fades in visible objects
+
+    objects.UpdateObjects( updates, 3 );
+    CORE_CHECK( objects.GetObject( 7, object ) && object.blending );
+    CORE_CHECK( objects.GetObject( 5, object ) && !object.blending );
+
+    for ( int i = 0; i < 10; ++i )
+        objects.Update( 0.1f );
+
+    CORE_CHECK( objects.GetObject( 7, object ) && object.visible && !object.blending && object.a == 1.0f );
+    CORE_CHECK( objects.GetObject( 3, object ) && object.visible && object.a == 1.0f );
+
+    // objects missing from the update are removed, new ones are added, and an id repeated
+    // within one update is applied in order
+
+    updates[0] = make_update( 9, MaxPlayers, true );
+    updates[1] = make_update( 3, MaxPlayers, false );
+    updates[2] = make_update( 1, 0, true );
+    updates[3] = make_update( 3, MaxPlayers, true );
+    updates[3].scale = 2.0f;
+
+    objects.UpdateObjects( updates, 4 );
+
+    CORE_CHECK( objects.GetNumObjects() == 3 );
+    CORE_CHECK( !objects.GetObject( 5, object ) );
+    CORE_CHECK( !objects.GetObject( 7, object ) );
+    CORE_CHECK( objects.GetObject( 1, object ) && object.authority == 0 );
+    CORE_CHECK( objects.GetObject( 9, object ) && object.authority == MaxPlayers );
+    CORE_CHECK( objects.GetObject( 3, object ) && object.scale == 2.0f && object.blending );
+
+    // changing authority blends toward the new color
+
+    updates[0] = make_update( 1, MaxPlayers, true );
+    objects.UpdateObjects( updates, 1 );
+    objects.Update( 0.1f );
+    CORE_CHECK( objects.GetObject( 1, object ) && object.authority == MaxPlayers );
+    view::getAuthorityColor( 0, r, g, b );
+    CORE_CHECK( object.r < r && object.g > g );
+
+    // ids use the full 30 bits the activation system gives them
+
+    const unsigned int MaxId = ( 1 << 30 ) - 1;
+    updates[0] = make_update( MaxId, 0, true );
+    objects.UpdateObjects( updates, 1 );
+    CORE_CHECK( objects.GetNumObjects() == 1 );
+    CORE_CHECK( objects.GetObject( MaxId, object ) && object.id == MaxId );
+
+    objects.Reset();
+    CORE_CHECK( objects.GetNumObjects() == 0 );
+    CORE_CHECK( !objects.GetObject( 1, object ) );
+}
+
+void test_view_matches_reference()
+{
+    printf( "test_view_matches_reference\n" );
+
+    const int MaxId = 64;
+    const int NumFrames = 1000;
+
+    view::ObjectManager objects;
+    ReferenceObjects reference;
+
+    view::ObjectUpdate updates[MaxId*2];
+
+    bool identical = true;
+
+    for ( int frame = 0; frame < NumFrames; ++frame )
+    {
+        // a random subset of ids in random order, with the odd repeat, and objects moving, changing authority and fading
+
+        if ( ( frame % 3 ) == 0 )
+        {
+            int count = 0;
+            for ( int id = 1; id <= MaxId; ++id )
+            {
+                if ( core::random_int( 0, 9 ) == 0 )
+                    continue;
+                view::ObjectUpdate & update = updates[count++];
+                update.id = id;
+                update.authority = core::random_int( 0, 20 ) == 0 ? core::random_int( 0, MaxPlayers ) : ( id % ( MaxPlayers + 1 ) );
+                update.visible = core::random_int( 0, 10 ) != 0;
+                update.scale = core::random_float( 0.5f, 2.0f );
+                update.position = vectorial::vec3f( core::random_float( -10, 10 ), core::random_float( -10, 10 ), core::random_float( 0, 10 ) );
+                update.orientation = normalize( vectorial::quat4f( core::random_float( -1, 1 ), core::random_float( -1, 1 ), core::random_float( -1, 1 ), core::random_float( -1, 1 ) ) );
+                if ( core::random_int( 0, 20 ) == 0 )
+                {
+                    updates[count] = update;
+                    updates[count].visible = !update.visible;
+                    count++;
+                }
+            }
+
+            if ( core::random_int( 0, 1 ) )
+            {
+                for ( int i = count - 1; i > 0; --i )
+                {
+                    const int j = core::random_int( 0, i );
+                    const view::ObjectUpdate temp = updates[i];
+                    updates[i] = updates[j];
+                    updates[j] = temp;
+                }
+            }
+
+            objects.UpdateObjects( updates, count );
+            reference_update_objects( reference, updates, count );
+        }
+
+        const float deltaTime = core::random_float( 0.005f, 0.05f );
+
+        objects.Update( deltaTime );
+        reference_update( reference, deltaTime );
+
+        identical = identical && objects.GetNumObjects() == (int) reference.size();
+
+        for ( ReferenceObjects::iterator itor = reference.begin(); itor != reference.end(); ++itor )
+        {
+            view::Object object;
+            identical = identical && objects.GetObject( itor->first, object ) && same( object, itor->second );
+        }
+    }
+
+    CORE_CHECK( identical );
+}
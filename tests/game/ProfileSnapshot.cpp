@@ -0,0 +1,77 @@
+#include "core/Core.h"
+#include "core/Random.h"
+#include "game/Snapshot.h"
+#include <stdio.h>
+
+// compares scalar QuantizedCubeState::Load/Save against the batched QuantizeCubeStates/DequantizeCubeStates
+
+const int NumIterations = 1000;
+
+static CubeState cube_states[NumCubes];
+static QuantizedCubeState quantized_cubes[NumCubes];
+static CubeState output_cube_states[NumCubes];
+
+int main()
+{
+    printf( "profile snapshot quantization (%s)\n\n", VECTORIAL_SIMD_TYPE );
+
+    core::RandomGenerator random;
+
+    for ( int i = 0; i < NumCubes; ++i )
+    {
+        vectorial::quat4f orientation( random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ) );
+        cube_states[i].interacting = false;
+        cube_states[i].position = vectorial::vec3f( random.GetFloat( -PositionBoundXY, PositionBoundXY ), 
+                                                    random.GetFloat( -PositionBoundXY, PositionBoundXY ),
+                                                    random.GetFloat( 0, PositionBoundZ ) );
+        cube_states[i].orientation = vectorial::normalize( orientation );
+        cube_states[i].linear_velocity = vectorial::vec3f::zero();
+        cube_states[i].angular_velocity = vectorial::vec3f::zero();
+    }
+
+    uint64_t checksum = 0;
+
+    uint64_t start = core::nanoseconds();
+    for ( int iteration = 0; iteration < NumIterations; ++iteration )
+    {
+        for ( int i = 0; i < NumCubes; ++i )
+            quantized_cubes[i].Load( cube_states[i] );
+        checksum += quantized_cubes[iteration % NumCubes].position_x;
+    }
+    const uint64_t scalar_quantize = core::nanoseconds() - start;
+
+    start = core::nanoseconds();
+    for ( int iteration = 0; iteration < NumIterations; ++iteration )
+    {
+        QuantizeCubeStates( cube_states, quantized_cubes, NumCubes );
+        checksum += quantized_cubes[iteration % NumCubes].position_x;
+    }
+    const uint64_t batch_quantize = core::nanoseconds() - start;
+
+    start = core::nanoseconds();
+    for ( int iteration = 0; iteration < NumIterations; ++iteration )
+    {
+        for ( int i = 0; i < NumCubes; ++i )
+            quantized_cubes[i].Save( output_cube_states[i] );
+        checksum += (uint64_t) output_cube_states[iteration % NumCubes].position.x();
+    }
+    const uint64_t scalar_dequantize = core::nanoseconds() - start;
+
+    start = core::nanoseconds();
+    for ( int iteration = 0; iteration < NumIterations; ++iteration )
+    {
+        DequantizeCubeStates( quantized_cubes, output_cube_states, NumCubes );
+        checksum += (uint64_t) output_cube_states[iteration % NumCubes].position.x();
+    }
+    const uint64_t batch_dequantize = core::nanoseconds() - start;
+
+    printf( "quantize:   scalar %.1fus, batch %.1fus per snapshot (%.2fx)\n", 
+        scalar_quantize / 1000.0 / NumIterations, batch_quantize / 1000.0 / NumIterations, scalar_quantize / double( batch_quantize ) );
+
+    printf( "dequantize: scalar %.1fus, batch %.1fus per snapshot (%.2fx)\n", 
+        scalar_dequantize / 1000.0 / NumIterations, batch_dequantize / 1000.0 / NumIterations, scalar_dequantize / double( batch_dequantize ) );
+
+    printf( "\n(checksum %llx)\n", (unsigned long long) checksum );
+
+    return 0;
+}
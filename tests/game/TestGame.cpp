@@ -0,0 +1,13 @@
+#include "core/Core.h"
+#include <stdio.h>
+
+extern void test_quantize_cube_states();
+extern void test_dequantize_cube_states();
+
+int main()
+{
+    test_quantize_cube_states();
+    test_dequantize_cube_states();
+
+    return 0;
+}
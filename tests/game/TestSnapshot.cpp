@@ -0,0 +1,126 @@
+#include "core/Core.h"
+#include "core/Random.h"
+#include "game/Snapshot.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+static vectorial::quat4f random_orientation( core::RandomGenerator & random )
+{
+    vectorial::quat4f q( random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ) );
+    if ( length_squared( q ) < 0.0001f )
+        return vectorial::quat4f::identity();
+    return vectorial::normalize( q );
+}
+
+static void random_cube_states( core::RandomGenerator & random, CubeState * cube_states, int count )
+{
+    // include the awkward cases: equal largest components, negative largest components and axis aligned
+
+    const vectorial::quat4f special[] = 
+    {
+        vectorial::quat4f( 0.5f, 0.5f, 0.5f, 0.5f ),
+        vectorial::quat4f( -0.5f, 0.5f, -0.5f, 0.5f ),
+        vectorial::quat4f( 0, 0, 0, 1 ),
+        vectorial::quat4f( 0, 0, 0, -1 ),
+        vectorial::quat4f( -1, 0, 0, 0 ),
+        vectorial::quat4f( 0, 0.70710678f, -0.70710678f, 0 ),
+        vectorial::quat4f( 0, -0.70710678f, 0.70710678f, 0 ),
+        vectorial::quat4f( -0.0f, 0, 1, 0 ),
+    };
+
+    const int NumSpecial = sizeof( special ) / sizeof( special[0] );
+
+    for ( int i = 0; i < count; ++i )
+    {
+        CubeState & cube_state = cube_states[i];
+        cube_state = CubeState();
+        cube_state.interacting = random.GetUint32( 2 ) != 0;
+        cube_state.position = vectorial::vec3f( random.GetFloat( -PositionBoundXY, PositionBoundXY ), 
+                                                random.GetFloat( -PositionBoundXY, PositionBoundXY ),
+                                                random.GetFloat( 0, PositionBoundZ ) );
+        if ( ( i % 16 ) == 0 )
+            cube_state.position = vectorial::vec3f( -1.0f / UnitsPerMeter * 0.5f, 0.0f, 1.0f / UnitsPerMeter * 1.5f );
+        cube_state.orientation = ( i % 5 ) == 0 ? special[ ( i / 5 ) % NumSpecial ] : random_orientation( random );
+        cube_state.linear_velocity = vectorial::vec3f( random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ) );
+        cube_state.angular_velocity = vectorial::vec3f( random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ), random.GetFloat( -1, +1 ) );
+    }
+}
+
+static bool equal_bits( const void * a, const void * b, int bytes )
+{
+    return memcmp( a, b, bytes ) == 0;
+}
+
+void test_quantize_cube_states()
+{
+    printf( "test_quantize_cube_states\n" );
+
+    const int NumStates = NumCubes + 3;           // not a multiple of four, so the scalar tail runs too
+
+    static CubeState cube_states[NumStates];
+    static QuantizedCubeState scalar[NumStates];
+    static QuantizedCubeState batch[NumStates];
+
+    core::RandomGenerator random;
+    random_cube_states( random, cube_states, NumStates );
+
+    for ( int i = 0; i < NumStates; ++i )
+        scalar[i].Load( cube_states[i] );
+
+    QuantizeCubeStates( cube_states, batch, NumStates );
+
+    for ( int i = 0; i < NumStates; ++i )
+    {
+        CORE_CHECK( batch[i] == scalar[i] );
+        CORE_CHECK( batch[i].interacting == scalar[i].interacting );
+        CORE_CHECK( batch[i].orientation.largest == scalar[i].orientation.largest );
+    }
+}
+
+void test_dequantize_cube_states()
+{
+    printf( "test_dequantize_cube_states\n" );
+
+    const int NumStates = NumCubes + 3;
+
+    static CubeState cube_states[NumStates];
+    static QuantizedCubeState quantized[NumStates];
+    static CubeState scalar[NumStates];
+    static CubeState batch[NumStates];
+
+    core::RandomGenerator random;
+    random_cube_states( random, cube_states, NumStates );
+
+    for ( int i = 0; i < NumStates; ++i )
+        quantized[i].Load( cube_states[i] );
+
+    // every largest component and the extreme integer values
+
+    for ( int i = 0; i < 64; ++i )
+    {
+        quantized[i].orientation.largest = i % 4;
+        quantized[i].orientation.integer_a = ( i & 4 ) ? compressed_quaternion<OrientationBits>::max_value : 0;
+        quantized[i].orientation.integer_b = ( i & 8 ) ? compressed_quaternion<OrientationBits>::max_value / 2 : 1;
+        quantized[i].orientation.integer_c = ( i & 16 ) ? compressed_quaternion<OrientationBits>::max_value / 2 + 1 : 0;
+    }
+
+    // velocity is not part of the quantized state: save must leave angular velocity alone and clear linear velocity
+
+    std::copy( cube_states, cube_states + NumStates, scalar );
+    std::copy( cube_states, cube_states + NumStates, batch );
+
+    for ( int i = 0; i < NumStates; ++i )
+        quantized[i].Save( scalar[i] );
+
+    DequantizeCubeStates( quantized, batch, NumStates );
+
+    for ( int i = 0; i < NumStates; ++i )
+    {
+        CORE_CHECK( batch[i].interacting == scalar[i].interacting );
+        CORE_CHECK( equal_bits( &batch[i].position, &scalar[i].position, sizeof( vectorial::vec3f ) ) );
+        CORE_CHECK( equal_bits( &batch[i].orientation, &scalar[i].orientation, sizeof( vectorial::quat4f ) ) );
+        CORE_CHECK( equal_bits( &batch[i].linear_velocity, &scalar[i].linear_velocity, sizeof( vectorial::vec3f ) ) );
+        CORE_CHECK( equal_bits( &batch[i].angular_velocity, &scalar[i].angular_velocity, sizeof( vectorial::vec3f ) ) );
+    }
+}
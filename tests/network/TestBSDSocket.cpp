@@ -1,5 +1,7 @@
 #include "network/Network.h"
 #include "network/BSDSocket.h"
+#include "network/Compressor.h"
+#include "core/Random.h"
 #include "TestPackets.h"
 
 void test_bsd_socket_send_and_receive_ipv4()
@@ -438,3 +440,129 @@ void test_bsd_socket_send_and_receive_multiple_ipv6()
     }
     core::memory::shutdown();
 }
+
+enum BlobPacketTypes
+{
+    PACKET_NOTHING,
+    PACKET_BLOB,
+
+    NUM_BLOB_PACKET_TYPES
+};
+
+const int BlobPacketBytes = 1011;         // protocol id, packet type and check bring this to exactly 1024 bytes serialized
+
+struct BlobPacket : public protocol::Packet
+{
+    uint8_t data[BlobPacketBytes];
+
+    BlobPacket() : Packet( PACKET_BLOB )
+    {
+        memset( data, 0, sizeof( data ) );
+    }
+
+    PROTOCOL_SERIALIZE_OBJECT( stream )
+    {
+        serialize_bytes( stream, data, BlobPacketBytes );
+    }
+};
+
+class BlobPacketFactory : public protocol::PacketFactory
+{
+    core::Allocator * m_allocator;
+
+public:
+
+    BlobPacketFactory( core::Allocator & allocator )
+        : PacketFactory( allocator, NUM_BLOB_PACKET_TYPES )
+    {
+        m_allocator = &allocator;
+    }
+
+protected:
+
+    protocol::Packet * CreateInternal( int type )
+    {
+        return type == PACKET_BLOB ? CORE_NEW( *m_allocator, BlobPacket ) : nullptr;
+    }
+};
+
+void test_bsd_socket_compressed_max_size_packet()
+{
+    printf( "test_bsd_socket_compressed_max_size_packet\n" );
+
+    core::memory::initialize();
+    {
+        // a max size packet that doesn't compress goes out raw, one byte over the max packet size.
+        // the receiver has room to spare because the stream reader can't read right up to the end of its buffer
+
+        BlobPacketFactory packetFactory( core::memory::default_allocator() );
+
+        network::PacketCompressor sender_compressor;
+        network::PacketCompressor receiver_compressor;
+
+        network::BSDSocketConfig sender_config;
+        sender_config.port = 10000;
+        sender_config.ipv6 = false;
+        sender_config.maxPacketSize = 1024;
+        sender_config.packetFactory = &packetFactory;
+        sender_config.compressor = &sender_compressor;
+
+        network::BSDSocket interface_sender( sender_config );
+
+        network::BSDSocketConfig receiver_config;
+        receiver_config.port = 10001;
+        receiver_config.ipv6 = false;
+        receiver_config.maxPacketSize = 2048;
+        receiver_config.packetFactory = &packetFactory;
+        receiver_config.compressor = &receiver_compressor;
+
+        network::BSDSocket interface_receiver( receiver_config );
+
+        network::Address sender_address( "[127.0.0.1]:10000" );
+        network::Address receiver_address( "[127.0.0.1]:10001" );
+
+        core::TimeBase timeBase;
+        timeBase.deltaTime = 0.01f;
+
+        core::RandomGenerator random( 1 );
+
+        BlobPacket blobPacketTemplate;
+        for ( int i = 0; i < BlobPacketBytes; ++i )
+            blobPacketTemplate.data[i] = uint8_t( random.GetUint32( 256 ) );
+
+        bool receivedBlobPacket = false;
+
+        while ( !receivedBlobPacket )
+        {
+            auto blobPacket = (BlobPacket*) packetFactory.Create( PACKET_BLOB );
+
+            memcpy( blobPacket->data, blobPacketTemplate.data, BlobPacketBytes );
+
+            interface_sender.SendPacket( receiver_address, blobPacket );
+
+            interface_sender.Update( timeBase );
+            interface_receiver.Update( timeBase );
+
+            CORE_CHECK( interface_sender.GetCounter( network::BSD_SOCKET_COUNTER_PACKET_TOO_LARGE_TO_SEND ) == 0 );
+
+            while ( true )
+            {
+                auto packet = interface_receiver.ReceivePacket();
+                if ( !packet )
+                    break;
+
+                CORE_CHECK( packet->GetAddress() == sender_address );
+                CORE_CHECK( memcmp( static_cast<BlobPacket*>( packet )->data, blobPacketTemplate.data, BlobPacketBytes ) == 0 );
+                receivedBlobPacket = true;
+
+                packetFactory.Destroy( packet );
+            }
+
+            timeBase.time += timeBase.deltaTime;
+        }
+
+        CORE_CHECK( sender_compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_PACKETS_SENT_RAW ) > 0 );
+        CORE_CHECK( interface_receiver.GetCounter( network::BSD_SOCKET_COUNTER_DECODE_FAILURES ) == 0 );
+    }
+    core::memory::shutdown();
+}
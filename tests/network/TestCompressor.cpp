@@ -0,0 +1,194 @@
+#include "network/Compressor.h"
+#include "core/Memory.h"
+#include "core/Random.h"
+#include <stdio.h>
+
+static void generate_packet( core::RandomGenerator & random, uint8_t * data, int bytes )
+{
+    // looks a bit like a snapshot: mostly constant fields with a few noisy bytes per record
+
+    for ( int i = 0; i < bytes; ++i )
+        data[i] = uint8_t( ( i % 16 ) < 12 ? ( i % 16 ) * 7 : random.GetUint32( 256 ) );
+}
+
+void test_compressor_round_trip()
+{
+    printf( "test_compressor_round_trip\n" );
+
+    core::memory::initialize();
+    {
+        const int MaxPacketSize = 4096;
+
+        network::PacketCompressorConfig config;
+        config.maxPacketSize = MaxPacketSize;
+
+        network::PacketCompressor compressor( config );
+
+        core::RandomGenerator random( 1 );
+
+        uint8_t input[MaxPacketSize];
+        uint8_t encoded[MaxPacketSize+1];
+        uint8_t decoded[MaxPacketSize];
+
+        for ( int i = 0; i < 1000; ++i )
+        {
+            const int bytes = random.GetInt( 1, MaxPacketSize );
+
+            generate_packet( random, input, bytes );
+
+            const int encodedBytes = compressor.EncodePacket( input, bytes, encoded, sizeof( encoded ) );
+            CORE_CHECK( encodedBytes > 0 );
+            CORE_CHECK( encodedBytes <= network::PacketCompressor::GetMaxEncodedSize( bytes ) );
+
+            const int decodedBytes = compressor.DecodePacket( encoded, encodedBytes, decoded, sizeof( decoded ) );
+            CORE_CHECK( decodedBytes == bytes );
+            CORE_CHECK( memcmp( input, decoded, bytes ) == 0 );
+        }
+
+        CORE_CHECK( compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_PACKETS_COMPRESSED ) > 0 );
+        CORE_CHECK( compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_AFTER_ENCODE ) < 
+                    compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_BEFORE_ENCODE ) );
+        CORE_CHECK( compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_DECODE_FAILURES ) == 0 );
+    }
+    core::memory::shutdown();
+}
+
+void test_compressor_raw_fallback()
+{
+    printf( "test_compressor_raw_fallback\n" );
+
+    core::memory::initialize();
+    {
+        const int PacketSize = 1024;
+
+        network::PacketCompressor compressor;
+
+        core::RandomGenerator random( 2 );
+
+        uint8_t input[PacketSize];
+        uint8_t encoded[PacketSize+1];
+        uint8_t decoded[PacketSize];
+
+        for ( int i = 0; i < PacketSize; ++i )
+            input[i] = uint8_t( random.GetUint32() );
+
+        const int encodedBytes = compressor.EncodePacket( input, PacketSize, encoded, sizeof( encoded ) );
+        CORE_CHECK( encodedBytes == PacketSize + 1 );
+        CORE_CHECK( encoded[0] == network::PACKET_ENCODING_RAW );
+        CORE_CHECK( compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_PACKETS_SENT_RAW ) == 1 );
+
+        const int decodedBytes = compressor.DecodePacket( encoded, encodedBytes, decoded, sizeof( decoded ) );
+        CORE_CHECK( decodedBytes == PacketSize );
+        CORE_CHECK( memcmp( input, decoded, PacketSize ) == 0 );
+
+        // output buffer too small for even the raw packet
+
+        CORE_CHECK( compressor.EncodePacket( input, PacketSize, encoded, PacketSize ) == 0 );
+    }
+    core::memory::shutdown();
+}
+
+void test_compressor_corrupt_packets()
+{
+    printf( "test_compressor_corrupt_packets\n" );
+
+    core::memory::initialize();
+    {
+        const int MaxPacketSize = 1024;
+
+        network::PacketCompressorConfig config;
+        config.maxPacketSize = MaxPacketSize;
+
+        network::PacketCompressor compressor( config );
+
+        core::RandomGenerator random( 3 );
+
+        uint8_t input[MaxPacketSize];
+        uint8_t encoded[MaxPacketSize+1];
+        uint8_t decoded[MaxPacketSize];
+
+        generate_packet( random, input, MaxPacketSize );
+
+        const int encodedBytes = compressor.EncodePacket( input, MaxPacketSize, encoded, sizeof( encoded ) );
+        CORE_CHECK( encoded[0] == network::PACKET_ENCODING_LZ );
+
+        // flipping bytes and truncating must never read or write out of bounds
+
+        for ( int i = 0; i < 10000; ++i )
+        {
+            uint8_t corrupt[MaxPacketSize+1];
+            memcpy( corrupt, encoded, encodedBytes );
+            const int numFlips = random.GetInt( 1, 4 );
+            for ( int j = 0; j < numFlips; ++j )
+                corrupt[ random.GetInt( 0, encodedBytes - 1 ) ] = uint8_t( random.GetUint32() );
+            const int corruptBytes = random.GetInt( 0, encodedBytes );
+            const int decodedBytes = compressor.DecodePacket( corrupt, corruptBytes, decoded, sizeof( decoded ) );
+            CORE_CHECK( decodedBytes <= MaxPacketSize );
+        }
+
+        CORE_CHECK( compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_DECODE_FAILURES ) > 0 );
+    }
+    core::memory::shutdown();
+}
+
+void test_compressor_dictionary()
+{
+    printf( "test_compressor_dictionary\n" );
+
+    core::memory::initialize();
+    {
+        const int PacketSize = 256;
+        const int NumSamples = 64;
+        const int MaxDictionarySize = 4096;
+
+        core::RandomGenerator random( 4 );
+
+        // packets share a common template that doesn't repeat inside a single packet, so only a dictionary helps
+
+        uint8_t packetTemplate[PacketSize];
+        for ( int i = 0; i < PacketSize; ++i )
+            packetTemplate[i] = uint8_t( random.GetUint32() );
+
+        uint8_t sampleData[NumSamples][PacketSize];
+        const uint8_t * samples[NumSamples];
+        int sampleBytes[NumSamples];
+        for ( int i = 0; i < NumSamples; ++i )
+        {
+            memcpy( sampleData[i], packetTemplate, PacketSize );
+            sampleData[i][ random.GetInt( 0, PacketSize - 1 ) ] = uint8_t( random.GetUint32() );
+            samples[i] = sampleData[i];
+            sampleBytes[i] = PacketSize;
+        }
+
+        uint8_t dictionary[MaxDictionarySize];
+        const int dictionarySize = network::TrainPacketDictionary( samples, sampleBytes, NumSamples, dictionary, MaxDictionarySize );
+        CORE_CHECK( dictionarySize > 0 );
+        CORE_CHECK( dictionarySize <= MaxDictionarySize );
+
+        network::PacketCompressorConfig config;
+        config.maxPacketSize = PacketSize;
+        config.dictionary = dictionary;
+        config.dictionarySize = dictionarySize;
+
+        network::PacketCompressor withDictionary( config );
+        network::PacketCompressor withoutDictionary;
+
+        uint8_t packet[PacketSize];
+        memcpy( packet, packetTemplate, PacketSize );
+        packet[17] ^= 0xFF;
+
+        uint8_t encoded[PacketSize+1];
+        uint8_t decoded[PacketSize];
+
+        const int bytesWithout = withoutDictionary.EncodePacket( packet, PacketSize, encoded, sizeof( encoded ) );
+        const int bytesWith = withDictionary.EncodePacket( packet, PacketSize, encoded, sizeof( encoded ) );
+
+        CORE_CHECK( bytesWithout == PacketSize + 1 );
+        CORE_CHECK( bytesWith < PacketSize / 4 );
+
+        const int decodedBytes = withDictionary.DecodePacket( encoded, bytesWith, decoded, sizeof( decoded ) );
+        CORE_CHECK( decodedBytes == PacketSize );
+        CORE_CHECK( memcmp( packet, decoded, PacketSize ) == 0 );
+    }
+    core::memory::shutdown();
+}
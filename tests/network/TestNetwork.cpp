@@ -11,6 +11,12 @@ extern void test_bsd_socket_send_and_receive_ipv4();
 extern void test_bsd_socket_send_and_receive_ipv6();
 extern void test_bsd_socket_send_and_receive_multiple_ipv4();
 extern void test_bsd_socket_send_and_receive_multiple_ipv6();
+extern void test_bsd_socket_compressed_max_size_packet();
+
+extern void test_compressor_round_trip();
+extern void test_compressor_raw_fallback();
+extern void test_compressor_corrupt_packets();
+extern void test_compressor_dictionary();
 
 #if PROTOCOL_USE_RESOLVER
 extern void test_dns_resolve();
@@ -37,6 +43,12 @@ int main()
     test_bsd_socket_send_and_receive_ipv6();
     test_bsd_socket_send_and_receive_multiple_ipv4();
     test_bsd_socket_send_and_receive_multiple_ipv6();
+    test_bsd_socket_compressed_max_size_packet();
+
+    test_compressor_round_trip();
+    test_compressor_raw_fallback();
+    test_compressor_corrupt_packets();
+    test_compressor_dictionary();
 
 #if PROTOCOL_USE_RESOLVER
     test_dns_resolve();
@@ -1,6 +1,7 @@
 #include "protocol/Connection.h"
 #include "protocol/ReliableMessageChannel.h"
 #include "network/Simulator.h"
+#include "core/Random.h"
 #include "TestMessages.h"
 #include "TestPackets.h"
 #include <time.h>
@@ -58,14 +59,16 @@ protected:
     }
 };
 
-void soak_test()
+void soak_test( uint64_t seed )
 {
 #if PROFILE
     printf( "[profile protocol]\n" );
 #else
-    printf( "[soak protocol]\n" );
+    printf( "[soak protocol] seed = %llu\n", (unsigned long long) seed );
 #endif
 
+    core::RandomGenerator random( seed );
+
     TestMessageFactory messageFactory( core::memory::default_allocator() );
 
     TestChannelStructure channelStructure( messageFactory );
@@ -81,6 +84,7 @@ void soak_test()
     network::SimulatorConfig simulatorConfig;
     simulatorConfig.maxPacketSize = MaxPacketSize;
     simulatorConfig.packetFactory = &packetFactory;
+    simulatorConfig.seed = seed + 1;
     network::Simulator simulator( simulatorConfig );
     simulator.SetContext( context );
     simulator.AddState( { 0.0f, 0.0f, 0.0f } );
@@ -116,14 +120,14 @@ void soak_test()
 
     while ( !quit )
     {
-        const int maxMessagesToSend = 1 + rand() % 32;
+        const int maxMessagesToSend = random.GetInt( 1, 32 );
 
         for ( int i = 0; i < maxMessagesToSend; ++i )
         {
             if ( !messageChannel->CanSendMessage() )
                 break;
 
-            int value = rand() % 10000;
+            int value = random.GetUint32( 10000 );
 
             if ( value < 5000 )
             {
@@ -246,13 +250,17 @@ void soak_test()
     }
 }
 
-int main()
+int main( int argc, char ** argv )
 {
-    srand( time( nullptr ) );
+    // pass in a seed from a previous run to reproduce it
+
+    const uint64_t seed = ( argc > 1 ) ? strtoull( argv[1], nullptr, 10 ) : (uint64_t) time( nullptr );
+
+    core::random_seed( seed );
 
     core::memory::initialize();
 
-    soak_test();
+    soak_test( seed );
 
     core::memory::shutdown();
 
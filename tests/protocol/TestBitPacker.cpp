@@ -57,3 +57,52 @@ void test_bitpacker()
     CORE_CHECK( reader.GetBitsRead() == bitsWritten );
     CORE_CHECK( reader.GetBitsRemaining() == BufferSize * 8 - bitsWritten );
 }
+
+void test_bitpacker_rollback()
+{
+    printf( "test_bitpacker_rollback\n" );
+
+    const int BufferSize = 256;
+
+    uint8_t buffer[256];
+
+    protocol::BitWriter writer( buffer, BufferSize );
+
+    writer.WriteBits( 5, 3 );
+    writer.WriteBits( 1000, 10 );
+
+    // write across a few word boundaries, then undo it all
+
+    const protocol::BitWriter::Checkpoint checkpoint = writer.GetCheckpoint();
+
+    for ( int i = 0; i < 10; ++i )
+        writer.WriteBits( 0xFFFFFFFF, 32 );
+
+    CORE_CHECK( writer.GetBitsWritten() == 3 + 10 + 320 );
+
+    writer.Rollback( checkpoint );
+
+    CORE_CHECK( writer.GetBitsWritten() == 3 + 10 );
+    CORE_CHECK( writer.GetBytesWritten() == 0 );
+
+    // what is written after the rollback replaces what was undone
+
+    writer.WriteBits( 0, 20 );
+    writer.WriteBits( 123456, 17 );
+    writer.WriteBits( 7, 3 );
+    writer.FlushBits();
+
+    const int bitsWritten = 3 + 10 + 20 + 17 + 3;
+
+    CORE_CHECK( writer.GetBitsWritten() == bitsWritten );
+    CORE_CHECK( writer.GetBytesWritten() == 2*4 );
+
+    protocol::BitReader reader( buffer, BufferSize );
+
+    CORE_CHECK( reader.ReadBits( 3 ) == 5 );
+    CORE_CHECK( reader.ReadBits( 10 ) == 1000 );
+    CORE_CHECK( reader.ReadBits( 20 ) == 0 );
+    CORE_CHECK( reader.ReadBits( 17 ) == 123456 );
+    CORE_CHECK( reader.ReadBits( 3 ) == 7 );
+    CORE_CHECK( reader.ReadBits( 32 - ( bitsWritten - 32 ) ) == 0 );
+}
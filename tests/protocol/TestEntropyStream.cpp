@@ -0,0 +1,173 @@
+#include "protocol/Object.h"
+#include "protocol/Stream.h"
+#include "protocol/EntropyStream.h"
+#include "core/Random.h"
+#include <stdio.h>
+#include <string.h>
+
+const int NumEntropyItems = 64;
+
+struct EntropyTestObject : public protocol::Object
+{
+    int a,b,c;
+    uint32_t d;
+    bool e;
+    uint64_t f;
+    float g;
+    uint8_t bytes[5];
+    int items[NumEntropyItems];
+    int deltas[NumEntropyItems];
+
+    EntropyTestObject()
+    {
+        a = b = c = 0;
+        d = 0;
+        e = false;
+        f = 0;
+        g = 0.0f;
+        memset( bytes, 0, sizeof( bytes ) );
+        memset( items, 0, sizeof( items ) );
+        memset( deltas, 0, sizeof( deltas ) );
+    }
+
+    void Init( core::RandomGenerator & random )
+    {
+        a = 7;
+        b = -3;
+        c = 12345;
+        d = 0xDEADBEEF;
+        e = true;
+        f = 0x0123456789ABCDEFULL;
+        g = 3.1415926f;
+        for ( int i = 0; i < 5; ++i )
+            bytes[i] = uint8_t( i * 31 );
+
+        // skewed distributions, like positions and small deltas in a snapshot
+
+        for ( int i = 0; i < NumEntropyItems; ++i )
+        {
+            items[i] = random.GetUint32( 4 ) == 0 ? random.GetInt( 0, 1023 ) : random.GetInt( 0, 3 );
+            deltas[i] = random.GetInt( -4, +4 );
+        }
+    }
+
+    PROTOCOL_SERIALIZE_OBJECT( stream )
+    {
+        serialize_int( stream, a, 0, 10 );
+        serialize_int( stream, b, -5, +5 );
+        serialize_int( stream, c, -100, 100000 );
+        serialize_bits( stream, d, 32 );
+        serialize_bool( stream, e );
+        serialize_uint64( stream, f );
+        serialize_float( stream, g );
+        serialize_check( stream, 0x12345678 );
+        serialize_bytes( stream, bytes, 5 );
+        for ( int i = 0; i < NumEntropyItems; ++i )
+        {
+            serialize_int( stream, items[i], 0, 1023 );
+            serialize_int( stream, deltas[i], -256, +255 );
+        }
+        serialize_check( stream, 0x87654321 );
+    }
+};
+
+void test_entropy_stream()
+{
+    printf( "test_entropy_stream\n" );
+
+    const int BufferSize = 1024;
+
+    uint8_t buffer[BufferSize];
+    memset( buffer, 0, sizeof( buffer ) );
+
+    core::RandomGenerator random;
+
+    EntropyTestObject writeObject;
+    writeObject.Init( random );
+
+    int entropyBytes = 0;
+    {
+        protocol::EntropyWriteStream writeStream( buffer, BufferSize );
+        writeObject.Serialize( writeStream );
+        writeStream.Flush();
+        CORE_CHECK( !writeStream.IsOverflow() );
+        entropyBytes = writeStream.GetBytesProcessed();
+    }
+
+    EntropyTestObject readObject;
+    {
+        protocol::EntropyReadStream readStream( buffer, entropyBytes );
+        readObject.Serialize( readStream );
+        CORE_CHECK( !readStream.IsOverflow() );
+        CORE_CHECK( readStream.GetBytesRead() == entropyBytes );
+    }
+
+    CORE_CHECK( readObject.a == writeObject.a );
+    CORE_CHECK( readObject.b == writeObject.b );
+    CORE_CHECK( readObject.c == writeObject.c );
+    CORE_CHECK( readObject.d == writeObject.d );
+    CORE_CHECK( readObject.e == writeObject.e );
+    CORE_CHECK( readObject.f == writeObject.f );
+    CORE_CHECK( readObject.g == writeObject.g );
+    CORE_CHECK( memcmp( readObject.bytes, writeObject.bytes, sizeof( readObject.bytes ) ) == 0 );
+    for ( int i = 0; i < NumEntropyItems; ++i )
+    {
+        CORE_CHECK( readObject.items[i] == writeObject.items[i] );
+        CORE_CHECK( readObject.deltas[i] == writeObject.deltas[i] );
+    }
+
+    // the range coded stream should beat the bitpacked one on skewed data
+
+    uint8_t bitpackedBuffer[BufferSize];
+    protocol::WriteStream bitpackedStream( bitpackedBuffer, BufferSize );
+    writeObject.SerializeWrite( bitpackedStream );
+    bitpackedStream.Flush();
+    CORE_CHECK( entropyBytes < bitpackedStream.GetBytesProcessed() );
+}
+
+void test_entropy_stream_overflow()
+{
+    printf( "test_entropy_stream_overflow\n" );
+
+    const int BufferSize = 1024;
+
+    uint8_t buffer[BufferSize];
+
+    core::RandomGenerator random;
+
+    EntropyTestObject writeObject;
+    writeObject.Init( random );
+
+    // writing into a buffer that is too small must flag overflow and not write past the end
+
+    {
+        const int SmallSize = 8;
+        memset( buffer, 0xCD, sizeof( buffer ) );
+        protocol::EntropyWriteStream writeStream( buffer, SmallSize );
+        writeObject.Serialize( writeStream );
+        writeStream.Flush();
+        CORE_CHECK( writeStream.IsOverflow() );
+        for ( int i = SmallSize; i < BufferSize; ++i )
+            CORE_CHECK( buffer[i] == 0xCD );
+    }
+
+    // reading a truncated packet must flag overflow
+
+    int entropyBytes = 0;
+    {
+        protocol::EntropyWriteStream writeStream( buffer, BufferSize );
+        writeObject.Serialize( writeStream );
+        writeStream.Flush();
+        entropyBytes = writeStream.GetBytesProcessed();
+    }
+
+    {
+        protocol::EntropyReadStream readStream( buffer, entropyBytes / 2 );
+        for ( int i = 0; i < NumEntropyItems * 4; ++i )
+        {
+            int32_t value;
+            readStream.SerializeInteger( value, 0, 1023 );
+        }
+        CORE_CHECK( readStream.IsOverflow() );
+    }
+}
@@ -0,0 +1,126 @@
+#include "protocol/Huffman.h"
+#include "protocol/Stream.h"
+#include "core/Random.h"
+#include <stdio.h>
+#include <string.h>
+
+void test_huffman()
+{
+    printf( "test_huffman\n" );
+
+    const int NumSymbols = 1024;
+
+    // geometric-ish histogram, like the delta_*.txt files dumped by DeltaDemo
+
+    uint64_t counts[NumSymbols];
+    for ( int i = 0; i < NumSymbols; ++i )
+        counts[i] = i < 40 ? ( 1ULL << ( 40 - i ) ) : 0;
+
+    uint8_t lengths[NumSymbols];
+    uint16_t codes[NumSymbols];
+    uint16_t symbols[NumSymbols];
+
+    CORE_CHECK( protocol::huffman_build_lengths( counts, NumSymbols, protocol::HuffmanMaxCodeLength, lengths ) );
+
+    protocol::HuffmanTable table;
+    protocol::huffman_build_table( table, NumSymbols, lengths, codes, symbols );
+
+    // every symbol must have a code within the length limit, and the code must be complete
+
+    uint64_t kraft = 0;
+    for ( int i = 0; i < NumSymbols; ++i )
+    {
+        CORE_CHECK( lengths[i] > 0 );
+        CORE_CHECK( lengths[i] <= protocol::HuffmanMaxCodeLength );
+        kraft += 1ULL << ( protocol::HuffmanMaxCodeLength - lengths[i] );
+    }
+    CORE_CHECK( kraft == 1ULL << protocol::HuffmanMaxCodeLength );
+
+    // more frequent symbols never get longer codes
+
+    for ( int i = 1; i < 40; ++i )
+        CORE_CHECK( lengths[i-1] <= lengths[i] );
+
+    // round trip a bunch of symbols drawn from the distribution plus some unseen ones
+
+    const int NumValues = 512;
+    int values[NumValues];
+    core::RandomGenerator random;
+    for ( int i = 0; i < NumValues; ++i )
+    {
+        int symbol = 0;
+        while ( symbol < 39 && random.GetUint32( 2 ) )
+            symbol++;
+        values[i] = ( i % 64 ) == 0 ? random.GetInt( 0, NumSymbols - 1 ) : symbol;
+    }
+
+    const int BufferSize = 4096;
+    uint8_t buffer[BufferSize];
+    memset( buffer, 0, sizeof( buffer ) );
+
+    int bitsWritten = 0;
+    {
+        protocol::WriteStream stream( buffer, BufferSize );
+        for ( int i = 0; i < NumValues; ++i )
+            serialize_huffman( stream, values[i], table );
+        stream.Flush();
+        CORE_CHECK( !stream.IsOverflow() );
+        bitsWritten = stream.GetBitsProcessed();
+    }
+
+    {
+        protocol::MeasureStream stream( BufferSize );
+        for ( int i = 0; i < NumValues; ++i )
+            serialize_huffman( stream, values[i], table );
+        CORE_CHECK( stream.GetBitsProcessed() == bitsWritten );
+    }
+
+    uint64_t expectedBits = 0;
+    for ( int i = 0; i < NumValues; ++i )
+        expectedBits += lengths[values[i]];
+    CORE_CHECK( expectedBits == uint64_t( bitsWritten ) );
+    CORE_CHECK( bitsWritten < NumValues * 10 );
+
+    {
+        protocol::ReadStream stream( buffer, BufferSize );
+        for ( int i = 0; i < NumValues; ++i )
+        {
+            int value = -1;
+            serialize_huffman( stream, value, table );
+            CORE_CHECK( value == values[i] );
+        }
+        CORE_CHECK( !stream.Aborted() );
+    }
+}
+
+void test_huffman_length_limit()
+{
+    printf( "test_huffman_length_limit\n" );
+
+    // fibonacci counts produce the deepest possible tree, so they must be flattened to fit the limit
+
+    const int NumSymbols = 64;
+
+    uint64_t counts[NumSymbols];
+    counts[0] = 1;
+    counts[1] = 1;
+    for ( int i = 2; i < NumSymbols; ++i )
+        counts[i] = counts[i-1] + counts[i-2];
+
+    uint8_t lengths[NumSymbols];
+    const int MaxLength = 8;
+    CORE_CHECK( protocol::huffman_build_lengths( counts, NumSymbols, MaxLength, lengths ) );
+
+    uint64_t kraft = 0;
+    for ( int i = 0; i < NumSymbols; ++i )
+    {
+        CORE_CHECK( lengths[i] > 0 );
+        CORE_CHECK( lengths[i] <= MaxLength );
+        kraft += 1ULL << ( MaxLength - lengths[i] );
+    }
+    CORE_CHECK( kraft == 1ULL << MaxLength );
+
+    // impossible limits are rejected
+
+    CORE_CHECK( !protocol::huffman_build_lengths( counts, NumSymbols, 5, lengths ) );
+}
@@ -6,8 +6,13 @@
 extern void test_message_factory();
 extern void test_packet_factory();
 extern void test_bitpacker();
+extern void test_bitpacker_rollback();
 extern void test_stream();
 extern void test_stream_context();
+extern void test_entropy_stream();
+extern void test_entropy_stream_overflow();
+extern void test_huffman();
+extern void test_huffman_length_limit();
 extern void test_bit_array();
 extern void test_sliding_window();
 extern void test_sequence_buffer();
@@ -58,8 +63,13 @@ int main()
     test_message_factory();
     test_packet_factory();
     test_bitpacker();
+    test_bitpacker_rollback();
     test_stream();
     test_stream_context();
+    test_entropy_stream();
+    test_entropy_stream_overflow();
+    test_huffman();
+    test_huffman_length_limit();
     test_bit_array();
     test_sliding_window();
     test_sequence_buffer();
@@ -0,0 +1,215 @@
+/*
+    Entropy tool.
+
+    Builds static huffman tables from the delta histograms that DeltaDemo dumps to output/ 
+    when DELTA_STATS is enabled, and writes them out as a header of constant code tables.
+
+    Usage: EntropyTool <output header> <name> <histogram file> <column suffixes> [<name> <histogram file> <column suffixes> ...]
+
+    Each line of a histogram file is the count for one value, with one comma separated column
+    per component, eg. "scripts/delta_position.txt" has columns for x, y and z.
+
+    The tables in src/game/DeltaTables.h were generated with:
+
+        ./bin/EntropyTool src/game/DeltaTables.h delta_position scripts/delta_position.txt xyz delta_smallest_three scripts/delta_smallest_three.txt abc
+*/
+
+#include "core/Core.h"
+#include "protocol/Huffman.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxColumns = 4;
+const int MaxSymbols = 1024;
+
+struct Histogram
+{
+    int numColumns;
+    int numSymbols;
+    uint64_t counts[MaxColumns][MaxSymbols];
+};
+
+bool LoadHistogram( const char * filename, Histogram & histogram )
+{
+    FILE * file = fopen( filename, "r" );
+    if ( !file )
+    {
+        printf( "error: could not open histogram file \"%s\"\n", filename );
+        return false;
+    }
+
+    memset( &histogram, 0, sizeof( histogram ) );
+
+    char line[1024];
+    while ( fgets( line, sizeof( line ), file ) )
+    {
+        if ( histogram.numSymbols == MaxSymbols )
+        {
+            printf( "error: histogram \"%s\" has more than %d values\n", filename, MaxSymbols );
+            fclose( file );
+            return false;
+        }
+
+        int column = 0;
+        char * p = line;
+        while ( *p && *p != '\n' && *p != '\r' )
+        {
+            if ( column == MaxColumns )
+            {
+                printf( "error: histogram \"%s\" has more than %d columns\n", filename, MaxColumns );
+                fclose( file );
+                return false;
+            }
+            char * end = nullptr;
+            histogram.counts[column][histogram.numSymbols] = strtoull( p, &end, 10 );
+            if ( end == p )
+                break;
+            column++;
+            p = ( *end == ',' ) ? end + 1 : end;
+        }
+
+        if ( column == 0 )
+            continue;
+
+        if ( histogram.numColumns == 0 )
+            histogram.numColumns = column;
+
+        if ( column != histogram.numColumns )
+        {
+            printf( "error: histogram \"%s\" line %d has %d columns, expected %d\n", filename, histogram.numSymbols + 1, column, histogram.numColumns );
+            fclose( file );
+            return false;
+        }
+
+        histogram.numSymbols++;
+    }
+
+    fclose( file );
+
+    if ( histogram.numSymbols < 2 )
+    {
+        printf( "error: histogram \"%s\" is empty\n", filename );
+        return false;
+    }
+
+    return true;
+}
+
+template <typename T> void WriteArray( FILE * file, const char * type, const char * name, const char * suffix, const T * values, int count )
+{
+    fprintf( file, "static const %s %s_%s[%d] =\n{", type, name, suffix, count );
+    for ( int i = 0; i < count; ++i )
+    {
+        if ( ( i % 16 ) == 0 )
+            fprintf( file, "\n    " );
+        fprintf( file, "%d,", (int) values[i] );
+    }
+    fprintf( file, "\n};\n\n" );
+}
+
+void WriteTable( FILE * file, const char * name, const protocol::HuffmanTable & table )
+{
+    WriteArray( file, "uint8_t", name, "lengths", table.lengths, table.numSymbols );
+    WriteArray( file, "uint16_t", name, "codes", table.codes, table.numSymbols );
+    WriteArray( file, "uint16_t", name, "symbols", table.symbols, table.numSymbols );
+
+    fprintf( file, "static const protocol::HuffmanTable %s_table =\n{\n", name );
+    fprintf( file, "    %d,\n", table.numSymbols );
+    fprintf( file, "    %s_lengths,\n", name );
+    fprintf( file, "    %s_codes,\n", name );
+    fprintf( file, "    %s_symbols,\n", name );
+
+    const uint16_t * arrays[] = { table.firstCode, table.firstIndex, table.lengthCount };
+    for ( int i = 0; i < 3; ++i )
+    {
+        fprintf( file, "    {" );
+        for ( int j = 0; j <= protocol::HuffmanMaxCodeLength; ++j )
+            fprintf( file, " %d%s", arrays[i][j], j < protocol::HuffmanMaxCodeLength ? "," : " " );
+        fprintf( file, "}%s\n", i < 2 ? "," : "" );
+    }
+
+    fprintf( file, "};\n\n" );
+}
+
+int main( int argc, char * argv[] )
+{
+    if ( argc < 5 || ( ( argc - 2 ) % 3 ) != 0 )
+    {
+        printf( "usage: EntropyTool <output header> <name> <histogram file> <column suffixes> [...]\n" );
+        return 1;
+    }
+
+    const char * outputFilename = argv[1];
+
+    FILE * file = fopen( outputFilename, "w" );
+    if ( !file )
+    {
+        printf( "error: could not open \"%s\" for writing\n", outputFilename );
+        return 1;
+    }
+
+    fprintf( file, "// generated by tools/Entropy/EntropyTool.cpp. do not edit!\n\n" );
+    fprintf( file, "#ifndef GAME_DELTA_TABLES_H\n#define GAME_DELTA_TABLES_H\n\n" );
+    fprintf( file, "#include \"protocol/Huffman.h\"\n\n" );
+
+    static Histogram histogram;
+    static uint8_t lengths[MaxSymbols];
+    static uint16_t codes[MaxSymbols];
+    static uint16_t symbols[MaxSymbols];
+
+    for ( int arg = 2; arg < argc; arg += 3 )
+    {
+        const char * name = argv[arg];
+        const char * histogramFilename = argv[arg+1];
+        const char * suffixes = argv[arg+2];
+
+        if ( !LoadHistogram( histogramFilename, histogram ) )
+        {
+            fclose( file );
+            return 1;
+        }
+
+        if ( (int) strlen( suffixes ) != histogram.numColumns )
+        {
+            printf( "error: \"%s\" has %d columns but %d suffixes were given\n", histogramFilename, histogram.numColumns, (int) strlen( suffixes ) );
+            fclose( file );
+            return 1;
+        }
+
+        fprintf( file, "const int %s_symbols = %d;\n\n", name, histogram.numSymbols );
+
+        for ( int column = 0; column < histogram.numColumns; ++column )
+        {
+            char tableName[256];
+            snprintf( tableName, sizeof( tableName ), "%s_%c", name, suffixes[column] );
+
+            if ( !protocol::huffman_build_lengths( histogram.counts[column], histogram.numSymbols, protocol::HuffmanMaxCodeLength, lengths ) )
+            {
+                printf( "error: could not build code lengths for %s\n", tableName );
+                fclose( file );
+                return 1;
+            }
+
+            protocol::HuffmanTable table;
+            protocol::huffman_build_table( table, histogram.numSymbols, lengths, codes, symbols );
+
+            uint64_t total = 0;
+            for ( int i = 0; i < histogram.numSymbols; ++i )
+                total += histogram.counts[column][i];
+
+            const uint64_t bits = protocol::huffman_encoded_bits( table, histogram.counts[column] );
+            const int fixedBits = core::bits_required( 0, histogram.numSymbols - 1 );
+
+            printf( "%s: %.2f bits per value (fixed %d)\n", tableName, total ? bits / double( total ) : 0.0, fixedBits );
+
+            WriteTable( file, tableName, table );
+        }
+    }
+
+    fprintf( file, "#endif // #ifndef GAME_DELTA_TABLES_H\n" );
+
+    fclose( file );
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+    Packet dictionary tool.
+
+    Trains static packet compression dictionaries from the packet samples that CompressionDemo
+    and DeltaDemo dump to output/ when PACKET_SAMPLES is enabled, and writes them out as a
+    header of constant byte arrays.
+
+    Usage: PacketDictionaryTool <output header> <dictionary bytes> <name> <sample file> [<name> <sample file> ...]
+
+    A sample file is a sequence of packets, each a 32 bit little endian size followed by the
+    serialized packet bytes, exactly as they are handed to the packet compressor.
+
+    The dictionaries in src/game/PacketDictionary.h were generated with:
+
+        ./bin/PacketDictionaryTool src/game/PacketDictionary.h 16384 compression_dictionary output/compression_packets.bin delta_dictionary output/delta_packets.bin
+*/
+
+#include "core/Core.h"
+#include "core/Memory.h"
+#include "network/Compressor.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const int MaxSamples = 64 * 1024;
+const int MaxSampleBytes = 64 * 1024;
+const int MaxTrainingBytes = 1024 * 1024;           // training cost grows with the sample bytes, so larger sample sets are strided down to this
+
+struct Samples
+{
+    int numSamples;
+    int totalBytes;
+    uint8_t * data;
+    const uint8_t * samples[MaxSamples];
+    int sampleBytes[MaxSamples];
+};
+
+bool LoadSamples( const char * filename, Samples & samples )
+{
+    FILE * file = fopen( filename, "rb" );
+    if ( !file )
+    {
+        printf( "error: could not open sample file \"%s\"\n", filename );
+        return false;
+    }
+
+    fseek( file, 0, SEEK_END );
+    const long fileBytes = ftell( file );
+    fseek( file, 0, SEEK_SET );
+
+    samples.numSamples = 0;
+    samples.totalBytes = 0;
+    samples.data = (uint8_t*) malloc( fileBytes + 1 );
+
+    if ( fread( samples.data, 1, fileBytes, file ) != (size_t) fileBytes )
+    {
+        printf( "error: could not read sample file \"%s\"\n", filename );
+        fclose( file );
+        return false;
+    }
+
+    fclose( file );
+
+    long offset = 0;
+    while ( offset < fileBytes )
+    {
+        if ( samples.numSamples == MaxSamples )
+        {
+            printf( "error: sample file \"%s\" has more than %d packets\n", filename, MaxSamples );
+            return false;
+        }
+
+        if ( offset + 4 > fileBytes )
+        {
+            printf( "error: sample file \"%s\" is truncated\n", filename );
+            return false;
+        }
+
+        const uint8_t * p = samples.data + offset;
+        const int bytes = p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( p[3] << 24 );
+        offset += 4;
+
+        if ( bytes <= 0 || bytes > MaxSampleBytes || offset + bytes > fileBytes )
+        {
+            printf( "error: sample file \"%s\" has a bad packet size %d at offset %ld\n", filename, bytes, offset - 4 );
+            return false;
+        }
+
+        samples.samples[samples.numSamples] = samples.data + offset;
+        samples.sampleBytes[samples.numSamples] = bytes;
+        samples.numSamples++;
+        samples.totalBytes += bytes;
+        offset += bytes;
+    }
+
+    if ( samples.numSamples == 0 )
+    {
+        printf( "error: sample file \"%s\" is empty\n", filename );
+        return false;
+    }
+
+    return true;
+}
+
+void MeasureCompression( const char * name, const Samples & samples, const uint8_t * dictionary, int dictionaryBytes )
+{
+    network::PacketCompressorConfig config;
+    config.dictionary = dictionary;
+    config.dictionarySize = dictionaryBytes;
+    config.maxPacketSize = MaxSampleBytes;
+
+    network::PacketCompressor compressor( config );
+
+    static uint8_t encoded[MaxSampleBytes+1];
+    static uint8_t decoded[MaxSampleBytes];
+
+    for ( int i = 0; i < samples.numSamples; ++i )
+    {
+        const int encodedBytes = compressor.EncodePacket( samples.samples[i], samples.sampleBytes[i], encoded, sizeof( encoded ) );
+        const int decodedBytes = compressor.DecodePacket( encoded, encodedBytes, decoded, sizeof( decoded ) );
+        if ( decodedBytes != samples.sampleBytes[i] || memcmp( decoded, samples.samples[i], decodedBytes ) != 0 )
+        {
+            printf( "error: %s packet %d did not survive compression\n", name, i );
+            exit( 1 );
+        }
+    }
+
+    const uint64_t packets = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_PACKETS_ENCODED );
+    const uint64_t bytesBefore = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_BEFORE_ENCODE );
+    const uint64_t bytesAfter = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_BYTES_AFTER_ENCODE );
+    const uint64_t encodeNanoseconds = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_ENCODE_NANOSECONDS );
+    const uint64_t decodeNanoseconds = compressor.GetCounter( network::PACKET_COMPRESSOR_COUNTER_DECODE_NANOSECONDS );
+
+    printf( "%s: %d byte dictionary, %.1f -> %.1f bytes per packet (%.1f%%), encode %.1fus, decode %.1fus\n",
+        name, dictionaryBytes, bytesBefore / double( packets ), bytesAfter / double( packets ),
+        100.0 * bytesAfter / double( bytesBefore ), encodeNanoseconds / 1000.0 / packets, decodeNanoseconds / 1000.0 / packets );
+}
+
+void WriteDictionary( FILE * file, const char * name, const uint8_t * dictionary, int dictionaryBytes )
+{
+    fprintf( file, "static const uint8_t %s[%d] =\n{", name, dictionaryBytes );
+    for ( int i = 0; i < dictionaryBytes; ++i )
+    {
+        if ( ( i % 32 ) == 0 )
+            fprintf( file, "\n    " );
+        fprintf( file, "%d,", dictionary[i] );
+    }
+    fprintf( file, "\n};\n\n" );
+}
+
+int main( int argc, char * argv[] )
+{
+    if ( argc < 5 || ( ( argc - 3 ) % 2 ) != 0 )
+    {
+        printf( "usage: PacketDictionaryTool <output header> <dictionary bytes> <name> <sample file> [...]\n" );
+        return 1;
+    }
+
+    const char * outputFilename = argv[1];
+
+    const int maxDictionaryBytes = atoi( argv[2] );
+    if ( maxDictionaryBytes <= 0 || maxDictionaryBytes > 64 * 1024 )
+    {
+        printf( "error: dictionary bytes must be in [1,65536]\n" );
+        return 1;
+    }
+
+    core::memory::initialize();
+
+    FILE * file = fopen( outputFilename, "w" );
+    if ( !file )
+    {
+        printf( "error: could not open \"%s\" for writing\n", outputFilename );
+        return 1;
+    }
+
+    fprintf( file, "// generated by tools/PacketDictionary/PacketDictionaryTool.cpp. do not edit!\n\n" );
+    fprintf( file, "#ifndef GAME_PACKET_DICTIONARY_H\n#define GAME_PACKET_DICTIONARY_H\n\n" );
+    fprintf( file, "#include <stdint.h>\n\n" );
+
+    static Samples samples;
+    static Samples training;
+
+    uint8_t * dictionary = (uint8_t*) malloc( maxDictionaryBytes );
+
+    for ( int arg = 3; arg < argc; arg += 2 )
+    {
+        const char * name = argv[arg];
+        const char * samplesFilename = argv[arg+1];
+
+        if ( !LoadSamples( samplesFilename, samples ) )
+        {
+            fclose( file );
+            return 1;
+        }
+
+        // train on an even spread of the samples so every part of the run is represented
+
+        const int stride = samples.totalBytes / MaxTrainingBytes + 1;
+
+        training.numSamples = 0;
+        training.totalBytes = 0;
+        for ( int i = 0; i < samples.numSamples; i += stride )
+        {
+            training.samples[training.numSamples] = samples.samples[i];
+            training.sampleBytes[training.numSamples] = samples.sampleBytes[i];
+            training.numSamples++;
+            training.totalBytes += samples.sampleBytes[i];
+        }
+
+        printf( "%s: training on %d of %d packets (%d bytes)\n", name, training.numSamples, samples.numSamples, training.totalBytes );
+
+        const int dictionaryBytes = network::TrainPacketDictionary( training.samples, training.sampleBytes, training.numSamples, dictionary, maxDictionaryBytes );
+
+        if ( dictionaryBytes == 0 )
+        {
+            printf( "error: samples in \"%s\" are too small to train a dictionary\n", samplesFilename );
+            fclose( file );
+            return 1;
+        }
+
+        MeasureCompression( name, samples, nullptr, 0 );
+        MeasureCompression( name, samples, dictionary, dictionaryBytes );
+
+        WriteDictionary( file, name, dictionary, dictionaryBytes );
+
+        free( samples.data );
+    }
+
+    fprintf( file, "#endif // #ifndef GAME_PACKET_DICTIONARY_H\n" );
+
+    fclose( file );
+
+    free( dictionary );
+
+    core::memory::shutdown();
+
+    return 0;
+}